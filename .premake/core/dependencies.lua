@@ -60,6 +60,11 @@ function linkGoogleTest()
     links { "gtest", "gmock" }
 end
 
+-- Link Google Benchmark
+function linkGoogleBenchmark()
+    links { "benchmark" }
+end
+
 -- Link profiler dependencies
 function linkOptick()
     filter { "configurations:Profile" }
@@ -13,9 +13,11 @@ layout(set = 0, binding = 0) uniform DrawParams {
   EntitiesArray spriteEntities;
 
   TransformsArray meshTransforms;
+  InstancesArray meshInstances;
   EntitiesArray meshEntities;
 
   TransformsArray skinnedMeshTransforms;
+  InstancesArray skinnedMeshInstances;
   EntitiesArray skinnedMeshEntities;
   SkeletonsArray skeletons;
 
@@ -8,7 +8,8 @@ layout(location = 0) out uint outEntity;
 #include "mouse-picking-base.glsl"
 
 void main() {
-  mat4 modelMatrix = getMeshTransform(gl_InstanceIndex).modelMatrix;
+  mat4 modelMatrix =
+      getMeshTransform(getMeshInstance(gl_InstanceIndex)).modelMatrix;
 
   vec4 worldPosition =
       getCamera().viewProj * modelMatrix * vec4(inPosition, 1.0f);
@@ -13,9 +13,10 @@ const vec2 positions[4] =
     vec2[](vec2(-1, -1), vec2(+1, -1), vec2(-1, +1), vec2(+1, +1));
 
 void main() {
-  mat4 modelMatrix = getSkinnedMeshTransform(gl_InstanceIndex).modelMatrix;
+  uint instance = getSkinnedMeshInstance(gl_InstanceIndex);
+  mat4 modelMatrix = getSkinnedMeshTransform(instance).modelMatrix;
 
-  SkeletonItem item = getSkeleton(gl_InstanceIndex);
+  SkeletonItem item = getSkeleton(instance);
 
   mat4 skinMatrix = inWeights.x * item.joints[inJoints.x] +
                     inWeights.y * item.joints[inJoints.y] +
@@ -567,25 +567,25 @@ void EditorRenderer::updateFrameData(EntityDatabase &entityDatabase,
   frameData.setEditorGrid(state.grid);
 
   for (auto [entity, worldTransform, skeleton] :
-       entityDatabase.view<WorldTransform, SkeletonDebug>()) {
+       entityDatabase.view<const WorldTransform, const SkeletonDebug>()) {
     frameData.addSkeleton(worldTransform.worldTransform,
                           skeleton.boneTransforms);
   }
 
   for (auto [entity, world, light] :
-       entityDatabase.view<WorldTransform, DirectionalLight>()) {
+       entityDatabase.view<const WorldTransform, const DirectionalLight>()) {
     frameData.addGizmo(IconRegistry::getIcon(EditorIcon::Sun),
                        world.worldTransform);
   }
 
   for (auto [entity, world, light] :
-       entityDatabase.view<WorldTransform, PointLight>()) {
+       entityDatabase.view<const WorldTransform, const PointLight>()) {
     frameData.addGizmo(IconRegistry::getIcon(EditorIcon::Light),
                        world.worldTransform);
   }
 
   for (auto [entity, world, camera] :
-       entityDatabase.view<WorldTransform, PerspectiveLens>()) {
+       entityDatabase.view<const WorldTransform, const PerspectiveLens>()) {
     static constexpr f32 NinetyDegreesInRadians = glm::pi<f32>() / 2.0f;
 
     frameData.addGizmo(IconRegistry::getIcon(EditorIcon::Camera),
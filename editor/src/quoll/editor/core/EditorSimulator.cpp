@@ -1,4 +1,6 @@
 #include "quoll/core/Base.h"
+#include "quoll/physx/PhysxBackendDesc.h"
+
 #include "EditorSimulator.h"
 
 namespace quoll::editor {
@@ -6,11 +8,13 @@ namespace quoll::editor {
 EditorSimulator::EditorSimulator(InputDeviceManager &deviceManager,
                                  EventSystem &eventSystem, Window &window,
                                  AssetRegistry &assetRegistry,
-                                 EditorCamera &editorCamera)
+                                 EditorCamera &editorCamera,
+                                 const PhysxBackendDesc &physicsDesc)
     : mInputMapSystem(deviceManager, assetRegistry),
       mScriptingSystem(eventSystem, assetRegistry),
       mAnimationSystem(assetRegistry),
-      mPhysicsSystem(PhysicsSystem::createPhysxBackend(eventSystem)),
+      mPhysicsSystem(
+          PhysicsSystem::createPhysxBackend(eventSystem, physicsDesc)),
       mEditorCamera(editorCamera), mAudioSystem(assetRegistry) {}
 
 void EditorSimulator::update(f32 dt, WorkspaceState &state) {
@@ -51,6 +55,7 @@ void EditorSimulator::observeChanges(EntityDatabase &simulationDatabase) {
 
 void EditorSimulator::updateEditor(f32 dt, WorkspaceState &state) {
   auto &entityDatabase = state.scene.entityDatabase;
+  mSceneUpdater.storePreviousTransforms(entityDatabase);
   mEntityDeleter.update(state.scene);
 
   mCameraAspectRatioUpdater.update(entityDatabase);
@@ -62,12 +67,13 @@ void EditorSimulator::updateEditor(f32 dt, WorkspaceState &state) {
 
 void EditorSimulator::updateSimulation(f32 dt, WorkspaceState &state) {
   auto &entityDatabase = state.simulationScene.entityDatabase;
+  mSceneUpdater.storePreviousTransforms(entityDatabase);
   mEntityDeleter.update(state.simulationScene);
 
+  mPhysicsSystem.beginUpdate(dt, entityDatabase);
   mInputMapSystem.update(entityDatabase);
-
   mCameraAspectRatioUpdater.update(entityDatabase);
-  mPhysicsSystem.update(dt, entityDatabase);
+  mPhysicsSystem.endUpdate(entityDatabase);
 
   mScriptingSystem.start(entityDatabase, mPhysicsSystem);
   mScriptingSystem.update(dt, entityDatabase);
@@ -34,10 +34,12 @@ public:
    * @param window Window
    * @param assetRegistry Asset registry
    * @param editorCamera Editor camera
+   * @param physicsDesc Physics options
    */
   EditorSimulator(InputDeviceManager &deviceManager, EventSystem &eventSystem,
                   Window &window, AssetRegistry &assetRegistry,
-                  EditorCamera &editorCamera);
+                  EditorCamera &editorCamera,
+                  const PhysxBackendDesc &physicsDesc);
 
   /**
    * @brief Main update function
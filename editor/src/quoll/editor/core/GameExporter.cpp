@@ -1,6 +1,8 @@
 #include "quoll/core/Base.h"
 #include "quoll/core/Engine.h"
 #include "quoll/yaml/Yaml.h"
+#include "quoll/physx/PhysxBackendDescSerializer.h"
+#include "quoll/renderer/DynamicResolutionSettingsSerializer.h"
 
 #include "GameExporter.h"
 
@@ -46,6 +48,9 @@ void GameExporter::exportGame(const Project &project, const Path &destination) {
   YAML::Node node;
   node["name"] = gameName.string();
   node["startingScene"] = project.startingScene;
+  node["physics"] = PhysxBackendDescSerializer::serialize(project.physics);
+  node["dynamicResolution"] =
+      DynamicResolutionSettingsSerializer::serialize(project.dynamicResolution);
 
   std::ofstream stream(destination / "launch.yml", std::ios::out);
   stream << node;
@@ -103,37 +103,23 @@ void MousePickingGraph::execute(rhi::RenderCommandList &commandList,
                              frameData.getTextEntities().size() *
                                  sizeof(Entity));
 
-  {
-    usize offset = 0;
-    auto *bufferData = static_cast<Entity *>(mMeshEntitiesBuffer.map());
-    for (auto &[_, meshData] : frameData.getMeshGroups()) {
-      memcpy(bufferData + offset, meshData.entities.data(),
-             sizeof(Entity) * meshData.entities.size());
-      offset += meshData.entities.size();
-    }
-    mMeshEntitiesBuffer.unmap();
-  }
-
-  {
-    usize offset = 0;
-    auto *bufferData = static_cast<Entity *>(mSkinnedMeshEntitiesBuffer.map());
-    for (auto &[_, meshData] : frameData.getSkinnedMeshGroups()) {
-      memcpy(bufferData + offset, meshData.entities.data(),
-             sizeof(Entity) * meshData.entities.size());
-      offset += meshData.entities.size();
-    }
-    mSkinnedMeshEntitiesBuffer.unmap();
-  }
+  mMeshEntitiesBuffer.update(frameData.getMeshEntities().data(),
+                             frameData.getMeshEntities().size() *
+                                 sizeof(Entity));
+  mSkinnedMeshEntitiesBuffer.update(frameData.getSkinnedMeshEntities().data(),
+                                    frameData.getSkinnedMeshEntities().size() *
+                                        sizeof(Entity));
 
   mMousePos = mousePos;
 
   if (mResized) {
-    mRenderGraph.destroy(mRenderStorage);
+    mRenderGraph.destroy(mRenderStorage, true);
     mRenderGraph = RenderGraph("Mouse picking");
 
     createRenderGraph();
 
     mRenderGraph.build(mRenderStorage);
+    mRenderStorage.destroyRetainedPipelines();
 
     mResized = false;
   }
@@ -250,9 +236,11 @@ void MousePickingGraph::createRenderGraph() {
     rhi::DeviceAddress spriteEntities;
 
     rhi::DeviceAddress meshTransforms;
+    rhi::DeviceAddress meshInstances;
     rhi::DeviceAddress meshEntities;
 
     rhi::DeviceAddress skinnedMeshTransforms;
+    rhi::DeviceAddress skinnedMeshInstances;
     rhi::DeviceAddress skinnedMeshEntities;
     rhi::DeviceAddress skeletons;
 
@@ -270,9 +258,11 @@ void MousePickingGraph::createRenderGraph() {
         frameData.getSpriteTransformsBuffer(),
         mSpriteEntitiesBuffer.getAddress(),
 
-        frameData.getMeshTransformsBuffer(), mMeshEntitiesBuffer.getAddress(),
+        frameData.getMeshTransformsBuffer(), frameData.getMeshInstancesBuffer(),
+        mMeshEntitiesBuffer.getAddress(),
 
         frameData.getSkinnedMeshTransformsBuffer(),
+        frameData.getSkinnedMeshInstancesBuffer(),
         mSkinnedMeshEntitiesBuffer.getAddress(), frameData.getSkeletonsBuffer(),
 
         frameData.getTextTransformsBuffer(), mTextEntitiesBuffer.getAddress(),
@@ -307,11 +297,9 @@ void MousePickingGraph::createRenderGraph() {
                                  mBindlessParams.at(frameIndex).getDescriptor(),
                                  offsets);
 
-      u32 instanceStart = 0;
-      for (auto &[handle, meshData] : frameData.getMeshGroups()) {
-        const auto &mesh = mAssetRegistry.getMeshes().getAsset(handle).data;
-
-        u32 numInstances = static_cast<u32>(meshData.transforms.size());
+      for (const auto &batch : frameData.getMeshBatches()) {
+        const auto &mesh =
+            mAssetRegistry.getMeshes().getAsset(batch.mesh).data;
 
         commandList.bindVertexBuffers(
             MeshRenderUtils::getGeometryBuffers(mesh),
@@ -325,11 +313,10 @@ void MousePickingGraph::createRenderGraph() {
           i32 vertexCount = static_cast<i32>(geometry.positions.size());
 
           commandList.drawIndexed(indexCount, indexOffset, vertexOffset,
-                                  numInstances, instanceStart);
+                                  batch.numInstances, batch.instanceStart);
           vertexOffset += vertexCount;
           indexOffset += indexCount;
         }
-        instanceStart += numInstances;
       }
     }
 
@@ -341,11 +328,9 @@ void MousePickingGraph::createRenderGraph() {
                                  mBindlessParams.at(frameIndex).getDescriptor(),
                                  offsets);
 
-      u32 instanceStart = 0;
-      for (auto &[handle, meshData] : frameData.getSkinnedMeshGroups()) {
-        const auto &mesh = mAssetRegistry.getMeshes().getAsset(handle).data;
-
-        u32 numInstances = static_cast<u32>(meshData.transforms.size());
+      for (const auto &batch : frameData.getSkinnedMeshBatches()) {
+        const auto &mesh =
+            mAssetRegistry.getMeshes().getAsset(batch.mesh).data;
 
         commandList.bindVertexBuffers(
             MeshRenderUtils::getSkinnedGeometryBuffers(mesh),
@@ -359,11 +344,10 @@ void MousePickingGraph::createRenderGraph() {
           i32 vertexCount = static_cast<i32>(geometry.positions.size());
 
           commandList.drawIndexed(indexCount, indexOffset, vertexOffset,
-                                  numInstances, instanceStart);
+                                  batch.numInstances, batch.instanceStart);
           vertexOffset += vertexCount;
           indexOffset += indexCount;
         }
-        instanceStart += numInstances;
       }
     }
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "quoll/physx/PhysxBackendDesc.h"
+#include "quoll/renderer/DynamicResolutionController.h"
+
 namespace quoll::editor {
 
 /**
@@ -35,6 +38,18 @@ struct Project {
    * Starting scene asset UUID
    */
   Uuid startingScene;
+
+  /**
+   * Physics options
+   */
+  PhysxBackendDesc physics;
+
+  /**
+   * Dynamic resolution settings of game
+   *
+   * Dynamic resolution is disabled if empty
+   */
+  std::optional<DynamicResolutionSettings> dynamicResolution;
 };
 
 } // namespace quoll::editor
@@ -1,5 +1,7 @@
 #include "quoll/core/Base.h"
 #include "quoll/yaml/Yaml.h"
+#include "quoll/physx/PhysxBackendDescSerializer.h"
+#include "quoll/renderer/DynamicResolutionSettingsSerializer.h"
 #include "quoll/platform/tools/FileDialog.h"
 
 #include "ProjectManager.h"
@@ -64,6 +66,11 @@ bool ProjectManager::createProjectInPath() {
             .string();
     projectObj["paths"]["settings"] =
         std::filesystem::relative(mProject.settingsPath, projectPath).string();
+    projectObj["physics"] =
+        PhysxBackendDescSerializer::serialize(mProject.physics);
+    projectObj["dynamicResolution"] =
+        DynamicResolutionSettingsSerializer::serialize(
+            mProject.dynamicResolution);
 
     auto projectFile = projectPath / (mProject.name + ".quoll");
 
@@ -110,6 +117,10 @@ bool ProjectManager::openProjectInPath() {
       directory / String(projectObj["paths"]["assetsCache"].as<String>());
   mProject.settingsPath =
       directory / String(projectObj["paths"]["settings"].as<String>());
+  mProject.physics =
+      PhysxBackendDescSerializer::deserialize(projectObj["physics"]);
+  mProject.dynamicResolution = DynamicResolutionSettingsSerializer::deserialize(
+      projectObj["dynamicResolution"]);
 
   return true;
 }
@@ -121,7 +121,8 @@ void EditorScreen::start(const Project &rawProject) {
   MainLoop mainLoop(mWindow, fpsCounter);
 
   ImguiDebugLayer debugLayer(mDevice->getDeviceInformation(),
-                             mDevice->getDeviceStats(), fpsCounter);
+                             mDevice->getDeviceStats(), fpsCounter,
+                             renderer.getGraph());
 
   IconRegistry::loadIcons(renderStorage,
                           std::filesystem::current_path() / "assets" / "icons");
@@ -186,7 +187,8 @@ void EditorScreen::start(const Project &rawProject) {
   ui.processShortcuts(context, mEventSystem);
 
   EditorSimulator simulator(mDeviceManager, mEventSystem, mWindow,
-                            assetManager.getAssetRegistry(), editorCamera);
+                            assetManager.getAssetRegistry(), editorCamera,
+                            project.physics);
 
   mWindow.maximize();
 
@@ -67,7 +67,8 @@ std::optional<Project> ProjectSelectorScreen::start() {
   });
 
   ImguiDebugLayer debugLayer(mDevice->getDeviceInformation(),
-                             mDevice->getDeviceStats(), fpsCounter);
+                             mDevice->getDeviceStats(), fpsCounter,
+                             renderer.getGraph());
 
   mainLoop.setRenderFn([&]() mutable {
     if (presenter.requiresFramebufferUpdate()) {
@@ -0,0 +1,74 @@
+/**
+ * @brief Mesh instance data for culling
+ */
+struct CullInstance {
+  /**
+   * World bounding sphere
+   */
+  vec4 boundingSphere;
+
+  /**
+   * Batch index
+   */
+  uvec4 batch;
+};
+
+Buffer(16) CullInstancesArray { CullInstance items[]; };
+
+/**
+ * @brief Mesh batch data for culling
+ */
+struct CullBatch {
+  /**
+   * First draw command
+   */
+  uint firstCommand;
+
+  /**
+   * Number of draw commands
+   */
+  uint numCommands;
+
+  /**
+   * First instance in visible instances
+   */
+  uint instanceStart;
+
+  /**
+   * Padding
+   */
+  uint padding;
+};
+
+Buffer(16) CullBatchesArray { CullBatch items[]; };
+
+/**
+ * @brief Indexed draw command
+ */
+struct IndexedDrawCommand {
+  uint indexCount;
+  uint instanceCount;
+  uint firstIndex;
+  int vertexOffset;
+  uint firstInstance;
+};
+
+Buffer(4) DrawCommandsArray { IndexedDrawCommand items[]; };
+
+/**
+ * @brief Culling visibility
+ *
+ * Stores whether mesh instance is
+ * drawn after first culling pass
+ */
+Buffer(4) CullVisibilityArray { uint items[]; };
+
+/**
+ * @brief Culling statistics
+ */
+Buffer(16) CullStats {
+  uint numInstances;
+  uint numVisibleEarly;
+  uint numVisibleLate;
+  uint padding;
+};
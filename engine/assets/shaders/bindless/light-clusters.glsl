@@ -0,0 +1,27 @@
+/**
+ * @brief Light cluster data
+ */
+Buffer(64) LightClusterData {
+  mat4 inverseProj;
+  uvec4 gridSize;
+  vec4 depthSlices;
+};
+
+/**
+ * @brief Light clusters
+ *
+ * Every cluster stores number of lights
+ * followed by point light indices
+ */
+Buffer(16) LightClustersArray { uint items[]; };
+
+#define getLightClusterData() uDrawParams.lightClusterData
+
+#define getLightClusterStart(cluster)                                          \
+  ((cluster) * (getLightClusterData().gridSize.w + 1))
+
+#define getLightClusterSize(cluster)                                           \
+  uDrawParams.lightClusters.items[getLightClusterStart(cluster)]
+
+#define getLightClusterLight(cluster, index)                                   \
+  uDrawParams.lightClusters.items[getLightClusterStart(cluster) + 1 + (index)]
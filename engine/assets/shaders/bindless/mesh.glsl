@@ -1,6 +1,19 @@
 #include "transform.glsl"
 #include "skeleton.glsl"
 
+/**
+ * @brief Instance slots
+ *
+ * Maps draw instance index to
+ * persistent instance slot
+ */
+Buffer(16) InstancesArray { uint items[]; };
+
+#define getMeshInstance(index) uDrawParams.meshInstances.items[index]
+
+#define getSkinnedMeshInstance(index)                                          \
+  uDrawParams.skinnedMeshInstances.items[index]
+
 #define getMeshTransform(index) uDrawParams.meshTransforms.items[index]
 
 #define getSkinnedMeshTransform(index)                                         \
@@ -16,3 +16,19 @@ struct ShadowMapItem {
 Buffer(64) ShadowMapsArray { ShadowMapItem items[]; };
 
 #define getShadowMap(index) uDrawParams.shadows.items[index]
+
+/**
+ * @brief Shadow caster masks
+ *
+ * Maps draw instance index to shadow
+ * maps that the instance is visible in
+ */
+Buffer(16) ShadowCasterMasksArray { uint items[]; };
+
+/**
+ * Position that is outside of clip space
+ *
+ * Used for culling instances
+ * that are not in shadow map
+ */
+#define CulledShadowPosition vec4(2.0, 2.0, 2.0, 1.0)
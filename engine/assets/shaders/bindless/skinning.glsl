@@ -0,0 +1,108 @@
+#ifndef SKINNING_GLSL
+#define SKINNING_GLSL
+
+/**
+ * @brief Joints of all skeletons
+ *
+ * Every skeleton is stored at
+ * its own offset
+ */
+Buffer(64) JointsArray { mat4 items[]; };
+
+/**
+ * @brief Tightly packed vec3 values
+ *
+ * Stored as floats because vec3
+ * arrays are padded in std430
+ */
+Buffer(4) PackedVec3Array { float items[]; };
+
+Buffer(16) Vec4Array { vec4 items[]; };
+
+Buffer(16) UVec4Array { uvec4 items[]; };
+
+/**
+ * @brief Skinning job
+ *
+ * Skins vertices of single skinned mesh
+ * instance into skinned vertex cache
+ */
+struct SkinningJob {
+  /**
+   * Source positions
+   */
+  PackedVec3Array positions;
+
+  /**
+   * Source normals
+   */
+  PackedVec3Array normals;
+
+  /**
+   * Source tangents
+   */
+  Vec4Array tangents;
+
+  /**
+   * Source joints
+   */
+  UVec4Array joints;
+
+  /**
+   * Source weights
+   */
+  Vec4Array weights;
+
+  /**
+   * Number of vertices
+   */
+  uint numVertices;
+
+  /**
+   * First vertex in skinned vertex cache
+   */
+  uint vertexOffset;
+
+  /**
+   * First joint in joints buffer
+   */
+  uint jointOffset;
+
+  /**
+   * Padding
+   */
+  uint padding;
+};
+
+Buffer(8) SkinningJobsArray { SkinningJob items[]; };
+
+#define getSkinningJob(index) uDrawParams.skinningJobs.items[index]
+
+#define getJoint(index) uDrawParams.joints.items[index]
+
+/**
+ * @brief Read packed vec3 value
+ *
+ * @param array Packed vec3 array
+ * @param index Value index
+ * @return Value
+ */
+vec3 readPackedVec3(PackedVec3Array array, uint index) {
+  return vec3(array.items[index * 3], array.items[index * 3 + 1],
+              array.items[index * 3 + 2]);
+}
+
+/**
+ * @brief Write packed vec3 value
+ *
+ * @param array Packed vec3 array
+ * @param index Value index
+ * @param value Value
+ */
+void writePackedVec3(PackedVec3Array array, uint index, vec3 value) {
+  array.items[index * 3] = value.x;
+  array.items[index * 3 + 1] = value.y;
+  array.items[index * 3 + 2] = value.z;
+}
+
+#endif
@@ -5,8 +5,6 @@ layout(location = 1) in vec3 inNormal;
 layout(location = 2) in vec4 inTangent;
 layout(location = 3) in vec2 inTextureCoord0;
 layout(location = 4) in vec2 inTextureCoord1;
-layout(location = 5) in uvec4 inJoints;
-layout(location = 6) in vec4 inWeights;
 
 layout(location = 0) out vec3 outWorldPosition;
 layout(location = 1) out vec2 outTextureCoord[2];
@@ -28,7 +26,8 @@ layout(set = 1, binding = 0) uniform DrawParameters {
   MaterialRangeArray meshMaterialRanges;
   TransformsArray skinnedMeshTransforms;
   MaterialRangeArray skinnedMeshMaterialRanges;
-  SkeletonsArray skeletons;
+  InstancesArray meshInstances;
+  InstancesArray skinnedMeshInstances;
   Camera camera;
   Empty scene;
   Empty directionalLights;
@@ -41,15 +40,9 @@ layout(std430, push_constant) uniform PushConstants { uint submeshIndex; }
 uMeshParams;
 
 void main() {
-  mat4 worldMatrix = getSkinnedMeshTransform(gl_InstanceIndex).modelMatrix;
-  SkeletonItem item = getSkeleton(gl_InstanceIndex);
-
-  mat4 skinMatrix = inWeights.x * item.joints[inJoints.x] +
-                    inWeights.y * item.joints[inJoints.y] +
-                    inWeights.z * item.joints[inJoints.z] +
-                    inWeights.w * item.joints[inJoints.w];
-
-  mat4 modelMatrix = worldMatrix * skinMatrix;
+  // Vertices are already skinned by skinning pass
+  uint instance = getSkinnedMeshInstance(gl_InstanceIndex);
+  mat4 modelMatrix = getSkinnedMeshTransform(instance).modelMatrix;
 
   vec4 worldPosition = modelMatrix * vec4(inPosition, 1.0f);
 
@@ -66,7 +59,7 @@ void main() {
   gl_Position = getCamera().viewProj * worldPosition;
 
   outMaterialIndex =
-      min(uDrawParams.skinnedMeshMaterialRanges.items[gl_InstanceIndex].start +
+      min(uDrawParams.skinnedMeshMaterialRanges.items[instance].start +
               uMeshParams.submeshIndex,
-          uDrawParams.skinnedMeshMaterialRanges.items[gl_InstanceIndex].end);
+          uDrawParams.skinnedMeshMaterialRanges.items[instance].end);
 }
@@ -26,7 +26,8 @@ layout(set = 1, binding = 0) uniform DrawParameters {
   MaterialRangeArray meshMaterialRanges;
   TransformsArray skinnedMeshTransforms;
   MaterialRangeArray skinnedMeshMaterialRanges;
-  SkeletonsArray skeletons;
+  InstancesArray meshInstances;
+  InstancesArray skinnedMeshInstances;
   Camera camera;
   Empty scene;
   Empty directionalLights;
@@ -39,7 +40,8 @@ layout(std430, push_constant) uniform PushConstants { uint submeshIndex; }
 uMeshParams;
 
 void main() {
-  mat4 modelMatrix = getMeshTransform(gl_InstanceIndex).modelMatrix;
+  uint instance = getMeshInstance(gl_InstanceIndex);
+  mat4 modelMatrix = getMeshTransform(instance).modelMatrix;
 
   vec4 worldPosition = modelMatrix * vec4(inPosition, 1.0f);
 
@@ -56,7 +58,7 @@ void main() {
   gl_Position = getCamera().viewProj * worldPosition;
 
   outMaterialIndex =
-      min(uDrawParams.meshMaterialRanges.items[gl_InstanceIndex].start +
+      min(uDrawParams.meshMaterialRanges.items[instance].start +
               uMeshParams.submeshIndex,
-          uDrawParams.meshMaterialRanges.items[gl_InstanceIndex].end);
+          uDrawParams.meshMaterialRanges.items[instance].end);
 }
@@ -17,6 +17,7 @@ layout(push_constant) uniform DrawParameters {
   uint sceneTexture;
   uint bloomTexture;
   uint defaultSampler;
+  float resolutionScale;
 }
 uDrawParams;
 
@@ -52,14 +53,18 @@ vec3 aces(vec3 v) {
 const float BloomContribution = 0.2;
 
 void main() {
+  // Scene is only rendered into a part of the
+  // scene texture with dynamic resolution
+  vec2 texCoord = inTexCoord * uDrawParams.resolutionScale;
+
   vec4 hdrColor =
       texture(sampler2D(uGlobalTextures[uDrawParams.sceneTexture],
                         uGlobalSamplers[uDrawParams.defaultSampler]),
-              inTexCoord);
+              texCoord);
   vec3 bloomColor =
       texture(sampler2D(uGlobalTextures[uDrawParams.bloomTexture],
                         uGlobalSamplers[uDrawParams.defaultSampler]),
-              inTexCoord)
+              texCoord)
           .rgb;
 
   float ev100 = getCamera().exposure.x;
@@ -14,6 +14,7 @@ layout(location = 0) out vec4 outColor;
 #include "bindless/scene.glsl"
 #include "bindless/shadows.glsl"
 #include "bindless/lights.glsl"
+#include "bindless/light-clusters.glsl"
 #include "bindless/material.glsl"
 
 layout(set = 0, binding = 0) uniform texture2D uGlobalTextures[];
@@ -28,12 +29,15 @@ layout(set = 1, binding = 0) uniform DrawParameters {
   MaterialRangeArray meshMaterialRanges;
   Empty skinnedMeshTransforms;
   MaterialRangeArray skinnedMaterialRanges;
-  Empty skeletons;
+  Empty meshInstances;
+  Empty skinnedMeshInstances;
   Camera camera;
   Scene scene;
   DirectionalLightsArray directionalLights;
   PointLightsArray pointLights;
   ShadowMapsArray shadows;
+  LightClusterData lightClusterData;
+  LightClustersArray lightClusters;
   uint defaultSampler;
 }
 uDrawParams;
@@ -390,6 +394,30 @@ float calculateShadowFactor(DirectionalLightItem item) {
                                       cascadeIndex);
 }
 
+/**
+ * Get light cluster of fragment
+ *
+ * @return Light cluster index
+ */
+uint getLightClusterIndex() {
+  uvec4 gridSize = getLightClusterData().gridSize;
+  vec4 depthSlices = getLightClusterData().depthSlices;
+
+  vec4 clipPosition = getCamera().viewProj * vec4(inWorldPosition, 1.0);
+  vec2 ndc = clipPosition.xy / clipPosition.w;
+  uvec2 tile = uvec2(
+      clamp((ndc * 0.5 + 0.5) * vec2(gridSize.xy), vec2(0.0),
+            vec2(gridSize.xy - 1)));
+
+  float viewDepth = -(getCamera().view * vec4(inWorldPosition, 1.0)).z;
+  uint slice =
+      uint(clamp(log(max(viewDepth, depthSlices.x)) * depthSlices.z +
+                     depthSlices.w,
+                 0.0, float(gridSize.z - 1)));
+
+  return tile.x + tile.y * gridSize.x + slice * gridSize.x * gridSize.y;
+}
+
 vec3 getLightContributionFactor(LightCalculations calc, vec3 F0, float NdotV,
                                 float alpha, vec3 diffuseColor) {
   float NdotL = calc.NdotL;
@@ -467,9 +495,10 @@ void main() {
              shadowFactor;
   }
 
-  uint numPointLights = getScene().data.y;
-  for (uint i = 0; i < numPointLights; i++) {
-    PointLightItem item = getPointLight(i);
+  uint cluster = getLightClusterIndex();
+  uint numClusterLights = getLightClusterSize(cluster);
+  for (uint i = 0; i < numClusterLights; i++) {
+    PointLightItem item = getPointLight(getLightClusterLight(cluster, i));
     LightCalculations calc = getPointLightSurfaceCalculations(item, n, v);
 
     if (calc.NdotL < 0.001 || calc.intensity < 0.001) {
@@ -0,0 +1,29 @@
+#version 460
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_EXT_nonuniform_qualifier : enable
+
+layout(location = 0) flat in uint inLayer;
+
+layout(set = 0, binding = 0) uniform texture2DArray uTextures2DArray[];
+layout(set = 0, binding = 1) uniform sampler uGlobalSamplers[];
+
+layout(push_constant) uniform DrawParameters {
+  uint source;
+  uint defaultSampler;
+}
+uDrawParams;
+
+void main() {
+  // Shadow maps are cleared to far plane
+  // when there is no source texture
+  if (uDrawParams.source == 0) {
+    gl_FragDepth = 1.0;
+    return;
+  }
+
+  gl_FragDepth =
+      texelFetch(sampler2DArray(uTextures2DArray[uDrawParams.source],
+                                uGlobalSamplers[uDrawParams.defaultSampler]),
+                 ivec3(gl_FragCoord.xy, inLayer), 0)
+          .r;
+}
@@ -0,0 +1,14 @@
+#version 460
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shader_viewport_layer_array : enable
+
+layout(location = 0) flat out uint outLayer;
+
+void main() {
+  // Every instance draws fullscreen
+  // triangle into one shadow map
+  vec2 texCoord = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+  gl_Layer = gl_InstanceIndex;
+  outLayer = gl_InstanceIndex;
+  gl_Position = vec4(texCoord * 2.0 - 1.0, 0.0, 1.0);
+}
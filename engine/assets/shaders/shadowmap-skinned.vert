@@ -3,8 +3,6 @@
 #extension GL_ARB_shader_viewport_layer_array : enable
 
 layout(location = 0) in vec3 inPosition;
-layout(location = 1) in uvec4 inJoints;
-layout(location = 2) in vec4 inWeights;
 
 #include "bindless/base.glsl"
 #include "bindless/mesh.glsl"
@@ -13,24 +11,33 @@ layout(location = 2) in vec4 inWeights;
 layout(set = 0, binding = 0) uniform DrawParameters {
   TransformsArray meshTransforms;
   TransformsArray skinnedMeshTransforms;
-  SkeletonsArray skeletons;
+  InstancesArray meshInstances;
+  InstancesArray skinnedMeshInstances;
+  ShadowCasterMasksArray meshShadowCasterMasks;
+  ShadowCasterMasksArray skinnedMeshShadowCasterMasks;
   ShadowMapsArray shadows;
 }
 uDrawParams;
 
-layout(push_constant) uniform PushConstants { uvec4 shadow; }
+layout(push_constant) uniform PushConstants { uint numShadowMaps; }
 uShadowParams;
 
 void main() {
-  mat4 modelMatrix = getSkinnedMeshTransform(gl_InstanceIndex).modelMatrix;
-  SkeletonItem item = getSkeleton(gl_InstanceIndex);
+  // Every instance is drawn once per shadow map
+  uint shadowIndex = gl_InstanceIndex % uShadowParams.numShadowMaps;
+  uint drawIndex = gl_InstanceIndex / uShadowParams.numShadowMaps;
+  gl_Layer = int(shadowIndex);
 
-  mat4 skinMatrix = inWeights.x * item.joints[inJoints.x] +
-                    inWeights.y * item.joints[inJoints.y] +
-                    inWeights.z * item.joints[inJoints.z] +
-                    inWeights.w * item.joints[inJoints.w];
+  uint mask = uDrawParams.skinnedMeshShadowCasterMasks.items[drawIndex];
+  if ((mask & (1u << shadowIndex)) == 0) {
+    gl_Position = CulledShadowPosition;
+    return;
+  }
 
-  gl_Position = getShadowMap(uShadowParams.shadow.x).shadowMatrix *
-                modelMatrix * skinMatrix * vec4(inPosition, 1.0);
-  gl_Layer = int(uShadowParams.shadow.x);
+  // Vertices are already skinned by skinning pass
+  uint instance = getSkinnedMeshInstance(drawIndex);
+  mat4 modelMatrix = getSkinnedMeshTransform(instance).modelMatrix;
+
+  gl_Position = getShadowMap(shadowIndex).shadowMatrix * modelMatrix *
+                vec4(inPosition, 1.0);
 }
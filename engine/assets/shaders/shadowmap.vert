@@ -11,18 +11,31 @@ layout(location = 0) in vec3 inPosition;
 layout(set = 0, binding = 0) uniform DrawParameters {
   TransformsArray meshTransforms;
   TransformsArray skinnedMeshTransforms;
-  SkeletonsArray skeletons;
+  InstancesArray meshInstances;
+  InstancesArray skinnedMeshInstances;
+  ShadowCasterMasksArray meshShadowCasterMasks;
+  ShadowCasterMasksArray skinnedMeshShadowCasterMasks;
   ShadowMapsArray shadows;
 }
 uDrawParams;
 
-layout(push_constant) uniform PushConstants { uvec4 shadow; }
+layout(push_constant) uniform PushConstants { uint numShadowMaps; }
 uShadowParams;
 
 void main() {
-  mat4 modelMatrix = getMeshTransform(gl_InstanceIndex).modelMatrix;
+  // Every instance is drawn once per shadow map
+  uint shadowIndex = gl_InstanceIndex % uShadowParams.numShadowMaps;
+  uint drawIndex = gl_InstanceIndex / uShadowParams.numShadowMaps;
+  gl_Layer = int(shadowIndex);
 
-  gl_Position = getShadowMap(uShadowParams.shadow.x).shadowMatrix *
-                modelMatrix * vec4(inPosition, 1.0);
-  gl_Layer = int(uShadowParams.shadow.x);
+  uint mask = uDrawParams.meshShadowCasterMasks.items[drawIndex];
+  if ((mask & (1u << shadowIndex)) == 0) {
+    gl_Position = CulledShadowPosition;
+    return;
+  }
+
+  mat4 modelMatrix = getMeshTransform(getMeshInstance(drawIndex)).modelMatrix;
+
+  gl_Position = getShadowMap(shadowIndex).shadowMatrix * modelMatrix *
+                vec4(inPosition, 1.0);
 }
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+static const quoll::Path FixturesPath =
+    std::filesystem::current_path() / "fixtures";
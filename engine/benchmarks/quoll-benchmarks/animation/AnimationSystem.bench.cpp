@@ -0,0 +1,60 @@
+#include "quoll/core/Base.h"
+#include "quoll/animation/AnimationSystem.h"
+#include "quoll/animation/Animator.h"
+#include "quoll/scene/LocalTransform.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+static void AnimationSystem_Update(benchmark::State &state) {
+  static constexpr f32 TimeDelta = 0.01f;
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  quoll::AssetRegistry assetRegistry;
+  quoll::AnimationSystem animationSystem(assetRegistry);
+  quoll::EntityDatabase entityDatabase;
+
+  quoll::AssetData<quoll::AnimationAsset> animation{};
+  animation.data.time = 2.0f;
+
+  for (auto target : {quoll::KeyframeSequenceAssetTarget::Position,
+                      quoll::KeyframeSequenceAssetTarget::Rotation,
+                      quoll::KeyframeSequenceAssetTarget::Scale}) {
+    quoll::KeyframeSequenceAsset sequence{};
+    sequence.target = target;
+    sequence.interpolation = quoll::KeyframeSequenceAssetInterpolation::Linear;
+    sequence.keyframeTimes = {0.0f, 0.5f, 1.0f};
+    sequence.keyframeValues = {glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
+                               glm::vec4(0.5f, 0.0f, 0.0f, 1.0f),
+                               glm::vec4(1.0f, 0.0f, 0.0f, 1.0f)};
+    animation.data.keyframes.push_back(sequence);
+  }
+
+  auto animationHandle = assetRegistry.getAnimations().addAsset(animation);
+
+  quoll::AssetData<quoll::AnimatorAsset> animator{};
+  animator.data.initialState = 0;
+  animator.data.states.push_back({"Animation", animationHandle});
+  auto animatorHandle = assetRegistry.getAnimators().addAsset(animator);
+
+  for (usize i = 0; i < numEntities; ++i) {
+    auto entity = entityDatabase.create();
+    entityDatabase.set<quoll::LocalTransform>(entity, {});
+
+    quoll::Animator component{};
+    component.asset = animatorHandle;
+    entityDatabase.set(entity, component);
+  }
+
+  for (auto _ : state) {
+    animationSystem.update(TimeDelta, entityDatabase);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+BENCHMARK(AnimationSystem_Update)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,76 @@
+#include "quoll/core/Base.h"
+#include "quoll/asset/AssetCache.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+static const quoll::Path CachePath =
+    std::filesystem::current_path() / "benchmark-cache";
+
+/**
+ * @brief Asset cache benchmark fixture
+ *
+ * Creates assets from fixtures in
+ * a temporary cache directory
+ */
+class AssetCacheBenchmark : public benchmark::Fixture {
+public:
+  /**
+   * @brief Set up benchmark
+   *
+   * @param state Benchmark state
+   */
+  void SetUp(benchmark::State &state) override {
+    std::filesystem::remove_all(CachePath);
+    std::filesystem::create_directory(CachePath);
+
+    cache = std::make_unique<quoll::AssetCache>(CachePath);
+
+    cache->createTextureFromSource(FixturesPath / "1x1-2d.ktx", texture);
+    cache->createFontFromSource(FixturesPath / "valid-font.ttf", font);
+    cache->createAudioFromSource(FixturesPath / "valid-audio.wav", audio);
+    cache->createLuaScriptFromSource(FixturesPath / "script-asset-valid.lua",
+                                     luaScript);
+  }
+
+  /**
+   * @brief Tear down benchmark
+   *
+   * @param state Benchmark state
+   */
+  void TearDown(benchmark::State &state) override {
+    cache.reset();
+    std::filesystem::remove_all(CachePath);
+  }
+
+public:
+  std::unique_ptr<quoll::AssetCache> cache;
+
+  quoll::Uuid texture = quoll::Uuid::generate();
+  quoll::Uuid font = quoll::Uuid::generate();
+  quoll::Uuid audio = quoll::Uuid::generate();
+  quoll::Uuid luaScript = quoll::Uuid::generate();
+};
+
+BENCHMARK_F(AssetCacheBenchmark, LoadTexture)(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->loadTexture(texture));
+  }
+}
+
+BENCHMARK_F(AssetCacheBenchmark, LoadFont)(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->loadFont(font));
+  }
+}
+
+BENCHMARK_F(AssetCacheBenchmark, LoadAudio)(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->loadAudio(audio));
+  }
+}
+
+BENCHMARK_F(AssetCacheBenchmark, LoadLuaScript)(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->loadLuaScript(luaScript));
+  }
+}
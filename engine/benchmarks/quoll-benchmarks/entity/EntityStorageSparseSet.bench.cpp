@@ -0,0 +1,114 @@
+#include "quoll/core/Base.h"
+#include "quoll/entity/EntityStorageSparseSet.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+struct Position {
+  glm::vec3 value{0.0f};
+};
+
+struct Velocity {
+  glm::vec3 value{0.0f};
+};
+
+class BenchmarkEntityStorage : public quoll::EntityStorageSparseSet {
+public:
+  BenchmarkEntityStorage() {
+    reg<Position>();
+    reg<Velocity>();
+  }
+};
+
+static std::vector<quoll::Entity>
+createEntities(BenchmarkEntityStorage &storage, usize numEntities) {
+  std::vector<quoll::Entity> entities(numEntities);
+  for (auto &entity : entities) {
+    entity = storage.create();
+  }
+
+  return entities;
+}
+
+static void EntityStorageSparseSet_Set(benchmark::State &state) {
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto storage = std::make_unique<BenchmarkEntityStorage>();
+    auto entities = createEntities(*storage, numEntities);
+    state.ResumeTiming();
+
+    for (auto entity : entities) {
+      storage->set<Position>(entity, {glm::vec3{1.0f}});
+    }
+    benchmark::ClobberMemory();
+
+    state.PauseTiming();
+    storage.reset();
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+static void EntityStorageSparseSet_Get(benchmark::State &state) {
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  BenchmarkEntityStorage storage;
+  auto entities = createEntities(storage, numEntities);
+  for (auto entity : entities) {
+    storage.set<Position>(entity, {glm::vec3{1.0f}});
+  }
+
+  for (auto _ : state) {
+    f32 sum = 0.0f;
+    for (auto entity : entities) {
+      sum += storage.get<Position>(entity).value.x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+static void EntityStorageSparseSet_View(benchmark::State &state) {
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  BenchmarkEntityStorage storage;
+  auto entities = createEntities(storage, numEntities);
+  for (usize i = 0; i < entities.size(); ++i) {
+    storage.set<Position>(entities.at(i), {});
+
+    // Half of the entities are moving
+    // so that view skips entities
+    if (i % 2 == 0) {
+      storage.set<Velocity>(entities.at(i), {glm::vec3{1.0f}});
+    }
+  }
+
+  for (auto _ : state) {
+    for (auto [entity, position, velocity] :
+         storage.view<Position, Velocity>()) {
+      position.value += velocity.value;
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+BENCHMARK(EntityStorageSparseSet_Set)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(EntityStorageSparseSet_Get)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(EntityStorageSparseSet_View)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,52 @@
+#include "quoll/core/Base.h"
+#include "quoll/core/Engine.h"
+#include "quoll/logger/NoopLogTransport.h"
+#include "quoll/profiler/Tracer.h"
+
+#include "Benchmark.h"
+
+int main(int argc, char **argv) {
+  quoll::Engine::getLogger().setTransport(quoll::NoopLogTransport);
+  quoll::Engine::getUserLogger().setTransport(quoll::NoopLogTransport);
+
+  static const quoll::String TraceArg = "--trace=";
+
+  std::vector<char *> args;
+  std::optional<quoll::Path> tracePath;
+  bool hasOutput = false;
+  for (int i = 0; i < argc; ++i) {
+    quoll::StringView arg = argv[i];
+    if (arg.starts_with(TraceArg)) {
+      tracePath = arg.substr(TraceArg.size());
+      continue;
+    }
+
+    hasOutput = hasOutput || arg.starts_with("--benchmark_out=");
+    args.push_back(argv[i]);
+  }
+
+  // Results are written as JSON for tracking
+  // unless output file is passed explicitly
+  quoll::String output = "--benchmark_out=benchmark-results.json";
+  quoll::String outputFormat = "--benchmark_out_format=json";
+  if (!hasOutput) {
+    args.push_back(output.data());
+    args.push_back(outputFormat.data());
+  }
+
+  auto numArgs = static_cast<int>(args.size());
+  ::benchmark::Initialize(&numArgs, args.data());
+  if (::benchmark::ReportUnrecognizedArguments(numArgs, args.data())) {
+    return 1;
+  }
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+
+  if (tracePath.has_value()) {
+    std::ofstream stream(tracePath.value());
+    quoll::Tracer::capture().writeChromeTrace(stream);
+  }
+
+  return 0;
+}
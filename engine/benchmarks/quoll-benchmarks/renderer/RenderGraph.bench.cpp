@@ -0,0 +1,65 @@
+#include "quoll/core/Base.h"
+#include "quoll/rhi-mock/MockRenderDevice.h"
+#include "quoll/renderer/RenderGraph.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+/**
+ * @brief Add chain of graphics passes
+ *
+ * Every pass reads the output of
+ * the previous pass
+ *
+ * @param graph Render graph
+ * @param numPasses Number of passes
+ */
+static void addPassChain(quoll::RenderGraph &graph, usize numPasses) {
+  quoll::rhi::TextureDescription description{};
+  description.width = 1920;
+  description.height = 1080;
+  description.format = quoll::rhi::Format::Rgba8Srgb;
+  description.usage = quoll::rhi::TextureUsage::Color |
+                      quoll::rhi::TextureUsage::Sampled;
+
+  std::optional<quoll::RenderGraphResource<quoll::rhi::TextureHandle>>
+      previous;
+
+  for (usize i = 0; i < numPasses; ++i) {
+    auto texture = graph.create(description);
+
+    auto &pass = graph.addGraphicsPass("Pass " + std::to_string(i));
+    pass.write(texture, quoll::AttachmentType::Color, glm::vec4());
+    if (previous.has_value()) {
+      pass.read(previous.value());
+    }
+
+    previous.emplace(texture);
+  }
+}
+
+static void RenderGraph_Build(benchmark::State &state) {
+  auto numPasses = static_cast<usize>(state.range(0));
+
+  quoll::rhi::MockRenderDevice device;
+  quoll::RenderStorage storage(&device);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    quoll::RenderGraph graph("BenchmarkGraph");
+    addPassChain(graph, numPasses);
+    state.ResumeTiming();
+
+    graph.build(storage);
+
+    state.PauseTiming();
+    graph.destroy(storage);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<i64>(numPasses));
+}
+
+BENCHMARK(RenderGraph_Build)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,90 @@
+#include "quoll/core/Base.h"
+#include "quoll/rhi-mock/MockRenderDevice.h"
+#include "quoll/renderer/RenderStorage.h"
+#include "quoll/renderer/SceneRendererFrameData.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+/**
+ * @brief Create mesh with a single geometry
+ *
+ * @return Mesh asset
+ */
+static quoll::MeshAsset createMesh() {
+  quoll::BaseGeometryAsset geometry{};
+  geometry.positions = {glm::vec3(0.0f, 0.0f, 0.0f),
+                        glm::vec3(1.0f, 0.0f, 0.0f),
+                        glm::vec3(0.0f, 1.0f, 0.0f)};
+  geometry.indices = {0, 1, 2};
+
+  quoll::MeshAsset mesh{};
+  mesh.geometries.push_back(geometry);
+  mesh.boundingSphere = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+  return mesh;
+}
+
+/**
+ * @brief Fill frame data with meshes
+ *
+ * @param frameData Frame data
+ * @param mesh Mesh asset
+ * @param numEntities Number of mesh entities
+ */
+static void addMeshes(quoll::SceneRendererFrameData &frameData,
+                      const quoll::MeshAsset &mesh, usize numEntities) {
+  frameData.clear();
+  frameData.setCameraData(quoll::Camera{}, quoll::PerspectiveLens{});
+
+  for (usize i = 0; i < numEntities; ++i) {
+    glm::mat4 transform = glm::translate(
+        glm::mat4{1.0f}, glm::vec3(static_cast<f32>(i), 0.0f, 0.0f));
+
+    frameData.addMesh(quoll::MeshAssetHandle{1}, mesh,
+                      quoll::Entity{static_cast<u32>(i + 1)}, transform, {},
+                      false);
+  }
+}
+
+static void SceneRendererFrameData_Build(benchmark::State &state) {
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  quoll::rhi::MockRenderDevice device;
+  quoll::RenderStorage renderStorage(&device);
+  quoll::SceneRendererFrameData frameData(renderStorage, numEntities);
+  auto mesh = createMesh();
+
+  for (auto _ : state) {
+    addMeshes(frameData, mesh, numEntities);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+static void SceneRendererFrameData_UpdateBuffers(benchmark::State &state) {
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  quoll::rhi::MockRenderDevice device;
+  quoll::RenderStorage renderStorage(&device);
+  quoll::SceneRendererFrameData frameData(renderStorage, numEntities);
+  auto mesh = createMesh();
+
+  for (auto _ : state) {
+    addMeshes(frameData, mesh, numEntities);
+    frameData.updateBuffers();
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+BENCHMARK(SceneRendererFrameData_Build)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(SceneRendererFrameData_UpdateBuffers)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
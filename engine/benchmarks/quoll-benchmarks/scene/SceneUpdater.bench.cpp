@@ -0,0 +1,91 @@
+#include "quoll/core/Base.h"
+#include "quoll/scene/LocalTransform.h"
+#include "quoll/scene/WorldTransform.h"
+#include "quoll/scene/Parent.h"
+#include "quoll/scene/SceneUpdater.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+/**
+ * @brief Create transform hierarchies
+ *
+ * Entities are created in chains where every
+ * entity is the parent of the next one. Parents
+ * are created before their children.
+ *
+ * @param entityDatabase Entity database
+ * @param numEntities Number of entities
+ * @param depth Number of entities in a chain
+ */
+static void createHierarchy(quoll::EntityDatabase &entityDatabase,
+                            usize numEntities, usize depth) {
+  quoll::Entity parent = quoll::Entity::Null;
+  for (usize i = 0; i < numEntities; ++i) {
+    auto entity = entityDatabase.create();
+
+    quoll::LocalTransform transform{};
+    transform.localPosition = glm::vec3(1.0f, 0.5f, 0.25f);
+    transform.localRotation = glm::quat(glm::vec3(0.1f, 0.2f, 0.3f));
+    entityDatabase.set(entity, transform);
+    entityDatabase.set<quoll::WorldTransform>(entity, {});
+
+    if (i % depth != 0) {
+      entityDatabase.set<quoll::Parent>(entity, {parent});
+    }
+
+    parent = entity;
+  }
+}
+
+static void SceneUpdater_DeepHierarchy(benchmark::State &state) {
+  static constexpr usize Depth = 64;
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  quoll::EntityDatabase entityDatabase;
+  quoll::SceneUpdater sceneUpdater;
+  createHierarchy(entityDatabase, numEntities, Depth);
+
+  for (auto _ : state) {
+    sceneUpdater.update(entityDatabase);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+static void SceneUpdater_WideHierarchy(benchmark::State &state) {
+  auto numEntities = static_cast<usize>(state.range(0));
+
+  quoll::EntityDatabase entityDatabase;
+  quoll::SceneUpdater sceneUpdater;
+
+  // One root with every other entity as its child
+  auto root = entityDatabase.create();
+  entityDatabase.set<quoll::LocalTransform>(root, {});
+  entityDatabase.set<quoll::WorldTransform>(root, {});
+
+  for (usize i = 1; i < numEntities; ++i) {
+    auto entity = entityDatabase.create();
+    entityDatabase.set<quoll::LocalTransform>(entity, {});
+    entityDatabase.set<quoll::WorldTransform>(entity, {});
+    entityDatabase.set<quoll::Parent>(entity, {root});
+  }
+
+  for (auto _ : state) {
+    sceneUpdater.update(entityDatabase);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numEntities));
+}
+
+BENCHMARK(SceneUpdater_DeepHierarchy)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(SceneUpdater_WideHierarchy)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,48 @@
+#include "quoll/core/Base.h"
+#include "quoll/scene/Skeleton.h"
+#include "quoll/scene/SkeletonUpdater.h"
+
+#include "quoll-benchmarks/Benchmark.h"
+
+static void SkeletonUpdater_Update(benchmark::State &state) {
+  static constexpr u32 NumJoints = 64;
+  auto numSkeletons = static_cast<usize>(state.range(0));
+
+  quoll::EntityDatabase entityDatabase;
+  quoll::SkeletonUpdater skeletonUpdater;
+
+  for (usize i = 0; i < numSkeletons; ++i) {
+    auto entity = entityDatabase.create();
+
+    quoll::Skeleton skeleton{};
+    skeleton.numJoints = NumJoints;
+    skeleton.jointWorldTransforms.resize(NumJoints, glm::mat4{1.0f});
+    skeleton.jointFinalTransforms.resize(NumJoints, glm::mat4{1.0f});
+
+    for (u32 joint = 0; joint < NumJoints; ++joint) {
+      skeleton.jointLocalPositions.push_back(glm::vec3(0.0f, 1.0f, 0.0f));
+      skeleton.jointLocalRotations.push_back(
+          glm::quat(glm::vec3(0.0f, 0.1f, 0.0f)));
+      skeleton.jointLocalScales.push_back(glm::vec3(1.0f));
+      skeleton.jointParents.push_back(
+          static_cast<quoll::JointId>(joint > 0 ? joint - 1 : 0));
+      skeleton.jointInverseBindMatrices.push_back(glm::mat4{1.0f});
+      skeleton.jointNames.push_back("Joint " + std::to_string(joint));
+    }
+
+    entityDatabase.set(entity, skeleton);
+  }
+
+  for (auto _ : state) {
+    skeletonUpdater.update(entityDatabase);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<i64>(numSkeletons * NumJoints));
+}
+
+BENCHMARK(SkeletonUpdater_Update)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000)
+    ->Unit(benchmark::kMicrosecond);
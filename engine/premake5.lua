@@ -13,6 +13,8 @@ function copyEngineAssets()
         "glslc "..assetsPath.."/shaders/shadowmap.frag -o"..outputPath.."/shaders/shadowmap.frag.spv",
         "glslc "..assetsPath.."/shaders/shadowmap.vert -o"..outputPath.."/shaders/shadowmap.vert.spv", 
         "glslc "..assetsPath.."/shaders/shadowmap-skinned.vert -o"..outputPath.."/shaders/shadowmap-skinned.vert.spv",
+        "glslc "..assetsPath.."/shaders/shadowmap-layer.vert -o"..outputPath.."/shaders/shadowmap-layer.vert.spv",
+        "glslc "..assetsPath.."/shaders/shadowmap-copy.frag -o"..outputPath.."/shaders/shadowmap-copy.frag.spv",
         "glslc "..assetsPath.."/shaders/imgui.frag -o"..outputPath.."/shaders/imgui.frag.spv",
         "glslc "..assetsPath.."/shaders/imgui.vert -o"..outputPath.."/shaders/imgui.vert.spv",
         "glslc "..assetsPath.."/shaders/text.vert -o"..outputPath.."/shaders/text.vert.spv",
@@ -25,6 +27,10 @@ function copyEngineAssets()
         "glslc "..assetsPath.."/shaders/extract-bright-colors.comp -o "..outputPath.."/shaders/extract-bright-colors.comp.spv",
         "glslc "..assetsPath.."/shaders/bloom-downsample.comp -o "..outputPath.."/shaders/bloom-downsample.comp.spv",
         "glslc "..assetsPath.."/shaders/bloom-upsample.comp -o "..outputPath.."/shaders/bloom-upsample.comp.spv",
+        "glslc "..assetsPath.."/shaders/cluster-lights.comp -o "..outputPath.."/shaders/cluster-lights.comp.spv",
+        "glslc "..assetsPath.."/shaders/skin-meshes.comp -o "..outputPath.."/shaders/skin-meshes.comp.spv",
+        "glslc "..assetsPath.."/shaders/cull-meshes.comp -o "..outputPath.."/shaders/cull-meshes.comp.spv",
+        "glslc "..assetsPath.."/shaders/build-depth-pyramid.comp -o "..outputPath.."/shaders/build-depth-pyramid.comp.spv",
         "glslc "..assetsPath.."/shaders/hdr.frag -o "..outputPath.."/shaders/hdr.frag.spv",
 
         -- Fonts
@@ -73,3 +79,28 @@ project "QuollEngineTest"
         "{COPYDIR} ../../engine/tests/fixtures %{cfg.buildtarget.directory}/fixtures"
     }
 
+project "QuollEngineBenchmark"
+    basedir "../workspace/engine-benchmark"
+    kind "ConsoleApp"
+
+    configurations {
+        "Debug", "Release"
+    }
+
+    includedirs {
+        "../engine/benchmarks",
+        "../engine/src",
+        "../engine/rhi/mock/include"
+    }
+
+    files {
+        "benchmarks/**.cpp",
+        "benchmarks/**.h"
+    }
+
+    linkDependenciesWith{"QuollEngine", "QuollRHIMock", "QuollRHICore"}
+    linkGoogleBenchmark{}
+
+    postbuildcommands {
+        "{COPYDIR} ../../engine/tests/fixtures %{cfg.buildtarget.directory}/fixtures"
+    }
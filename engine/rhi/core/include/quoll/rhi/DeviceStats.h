@@ -8,7 +8,9 @@ namespace quoll::rhi {
  * @brief Device statistics collector
  *
  * Stores information about how many
- * draw calls etc are done by the device
+ * draw calls etc are done by the device.
+ * Counters can be updated from command
+ * lists that are recorded in parallel.
  */
 class DeviceStats {
 public:
@@ -36,6 +38,28 @@ public:
    */
   void addCommandCall();
 
+  /**
+   * @brief Add uploaded bytes
+   *
+   * Only changed ranges of persistent
+   * buffers are counted
+   *
+   * @param size Number of bytes written to device buffers
+   */
+  void addUploadedBytes(usize size);
+
+  /**
+   * @brief Set occlusion culling results
+   *
+   * Culling results are read back from device
+   * after their frame is complete; so, they are
+   * not reset with calls
+   *
+   * @param visibleCount Number of visible instances
+   * @param culledCount Number of culled instances
+   */
+  void setCullingResults(u32 visibleCount, u32 culledCount);
+
   /**
    * @brief Get number of draw calls
    *
@@ -57,6 +81,29 @@ public:
    */
   inline u32 getCommandCallsCount() const { return mCommandCallsCount; }
 
+  /**
+   * @brief Get number of uploaded bytes
+   *
+   * @return Number of bytes written to device buffers
+   */
+  inline usize getUploadedBytes() const { return mUploadedBytes; }
+
+  /**
+   * @brief Get number of visible instances
+   *
+   * @return Number of instances that passed culling
+   */
+  inline u32 getVisibleInstancesCount() const {
+    return mVisibleInstancesCount;
+  }
+
+  /**
+   * @brief Get number of culled instances
+   *
+   * @return Number of instances that failed culling
+   */
+  inline u32 getCulledInstancesCount() const { return mCulledInstancesCount; }
+
   /**
    * @brief Get resource metrics
    *
@@ -67,9 +114,12 @@ public:
   }
 
 private:
-  u32 mDrawCallsCount = 0;
-  usize mDrawnPrimitivesCount = 0;
-  u32 mCommandCallsCount = 0;
+  std::atomic<u32> mDrawCallsCount = 0;
+  std::atomic<usize> mDrawnPrimitivesCount = 0;
+  std::atomic<u32> mCommandCallsCount = 0;
+  std::atomic<usize> mUploadedBytes = 0;
+  std::atomic<u32> mVisibleInstancesCount = 0;
+  std::atomic<u32> mCulledInstancesCount = 0;
 
   NativeResourceMetrics *mResourceMetrics;
 };
@@ -14,7 +14,49 @@ enum Format {
   Rgba32Uint,
   Depth16Unorm,
   Depth32Float,
-  Depth32FloatStencil8Uint
+  Depth32FloatStencil8Uint,
+  R32Float
 };
 
+/**
+ * @brief Get size of single texel in bytes
+ *
+ * Undefined format has no texel size. Every
+ * other format must be listed; so, adding a
+ * format without a size is caught by switch
+ * warnings and asserted at runtime.
+ *
+ * @param format Format
+ * @return Texel size in bytes
+ */
+constexpr usize getFormatSize(Format format) {
+  switch (format) {
+  case Undefined:
+    return 0;
+  case Depth16Unorm:
+    return 2;
+  case Rgba8Unorm:
+  case Rgba8Srgb:
+  case Bgra8Srgb:
+  case Depth32Float:
+  case R32Float:
+    return 4;
+  case Rgba16Float:
+  case Rg32Float:
+    return 8;
+  // Devices store stencil of combined depth stencil
+  // formats separately or pad texels to 64 bits
+  case Depth32FloatStencil8Uint:
+    return 8;
+  case Rgb32Float:
+    return 12;
+  case Rgba32Float:
+  case Rgba32Uint:
+    return 16;
+  }
+
+  QuollAssert(false, "Format has no texel size");
+  return 0;
+}
+
 } // namespace quoll::rhi
@@ -8,6 +8,7 @@
 #include "quoll/rhi/Filter.h"
 #include "quoll/rhi/CopyRegion.h"
 #include "quoll/rhi/BlitRegion.h"
+#include "quoll/rhi/SubpassContents.h"
 
 namespace quoll::rhi {
 
@@ -42,11 +43,13 @@ public:
    * @param framebuffer Framebuffer
    * @param renderAreaOffset Render area offset
    * @param renderAreaSize Render area size
+   * @param contents Render pass contents
    */
   virtual void beginRenderPass(rhi::RenderPassHandle renderPass,
                                FramebufferHandle framebuffer,
                                const glm::ivec2 &renderAreaOffset,
-                               const glm::uvec2 &renderAreaSize) = 0;
+                               const glm::uvec2 &renderAreaSize,
+                               SubpassContents contents) = 0;
 
   /**
    * @brief End render pass
@@ -124,6 +127,17 @@ public:
   virtual void drawIndexed(u32 indexCount, u32 firstIndex, i32 vertexOffset,
                            u32 instanceCount, u32 firstInstance) = 0;
 
+  /**
+   * @brief Draw indexed with parameters from buffer
+   *
+   * @param buffer Buffer with indexed draw commands
+   * @param offset Offset of first command in buffer
+   * @param drawCount Number of draw commands
+   * @param stride Stride between draw commands
+   */
+  virtual void drawIndexedIndirect(BufferHandle buffer, u64 offset,
+                                   u32 drawCount, u32 stride) = 0;
+
   /**
    * @brief Dispatch compute work
    *
@@ -194,6 +208,41 @@ public:
    */
   virtual void blitTexture(TextureHandle source, TextureHandle destination,
                            std::span<BlitRegion> regions, Filter filter) = 0;
+
+  /**
+   * @brief Reset queries
+   *
+   * Queries must be reset before they are written
+   *
+   * @param queryPool Query pool
+   * @param firstQuery First query index
+   * @param queryCount Number of queries
+   */
+  virtual void resetQueryPool(QueryPoolHandle queryPool, u32 firstQuery,
+                              u32 queryCount) = 0;
+
+  /**
+   * @brief Write timestamp
+   *
+   * @param queryPool Query pool
+   * @param query Query index
+   * @param stage Pipeline stage
+   */
+  virtual void writeTimestamp(QueryPoolHandle queryPool, u32 query,
+                              PipelineStage stage) = 0;
+
+  /**
+   * @brief Execute secondary command lists
+   *
+   * @param commandLists Secondary command lists
+   */
+  virtual void executeCommands(
+      std::span<NativeRenderCommandListInterface *> commandLists) = 0;
+
+  /**
+   * @brief End secondary command list recording
+   */
+  virtual void end() = 0;
 };
 
 } // namespace quoll::rhi
@@ -33,6 +33,15 @@ struct PipelineInputAssembly {
    * Primitive topology
    */
   PrimitiveTopology primitiveTopology = PrimitiveTopology::TriangleList;
+
+  /**
+   * @brief Check if input assembly is equal to another one
+   *
+   * @param rhs Other input assembly
+   * @retval true Input assembly is equal
+   * @retval false Input assembly is not equal
+   */
+  bool operator==(const PipelineInputAssembly &rhs) const = default;
 };
 
 /**
@@ -58,6 +67,15 @@ struct PipelineRasterizer {
    * @brief Line width
    */
   f32 lineWidth = 1.0f;
+
+  /**
+   * @brief Check if rasterizer is equal to another one
+   *
+   * @param rhs Other rasterizer
+   * @retval true Rasterizer is equal
+   * @retval false Rasterizer is not equal
+   */
+  bool operator==(const PipelineRasterizer &rhs) const = default;
 };
 
 enum class BlendFactor {
@@ -122,6 +140,15 @@ struct PipelineVertexInputBinding {
    * Vertex input rate
    */
   VertexInputRate inputRate = VertexInputRate::Vertex;
+
+  /**
+   * @brief Check if vertex input binding is equal to another one
+   *
+   * @param rhs Other vertex input binding
+   * @retval true Vertex input binding is equal
+   * @retval false Vertex input binding is not equal
+   */
+  bool operator==(const PipelineVertexInputBinding &rhs) const = default;
 };
 
 /**
@@ -147,6 +174,15 @@ struct PipelineVertexInputAttribute {
    * Attribute offset
    */
   u32 offset = 0;
+
+  /**
+   * @brief Check if vertex input attribute is equal to another one
+   *
+   * @param rhs Other vertex input attribute
+   * @retval true Vertex input attribute is equal
+   * @retval false Vertex input attribute is not equal
+   */
+  bool operator==(const PipelineVertexInputAttribute &rhs) const = default;
 };
 
 /**
@@ -162,6 +198,15 @@ struct PipelineVertexInputLayout {
    * Input layout attributes
    */
   std::vector<PipelineVertexInputAttribute> attributes;
+
+  /**
+   * @brief Check if vertex input layout is equal to another one
+   *
+   * @param rhs Other vertex input layout
+   * @retval true Vertex input layout is equal
+   * @retval false Vertex input layout is not equal
+   */
+  bool operator==(const PipelineVertexInputLayout &rhs) const = default;
 };
 
 /**
@@ -202,6 +247,15 @@ struct PipelineColorBlendAttachment {
    * Alpha blend operation
    */
   BlendOp alphaOp = BlendOp::Add;
+
+  /**
+   * @brief Check if color blend attachment is equal to another one
+   *
+   * @param rhs Other color blend attachment
+   * @retval true Color blend attachment is equal
+   * @retval false Color blend attachment is not equal
+   */
+  bool operator==(const PipelineColorBlendAttachment &rhs) const = default;
 };
 
 /**
@@ -212,6 +266,15 @@ struct PipelineColorBlend {
    * Color blend attachments
    */
   std::vector<PipelineColorBlendAttachment> attachments;
+
+  /**
+   * @brief Check if color blending is equal to another one
+   *
+   * @param rhs Other color blending
+   * @retval true Color blending is equal
+   * @retval false Color blending is not equal
+   */
+  bool operator==(const PipelineColorBlend &rhs) const = default;
 };
 
 /**
@@ -252,6 +315,15 @@ struct PipelineStencil {
    * Reference value
    */
   u32 reference = 0;
+
+  /**
+   * @brief Check if stencil description is equal to another one
+   *
+   * @param rhs Other stencil description
+   * @retval true Stencil description is equal
+   * @retval false Stencil description is not equal
+   */
+  bool operator==(const PipelineStencil &rhs) const = default;
 };
 
 /**
@@ -282,6 +354,15 @@ struct PipelineDepthStencil {
    * Back stencil
    */
   PipelineStencil back{};
+
+  /**
+   * @brief Check if depth stencil state is equal to another one
+   *
+   * @param rhs Other depth stencil state
+   * @retval true Depth stencil state is equal
+   * @retval false Depth stencil state is not equal
+   */
+  bool operator==(const PipelineDepthStencil &rhs) const = default;
 };
 
 /**
@@ -292,6 +373,15 @@ struct PipelineMultisample {
    * Sample count
    */
   u32 sampleCount = 1;
+
+  /**
+   * @brief Check if multisampling is equal to another one
+   *
+   * @param rhs Other multisampling
+   * @retval true Multisampling is equal
+   * @retval false Multisampling is not equal
+   */
+  bool operator==(const PipelineMultisample &rhs) const = default;
 };
 
 /**
@@ -347,6 +437,15 @@ struct GraphicsPipelineDescription {
    * Render pass
    */
   RenderPassHandle renderPass = RenderPassHandle::Null;
+
+  /**
+   * @brief Check if pipeline description is equal to another one
+   *
+   * @param rhs Other pipeline description
+   * @retval true Pipeline description is equal
+   * @retval false Pipeline description is not equal
+   */
+  bool operator==(const GraphicsPipelineDescription &rhs) const = default;
 };
 
 /**
@@ -362,6 +461,15 @@ struct ComputePipelineDescription {
    * Debug name
    */
   String debugName;
+
+  /**
+   * @brief Check if pipeline description is equal to another one
+   *
+   * @param rhs Other pipeline description
+   * @retval true Pipeline description is equal
+   * @retval false Pipeline description is not equal
+   */
+  bool operator==(const ComputePipelineDescription &rhs) const = default;
 };
 
 } // namespace quoll::rhi
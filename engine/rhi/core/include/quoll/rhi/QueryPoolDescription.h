@@ -0,0 +1,30 @@
+#pragma once
+
+namespace quoll::rhi {
+
+/**
+ * @brief Query types
+ */
+enum class QueryType { Timestamp };
+
+/**
+ * @brief Query pool description
+ */
+struct QueryPoolDescription {
+  /**
+   * Query type
+   */
+  QueryType type = QueryType::Timestamp;
+
+  /**
+   * Number of queries
+   */
+  u32 count = 0;
+
+  /**
+   * Debug name
+   */
+  String debugName;
+};
+
+} // namespace quoll::rhi
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "StageFlags.h"
+
+namespace quoll::rhi {
+
+/**
+ * @brief Device queue types
+ *
+ * Compute queue executes work asynchronously
+ * to the graphics queue
+ */
+enum class QueueType { Graphics, Compute };
+
+/**
+ * @brief Wait for queue submission
+ *
+ * Every queue has its own counter that is
+ * incremented on every submission. Commands
+ * of a submission that waits for another queue
+ * do not start executing the wait stage until
+ * counter of the other queue reaches the value.
+ */
+struct QueueWait {
+  /**
+   * Queue to wait for
+   */
+  QueueType queue = QueueType::Graphics;
+
+  /**
+   * Submission value to wait for
+   */
+  u64 value = 0;
+
+  /**
+   * Pipeline stages that wait for submission
+   */
+  PipelineStage stage = PipelineStage::None;
+};
+
+} // namespace quoll::rhi
@@ -70,13 +70,16 @@ public:
    * @param framebuffer Framebuffer
    * @param renderAreaOffset Render area offset
    * @param renderAreaSize Render area size
+   * @param contents Render pass contents
    */
-  inline void beginRenderPass(rhi::RenderPassHandle renderPass,
-                              FramebufferHandle framebuffer,
-                              const glm::ivec2 &renderAreaOffset,
-                              const glm::uvec2 &renderAreaSize) {
-    mNativeRenderCommandList->beginRenderPass(renderPass, framebuffer,
-                                              renderAreaOffset, renderAreaSize);
+  inline void
+  beginRenderPass(rhi::RenderPassHandle renderPass,
+                  FramebufferHandle framebuffer,
+                  const glm::ivec2 &renderAreaOffset,
+                  const glm::uvec2 &renderAreaSize,
+                  SubpassContents contents = SubpassContents::Inline) {
+    mNativeRenderCommandList->beginRenderPass(
+        renderPass, framebuffer, renderAreaOffset, renderAreaSize, contents);
   }
 
   /**
@@ -173,6 +176,20 @@ public:
                                           instanceCount, firstInstance);
   }
 
+  /**
+   * @brief Draw indexed with parameters from buffer
+   *
+   * @param buffer Buffer with indexed draw commands
+   * @param offset Offset of first command in buffer
+   * @param drawCount Number of draw commands
+   * @param stride Stride between draw commands
+   */
+  inline void drawIndexedIndirect(BufferHandle buffer, u64 offset,
+                                  u32 drawCount, u32 stride) {
+    mNativeRenderCommandList->drawIndexedIndirect(buffer, offset, drawCount,
+                                                  stride);
+  }
+
   /**
    * @brief Dispatch compute work
    *
@@ -261,6 +278,55 @@ public:
     mNativeRenderCommandList->blitTexture(source, destination, regions, filter);
   }
 
+  /**
+   * @brief Reset queries
+   *
+   * @param queryPool Query pool
+   * @param firstQuery First query index
+   * @param queryCount Number of queries
+   */
+  inline void resetQueryPool(QueryPoolHandle queryPool, u32 firstQuery,
+                             u32 queryCount) {
+    mNativeRenderCommandList->resetQueryPool(queryPool, firstQuery,
+                                             queryCount);
+  }
+
+  /**
+   * @brief Write timestamp
+   *
+   * @param queryPool Query pool
+   * @param query Query index
+   * @param stage Pipeline stage
+   */
+  inline void writeTimestamp(QueryPoolHandle queryPool, u32 query,
+                             PipelineStage stage) {
+    mNativeRenderCommandList->writeTimestamp(queryPool, query, stage);
+  }
+
+  /**
+   * @brief Execute secondary command lists
+   *
+   * Secondary command lists must be ended
+   * before they are executed
+   *
+   * @param commandLists Secondary command lists
+   */
+  inline void executeCommands(std::span<RenderCommandList *> commandLists) {
+    std::vector<NativeRenderCommandListInterface *> nativeCommandLists(
+        commandLists.size());
+    for (usize i = 0; i < commandLists.size(); ++i) {
+      nativeCommandLists.at(i) =
+          commandLists[i]->mNativeRenderCommandList.get();
+    }
+
+    mNativeRenderCommandList->executeCommands(nativeCommandLists);
+  }
+
+  /**
+   * @brief End secondary command list recording
+   */
+  inline void end() { mNativeRenderCommandList->end(); }
+
 private:
   std::unique_ptr<NativeRenderCommandListInterface> mNativeRenderCommandList;
 };
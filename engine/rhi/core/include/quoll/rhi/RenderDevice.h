@@ -4,6 +4,7 @@
 
 #include "DeviceStats.h"
 #include "RenderFrame.h"
+#include "QueueType.h"
 #include "Buffer.h"
 #include "Swapchain.h"
 
@@ -11,11 +12,13 @@
 #include "BufferDescription.h"
 #include "TextureDescription.h"
 #include "TextureViewDescription.h"
+#include "TextureUploadDescription.h"
 #include "ShaderDescription.h"
 #include "RenderPassDescription.h"
 #include "FramebufferDescription.h"
 #include "PipelineDescription.h"
 #include "SamplerDescription.h"
+#include "QueryPoolDescription.h"
 
 namespace quoll::rhi {
 
@@ -29,6 +32,12 @@ public:
    */
   static constexpr usize NumFrames = 2;
 
+  /**
+   * @brief Maximum number of threads
+   * that record secondary command lists
+   */
+  static constexpr u32 MaxRecordingThreads = 8;
+
 public:
   RenderDevice(const RenderDevice &) = delete;
   RenderDevice &operator=(const RenderDevice &) = delete;
@@ -59,6 +68,106 @@ public:
    */
   virtual void submitImmediate(RenderCommandList &commandList) = 0;
 
+  /**
+   * @brief Request secondary command list
+   *
+   * Secondary command list continues the render
+   * pass that is begun in the frame command list
+   * with secondary command list contents. Command
+   * lists are owned by the device and are reused
+   * in the next frame with the same frame index.
+   *
+   * Can be called from multiple threads as long
+   * as every thread uses its own thread index.
+   *
+   * @param threadIndex Recording thread index
+   * @param renderPass Render pass
+   * @param framebuffer Framebuffer
+   * @return Secondary command list
+   */
+  virtual RenderCommandList &
+  requestSecondaryCommandList(u32 threadIndex, RenderPassHandle renderPass,
+                              FramebufferHandle framebuffer) = 0;
+
+  /**
+   * @brief Check if device has async compute queue
+   *
+   * @retval true Device has async compute queue
+   * @retval false Device only has graphics queue
+   */
+  virtual bool hasAsyncCompute() const = 0;
+
+  /**
+   * @brief Request queue command list
+   *
+   * Queue command list is recorded and submitted
+   * in the current frame. Command lists are owned
+   * by the device and are reused in the next frame
+   * with the same frame index.
+   *
+   * @param queue Queue type
+   * @return Queue command list in recording state
+   */
+  virtual RenderCommandList &requestQueueCommandList(QueueType queue) = 0;
+
+  /**
+   * @brief Submit queue command list
+   *
+   * Submissions of every queue are executed in
+   * submission order. Frame command list is executed
+   * after all queue submissions of the frame.
+   *
+   * @param commandList Queue command list
+   * @param queue Queue type
+   * @param waits Submissions of other queues to wait for
+   * @return Submission value of the queue
+   */
+  virtual u64 submitQueueCommandList(RenderCommandList &commandList,
+                                     QueueType queue,
+                                     std::span<const QueueWait> waits) = 0;
+
+  /**
+   * @brief Upload data to texture
+   *
+   * Data is copied into staging memory and copy
+   * commands are added to the pending upload batch.
+   * Function does not wait for the copy. Frames and
+   * immediate submissions wait for all uploads that
+   * are submitted before them.
+   *
+   * @param description Texture upload description
+   * @return Upload value
+   */
+  virtual u64 uploadTexture(const TextureUploadDescription &description) = 0;
+
+  /**
+   * @brief Submit pending uploads
+   *
+   * @return Upload value of the last submitted upload
+   */
+  virtual u64 flushUploads() = 0;
+
+  /**
+   * @brief Check if upload is complete
+   *
+   * Does not submit pending uploads
+   *
+   * @param value Upload value
+   * @retval true Upload is complete
+   * @retval false Upload is pending or in flight
+   */
+  virtual bool isUploadComplete(u64 value) = 0;
+
+  /**
+   * @brief Wait for upload to complete
+   *
+   * Submits pending uploads if upload
+   * value is not submitted yet
+   *
+   * @param value Upload value
+   */
+  virtual void waitForUpload(u64 value) = 0;
+
   /**
    * @brief Begin frame
    *
@@ -92,6 +201,13 @@ public:
    */
   virtual const DeviceStats &getDeviceStats() const = 0;
 
+  /**
+   * @brief Get device stats
+   *
+   * @return Device stats
+   */
+  virtual DeviceStats &getDeviceStats() = 0;
+
   /**
    * @brief Destroy all resources in the device
    *
@@ -237,6 +353,9 @@ public:
   /**
    * @brief Create graphics pipeline
    *
+   * Can be called from multiple threads as long
+   * as every thread creates a different pipeline.
+   *
    * @param description Graphics pipeline description
    * @param handle Pipeline handle
    */
@@ -246,6 +365,9 @@ public:
   /**
    * @brief Create compute pipeline
    *
+   * Can be called from multiple threads as long
+   * as every thread creates a different pipeline.
+   *
    * @param description Compute pipeline description
    * @param handle Pipeline handle
    */
@@ -267,6 +389,37 @@ public:
    * @retval false Device does not have pipeline
    */
   virtual bool hasPipeline(PipelineHandle handle) = 0;
+
+  /**
+   * @brief Create query pool
+   *
+   * @param description Query pool description
+   * @return Query pool handle
+   */
+  virtual QueryPoolHandle
+  createQueryPool(const QueryPoolDescription &description) = 0;
+
+  /**
+   * @brief Destroy query pool
+   *
+   * @param handle Query pool handle
+   */
+  virtual void destroyQueryPool(QueryPoolHandle handle) = 0;
+
+  /**
+   * @brief Get query pool results
+   *
+   * Does not wait for the results. Timestamp
+   * results are converted to nanoseconds.
+   *
+   * @param handle Query pool handle
+   * @param firstQuery First query index
+   * @param results Query results
+   * @retval true All results are available
+   * @retval false Some results are not available
+   */
+  virtual bool getQueryPoolResults(QueryPoolHandle handle, u32 firstQuery,
+                                   std::span<u64> results) = 0;
 };
 
 } // namespace quoll::rhi
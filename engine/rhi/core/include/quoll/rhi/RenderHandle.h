@@ -20,6 +20,8 @@ enum class DescriptorLayoutHandle : u32 { Null = 0 };
 
 enum class DescriptorHandle : u32 { Null = 0 };
 
+enum class QueryPoolHandle : u32 { Null = 0 };
+
 /**
  * @brief Check if type equals any of the other types
  *
@@ -41,7 +43,8 @@ template <class THandle> constexpr inline bool isHandleValid(THandle handle) {
   static_assert(
       IsAnySame<THandle, ShaderHandle, BufferHandle, TextureHandle,
                 SamplerHandle, RenderPassHandle, FramebufferHandle,
-                PipelineHandle, DescriptorLayoutHandle, DescriptorHandle>,
+                PipelineHandle, DescriptorLayoutHandle, DescriptorHandle,
+                QueryPoolHandle>,
       "Type must be a render handle");
   return handle != THandle::Null;
 }
@@ -57,7 +60,8 @@ template <class THandle> constexpr inline u32 castHandleToUint(THandle handle) {
   static_assert(
       IsAnySame<THandle, ShaderHandle, BufferHandle, TextureHandle,
                 SamplerHandle, RenderPassHandle, FramebufferHandle,
-                PipelineHandle, DescriptorLayoutHandle, DescriptorHandle>,
+                PipelineHandle, DescriptorLayoutHandle, DescriptorHandle,
+                QueryPoolHandle>,
       "Type must be a render handle");
 
   return static_cast<u32>(handle);
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace quoll::rhi {
+
+/**
+ * @brief Render pass contents
+ *
+ * Render pass commands are either recorded
+ * inline in the command list or provided by
+ * secondary command lists
+ */
+enum class SubpassContents { Inline, SecondaryCommandLists };
+
+} // namespace quoll::rhi
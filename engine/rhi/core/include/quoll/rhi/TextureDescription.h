@@ -69,10 +69,47 @@ struct TextureDescription {
    */
   u32 samples = 1;
 
+  /**
+   * Allow other textures to alias memory of this texture
+   */
+  bool aliasable = false;
+
+  /**
+   * Texture whose memory is reused by this texture
+   *
+   * Aliased texture must be aliasable, must have
+   * the same format, usage, and sample count, and
+   * must not be larger than this texture. Contents
+   * of the texture are undefined at its first use.
+   */
+  TextureHandle aliasOf = TextureHandle::Null;
+
   /**
    * Debug name
    */
   String debugName;
 };
 
+/**
+ * @brief Get approximate memory size of texture
+ *
+ * Does not take alignment and padding
+ * requirements of the device into account
+ *
+ * @param description Texture description
+ * @return Memory size in bytes
+ */
+inline usize getTextureMemorySize(const TextureDescription &description) {
+  usize size = 0;
+  for (u32 level = 0; level < description.mipLevelCount; ++level) {
+    usize width = std::max(description.width >> level, 1u);
+    usize height = std::max(description.height >> level, 1u);
+    usize depth = std::max(description.depth >> level, 1u);
+    size += width * height * depth;
+  }
+
+  return size * description.layerCount * description.samples *
+         getFormatSize(description.format);
+}
+
 } // namespace quoll::rhi
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "RenderHandle.h"
+#include "ImageLayout.h"
+#include "CopyRegion.h"
+
+namespace quoll::rhi {
+
+/**
+ * @brief Texture upload description
+ */
+struct TextureUploadDescription {
+  /**
+   * Destination texture
+   */
+  TextureHandle texture = TextureHandle::Null;
+
+  /**
+   * Source data
+   *
+   * Data is copied into staging memory
+   * before upload function returns
+   */
+  const void *data = nullptr;
+
+  /**
+   * Source data size
+   */
+  usize size = 0;
+
+  /**
+   * Copy regions
+   *
+   * Buffer offsets are relative
+   * to the start of source data
+   */
+  std::vector<CopyRegion> regions;
+
+  /**
+   * Number of texture levels
+   */
+  u32 levelCount = 1;
+
+  /**
+   * Texture layout after upload
+   */
+  ImageLayout layout = ImageLayout::ShaderReadOnlyOptimal;
+};
+
+} // namespace quoll::rhi
@@ -16,8 +16,16 @@ void DeviceStats::resetCalls() {
   mDrawCallsCount = 0;
   mDrawnPrimitivesCount = 0;
   mCommandCallsCount = 0;
+  mUploadedBytes = 0;
 }
 
 void DeviceStats::addCommandCall() { mCommandCallsCount++; }
 
+void DeviceStats::addUploadedBytes(usize size) { mUploadedBytes += size; }
+
+void DeviceStats::setCullingResults(u32 visibleCount, u32 culledCount) {
+  mVisibleInstancesCount = visibleCount;
+  mCulledInstancesCount = culledCount;
+}
+
 } // namespace quoll::rhi
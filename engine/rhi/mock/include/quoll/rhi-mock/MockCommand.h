@@ -12,13 +12,17 @@ enum class MockCommandType {
   PushConstants,
   Draw,
   DrawIndexed,
+  DrawIndexedIndirect,
   Dispatch,
   SetViewport,
   SetScissor,
   PipelineBarrier,
   CopyTextureToBuffer,
   CopyBufferToTexture,
-  BlitTexture
+  BlitTexture,
+  ExecuteCommands,
+  ResetQueryPool,
+  WriteTimestamp
 };
 
 /**
@@ -64,6 +68,11 @@ struct MockCommandBeginRenderPass
    * Render area size
    */
   glm::uvec2 renderAreaSize;
+
+  /**
+   * Subpass contents
+   */
+  SubpassContents contents = SubpassContents::Inline;
 };
 
 /**
@@ -228,6 +237,32 @@ struct MockCommandDrawIndexed
   u32 firstInstance;
 };
 
+/**
+ * @brief Draw indexed indirect command
+ */
+struct MockCommandDrawIndexedIndirect
+    : public MockCommandTyped<MockCommandType::DrawIndexedIndirect> {
+  /**
+   * Buffer
+   */
+  BufferHandle buffer;
+
+  /**
+   * Offset
+   */
+  u64 offset;
+
+  /**
+   * Draw count
+   */
+  u32 drawCount;
+
+  /**
+   * Stride
+   */
+  u32 stride;
+};
+
 /**
  * @brief Dispatch command
  */
@@ -385,4 +420,60 @@ struct MockCommandBlitTexture
   Filter filter;
 };
 
+/**
+ * @brief Execute commands command
+ *
+ * Commands of executed command lists are
+ * recorded right after this command
+ */
+struct MockCommandExecuteCommands
+    : public MockCommandTyped<MockCommandType::ExecuteCommands> {
+  /**
+   * Number of executed command lists
+   */
+  u32 numCommandLists = 0;
+};
+
+/**
+ * @brief Reset query pool command
+ */
+struct MockCommandResetQueryPool
+    : public MockCommandTyped<MockCommandType::ResetQueryPool> {
+  /**
+   * Query pool
+   */
+  QueryPoolHandle queryPool = QueryPoolHandle::Null;
+
+  /**
+   * First query index
+   */
+  u32 firstQuery = 0;
+
+  /**
+   * Number of queries
+   */
+  u32 queryCount = 0;
+};
+
+/**
+ * @brief Write timestamp command
+ */
+struct MockCommandWriteTimestamp
+    : public MockCommandTyped<MockCommandType::WriteTimestamp> {
+  /**
+   * Query pool
+   */
+  QueryPoolHandle queryPool = QueryPoolHandle::Null;
+
+  /**
+   * Query index
+   */
+  u32 query = 0;
+
+  /**
+   * Pipeline stage
+   */
+  PipelineStage stage = PipelineStage::None;
+};
+
 } // namespace quoll::rhi
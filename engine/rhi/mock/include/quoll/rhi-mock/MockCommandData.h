@@ -45,7 +45,7 @@ struct MockBindings {
   IndexType indexType = IndexType::Uint16;
 };
 
-enum class DrawCallType { Draw, DrawIndexed };
+enum class DrawCallType { Draw, DrawIndexed, DrawIndexedIndirect };
 
 /**
  * @brief Mock draw call
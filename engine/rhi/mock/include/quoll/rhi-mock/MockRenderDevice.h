@@ -10,6 +10,53 @@
 
 namespace quoll::rhi {
 
+/**
+ * @brief Mock queue submission
+ */
+struct MockQueueSubmission {
+  /**
+   * Queue type
+   */
+  QueueType queue = QueueType::Graphics;
+
+  /**
+   * Submission value of the queue
+   */
+  u64 value = 0;
+
+  /**
+   * Submissions of other queues to wait for
+   */
+  std::vector<QueueWait> waits;
+
+  /**
+   * Submitted commands
+   */
+  MockCommandList commandList;
+};
+
+/**
+ * @brief Mock texture upload
+ */
+struct MockTextureUpload {
+  /**
+   * Upload description
+   *
+   * Data pointer is not valid after upload
+   */
+  TextureUploadDescription description;
+
+  /**
+   * Copy of uploaded data
+   */
+  std::vector<u8> data;
+
+  /**
+   * Upload value
+   */
+  u64 value = 0;
+};
+
 /**
  * @brief Mock render device
  */
@@ -45,6 +92,106 @@ public:
    */
   void submitImmediate(RenderCommandList &commandList) override;
 
+  /**
+   * @brief Request secondary command list
+   *
+   * @param threadIndex Recording thread index
+   * @param renderPass Render pass
+   * @param framebuffer Framebuffer
+   * @return Secondary command list
+   */
+  RenderCommandList &
+  requestSecondaryCommandList(u32 threadIndex, RenderPassHandle renderPass,
+                              FramebufferHandle framebuffer) override;
+
+  /**
+   * @brief Check if device has async compute queue
+   *
+   * @retval true Device has async compute queue
+   * @retval false Device only has graphics queue
+   */
+  inline bool hasAsyncCompute() const override { return mAsyncCompute; }
+
+  /**
+   * @brief Enable or disable async compute queue
+   *
+   * @param asyncCompute Async compute queue exists
+   */
+  inline void setAsyncCompute(bool asyncCompute) {
+    mAsyncCompute = asyncCompute;
+  }
+
+  /**
+   * @brief Request queue command list
+   *
+   * @param queue Queue type
+   * @return Queue command list
+   */
+  RenderCommandList &requestQueueCommandList(QueueType queue) override;
+
+  /**
+   * @brief Submit queue command list
+   *
+   * @param commandList Queue command list
+   * @param queue Queue type
+   * @param waits Submissions of other queues to wait for
+   * @return Submission value of the queue
+   */
+  u64 submitQueueCommandList(RenderCommandList &commandList, QueueType queue,
+                             std::span<const QueueWait> waits) override;
+
+  /**
+   * @brief Get queue submissions
+   *
+   * @return Queue submissions
+   */
+  inline const std::vector<MockQueueSubmission> &getQueueSubmissions() const {
+    return mQueueSubmissions;
+  }
+
+  /**
+   * @brief Upload data to texture
+   *
+   * @param description Texture upload description
+   * @return Upload value
+   */
+  u64 uploadTexture(const TextureUploadDescription &description) override;
+
+  /**
+   * @brief Submit pending uploads
+   *
+   * Mock device completes uploads
+   * as soon as they are submitted
+   *
+   * @return Upload value of the last submitted upload
+   */
+  u64 flushUploads() override;
+
+  /**
+   * @brief Check if upload is complete
+   *
+   * @param value Upload value
+   * @retval true Upload is submitted
+   * @retval false Upload is pending
+   */
+  bool isUploadComplete(u64 value) override;
+
+  /**
+   * @brief Wait for upload to complete
+   *
+   * @param value Upload value
+   */
+  void waitForUpload(u64 value) override;
+
+  /**
+   * @brief Get texture uploads
+   *
+   * @return Texture uploads
+   */
+  inline const std::vector<MockTextureUpload> &getTextureUploads() const {
+    return mTextureUploads;
+  }
+
   /**
    * @brief Begin frame
    *
@@ -78,6 +225,13 @@ public:
    */
   const DeviceStats &getDeviceStats() const override;
 
+  /**
+   * @brief Get device stats
+   *
+   * @return Device stats
+   */
+  DeviceStats &getDeviceStats() override;
+
   /**
    * @brief Destroy all resources
    */
@@ -189,6 +343,16 @@ public:
    */
   u32 getTextureUpdates(TextureHandle handle);
 
+  /**
+   * @brief Get memory size of aliased textures
+   *
+   * Aliased textures reuse memory of other textures;
+   * so, this is the memory saved by aliasing
+   *
+   * @return Memory size of aliased textures in bytes
+   */
+  usize getAliasedTextureMemorySize() const;
+
   /**
    * @brief Create texture view
    *
@@ -330,9 +494,69 @@ public:
     return mPipelines.exists(handle);
   }
 
+  /**
+   * @brief Get number of created pipelines
+   *
+   * Counts every pipeline creation including
+   * the ones that replace existing pipelines
+   *
+   * @return Number of created pipelines
+   */
+  inline usize getNumCreatedPipelines() const { return mNumCreatedPipelines; }
+
+  /**
+   * @brief Create query pool
+   *
+   * @param description Query pool description
+   * @return Query pool handle
+   */
+  QueryPoolHandle
+  createQueryPool(const QueryPoolDescription &description) override;
+
+  /**
+   * @brief Destroy query pool
+   *
+   * @param handle Query pool handle
+   */
+  void destroyQueryPool(QueryPoolHandle handle) override;
+
+  /**
+   * @brief Get query pool results
+   *
+   * Mock device returns synthetic timestamps
+   * that increase by a fixed interval for
+   * every query index
+   *
+   * @param handle Query pool handle
+   * @param firstQuery First query index
+   * @param results Query results
+   * @retval true Query pool exists
+   * @retval false Query pool does not exist
+   */
+  bool getQueryPoolResults(QueryPoolHandle handle, u32 firstQuery,
+                           std::span<u64> results) override;
+
+  /**
+   * @brief Check if device has query pool
+   *
+   * @param handle Query pool handle
+   * @retval true Device has query pool
+   * @retval false Device does not have query pool
+   */
+  inline bool hasQueryPool(QueryPoolHandle handle) const {
+    return mQueryPools.exists(handle);
+  }
+
+public:
+  /**
+   * Synthetic timestamp interval in nanoseconds
+   */
+  static constexpr u64 TimestampInterval = 100000;
+
 private:
   MockResourceMap<BufferHandle, std::unique_ptr<MockBuffer>> mBuffers;
   MockResourceMap<TextureHandle, MockTexture> mTextures;
+  std::unordered_map<TextureHandle, usize> mAliasedTextureSizes;
   MockResourceMap<SamplerHandle, SamplerDescription> mSamplers;
   MockResourceMap<FramebufferHandle, FramebufferDescription> mFramebuffers;
   MockResourceMap<RenderPassHandle, RenderPassDescription> mRenderPasses;
@@ -343,11 +567,33 @@ private:
   MockResourceMap<DescriptorHandle, std::unique_ptr<MockDescriptor>>
       mDescriptors;
   MockResourceMap<PipelineHandle, MockPipeline> mPipelines;
+  usize mNumCreatedPipelines = 0;
+  MockResourceMap<QueryPoolHandle, QueryPoolDescription> mQueryPools;
+  std::mutex mPipelineMutex;
 
   std::array<RenderCommandList, NumFrames> mCommandLists;
   std::vector<MockCommandList> mSubmittedCommandLists;
   u32 mFrameIndex = 0;
 
+  struct SecondaryCommandLists {
+    std::deque<RenderCommandList> commandLists;
+    usize used = 0;
+  };
+
+  std::array<std::array<SecondaryCommandLists, MaxRecordingThreads>, NumFrames>
+      mSecondaryCommandLists;
+
+  bool mAsyncCompute = true;
+  std::array<std::array<std::deque<RenderCommandList>, 2>, NumFrames>
+      mQueueCommandLists;
+  std::array<std::array<usize, 2>, NumFrames> mUsedQueueCommandLists{};
+  std::array<u64, 2> mQueueValues{};
+  std::vector<MockQueueSubmission> mQueueSubmissions;
+
+  std::vector<MockTextureUpload> mTextureUploads;
+  u64 mUploadValue = 0;
+  u64 mSubmittedUploadValue = 0;
+
   DeviceStats mDeviceStats;
 };
 
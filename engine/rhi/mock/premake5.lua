@@ -12,3 +12,8 @@ project "QuollRHIMock"
         "src/*.cpp", 
         "include/**.h"
     }
+
+function linkMockRHI()
+    links { "QuollRHIMock", "QuollRHICore" }
+    includedirs { "../engine/rhi/mock/include" }
+end
@@ -6,8 +6,10 @@ namespace quoll::rhi {
 MockBuffer::MockBuffer(const BufferDescription &description)
     : mDescription(description) {
   mData.resize(description.size);
-  const auto *data = static_cast<const u8 *>(description.data);
-  memcpy(mData.data(), data, description.size);
+  if (description.data) {
+    const auto *data = static_cast<const u8 *>(description.data);
+    memcpy(mData.data(), data, description.size);
+  }
 }
 
 void *MockBuffer::map() { return mData.data(); }
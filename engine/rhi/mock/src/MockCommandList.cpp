@@ -17,12 +17,14 @@ MockCommandList::MockCommandList(MockCommandList &&rhs) {
 void MockCommandList::beginRenderPass(rhi::RenderPassHandle renderPass,
                                       FramebufferHandle framebuffer,
                                       const glm::ivec2 &renderAreaOffset,
-                                      const glm::uvec2 &renderAreaSize) {
+                                      const glm::uvec2 &renderAreaSize,
+                                      SubpassContents contents) {
   auto *command = new MockCommandBeginRenderPass;
   command->renderPass = renderPass;
   command->framebuffer = framebuffer;
   command->renderAreaOffset = renderAreaOffset;
   command->renderAreaSize = renderAreaSize;
+  command->contents = contents;
   mCommands.push_back(std::unique_ptr<MockCommand>(command));
 
   mBindings.renderPass = renderPass;
@@ -125,6 +127,22 @@ void MockCommandList::drawIndexed(u32 indexCount, u32 firstIndex,
   mDrawCalls.push_back(call);
 }
 
+void MockCommandList::drawIndexedIndirect(BufferHandle buffer, u64 offset,
+                                          u32 drawCount, u32 stride) {
+  auto *command = new MockCommandDrawIndexedIndirect;
+  command->buffer = buffer;
+  command->offset = offset;
+  command->drawCount = drawCount;
+  command->stride = stride;
+  mCommands.push_back(std::unique_ptr<MockCommand>(command));
+
+  MockDrawCall call{};
+  call.type = DrawCallType::DrawIndexedIndirect;
+  call.bindings = mBindings;
+  call.command = command;
+  mDrawCalls.push_back(call);
+}
+
 void MockCommandList::dispatch(u32 groupCountX, u32 groupCountY,
                                u32 groupCountZ) {
   auto *command = new MockCommandDispatch;
@@ -195,6 +213,50 @@ void MockCommandList::blitTexture(TextureHandle source,
   mCommands.push_back(std::unique_ptr<MockCommand>(command));
 }
 
+void MockCommandList::executeCommands(
+    std::span<NativeRenderCommandListInterface *> commandLists) {
+  auto *command = new MockCommandExecuteCommands;
+  command->numCommandLists = static_cast<u32>(commandLists.size());
+  mCommands.push_back(std::unique_ptr<MockCommand>(command));
+
+  for (auto *nativeCommandList : commandLists) {
+    auto *commandList = static_cast<MockCommandList *>(nativeCommandList);
+
+    for (auto &secondaryCommand : commandList->mCommands) {
+      mCommands.push_back(std::move(secondaryCommand));
+    }
+
+    mDrawCalls.insert(mDrawCalls.end(), commandList->mDrawCalls.begin(),
+                      commandList->mDrawCalls.end());
+    mDispatchCalls.insert(mDispatchCalls.end(),
+                          commandList->mDispatchCalls.begin(),
+                          commandList->mDispatchCalls.end());
+    commandList->clear();
+  }
+}
+
+void MockCommandList::resetQueryPool(QueryPoolHandle queryPool,
+                                     u32 firstQuery, u32 queryCount) {
+  auto *command = new MockCommandResetQueryPool;
+  command->queryPool = queryPool;
+  command->firstQuery = firstQuery;
+  command->queryCount = queryCount;
+  mCommands.push_back(std::unique_ptr<MockCommand>(command));
+}
+
+void MockCommandList::writeTimestamp(QueryPoolHandle queryPool, u32 query,
+                                     PipelineStage stage) {
+  auto *command = new MockCommandWriteTimestamp;
+  command->queryPool = queryPool;
+  command->query = query;
+  command->stage = stage;
+  mCommands.push_back(std::unique_ptr<MockCommand>(command));
+}
+
+void MockCommandList::end() {
+  // Do nothing
+}
+
 void MockCommandList::clear() {
   mBindings = MockBindings{};
   mDrawCalls.clear();
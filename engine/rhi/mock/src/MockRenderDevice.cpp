@@ -15,20 +15,100 @@ RenderCommandList MockRenderDevice::requestImmediateCommandList() {
 }
 
 void MockRenderDevice::submitImmediate(RenderCommandList &commandList) {
+  flushUploads();
+
   auto *mockCommandList = static_cast<MockCommandList *>(
       commandList.getNativeRenderCommandList().get());
   mSubmittedCommandLists.push_back(std::move(*mockCommandList));
   mockCommandList->clear();
 }
 
+RenderCommandList &
+MockRenderDevice::requestSecondaryCommandList(u32 threadIndex,
+                                              RenderPassHandle renderPass,
+                                              FramebufferHandle framebuffer) {
+  QuollAssert(threadIndex < MaxRecordingThreads,
+              "Thread index must be less than max recording threads");
+
+  auto &secondary = mSecondaryCommandLists.at(mFrameIndex).at(threadIndex);
+  if (secondary.used == secondary.commandLists.size()) {
+    secondary.commandLists.push_back(RenderCommandList(new MockCommandList));
+  }
+
+  return secondary.commandLists.at(secondary.used++);
+}
+
+RenderCommandList &MockRenderDevice::requestQueueCommandList(QueueType queue) {
+  QuollAssert(queue == QueueType::Graphics || mAsyncCompute,
+              "Device does not have async compute queue");
+
+  auto queueIndex = static_cast<usize>(queue);
+  auto &commandLists = mQueueCommandLists.at(mFrameIndex).at(queueIndex);
+  auto &used = mUsedQueueCommandLists.at(mFrameIndex).at(queueIndex);
+  if (used == commandLists.size()) {
+    commandLists.push_back(RenderCommandList(new MockCommandList));
+  }
+
+  return commandLists.at(used++);
+}
+
+u64 MockRenderDevice::submitQueueCommandList(RenderCommandList &commandList,
+                                             QueueType queue,
+                                             std::span<const QueueWait> waits) {
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+
+  auto value = ++mQueueValues.at(static_cast<usize>(queue));
+  mQueueSubmissions.push_back({queue, value, {waits.begin(), waits.end()},
+                               std::move(*mockCommandList)});
+  mockCommandList->clear();
+
+  return value;
+}
+
+u64 MockRenderDevice::uploadTexture(
+    const TextureUploadDescription &description) {
+  const auto *data = static_cast<const u8 *>(description.data);
+
+  MockTextureUpload upload{description, {data, data + description.size},
+                           ++mUploadValue};
+  upload.description.data = nullptr;
+  mTextureUploads.push_back(std::move(upload));
+
+  return mUploadValue;
+}
+
+u64 MockRenderDevice::flushUploads() {
+  mSubmittedUploadValue = mUploadValue;
+  return mSubmittedUploadValue;
+}
+
+bool MockRenderDevice::isUploadComplete(u64 value) {
+  return value <= mSubmittedUploadValue;
+}
+
+void MockRenderDevice::waitForUpload(u64 value) {
+  if (value > mSubmittedUploadValue) {
+    flushUploads();
+  }
+}
+
 RenderFrame MockRenderDevice::beginFrame() {
   auto frameIndex = mFrameIndex;
   mFrameIndex = (mFrameIndex + 1) % NumFrames;
 
+  for (auto &secondary : mSecondaryCommandLists.at(mFrameIndex)) {
+    secondary.used = 0;
+  }
+
+  mUsedQueueCommandLists.at(mFrameIndex) = {};
+
   return RenderFrame{frameIndex, 0, mCommandLists.at(mFrameIndex)};
 }
 
 void MockRenderDevice::endFrame(const RenderFrame &renderFrame) {
+  flushUploads();
+
   auto *mockCommandList = static_cast<MockCommandList *>(
       renderFrame.commandList.getNativeRenderCommandList().get());
   mSubmittedCommandLists.push_back(std::move(*mockCommandList));
@@ -47,14 +127,18 @@ const DeviceStats &MockRenderDevice::getDeviceStats() const {
   return mDeviceStats;
 }
 
+DeviceStats &MockRenderDevice::getDeviceStats() { return mDeviceStats; }
+
 void MockRenderDevice::destroyResources() {
   mBuffers.clear();
   mTextures.clear();
+  mAliasedTextureSizes.clear();
   mFramebuffers.clear();
   mRenderPasses.clear();
   mShaders.clear();
   mDescriptorLayouts.clear();
   mDescriptors.clear();
+  mQueryPools.clear();
 }
 
 Swapchain MockRenderDevice::getSwapchain() { return Swapchain(); }
@@ -95,6 +179,26 @@ void MockRenderDevice::destroyBuffer(BufferHandle handle) {
 
 void MockRenderDevice::createTexture(const TextureDescription &description,
                                      TextureHandle handle) {
+  mAliasedTextureSizes.erase(handle);
+
+  if (isHandleValid(description.aliasOf)) {
+    QuollAssert(mTextures.exists(description.aliasOf),
+                "Aliased texture does not exist");
+    const auto &original = mTextures.at(description.aliasOf).getDescription();
+
+    QuollAssert(original.aliasable, "Aliased texture must be aliasable");
+    QuollAssert(original.format == description.format &&
+                    original.usage == description.usage &&
+                    original.samples == description.samples,
+                "Aliased texture must be compatible with texture");
+    QuollAssert(getTextureMemorySize(description) <=
+                    getTextureMemorySize(original),
+                "Texture must not be larger than aliased texture");
+
+    mAliasedTextureSizes.insert_or_assign(handle,
+                                          getTextureMemorySize(description));
+  }
+
   return mTextures.insert({description}, handle);
 }
 
@@ -119,6 +223,16 @@ MockRenderDevice::getTextureViewDescription(TextureHandle handle) const {
 
 void MockRenderDevice::destroyTexture(TextureHandle handle) {
   mTextures.erase(handle);
+  mAliasedTextureSizes.erase(handle);
+}
+
+usize MockRenderDevice::getAliasedTextureMemorySize() const {
+  usize size = 0;
+  for (auto [_, textureSize] : mAliasedTextureSizes) {
+    size += textureSize;
+  }
+
+  return size;
 }
 
 u32 MockRenderDevice::getTextureUpdates(TextureHandle handle) {
@@ -160,12 +274,16 @@ MockRenderDevice::getFramebufferDescription(FramebufferHandle handle) const {
 
 void MockRenderDevice::createPipeline(
     const GraphicsPipelineDescription &description, PipelineHandle handle) {
+  std::lock_guard lock(mPipelineMutex);
   mPipelines.insert({description}, handle);
+  mNumCreatedPipelines++;
 }
 
 void MockRenderDevice::createPipeline(
     const ComputePipelineDescription &description, PipelineHandle handle) {
+  std::lock_guard lock(mPipelineMutex);
   mPipelines.insert({description}, handle);
+  mNumCreatedPipelines++;
 }
 
 void MockRenderDevice::destroyPipeline(PipelineHandle handle) {
@@ -176,4 +294,27 @@ const MockPipeline &MockRenderDevice::getPipeline(PipelineHandle handle) const {
   return mPipelines.at(handle);
 }
 
+QueryPoolHandle
+MockRenderDevice::createQueryPool(const QueryPoolDescription &description) {
+  return mQueryPools.insert(description);
+}
+
+void MockRenderDevice::destroyQueryPool(QueryPoolHandle handle) {
+  mQueryPools.erase(handle);
+}
+
+bool MockRenderDevice::getQueryPoolResults(QueryPoolHandle handle,
+                                           u32 firstQuery,
+                                           std::span<u64> results) {
+  if (!mQueryPools.exists(handle)) {
+    return false;
+  }
+
+  for (usize i = 0; i < results.size(); ++i) {
+    results[i] = (firstQuery + i) * TimestampInterval;
+  }
+
+  return true;
+}
+
 } // namespace quoll::rhi
@@ -52,11 +52,13 @@ public:
    * @param framebuffer Framebuffer
    * @param renderAreaOffset Render area offset
    * @param renderAreaSize Render area size
+   * @param contents Subpass contents
    */
   void beginRenderPass(rhi::RenderPassHandle renderPass,
                        FramebufferHandle framebuffer,
                        const glm::ivec2 &renderAreaOffset,
-                       const glm::uvec2 &renderAreaSize) override;
+                       const glm::uvec2 &renderAreaSize,
+                       SubpassContents contents) override;
 
   /**
    * @brief End render pass
@@ -134,6 +136,17 @@ public:
   void drawIndexed(u32 indexCount, u32 firstIndex, i32 vertexOffset,
                    u32 instanceCount, u32 firstInstance) override;
 
+  /**
+   * @brief Draw indexed with parameters from buffer
+   *
+   * @param buffer Buffer with indexed draw commands
+   * @param offset Offset of first command in buffer
+   * @param drawCount Number of draw commands
+   * @param stride Stride between draw commands
+   */
+  void drawIndexedIndirect(BufferHandle buffer, u64 offset, u32 drawCount,
+                           u32 stride) override;
+
   /**
    * @brief Dispatch compute work
    *
@@ -203,6 +216,39 @@ public:
   void blitTexture(TextureHandle source, TextureHandle destination,
                    std::span<BlitRegion> regions, Filter filter) override;
 
+  /**
+   * @brief Execute secondary command lists
+   *
+   * @param commandLists Secondary command lists
+   */
+  void executeCommands(
+      std::span<NativeRenderCommandListInterface *> commandLists) override;
+
+  /**
+   * @brief Reset queries
+   *
+   * @param queryPool Query pool
+   * @param firstQuery First query index
+   * @param queryCount Number of queries
+   */
+  void resetQueryPool(QueryPoolHandle queryPool, u32 firstQuery,
+                      u32 queryCount) override;
+
+  /**
+   * @brief Write timestamp
+   *
+   * @param queryPool Query pool
+   * @param query Query index
+   * @param stage Pipeline stage
+   */
+  void writeTimestamp(QueryPoolHandle queryPool, u32 query,
+                      PipelineStage stage) override;
+
+  /**
+   * @brief End command list
+   */
+  void end() override;
+
 private:
   VkCommandBuffer mCommandBuffer = VK_NULL_HANDLE;
 
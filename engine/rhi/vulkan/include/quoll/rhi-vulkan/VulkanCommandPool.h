@@ -41,9 +41,11 @@ public:
    * @brief Create command buffers
    *
    * @param count Number of buffers
+   * @param level Command buffer level
    * @return List of render command lists
    */
-  std::vector<RenderCommandList> createCommandLists(u32 count);
+  std::vector<RenderCommandList> createCommandLists(
+      u32 count, VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
   /**
    * @brief Free command list
@@ -52,6 +54,11 @@ public:
    */
   void freeCommandList(RenderCommandList &commandList);
 
+  /**
+   * @brief Reset all command lists of the pool
+   */
+  void reset();
+
 private:
   VkCommandPool mCommandPool = VK_NULL_HANDLE;
   VulkanDeviceObject &mDevice;
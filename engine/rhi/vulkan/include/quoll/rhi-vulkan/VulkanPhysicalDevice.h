@@ -53,6 +53,15 @@ public:
    */
   inline const String &getName() const { return mName; }
 
+  /**
+   * @brief Get physical device properties
+   *
+   * @return Physical device properties
+   */
+  inline const VkPhysicalDeviceProperties &getProperties() const {
+    return mProperties;
+  }
+
   /**
    * @brief Get queue family indices
    *
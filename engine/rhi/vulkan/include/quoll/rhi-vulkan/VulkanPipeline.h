@@ -22,11 +22,13 @@ public:
    * @param device Vulkan device
    * @param registry Resource registry
    * @param pipelineLayoutCache Pipeline layout cache
+   * @param pipelineCache Vulkan pipeline cache
    */
   VulkanPipeline(const GraphicsPipelineDescription &description,
                  VulkanDeviceObject &device,
                  const VulkanResourceRegistry &registry,
-                 VulkanPipelineLayoutCache &pipelineLayoutCache);
+                 VulkanPipelineLayoutCache &pipelineLayoutCache,
+                 VkPipelineCache pipelineCache);
 
   /**
    * @brief Create compute pipeline
@@ -35,11 +37,13 @@ public:
    * @param device Vulkan device
    * @param registry Resource registry
    * @param pipelineLayoutCache Pipeline layout cache
+   * @param pipelineCache Vulkan pipeline cache
    */
   VulkanPipeline(const ComputePipelineDescription &description,
                  VulkanDeviceObject &device,
                  const VulkanResourceRegistry &registry,
-                 VulkanPipelineLayoutCache &pipelineLayoutCache);
+                 VulkanPipelineLayoutCache &pipelineLayoutCache,
+                 VkPipelineCache pipelineCache);
 
   /**
    * @brief Destructor
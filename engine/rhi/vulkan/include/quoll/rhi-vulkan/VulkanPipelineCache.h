@@ -0,0 +1,80 @@
+#pragma once
+
+#include "VulkanDeviceObject.h"
+#include "VulkanPhysicalDevice.h"
+
+namespace quoll::rhi {
+
+/**
+ * @brief Vulkan pipeline cache
+ *
+ * Loads pipeline cache data from disk on creation
+ * and stores it back on destruction. Cache file
+ * name contains pipeline cache UUID of the driver,
+ * so that every driver version has its own file.
+ */
+class VulkanPipelineCache {
+public:
+  /**
+   * @brief Create Vulkan pipeline cache
+   *
+   * @param device Vulkan device
+   * @param physicalDevice Vulkan physical device
+   * @param directory Directory of cache file
+   */
+  VulkanPipelineCache(VulkanDeviceObject &device,
+                      const VulkanPhysicalDevice &physicalDevice,
+                      const Path &directory);
+
+  /**
+   * @brief Save and destroy pipeline cache
+   */
+  ~VulkanPipelineCache();
+
+  VulkanPipelineCache(const VulkanPipelineCache &) = delete;
+  VulkanPipelineCache &operator=(const VulkanPipelineCache &) = delete;
+  VulkanPipelineCache(VulkanPipelineCache &&) = delete;
+  VulkanPipelineCache &operator=(VulkanPipelineCache &&) = delete;
+
+  /**
+   * @brief Save pipeline cache to disk
+   */
+  void save();
+
+  /**
+   * @brief Get Vulkan pipeline cache
+   *
+   * Vulkan pipeline caches are internally
+   * synchronized and can be used for creating
+   * pipelines from multiple threads
+   *
+   * @return Vulkan pipeline cache
+   */
+  inline VkPipelineCache getPipelineCache() const { return mPipelineCache; }
+
+  /**
+   * @brief Get cache file path
+   *
+   * @return Cache file path
+   */
+  inline const Path &getPath() const { return mPath; }
+
+private:
+  /**
+   * @brief Load cache data from disk
+   *
+   * Cache data is discarded if its header
+   * does not match the physical device
+   *
+   * @param properties Physical device properties
+   * @return Cache data
+   */
+  std::vector<u8> load(const VkPhysicalDeviceProperties &properties);
+
+private:
+  VulkanDeviceObject &mDevice;
+  VkPipelineCache mPipelineCache = VK_NULL_HANDLE;
+  Path mPath;
+};
+
+} // namespace quoll::rhi
@@ -16,6 +16,9 @@ namespace quoll::rhi {
  * or pipeline layouts if the provided
  * create information matches what's
  * already in the cache
+ *
+ * Descriptor layouts can be requested from
+ * multiple threads that create pipelines
  */
 class VulkanPipelineLayoutCache {
 public:
@@ -59,6 +62,7 @@ public:
    */
   inline VkDescriptorSetLayout
   getVulkanDescriptorSetLayout(DescriptorLayoutHandle handle) {
+    std::lock_guard lock(mMutex);
     return mDescriptorSetLayouts.at(static_cast<usize>(handle) - 1);
   }
 
@@ -93,6 +97,8 @@ private:
 
   std::vector<DescriptorLayoutDescription> mDescriptorLayoutDescriptions;
   std::vector<VkDescriptorSetLayout> mDescriptorSetLayouts;
+
+  std::mutex mMutex;
 };
 
 } // namespace quoll::rhi
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "quoll/rhi/QueryPoolDescription.h"
+
+namespace quoll::rhi {
+
+/**
+ * @brief Vulkan query pool
+ *
+ * Manages query pool lifecycle and
+ * reads back query results
+ */
+class VulkanQueryPool {
+public:
+  /**
+   * @brief Create Vulkan query pool
+   *
+   * @param description Query pool description
+   * @param device Vulkan device
+   * @param timestampPeriod Nanoseconds per timestamp tick
+   */
+  VulkanQueryPool(const QueryPoolDescription &description,
+                  VulkanDeviceObject &device, f32 timestampPeriod);
+
+  /**
+   * @brief Destroy Vulkan query pool
+   */
+  ~VulkanQueryPool();
+
+  VulkanQueryPool(const VulkanQueryPool &) = delete;
+  VulkanQueryPool &operator=(const VulkanQueryPool &) = delete;
+  VulkanQueryPool(VulkanQueryPool &&) = delete;
+  VulkanQueryPool &operator=(VulkanQueryPool &&) = delete;
+
+  /**
+   * @brief Get results
+   *
+   * @param firstQuery First query index
+   * @param results Query results
+   * @retval true All results are available
+   * @retval false Some results are not available
+   */
+  bool getResults(u32 firstQuery, std::span<u64> results);
+
+  /**
+   * @brief Get Vulkan query pool
+   *
+   * @return Vulkan query pool
+   */
+  inline VkQueryPool getQueryPool() const { return mQueryPool; }
+
+private:
+  QueryPoolDescription mDescription;
+
+  VulkanDeviceObject &mDevice;
+
+  VkQueryPool mQueryPool = VK_NULL_HANDLE;
+
+  f32 mTimestampPeriod = 1.0f;
+};
+
+} // namespace quoll::rhi
@@ -14,8 +14,9 @@ public:
    *
    * @param device Vulkan device object
    * @param queueIndex Queue index
+   * @param index Index of queue within the queue family
    */
-  VulkanQueue(VulkanDeviceObject &device, u32 queueIndex);
+  VulkanQueue(VulkanDeviceObject &device, u32 queueIndex, u32 index = 0);
 
   /**
    * @brief Get queue index
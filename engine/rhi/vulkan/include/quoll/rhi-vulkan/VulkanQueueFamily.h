@@ -11,6 +11,12 @@ namespace quoll::rhi {
  * different queue families
  */
 class VulkanQueueFamily {
+public:
+  /**
+   * Index of transfer queue in graphics family
+   */
+  static constexpr u32 TransferQueueIndex = 2;
+
 public:
   /**
    * @brief Default constructor
@@ -69,10 +75,37 @@ public:
    */
   inline u32 getTransferFamily() const { return mTransferFamily.value(); }
 
+  /**
+   * @brief Check if async compute queue is available
+   *
+   * Async compute queue is the second queue of
+   * graphics family. Since both queues are in the
+   * same family, resources do not need queue
+   * family ownership transfers.
+   *
+   * @retval true Graphics family has more than one queue
+   * @retval false Graphics family has one queue
+   */
+  inline bool hasAsyncCompute() const { return mGraphicsQueueCount > 1; }
+
+  /**
+   * @brief Check if transfer queue is available
+   *
+   * Transfer queue is the third queue of graphics
+   * family and is used for uploads.
+   *
+   * @retval true Graphics family has more than two queues
+   * @retval false Graphics family has two queues or less
+   */
+  inline bool hasTransferQueue() const {
+    return mGraphicsQueueCount > TransferQueueIndex;
+  }
+
 private:
   std::optional<u32> mGraphicsFamily;
   std::optional<u32> mPresentFamily;
   std::optional<u32> mTransferFamily;
+  u32 mGraphicsQueueCount = 0;
 };
 
 } // namespace quoll::rhi
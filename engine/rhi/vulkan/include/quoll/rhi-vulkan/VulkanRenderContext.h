@@ -59,8 +59,15 @@ public:
    * Ends command buffer and submits it to the graphics queue
    *
    * @param frameManager Frame manager
+   * @param waitSemaphoreInfos Semaphores to wait for in addition
+   *                           to image available semaphore
+   * @param signalSemaphoreInfos Semaphores to signal in addition
+   *                             to render finished semaphore
    */
-  void endRendering(VulkanFrameManager &frameManager);
+  void
+  endRendering(VulkanFrameManager &frameManager,
+               std::span<const VkSemaphoreSubmitInfo> waitSemaphoreInfos,
+               std::span<const VkSemaphoreSubmitInfo> signalSemaphoreInfos);
 
 private:
   std::vector<RenderCommandList> mRenderCommandLists;
@@ -6,6 +6,7 @@
 #include "VulkanPhysicalDevice.h"
 #include "VulkanDeviceObject.h"
 #include "VulkanQueue.h"
+#include "VulkanTimelineSemaphore.h"
 #include "VulkanRenderContext.h"
 #include "VulkanUploadContext.h"
 #include "VulkanRenderBackend.h"
@@ -13,6 +14,7 @@
 #include "VulkanResourceRegistry.h"
 #include "VulkanCommandPool.h"
 #include "VulkanPipelineLayoutCache.h"
+#include "VulkanPipelineCache.h"
 #include "VulkanDescriptorPool.h"
 #include "VulkanSwapchain.h"
 
@@ -46,6 +48,81 @@ public:
    */
   void submitImmediate(RenderCommandList &commandList) override;
 
+  /**
+   * @brief Request secondary command list
+   *
+   * @param threadIndex Recording thread index
+   * @param renderPass Render pass
+   * @param framebuffer Framebuffer
+   * @return Secondary command list
+   */
+  RenderCommandList &
+  requestSecondaryCommandList(u32 threadIndex, RenderPassHandle renderPass,
+                              FramebufferHandle framebuffer) override;
+
+  /**
+   * @brief Check if device has async compute queue
+   *
+   * @retval true Device has async compute queue
+   * @retval false Device only has graphics queue
+   */
+  bool hasAsyncCompute() const override;
+
+  /**
+   * @brief Request queue command list
+   *
+   * @param queue Queue type
+   * @return Queue command list
+   */
+  RenderCommandList &requestQueueCommandList(QueueType queue) override;
+
+  /**
+   * @brief Submit queue command list
+   *
+   * Every submission signals timeline semaphore
+   * of its queue. First compute submission of the
+   * frame waits for the previous frame because
+   * render graph resources are shared between frames.
+   *
+   * @param commandList Queue command list
+   * @param queue Queue type
+   * @param waits Submissions of other queues to wait for
+   * @return Submission value of the queue
+   */
+  u64 submitQueueCommandList(RenderCommandList &commandList, QueueType queue,
+                             std::span<const QueueWait> waits) override;
+
+  /**
+   * @brief Upload data to texture
+   *
+   * @param description Texture upload description
+   * @return Upload value
+   */
+  u64 uploadTexture(const TextureUploadDescription &description) override;
+
+  /**
+   * @brief Submit pending uploads
+   *
+   * @return Upload value of the last submitted upload
+   */
+  u64 flushUploads() override;
+
+  /**
+   * @brief Check if upload is complete
+   *
+   * @param value Upload value
+   * @retval true Upload is complete
+   * @retval false Upload is pending or in flight
+   */
+  bool isUploadComplete(u64 value) override;
+
+  /**
+   * @brief Wait for upload to complete
+   *
+   * @param value Upload value
+   */
+  void waitForUpload(u64 value) override;
+
   /**
    * @brief Begin frame
    *
@@ -100,6 +177,13 @@ public:
    */
   const DeviceStats &getDeviceStats() const override { return mStats; }
 
+  /**
+   * @brief Get device stats
+   *
+   * @return Device stats
+   */
+  DeviceStats &getDeviceStats() override { return mStats; }
+
   /**
    * @brief Create shader
    *
@@ -257,6 +341,42 @@ public:
    */
   bool hasPipeline(PipelineHandle handle) override;
 
+  /**
+   * @brief Create query pool
+   *
+   * @param description Query pool description
+   * @return Query pool handle
+   */
+  QueryPoolHandle
+  createQueryPool(const QueryPoolDescription &description) override;
+
+  /**
+   * @brief Destroy query pool
+   *
+   * @param handle Query pool handle
+   */
+  void destroyQueryPool(QueryPoolHandle handle) override;
+
+  /**
+   * @brief Get query pool results
+   *
+   * @param handle Query pool handle
+   * @param firstQuery First query index
+   * @param results Query results
+   * @retval true All results are available
+   * @retval false Some results are not available
+   */
+  bool getQueryPoolResults(QueryPoolHandle handle, u32 firstQuery,
+                           std::span<u64> results) override;
+
+private:
+  /**
+   * @brief Submit pending uploads and wait for them
+   *
+   * @param waitSemaphoreInfos Wait semaphore infos
+   */
+  void addUploadWait(std::vector<VkSemaphoreSubmitInfo> &waitSemaphoreInfos);
+
 private:
   VulkanRenderBackend &mBackend;
   VulkanPhysicalDevice mPhysicalDevice;
@@ -268,12 +388,37 @@ private:
   VulkanResourceAllocator mAllocator;
   VulkanResourceRegistry mRegistry;
   VulkanPipelineLayoutCache mPipelineLayoutCache;
+  VulkanPipelineCache mPipelineCache;
   VulkanDescriptorPool mDescriptorPool;
   VulkanCommandPool mCommandPool;
   VulkanRenderContext mRenderContext;
   VulkanUploadContext mUploadContext;
   VulkanSwapchain mSwapchain;
 
+  struct SecondaryCommandLists {
+    std::unique_ptr<VulkanCommandPool> pool;
+    std::deque<RenderCommandList> commandLists;
+    usize used = 0;
+  };
+
+  std::array<std::array<SecondaryCommandLists, MaxRecordingThreads>, NumFrames>
+      mSecondaryCommandLists;
+
+  std::unique_ptr<VulkanQueue> mComputeQueue;
+  std::array<std::unique_ptr<VulkanTimelineSemaphore>, 2> mQueueTimelines;
+
+  struct QueueCommandLists {
+    std::unique_ptr<VulkanCommandPool> pool;
+    std::deque<RenderCommandList> commandLists;
+    usize used = 0;
+  };
+
+  std::array<std::array<QueueCommandLists, 2>, NumFrames> mQueueCommandLists;
+  u64 mPreviousFrameValue = 0;
+  bool mComputeSubmittedInFrame = false;
+
+  std::mutex mPipelineMutex;
+
   DeviceStats mStats;
 };
 
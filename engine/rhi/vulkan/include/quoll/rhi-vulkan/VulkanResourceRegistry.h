@@ -12,6 +12,7 @@ class VulkanFramebuffer;
 class VulkanPipeline;
 class VulkanShader;
 class VulkanSampler;
+class VulkanQueryPool;
 
 /**
  * @brief Vulkan resource registry
@@ -53,6 +54,7 @@ class VulkanResourceRegistry {
   using RenderPassMap = ResourceMap<RenderPassHandle, VulkanRenderPass>;
   using FramebufferMap = ResourceMap<FramebufferHandle, VulkanFramebuffer>;
   using PipelineMap = ResourceMap<PipelineHandle, VulkanPipeline>;
+  using QueryPoolMap = ResourceMap<QueryPoolHandle, VulkanQueryPool>;
 
 public:
   /**
@@ -240,6 +242,30 @@ public:
    */
   inline const PipelineMap::Map &getPipelines() const { return mPipelines.map; }
 
+  /**
+   * @brief Add query pool
+   *
+   * @param queryPool Vulkan query pool
+   * @return Query pool handle
+   */
+  QueryPoolHandle setQueryPool(std::unique_ptr<VulkanQueryPool> &&queryPool);
+
+  /**
+   * @brief Delete query pool
+   *
+   * @param handle Query pool handle
+   */
+  void deleteQueryPool(QueryPoolHandle handle);
+
+  /**
+   * @brief Get query pools
+   *
+   * @return Query pools
+   */
+  inline const QueryPoolMap::Map &getQueryPools() const {
+    return mQueryPools.map;
+  }
+
 private:
   BufferMap mBuffers;
   TextureMap mTextures;
@@ -248,6 +274,7 @@ private:
   RenderPassMap mRenderPasses;
   FramebufferMap mFramebuffers;
   PipelineMap mPipelines;
+  QueryPoolMap mQueryPools;
 };
 
 } // namespace quoll::rhi
@@ -35,11 +35,16 @@ public:
   /**
    * @brief Create Vulkan texture
    *
+   * If texture aliases another texture, image
+   * is bound to the allocation of that texture
+   *
    * @param description Texture description
+   * @param registry Resource registry
    * @param allocator Vma allocator
    * @param device Vulkan device
    */
   VulkanTexture(const TextureDescription &description,
+                VulkanResourceRegistry &registry,
                 VulkanResourceAllocator &allocator, VulkanDeviceObject &device);
 
   /**
@@ -114,6 +119,7 @@ private:
   VkImageView mImageView = VK_NULL_HANDLE;
   VmaAllocation mAllocation = VK_NULL_HANDLE;
   VkImageAspectFlags mAspectFlags = VK_IMAGE_ASPECT_NONE;
+  bool mAliased = false;
   VulkanResourceAllocator &mAllocator;
   VulkanDeviceObject &mDevice;
   TextureDescription mDescription;
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "VulkanDeviceObject.h"
+
+namespace quoll::rhi {
+
+/**
+ * @brief Vulkan timeline semaphore
+ *
+ * Stores the value that is signaled by
+ * the last submission to the queue
+ */
+class VulkanTimelineSemaphore {
+public:
+  /**
+   * @brief Create Vulkan timeline semaphore
+   *
+   * @param device Vulkan device
+   */
+  VulkanTimelineSemaphore(VulkanDeviceObject &device);
+
+  /**
+   * @brief Destroy Vulkan timeline semaphore
+   */
+  ~VulkanTimelineSemaphore();
+
+  VulkanTimelineSemaphore(const VulkanTimelineSemaphore &) = delete;
+  VulkanTimelineSemaphore &operator=(const VulkanTimelineSemaphore &) = delete;
+  VulkanTimelineSemaphore(VulkanTimelineSemaphore &&) = delete;
+  VulkanTimelineSemaphore &operator=(VulkanTimelineSemaphore &&) = delete;
+
+  /**
+   * @brief Get Vulkan semaphore
+   *
+   * @return Vulkan semaphore
+   */
+  inline VkSemaphore getSemaphore() const { return mSemaphore; }
+
+  /**
+   * @brief Get last signal value
+   *
+   * @return Value signaled by last submission
+   */
+  inline u64 getValue() const { return mValue; }
+
+  /**
+   * @brief Get signal value for next submission
+   *
+   * @return Next signal value
+   */
+  inline u64 next() { return ++mValue; }
+
+  /**
+   * @brief Get value that is reached in device
+   *
+   * @return Completed value
+   */
+  u64 getCompletedValue() const;
+
+  /**
+   * @brief Wait for value to be reached in device
+   *
+   * @param value Value to wait for
+   */
+  void wait(u64 value) const;
+
+private:
+  VulkanDeviceObject &mDevice;
+
+  VkSemaphore mSemaphore = VK_NULL_HANDLE;
+  u64 mValue = 0;
+};
+
+} // namespace quoll::rhi
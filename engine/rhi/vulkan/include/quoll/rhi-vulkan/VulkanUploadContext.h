@@ -1,27 +1,59 @@
 #pragma once
 
+#include "quoll/rhi/TextureUploadDescription.h"
+
 #include "VulkanDeviceObject.h"
+#include "VulkanPhysicalDevice.h"
 #include "VulkanQueue.h"
-#include "VulkanCommandPool.h"
+#include "VulkanBuffer.h"
+#include "VulkanResourceAllocator.h"
+#include "VulkanResourceRegistry.h"
+#include "VulkanTimelineSemaphore.h"
 
 namespace quoll::rhi {
 
 /**
  * @brief Vulkan upload context
+ *
+ * Copies upload data into a persistently mapped
+ * staging ring buffer and records copy commands
+ * into upload batches. Batches are submitted to the
+ * transfer queue and signal a timeline semaphore,
+ * so that callers can poll uploads without waiting.
+ * Staging memory of a batch is reused after the
+ * batch is complete.
+ *
+ * Transfer queue is a separate queue of graphics
+ * family when one is available; so, textures do
+ * not need queue family ownership transfers.
  */
 class VulkanUploadContext {
-  using SubmitFn = std::function<void(VkCommandBuffer)>;
+public:
+  /**
+   * Staging ring buffer size
+   */
+  static constexpr usize StagingBufferSize = 64ull * 1024 * 1024;
+
+  /**
+   * Staging buffer offset alignment
+   */
+  static constexpr usize StagingAlignment = 16;
 
 public:
   /**
    * @brief Create upload context
    *
    * @param device Vulkan device
-   * @param pool Command pool
-   * @param queue Vulkan queue
+   * @param physicalDevice Vulkan physical device
+   * @param allocator Vulkan allocator
+   * @param registry Vulkan resource registry
+   * @param graphicsQueue Graphics queue
    */
-  VulkanUploadContext(VulkanDeviceObject &device, VulkanCommandPool &pool,
-                      VulkanQueue &queue);
+  VulkanUploadContext(VulkanDeviceObject &device,
+                      const VulkanPhysicalDevice &physicalDevice,
+                      VulkanResourceAllocator &allocator,
+                      const VulkanResourceRegistry &registry,
+                      VulkanQueue &graphicsQueue);
 
   /**
    * @brief Destroy upload context
@@ -34,23 +66,140 @@ public:
   VulkanUploadContext &operator=(VulkanUploadContext &&) = delete;
 
   /**
-   * @brief Submit for upload
+   * @brief Upload data to texture
+   *
+   * @param description Texture upload description
+   * @return Upload value
+   */
+  u64 uploadTexture(const TextureUploadDescription &description);
+
+  /**
+   * @brief Submit pending upload batch
+   *
+   * @return Upload value of the last submitted batch
+   */
+  u64 flush();
+
+  /**
+   * @brief Check if upload is complete
+   *
+   * @param value Upload value
+   * @retval true Upload is complete
+   * @retval false Upload is pending or in flight
+   */
+  bool isComplete(u64 value);
+
+  /**
+   * @brief Wait for upload to complete
+   *
+   * @param value Upload value
+   */
+  void wait(u64 value);
+
+  /**
+   * @brief Submit and wait for all uploads
+   */
+  void waitForIdle();
+
+  /**
+   * @brief Get timeline semaphore of uploads
    *
-   * @param submitFn Submit function
+   * @return Upload timeline semaphore
    */
-  void submit(const SubmitFn &submitFn) const;
+  inline const VulkanTimelineSemaphore &getTimeline() const {
+    return mTimeline;
+  }
+
+  /**
+   * @brief Check if uploads use dedicated queue
+   *
+   * @retval true Uploads are submitted to transfer queue
+   * @retval false Uploads are submitted to graphics queue
+   */
+  inline bool hasTransferQueue() const { return mTransferQueue != nullptr; }
 
 private:
   /**
-   * @brief Create upload fence
+   * @brief Upload batch
    */
-  void createFence();
+  struct Batch {
+    /**
+     * Command buffer
+     */
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+
+    /**
+     * Upload value that is signaled
+     * when batch is complete
+     */
+    u64 value = 0;
+
+    /**
+     * Used staging memory including padding
+     */
+    usize stagingSize = 0;
+
+    /**
+     * Staging buffers of uploads that
+     * do not fit into staging ring buffer
+     */
+    std::vector<std::unique_ptr<VulkanBuffer>> dedicatedBuffers;
+  };
+
+private:
+  /**
+   * @brief Submit pending batch to queue
+   */
+  void submitPendingBatch();
+
+  /**
+   * @brief Allocate staging memory
+   *
+   * Waits for in flight batches if
+   * staging ring buffer is full
+   *
+   * @param size Allocation size
+   * @return Offset in staging ring buffer
+   */
+  usize allocateStaging(usize size);
+
+  /**
+   * @brief Get pending batch
+   *
+   * Starts recording a new batch if
+   * there is no pending batch
+   *
+   * @return Pending batch
+   */
+  Batch &getPendingBatch();
+
+  /**
+   * @brief Release completed batches
+   *
+   * @param waitForOldest Wait for oldest in flight batch
+   */
+  void retire(bool waitForOldest);
 
 private:
-  VkFence mUploadFence = VK_NULL_HANDLE;
-  RenderCommandList mCommandList;
-  VulkanQueue &mQueue;
   VulkanDeviceObject &mDevice;
+  VulkanResourceAllocator &mAllocator;
+  const VulkanResourceRegistry &mRegistry;
+
+  std::unique_ptr<VulkanQueue> mTransferQueue;
+  VulkanQueue *mQueue = nullptr;
+  VkCommandPool mCommandPool = VK_NULL_HANDLE;
+  VulkanTimelineSemaphore mTimeline;
+
+  std::unique_ptr<VulkanBuffer> mStagingBuffer;
+  u8 *mStagingData = nullptr;
+  usize mStagingHead = 0;
+  usize mStagingUsed = 0;
+
+  std::optional<Batch> mPendingBatch;
+  std::deque<Batch> mInFlightBatches;
+  std::vector<VkCommandBuffer> mFreeCommandBuffers;
+
+  std::mutex mMutex;
 };
 
 } // namespace quoll::rhi
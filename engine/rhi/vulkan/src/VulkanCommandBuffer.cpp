@@ -6,7 +6,9 @@
 #include "VulkanRenderPass.h"
 #include "VulkanFramebuffer.h"
 #include "VulkanPipeline.h"
+#include "VulkanQueryPool.h"
 #include "VulkanMapping.h"
+#include "VulkanError.h"
 
 namespace quoll::rhi {
 
@@ -19,7 +21,8 @@ VulkanCommandBuffer::VulkanCommandBuffer(
 void VulkanCommandBuffer::beginRenderPass(rhi::RenderPassHandle renderPass,
                                           FramebufferHandle framebuffer,
                                           const glm::ivec2 &renderAreaOffset,
-                                          const glm::uvec2 &renderAreaSize) {
+                                          const glm::uvec2 &renderAreaSize,
+                                          SubpassContents contents) {
   const auto &vulkanRenderPass = mRegistry.getRenderPasses().at(renderPass);
 
   VkRenderPassBeginInfo beginInfo{};
@@ -34,7 +37,10 @@ void VulkanCommandBuffer::beginRenderPass(rhi::RenderPassHandle renderPass,
       static_cast<u32>(vulkanRenderPass->getClearValues().size());
   beginInfo.pClearValues = vulkanRenderPass->getClearValues().data();
 
-  vkCmdBeginRenderPass(mCommandBuffer, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+  vkCmdBeginRenderPass(mCommandBuffer, &beginInfo,
+                       contents == SubpassContents::SecondaryCommandLists
+                           ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+                           : VK_SUBPASS_CONTENTS_INLINE);
   mStats.addCommandCall();
 }
 
@@ -123,6 +129,16 @@ void VulkanCommandBuffer::drawIndexed(u32 indexCount, u32 firstIndex,
   mStats.addDrawCall((indexCount / 3) * instanceCount);
 }
 
+void VulkanCommandBuffer::drawIndexedIndirect(BufferHandle buffer, u64 offset,
+                                              u32 drawCount, u32 stride) {
+  const auto &vulkanBuffer = mRegistry.getBuffers().at(buffer);
+  vkCmdDrawIndexedIndirect(mCommandBuffer, vulkanBuffer->getBuffer(), offset,
+                           drawCount, stride);
+
+  // Primitive count is only known by the device
+  mStats.addDrawCall(0);
+}
+
 void VulkanCommandBuffer::dispatch(u32 groupCountX, u32 groupCountY,
                                    u32 groupCountZ) {
   vkCmdDispatch(mCommandBuffer, groupCountX, groupCountY, groupCountZ);
@@ -330,4 +346,39 @@ void VulkanCommandBuffer::blitTexture(TextureHandle source,
                  VulkanMapping::getFilter(filter));
 }
 
+void VulkanCommandBuffer::executeCommands(
+    std::span<NativeRenderCommandListInterface *> commandLists) {
+  std::vector<VkCommandBuffer> commandBuffers(commandLists.size());
+  for (usize i = 0; i < commandLists.size(); ++i) {
+    commandBuffers.at(i) =
+        dynamic_cast<VulkanCommandBuffer *>(commandLists[i])
+            ->getVulkanCommandBuffer();
+  }
+
+  vkCmdExecuteCommands(mCommandBuffer, static_cast<u32>(commandBuffers.size()),
+                       commandBuffers.data());
+  mStats.addCommandCall();
+}
+
+void VulkanCommandBuffer::resetQueryPool(QueryPoolHandle queryPool,
+                                         u32 firstQuery, u32 queryCount) {
+  vkCmdResetQueryPool(mCommandBuffer,
+                      mRegistry.getQueryPools().at(queryPool)->getQueryPool(),
+                      firstQuery, queryCount);
+  mStats.addCommandCall();
+}
+
+void VulkanCommandBuffer::writeTimestamp(QueryPoolHandle queryPool, u32 query,
+                                         PipelineStage stage) {
+  vkCmdWriteTimestamp2KHR(
+      mCommandBuffer, VulkanMapping::getPipelineStageFlags(stage),
+      mRegistry.getQueryPools().at(queryPool)->getQueryPool(), query);
+  mStats.addCommandCall();
+}
+
+void VulkanCommandBuffer::end() {
+  checkForVulkanError(vkEndCommandBuffer(mCommandBuffer),
+                      "Failed to end recording command buffer");
+}
+
 } // namespace quoll::rhi
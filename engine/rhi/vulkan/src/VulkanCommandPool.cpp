@@ -37,14 +37,14 @@ VulkanCommandPool::~VulkanCommandPool() {
 }
 
 std::vector<RenderCommandList>
-VulkanCommandPool::createCommandLists(u32 count) {
+VulkanCommandPool::createCommandLists(u32 count, VkCommandBufferLevel level) {
   std::vector<VkCommandBuffer> commandBuffers(count);
   std::vector<RenderCommandList> renderCommandLists(count);
 
   VkCommandBufferAllocateInfo allocInfo{};
   allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
   allocInfo.commandPool = mCommandPool;
-  allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+  allocInfo.level = level;
   allocInfo.commandBufferCount = count;
 
   checkForVulkanError(
@@ -72,4 +72,9 @@ void VulkanCommandPool::freeCommandList(RenderCommandList &commandList) {
   vkFreeCommandBuffers(mDevice, mCommandPool, 1, &commandBuffer);
 }
 
+void VulkanCommandPool::reset() {
+  checkForVulkanError(vkResetCommandPool(mDevice, mCommandPool, 0),
+                      "Failed to reset command pool");
+}
+
 } // namespace quoll::rhi
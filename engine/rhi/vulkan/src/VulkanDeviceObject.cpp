@@ -29,6 +29,11 @@ VulkanDeviceObject::VulkanDeviceObject(
     const VulkanPhysicalDevice &physicalDevice)
     : mPhysicalDevice(physicalDevice) {
   f32 queuePriority = 1.0f;
+
+  // Second queue of graphics family is used
+  // for async compute and third one for uploads
+  std::array<f32, 3> graphicsQueuePriorities{1.0f, 1.0f, 1.0f};
+
   VkDeviceQueueCreateInfo createGraphicsQueueInfo{};
   createGraphicsQueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
   createGraphicsQueueInfo.flags = 0;
@@ -36,7 +41,12 @@ VulkanDeviceObject::VulkanDeviceObject(
   createGraphicsQueueInfo.queueFamilyIndex =
       physicalDevice.getQueueFamilyIndices().getGraphicsFamily();
   createGraphicsQueueInfo.queueCount = 1;
-  createGraphicsQueueInfo.pQueuePriorities = &queuePriority;
+  if (physicalDevice.getQueueFamilyIndices().hasTransferQueue()) {
+    createGraphicsQueueInfo.queueCount = 3;
+  } else if (physicalDevice.getQueueFamilyIndices().hasAsyncCompute()) {
+    createGraphicsQueueInfo.queueCount = 2;
+  }
+  createGraphicsQueueInfo.pQueuePriorities = graphicsQueuePriorities.data();
 
   std::vector<VkDeviceQueueCreateInfo> queueInfos;
   queueInfos.push_back(createGraphicsQueueInfo);
@@ -88,10 +98,15 @@ VulkanDeviceObject::VulkanDeviceObject(
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES;
   bufferDeviceAddressFeatures.pNext = &descriptorIndexingFeatures;
 
+  VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphoreFeatures{};
+  timelineSemaphoreFeatures.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+  timelineSemaphoreFeatures.pNext = &bufferDeviceAddressFeatures;
+
   VkPhysicalDeviceSynchronization2Features sync2Features{};
   sync2Features.sType =
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES;
-  sync2Features.pNext = &bufferDeviceAddressFeatures;
+  sync2Features.pNext = &timelineSemaphoreFeatures;
 
   VkPhysicalDeviceFeatures2 deviceFeatures{};
   deviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
@@ -99,6 +114,8 @@ VulkanDeviceObject::VulkanDeviceObject(
   vkGetPhysicalDeviceFeatures2(physicalDevice, &deviceFeatures);
 
   assertFeature(sync2Features.synchronization2, "Synchronization 2");
+  assertFeature(timelineSemaphoreFeatures.timelineSemaphore,
+                "Timeline semaphore");
   assertFeature(bufferDeviceAddressFeatures.bufferDeviceAddress,
                 "Buffer device address > Buffer device address");
   assertFeature(descriptorIndexingFeatures.descriptorBindingPartiallyBound,
@@ -320,6 +320,8 @@ VkFormat VulkanMapping::getFormat(Format format) {
     return VK_FORMAT_D32_SFLOAT;
   case rhi::Format::Depth32FloatStencil8Uint:
     return VK_FORMAT_D32_SFLOAT_S8_UINT;
+  case rhi::Format::R32Float:
+    return VK_FORMAT_R32_SFLOAT;
   case rhi::Format::Undefined:
   default:
     QuollAssert(false, "Undefined format");
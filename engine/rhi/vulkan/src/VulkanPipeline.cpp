@@ -13,7 +13,8 @@ namespace quoll::rhi {
 VulkanPipeline::VulkanPipeline(const GraphicsPipelineDescription &description,
                                VulkanDeviceObject &device,
                                const VulkanResourceRegistry &registry,
-                               VulkanPipelineLayoutCache &pipelineLayoutCache)
+                               VulkanPipelineLayoutCache &pipelineLayoutCache,
+                               VkPipelineCache pipelineCache)
     : mDevice(device), mDebugName(description.debugName),
       mBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS) {
 
@@ -224,7 +225,7 @@ VulkanPipeline::VulkanPipeline(const GraphicsPipelineDescription &description,
   pipelineInfo.pDynamicState = &dynamicState;
 
   checkForVulkanError(
-      vkCreateGraphicsPipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo,
+      vkCreateGraphicsPipelines(mDevice, pipelineCache, 1, &pipelineInfo,
                                 nullptr, &mPipeline),
       "Failed to create graphics pipeline", description.debugName);
 
@@ -237,7 +238,8 @@ VulkanPipeline::VulkanPipeline(const GraphicsPipelineDescription &description,
 VulkanPipeline::VulkanPipeline(const ComputePipelineDescription &description,
                                VulkanDeviceObject &device,
                                const VulkanResourceRegistry &registry,
-                               VulkanPipelineLayoutCache &pipelineLayoutCache)
+                               VulkanPipelineLayoutCache &pipelineLayoutCache,
+                               VkPipelineCache pipelineCache)
     : mDevice(device), mDebugName(description.debugName),
       mBindPoint(VK_PIPELINE_BIND_POINT_COMPUTE) {
 
@@ -263,7 +265,7 @@ VulkanPipeline::VulkanPipeline(const ComputePipelineDescription &description,
   pipelineInfo.stage = stage;
 
   checkForVulkanError(
-      vkCreateComputePipelines(mDevice, VK_NULL_HANDLE, 1, &pipelineInfo,
+      vkCreateComputePipelines(mDevice, pipelineCache, 1, &pipelineInfo,
                                nullptr, &mPipeline),
       "Failed to create compute pipeline", description.debugName);
 
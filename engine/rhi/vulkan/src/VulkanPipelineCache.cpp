@@ -0,0 +1,121 @@
+#include "quoll/core/Base.h"
+#include "quoll/core/Engine.h"
+
+#include "VulkanHeaders.h"
+#include "VulkanPipelineCache.h"
+#include "VulkanError.h"
+#include "VulkanLog.h"
+
+namespace quoll::rhi {
+
+/**
+ * @brief Get cache file name from pipeline cache UUID
+ *
+ * @param uuid Pipeline cache UUID
+ * @return Cache file name
+ */
+static String getCacheFileName(const u8 (&uuid)[VK_UUID_SIZE]) {
+  std::stringstream ss;
+  ss << "pipeline-cache-";
+  for (usize i = 0; i < VK_UUID_SIZE; ++i) {
+    ss << std::hex << std::setw(2) << std::setfill('0')
+       << static_cast<u32>(uuid[i]);
+  }
+  ss << ".bin";
+
+  return ss.str();
+}
+
+VulkanPipelineCache::VulkanPipelineCache(
+    VulkanDeviceObject &device, const VulkanPhysicalDevice &physicalDevice,
+    const Path &directory)
+    : mDevice(device) {
+  const auto &properties = physicalDevice.getProperties();
+  mPath = directory / getCacheFileName(properties.pipelineCacheUUID);
+
+  auto data = load(properties);
+
+  VkPipelineCacheCreateInfo createInfo{};
+  createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  createInfo.pNext = nullptr;
+  createInfo.flags = 0;
+  createInfo.initialDataSize = data.size();
+  createInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+  checkForVulkanError(
+      vkCreatePipelineCache(mDevice, &createInfo, nullptr, &mPipelineCache),
+      "Failed to create pipeline cache");
+
+  LOG_DEBUG_VK("Pipeline cache created. Loaded bytes: " << data.size(),
+               mPipelineCache);
+}
+
+VulkanPipelineCache::~VulkanPipelineCache() {
+  if (mPipelineCache) {
+    save();
+    vkDestroyPipelineCache(mDevice, mPipelineCache, nullptr);
+    LOG_DEBUG_VK("Pipeline cache destroyed", mPipelineCache);
+  }
+}
+
+void VulkanPipelineCache::save() {
+  usize size = 0;
+  checkForVulkanError(
+      vkGetPipelineCacheData(mDevice, mPipelineCache, &size, nullptr),
+      "Failed to get pipeline cache size");
+
+  std::vector<u8> data(size);
+  checkForVulkanError(
+      vkGetPipelineCacheData(mDevice, mPipelineCache, &size, data.data()),
+      "Failed to get pipeline cache data");
+
+  std::ofstream stream(mPath, std::ios::binary | std::ios::trunc);
+  if (!stream.good()) {
+    Engine::getLogger().warning()
+        << "Cannot write pipeline cache: " << mPath.string();
+    return;
+  }
+
+  stream.write(reinterpret_cast<const char *>(data.data()),
+               static_cast<std::streamsize>(size));
+
+  LOG_DEBUG_VK("Pipeline cache saved. Bytes: " << size, mPipelineCache);
+}
+
+std::vector<u8>
+VulkanPipelineCache::load(const VkPhysicalDeviceProperties &properties) {
+  std::ifstream stream(mPath, std::ios::binary | std::ios::ate);
+  if (!stream.good()) {
+    return {};
+  }
+
+  auto size = static_cast<usize>(stream.tellg());
+  if (size < sizeof(VkPipelineCacheHeaderVersionOne)) {
+    return {};
+  }
+
+  std::vector<u8> data(size);
+  stream.seekg(0, std::ios::beg);
+  stream.read(reinterpret_cast<char *>(data.data()),
+              static_cast<std::streamsize>(size));
+
+  // Some drivers do not validate the data they
+  // are given, so stale caches are rejected here
+  VkPipelineCacheHeaderVersionOne header{};
+  memcpy(&header, data.data(), sizeof(VkPipelineCacheHeaderVersionOne));
+
+  if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+      header.vendorID != properties.vendorID ||
+      header.deviceID != properties.deviceID ||
+      memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID,
+             VK_UUID_SIZE) != 0) {
+    Engine::getLogger().warning()
+        << "Pipeline cache does not match the device and is ignored: "
+        << mPath.string();
+    return {};
+  }
+
+  return data;
+}
+
+} // namespace quoll::rhi
@@ -43,6 +43,8 @@ VulkanPipelineLayoutCache::~VulkanPipelineLayoutCache() {
 
 DescriptorLayoutHandle VulkanPipelineLayoutCache::getOrCreateDescriptorLayout(
     const DescriptorLayoutDescription &description) {
+  std::lock_guard lock(mMutex);
+
   for (usize i = 0; i < mDescriptorLayoutDescriptions.size(); ++i) {
     const auto &existing = mDescriptorLayoutDescriptions.at(i);
     if (existing.bindings.size() != description.bindings.size()) {
@@ -68,6 +70,7 @@ DescriptorLayoutHandle VulkanPipelineLayoutCache::getOrCreateDescriptorLayout(
 }
 
 void VulkanPipelineLayoutCache::clear() {
+  std::lock_guard lock(mMutex);
   destroyAllDescriptorLayouts();
 
   mDescriptorSetLayouts.clear();
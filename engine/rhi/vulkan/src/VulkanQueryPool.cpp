@@ -0,0 +1,60 @@
+#include "quoll/core/Base.h"
+
+#include "VulkanHeaders.h"
+#include "VulkanDeviceObject.h"
+#include "VulkanQueryPool.h"
+#include "VulkanError.h"
+
+namespace quoll::rhi {
+
+VulkanQueryPool::VulkanQueryPool(const QueryPoolDescription &description,
+                                 VulkanDeviceObject &device,
+                                 f32 timestampPeriod)
+    : mDescription(description), mDevice(device),
+      mTimestampPeriod(timestampPeriod) {
+  VkQueryPoolCreateInfo createInfo{};
+  createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+  createInfo.flags = 0;
+  createInfo.pNext = nullptr;
+  createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+  createInfo.queryCount = description.count;
+
+  checkForVulkanError(
+      vkCreateQueryPool(mDevice, &createInfo, nullptr, &mQueryPool),
+      "Failed to create query pool", description.debugName);
+
+  mDevice.setObjectName(description.debugName + " query pool",
+                        VK_OBJECT_TYPE_QUERY_POOL,
+                        static_cast<void *>(mQueryPool));
+}
+
+VulkanQueryPool::~VulkanQueryPool() {
+  vkDestroyQueryPool(mDevice, mQueryPool, nullptr);
+}
+
+bool VulkanQueryPool::getResults(u32 firstQuery, std::span<u64> results) {
+  QuollAssert(firstQuery + results.size() <= mDescription.count,
+              "Query range is out of bounds");
+
+  auto result = vkGetQueryPoolResults(
+      mDevice, mQueryPool, firstQuery, static_cast<u32>(results.size()),
+      results.size_bytes(), results.data(), sizeof(u64),
+      VK_QUERY_RESULT_64_BIT);
+
+  if (result == VK_NOT_READY) {
+    return false;
+  }
+
+  checkForVulkanError(result, "Failed to get query pool results",
+                      mDescription.debugName);
+
+  if (mDescription.type == QueryType::Timestamp) {
+    for (auto &value : results) {
+      value = static_cast<u64>(static_cast<f64>(value) * mTimestampPeriod);
+    }
+  }
+
+  return true;
+}
+
+} // namespace quoll::rhi
@@ -5,9 +5,10 @@
 
 namespace quoll::rhi {
 
-VulkanQueue::VulkanQueue(VulkanDeviceObject &device, u32 queueIndex)
+VulkanQueue::VulkanQueue(VulkanDeviceObject &device, u32 queueIndex,
+                         u32 index)
     : mQueueIndex(queueIndex) {
-  vkGetDeviceQueue(device, mQueueIndex, 0, &mQueue);
+  vkGetDeviceQueue(device, mQueueIndex, index, &mQueue);
 }
 
 void VulkanQueue::submit(
@@ -16,6 +16,7 @@ VulkanQueueFamily::VulkanQueueFamily(VkPhysicalDevice device,
   for (u32 i = 0; i < queueFamilies.size(); ++i) {
     if (queueFamilies.at(i).queueFlags & VK_QUEUE_GRAPHICS_BIT) {
       mGraphicsFamily = i;
+      mGraphicsQueueCount = queueFamilies.at(i).queueCount;
     }
 
     if (queueFamilies.at(i).queueFlags & VK_QUEUE_TRANSFER_BIT) {
@@ -58,7 +58,10 @@ VulkanRenderContext::beginRendering(VulkanFrameManager &frameManager) {
   return mRenderCommandLists.at(frameManager.getCurrentFrameIndex());
 }
 
-void VulkanRenderContext::endRendering(VulkanFrameManager &frameManager) {
+void VulkanRenderContext::endRendering(
+    VulkanFrameManager &frameManager,
+    std::span<const VkSemaphoreSubmitInfo> waitSemaphoreInfos,
+    std::span<const VkSemaphoreSubmitInfo> signalSemaphoreInfos) {
   auto *commandBuffer =
       dynamic_cast<rhi::VulkanCommandBuffer *>(
           mRenderCommandLists.at(frameManager.getCurrentFrameIndex())
@@ -92,12 +95,17 @@ void VulkanRenderContext::endRendering(VulkanFrameManager &frameManager) {
 
   std::array<VkCommandBufferSubmitInfo, 1> commandBufferInfos{
       commandBufferInfo};
-  std::array<VkSemaphoreSubmitInfo, 1> waitSemaphoreInfos{waitSemaphoreInfo};
-  std::array<VkSemaphoreSubmitInfo, 1> signalSemaphoreInfos{
-      signalSemaphoreInfo};
+
+  std::vector<VkSemaphoreSubmitInfo> waits{waitSemaphoreInfo};
+  waits.insert(waits.end(), waitSemaphoreInfos.begin(),
+               waitSemaphoreInfos.end());
+
+  std::vector<VkSemaphoreSubmitInfo> signals{signalSemaphoreInfo};
+  signals.insert(signals.end(), signalSemaphoreInfos.begin(),
+                 signalSemaphoreInfos.end());
 
   mGraphicsQueue.submit(frameManager.getFrameFence(), commandBufferInfos,
-                        waitSemaphoreInfos, signalSemaphoreInfos);
+                        waits, signals);
 }
 
 } // namespace quoll::rhi
@@ -12,7 +12,9 @@
 #include "VulkanPipeline.h"
 #include "VulkanShader.h"
 #include "VulkanCommandBuffer.h"
+#include "VulkanQueryPool.h"
 #include "VulkanResourceMetrics.h"
+#include "VulkanMapping.h"
 
 #include "VulkanError.h"
 
@@ -25,6 +27,8 @@ VulkanRenderDevice::VulkanRenderDevice(
                    mPhysicalDevice.getQueueFamilyIndices().getGraphicsFamily(),
                    mRegistry, mDescriptorPool, mStats),
       mDevice(mPhysicalDevice), mPipelineLayoutCache(mDevice),
+      mPipelineCache(mDevice, mPhysicalDevice,
+                     std::filesystem::current_path()),
       mDescriptorPool(mDevice, mRegistry, mPipelineLayoutCache),
       mGraphicsQueue(
           mDevice, mPhysicalDevice.getQueueFamilyIndices().getGraphicsFamily()),
@@ -32,11 +36,40 @@ VulkanRenderDevice::VulkanRenderDevice(
                     mPhysicalDevice.getQueueFamilyIndices().getPresentFamily()),
       mFrameManager(mDevice),
       mRenderContext(mDevice, mCommandPool, mGraphicsQueue, mPresentQueue),
-      mUploadContext(mDevice, mCommandPool, mGraphicsQueue),
+      mUploadContext(mDevice, mPhysicalDevice, mAllocator, mRegistry,
+                     mGraphicsQueue),
       mSwapchain(mBackend, mPhysicalDevice, mDevice, mRegistry, mAllocator),
       mAllocator(mBackend, mPhysicalDevice, mDevice),
       mStats(new VulkanResourceMetrics(mRegistry, mDescriptorPool)) {
 
+  // Every recording thread gets its own pool per frame
+  // because command pools are not thread safe
+  for (auto &frameCommandLists : mSecondaryCommandLists) {
+    for (auto &secondary : frameCommandLists) {
+      secondary.pool = std::make_unique<VulkanCommandPool>(
+          mDevice, mPhysicalDevice.getQueueFamilyIndices().getGraphicsFamily(),
+          mRegistry, mDescriptorPool, mStats);
+    }
+  }
+
+  if (mPhysicalDevice.getQueueFamilyIndices().hasAsyncCompute()) {
+    mComputeQueue = std::make_unique<VulkanQueue>(
+        mDevice, mPhysicalDevice.getQueueFamilyIndices().getGraphicsFamily(),
+        1);
+  }
+
+  for (auto &timeline : mQueueTimelines) {
+    timeline = std::make_unique<VulkanTimelineSemaphore>(mDevice);
+  }
+
+  for (auto &frameCommandLists : mQueueCommandLists) {
+    for (auto &queueCommandLists : frameCommandLists) {
+      queueCommandLists.pool = std::make_unique<VulkanCommandPool>(
+          mDevice, mPhysicalDevice.getQueueFamilyIndices().getGraphicsFamily(),
+          mRegistry, mDescriptorPool, mStats);
+    }
+  }
+
   VkDevice device = mDevice.getVulkanHandle();
   VkPhysicalDevice physicalDeviceHandle = mPhysicalDevice.getVulkanHandle();
   VkQueue graphicsQueue = mGraphicsQueue.getVulkanHandle();
@@ -80,10 +113,184 @@ void VulkanRenderDevice::submitImmediate(RenderCommandList &commandList) {
   std::array<VkCommandBufferSubmitInfo, 1> commandBufferInfos{
       commandBufferInfo};
 
-  mGraphicsQueue.submit(VK_NULL_HANDLE, commandBufferInfos, {}, {});
+  std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos;
+  addUploadWait(waitSemaphoreInfos);
+
+  mGraphicsQueue.submit(VK_NULL_HANDLE, commandBufferInfos, waitSemaphoreInfos,
+                        {});
   mGraphicsQueue.waitForIdle();
 }
 
+RenderCommandList &
+VulkanRenderDevice::requestSecondaryCommandList(u32 threadIndex,
+                                                RenderPassHandle renderPass,
+                                                FramebufferHandle framebuffer) {
+  QuollAssert(threadIndex < MaxRecordingThreads,
+              "Thread index must be less than max recording threads");
+
+  auto &secondary = mSecondaryCommandLists.at(
+      mFrameManager.getCurrentFrameIndex())[threadIndex];
+  if (secondary.used == secondary.commandLists.size()) {
+    secondary.commandLists.push_back(std::move(
+        secondary.pool->createCommandLists(1, VK_COMMAND_BUFFER_LEVEL_SECONDARY)
+            .at(0)));
+  }
+
+  auto &commandList = secondary.commandLists.at(secondary.used++);
+  auto *commandBuffer = dynamic_cast<rhi::VulkanCommandBuffer *>(
+                            commandList.getNativeRenderCommandList().get())
+                            ->getVulkanCommandBuffer();
+
+  VkCommandBufferInheritanceInfo inheritanceInfo{};
+  inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+  inheritanceInfo.renderPass =
+      mRegistry.getRenderPasses().at(renderPass)->getRenderPass();
+  inheritanceInfo.subpass = 0;
+  inheritanceInfo.framebuffer =
+      mRegistry.getFramebuffers().at(framebuffer)->getFramebuffer();
+
+  VkCommandBufferBeginInfo beginInfo{};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                    VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+  beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+  checkForVulkanError(vkBeginCommandBuffer(commandBuffer, &beginInfo),
+                      "Failed to begin recording secondary command buffer");
+
+  return commandList;
+}
+
+bool VulkanRenderDevice::hasAsyncCompute() const {
+  return mComputeQueue != nullptr;
+}
+
+RenderCommandList &
+VulkanRenderDevice::requestQueueCommandList(QueueType queue) {
+  QuollAssert(queue == QueueType::Graphics || hasAsyncCompute(),
+              "Device does not have async compute queue");
+
+  auto &queueCommandLists =
+      mQueueCommandLists.at(mFrameManager.getCurrentFrameIndex())
+          .at(static_cast<usize>(queue));
+  if (queueCommandLists.used == queueCommandLists.commandLists.size()) {
+    queueCommandLists.commandLists.push_back(
+        std::move(queueCommandLists.pool->createCommandLists(1).at(0)));
+  }
+
+  auto &commandList =
+      queueCommandLists.commandLists.at(queueCommandLists.used++);
+  auto *commandBuffer = dynamic_cast<rhi::VulkanCommandBuffer *>(
+                            commandList.getNativeRenderCommandList().get())
+                            ->getVulkanCommandBuffer();
+
+  VkCommandBufferBeginInfo beginInfo{};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+  beginInfo.pInheritanceInfo = nullptr;
+
+  checkForVulkanError(vkBeginCommandBuffer(commandBuffer, &beginInfo),
+                      "Failed to begin recording queue command buffer");
+
+  return commandList;
+}
+
+/**
+ * @brief Create timeline semaphore submit info
+ *
+ * @param semaphore Timeline semaphore
+ * @param value Timeline value
+ * @param stage Pipeline stage
+ * @return Semaphore submit info
+ */
+static VkSemaphoreSubmitInfo
+getTimelineSubmitInfo(const VulkanTimelineSemaphore &semaphore, u64 value,
+                      VkPipelineStageFlags2 stage) {
+  VkSemaphoreSubmitInfo submitInfo{};
+  submitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+  submitInfo.pNext = nullptr;
+  submitInfo.semaphore = semaphore.getSemaphore();
+  submitInfo.value = value;
+  submitInfo.stageMask = stage;
+  submitInfo.deviceIndex = 0;
+  return submitInfo;
+}
+
+u64 VulkanRenderDevice::submitQueueCommandList(
+    RenderCommandList &commandList, QueueType queue,
+    std::span<const QueueWait> waits) {
+  QUOLL_PROFILE_EVENT("VulkanRenderDevice::submitQueueCommandList");
+
+  auto *commandBuffer = dynamic_cast<rhi::VulkanCommandBuffer *>(
+                            commandList.getNativeRenderCommandList().get())
+                            ->getVulkanCommandBuffer();
+
+  vkEndCommandBuffer(commandBuffer);
+
+  VkCommandBufferSubmitInfo commandBufferInfo{};
+  commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+  commandBufferInfo.pNext = nullptr;
+  commandBufferInfo.commandBuffer = commandBuffer;
+  commandBufferInfo.deviceMask = 0;
+
+  std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos;
+  for (const auto &wait : waits) {
+    waitSemaphoreInfos.push_back(getTimelineSubmitInfo(
+        *mQueueTimelines.at(static_cast<usize>(wait.queue)), wait.value,
+        VulkanMapping::getPipelineStageFlags(wait.stage)));
+  }
+
+  addUploadWait(waitSemaphoreInfos);
+
+  if (queue == QueueType::Compute && !mComputeSubmittedInFrame) {
+    waitSemaphoreInfos.push_back(getTimelineSubmitInfo(
+        *mQueueTimelines.at(static_cast<usize>(QueueType::Graphics)),
+        mPreviousFrameValue, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+    mComputeSubmittedInFrame = true;
+  }
+
+  auto &timeline = *mQueueTimelines.at(static_cast<usize>(queue));
+  auto value = timeline.next();
+
+  std::array<VkCommandBufferSubmitInfo, 1> commandBufferInfos{
+      commandBufferInfo};
+  std::array<VkSemaphoreSubmitInfo, 1> signalSemaphoreInfos{
+      getTimelineSubmitInfo(timeline, value,
+                            VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT)};
+
+  auto &vulkanQueue =
+      queue == QueueType::Compute ? *mComputeQueue : mGraphicsQueue;
+  vulkanQueue.submit(VK_NULL_HANDLE, commandBufferInfos, waitSemaphoreInfos,
+                     signalSemaphoreInfos);
+
+  return value;
+}
+
+u64 VulkanRenderDevice::uploadTexture(
+    const TextureUploadDescription &description) {
+  return mUploadContext.uploadTexture(description);
+}
+
+u64 VulkanRenderDevice::flushUploads() { return mUploadContext.flush(); }
+
+bool VulkanRenderDevice::isUploadComplete(u64 value) {
+  return mUploadContext.isComplete(value);
+}
+
+void VulkanRenderDevice::waitForUpload(u64 value) {
+  mUploadContext.wait(value);
+}
+
+void VulkanRenderDevice::addUploadWait(
+    std::vector<VkSemaphoreSubmitInfo> &waitSemaphoreInfos) {
+  auto value = mUploadContext.flush();
+  if (value > 0) {
+    waitSemaphoreInfos.push_back(
+        getTimelineSubmitInfo(mUploadContext.getTimeline(), value,
+                              VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+  }
+}
+
 RenderFrame VulkanRenderDevice::beginFrame() {
   static constexpr auto SkipFrame = std::numeric_limits<u32>::max();
   static RenderCommandList emptyCommandList;
@@ -93,6 +300,18 @@ RenderFrame VulkanRenderDevice::beginFrame() {
   mStats.resetCalls();
   mFrameManager.waitForFrame();
 
+  for (auto &secondary :
+       mSecondaryCommandLists.at(mFrameManager.getCurrentFrameIndex())) {
+    secondary.pool->reset();
+    secondary.used = 0;
+  }
+
+  for (auto &queueCommandLists :
+       mQueueCommandLists.at(mFrameManager.getCurrentFrameIndex())) {
+    queueCommandLists.pool->reset();
+    queueCommandLists.used = 0;
+  }
+
   u32 imageIndex =
       mSwapchain.acquireNextImage(mFrameManager.getImageAvailableSemaphore());
 
@@ -108,7 +327,31 @@ RenderFrame VulkanRenderDevice::beginFrame() {
 
 void VulkanRenderDevice::endFrame(const RenderFrame &renderFrame) {
   QUOLL_PROFILE_EVENT("VulkanRenderDevice::endFrame");
-  mRenderContext.endRendering(mFrameManager);
+
+  // Frame fence must cover async compute work
+  // of the frame; so, frame command list waits
+  // for the last compute submission
+  std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos;
+  addUploadWait(waitSemaphoreInfos);
+  if (mComputeSubmittedInFrame) {
+    const auto &computeTimeline =
+        *mQueueTimelines.at(static_cast<usize>(QueueType::Compute));
+    waitSemaphoreInfos.push_back(
+        getTimelineSubmitInfo(computeTimeline, computeTimeline.getValue(),
+                              VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+  }
+
+  auto &graphicsTimeline =
+      *mQueueTimelines.at(static_cast<usize>(QueueType::Graphics));
+  mPreviousFrameValue = graphicsTimeline.next();
+  mComputeSubmittedInFrame = false;
+
+  std::array<VkSemaphoreSubmitInfo, 1> signalSemaphoreInfos{
+      getTimelineSubmitInfo(graphicsTimeline, mPreviousFrameValue,
+                            VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT)};
+
+  mRenderContext.endRendering(mFrameManager, waitSemaphoreInfos,
+                              signalSemaphoreInfos);
 
   VkSwapchainKHR swapchainHandle = mSwapchain.getVulkanHandle();
   QUOLL_PROFILE_GPU_FLIP(&mSwapchain);
@@ -126,7 +369,9 @@ void VulkanRenderDevice::endFrame(const RenderFrame &renderFrame) {
 void VulkanRenderDevice::waitForIdle() { vkDeviceWaitIdle(mDevice); }
 
 void VulkanRenderDevice::destroyResources() {
+  mUploadContext.waitForIdle();
   waitForIdle();
+  mPipelineCache.save();
   mRegistry = VulkanResourceRegistry();
   mPipelineLayoutCache.clear();
   mDescriptorPool.reset();
@@ -172,7 +417,8 @@ Descriptor VulkanRenderDevice::createDescriptor(DescriptorLayoutHandle layout) {
 void VulkanRenderDevice::createTexture(const TextureDescription &description,
                                        TextureHandle handle) {
   mRegistry.setTexture(
-      std::make_unique<VulkanTexture>(description, mAllocator, mDevice),
+      std::make_unique<VulkanTexture>(description, mRegistry, mAllocator,
+                                      mDevice),
       handle);
 }
 
@@ -226,18 +472,22 @@ void VulkanRenderDevice::destroyFramebuffer(FramebufferHandle handle) {
 
 void VulkanRenderDevice::createPipeline(
     const GraphicsPipelineDescription &description, PipelineHandle handle) {
-  return mRegistry.setPipeline(
-      std::make_unique<VulkanPipeline>(description, mDevice, mRegistry,
-                                       mPipelineLayoutCache),
-      handle);
+  auto pipeline = std::make_unique<VulkanPipeline>(
+      description, mDevice, mRegistry, mPipelineLayoutCache,
+      mPipelineCache.getPipelineCache());
+
+  std::lock_guard lock(mPipelineMutex);
+  mRegistry.setPipeline(std::move(pipeline), handle);
 }
 
 void VulkanRenderDevice::createPipeline(
     const ComputePipelineDescription &description, PipelineHandle handle) {
-  return mRegistry.setPipeline(
-      std::make_unique<VulkanPipeline>(description, mDevice, mRegistry,
-                                       mPipelineLayoutCache),
-      handle);
+  auto pipeline = std::make_unique<VulkanPipeline>(
+      description, mDevice, mRegistry, mPipelineLayoutCache,
+      mPipelineCache.getPipelineCache());
+
+  std::lock_guard lock(mPipelineMutex);
+  mRegistry.setPipeline(std::move(pipeline), handle);
 }
 
 void VulkanRenderDevice::destroyPipeline(PipelineHandle handle) {
@@ -248,4 +498,22 @@ bool VulkanRenderDevice::hasPipeline(PipelineHandle handle) {
   return mRegistry.hasPipeline(handle);
 }
 
+QueryPoolHandle
+VulkanRenderDevice::createQueryPool(const QueryPoolDescription &description) {
+  return mRegistry.setQueryPool(std::make_unique<VulkanQueryPool>(
+      description, mDevice,
+      mPhysicalDevice.getProperties().limits.timestampPeriod));
+}
+
+void VulkanRenderDevice::destroyQueryPool(QueryPoolHandle handle) {
+  mRegistry.deleteQueryPool(handle);
+}
+
+bool VulkanRenderDevice::getQueryPoolResults(QueryPoolHandle handle,
+                                             u32 firstQuery,
+                                             std::span<u64> results) {
+  return mRegistry.getQueryPools().at(handle)->getResults(firstQuery,
+                                                           results);
+}
+
 } // namespace quoll::rhi
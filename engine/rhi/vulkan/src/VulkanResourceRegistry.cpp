@@ -8,6 +8,7 @@
 #include "VulkanFramebuffer.h"
 #include "VulkanPipeline.h"
 #include "VulkanShader.h"
+#include "VulkanQueryPool.h"
 
 namespace quoll::rhi {
 
@@ -79,4 +80,17 @@ void VulkanResourceRegistry::deletePipeline(PipelineHandle handle) {
   mPipelines.map.erase(handle);
 }
 
+QueryPoolHandle VulkanResourceRegistry::setQueryPool(
+    std::unique_ptr<VulkanQueryPool> &&queryPool) {
+  auto handle = QueryPoolHandle{mQueryPools.lastHandle};
+  mQueryPools.lastHandle++;
+  mQueryPools.map.insert_or_assign(handle, std::move(queryPool));
+
+  return handle;
+}
+
+void VulkanResourceRegistry::deleteQueryPool(QueryPoolHandle handle) {
+  mQueryPools.map.erase(handle);
+}
+
 } // namespace quoll::rhi
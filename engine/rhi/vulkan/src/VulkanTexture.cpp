@@ -21,6 +21,7 @@ VulkanTexture::VulkanTexture(VkImage image, VkImageView imageView,
 }
 
 VulkanTexture::VulkanTexture(const TextureDescription &description,
+                             VulkanResourceRegistry &registry,
                              VulkanResourceAllocator &allocator,
                              VulkanDeviceObject &device)
     : mAllocator(allocator), mDevice(device),
@@ -104,13 +105,30 @@ VulkanTexture::VulkanTexture(const TextureDescription &description,
   imageCreateInfo.samples =
       static_cast<VkSampleCountFlagBits>(description.samples);
 
-  VmaAllocationCreateInfo allocationCreateInfo{};
-  allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
-  allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
-  checkForVulkanError(vmaCreateImage(mAllocator, &imageCreateInfo,
-                                     &allocationCreateInfo, &mImage,
-                                     &mAllocation, nullptr),
-                      "Failed to create texture", description.debugName);
+  if (isHandleValid(description.aliasOf)) {
+    const auto &original = registry.getTextures().at(description.aliasOf);
+    QuollAssert(original->mDescription.aliasable,
+                "Aliased texture must be aliasable");
+
+    checkForVulkanError(vmaCreateAliasingImage(mAllocator,
+                                               original->mAllocation,
+                                               &imageCreateInfo, &mImage),
+                        "Failed to create aliasing texture",
+                        description.debugName);
+    mAliased = true;
+  } else {
+    VmaAllocationCreateInfo allocationCreateInfo{};
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+    if (description.aliasable) {
+      allocationCreateInfo.flags |= VMA_ALLOCATION_CREATE_CAN_ALIAS_BIT;
+    }
+
+    checkForVulkanError(vmaCreateImage(mAllocator, &imageCreateInfo,
+                                       &allocationCreateInfo, &mImage,
+                                       &mAllocation, nullptr),
+                        "Failed to create texture", description.debugName);
+  }
 
   mDevice.setObjectName(description.debugName, VK_OBJECT_TYPE_IMAGE, mImage);
 
@@ -187,6 +205,8 @@ VulkanTexture::~VulkanTexture() {
 
   if (mAllocation && mImage) {
     vmaDestroyImage(mAllocator, mImage, mAllocation);
+  } else if (mAliased && mImage) {
+    vkDestroyImage(mDevice, mImage, nullptr);
   }
 }
 
@@ -0,0 +1,53 @@
+#include "quoll/core/Base.h"
+
+#include "VulkanHeaders.h"
+#include "VulkanTimelineSemaphore.h"
+#include "VulkanError.h"
+
+namespace quoll::rhi {
+
+VulkanTimelineSemaphore::VulkanTimelineSemaphore(VulkanDeviceObject &device)
+    : mDevice(device) {
+  VkSemaphoreTypeCreateInfo typeInfo{};
+  typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+  typeInfo.pNext = nullptr;
+  typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+  typeInfo.initialValue = 0;
+
+  VkSemaphoreCreateInfo createInfo{};
+  createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  createInfo.pNext = &typeInfo;
+  createInfo.flags = 0;
+
+  checkForVulkanError(
+      vkCreateSemaphore(mDevice, &createInfo, nullptr, &mSemaphore),
+      "Failed to create timeline semaphore");
+}
+
+VulkanTimelineSemaphore::~VulkanTimelineSemaphore() {
+  vkDestroySemaphore(mDevice, mSemaphore, nullptr);
+}
+
+u64 VulkanTimelineSemaphore::getCompletedValue() const {
+  u64 value = 0;
+  checkForVulkanError(vkGetSemaphoreCounterValue(mDevice, mSemaphore, &value),
+                      "Failed to get timeline semaphore value");
+
+  return value;
+}
+
+void VulkanTimelineSemaphore::wait(u64 value) const {
+  VkSemaphoreWaitInfo waitInfo{};
+  waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+  waitInfo.pNext = nullptr;
+  waitInfo.flags = 0;
+  waitInfo.semaphoreCount = 1;
+  waitInfo.pSemaphores = &mSemaphore;
+  waitInfo.pValues = &value;
+
+  checkForVulkanError(vkWaitSemaphores(mDevice, &waitInfo,
+                                       std::numeric_limits<u64>::max()),
+                      "Failed to wait for timeline semaphore");
+}
+
+} // namespace quoll::rhi
@@ -1,76 +1,323 @@
 #include "quoll/core/Base.h"
 #include "quoll/core/Engine.h"
 
-#include "VulkanCommandBuffer.h"
 #include "VulkanUploadContext.h"
+#include "VulkanTexture.h"
+#include "VulkanMapping.h"
 #include "VulkanError.h"
 #include "VulkanLog.h"
 
 namespace quoll::rhi {
 
-VulkanUploadContext::VulkanUploadContext(VulkanDeviceObject &mDevice,
-                                         VulkanCommandPool &pool,
-                                         VulkanQueue &queue)
-    : mDevice(mDevice), mQueue(queue) {
+/**
+ * @brief Align offset
+ *
+ * @param offset Offset
+ * @param alignment Alignment
+ * @return Aligned offset
+ */
+static constexpr usize alignOffset(usize offset, usize alignment) {
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+VulkanUploadContext::VulkanUploadContext(
+    VulkanDeviceObject &device, const VulkanPhysicalDevice &physicalDevice,
+    VulkanResourceAllocator &allocator, const VulkanResourceRegistry &registry,
+    VulkanQueue &graphicsQueue)
+    : mDevice(device), mAllocator(allocator), mRegistry(registry),
+      mQueue(&graphicsQueue), mTimeline(device) {
+  const auto &queueFamily = physicalDevice.getQueueFamilyIndices();
 
-  mCommandList = std::move(pool.createCommandLists(1).at(0));
+  if (queueFamily.hasTransferQueue()) {
+    mTransferQueue = std::make_unique<VulkanQueue>(
+        mDevice, queueFamily.getGraphicsFamily(),
+        VulkanQueueFamily::TransferQueueIndex);
+    mQueue = mTransferQueue.get();
+  }
 
-  createFence();
+  VkCommandPoolCreateInfo poolInfo{};
+  poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+  poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT |
+                   VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+  poolInfo.queueFamilyIndex = queueFamily.getGraphicsFamily();
+
+  checkForVulkanError(
+      vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mCommandPool),
+      "Failed to create upload command pool");
+
+  BufferDescription stagingDesc{};
+  stagingDesc.usage = BufferUsage::TransferSource;
+  stagingDesc.size = StagingBufferSize;
+  stagingDesc.mapped = true;
+  stagingDesc.debugName = "Staging ring";
+
+  mStagingBuffer =
+      std::make_unique<VulkanBuffer>(stagingDesc, mAllocator, mDevice);
+  mStagingData = static_cast<u8 *>(mStagingBuffer->map());
+
+  LOG_DEBUG_VK("Upload context created. Transfer queue: "
+                   << (hasTransferQueue() ? "dedicated" : "graphics"),
+               mCommandPool);
 }
 
 VulkanUploadContext::~VulkanUploadContext() {
-  if (mUploadFence) {
-    vkDestroyFence(mDevice, mUploadFence, nullptr);
-    LOG_DEBUG_VK("Upload fence destroyed", mUploadFence);
+  waitForIdle();
+
+  if (mCommandPool) {
+    vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
+    LOG_DEBUG_VK("Upload command pool destroyed", mCommandPool);
   }
 }
 
-void VulkanUploadContext::submit(const SubmitFn &submitFn) const {
-  vkWaitForFences(mDevice, 1, &mUploadFence, true,
-                  std::numeric_limits<u32>::max());
+u64 VulkanUploadContext::uploadTexture(
+    const TextureUploadDescription &description) {
+  QUOLL_PROFILE_EVENT("VulkanUploadContext::uploadTexture");
+  std::lock_guard lock(mMutex);
 
-  vkResetFences(mDevice, 1, &mUploadFence);
+  retire(false);
 
-  VkCommandBufferBeginInfo beginInfo{};
-  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+  VkBuffer stagingBuffer = VK_NULL_HANDLE;
+  usize stagingOffset = 0;
+
+  if (description.size + StagingAlignment > StagingBufferSize) {
+    BufferDescription dedicatedDesc{};
+    dedicatedDesc.usage = BufferUsage::TransferSource;
+    dedicatedDesc.size = description.size;
+    dedicatedDesc.data = description.data;
+    dedicatedDesc.debugName = "Staging";
 
-  auto *commandBuffer = dynamic_cast<rhi::VulkanCommandBuffer *>(
-                            mCommandList.getNativeRenderCommandList().get())
-                            ->getVulkanCommandBuffer();
+    auto buffer =
+        std::make_unique<VulkanBuffer>(dedicatedDesc, mAllocator, mDevice);
+    stagingBuffer = buffer->getBuffer();
+    getPendingBatch().dedicatedBuffers.push_back(std::move(buffer));
+  } else {
+    stagingOffset = allocateStaging(description.size);
+    memcpy(mStagingData + stagingOffset, description.data, description.size);
+    stagingBuffer = mStagingBuffer->getBuffer();
+  }
+
+  auto &batch = getPendingBatch();
+  const auto &texture = mRegistry.getTextures().at(description.texture);
 
-  checkForVulkanError(vkBeginCommandBuffer(commandBuffer, &beginInfo),
-                      "Failed to start recording command buffer for uploads");
+  VkImageMemoryBarrier2 barrier{};
+  barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+  barrier.pNext = nullptr;
+  barrier.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+  barrier.srcAccessMask = VK_ACCESS_2_NONE;
+  barrier.dstStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+  barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+  barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.image = texture->getImage();
+  barrier.subresourceRange.aspectMask = texture->getImageAspectFlags();
+  barrier.subresourceRange.baseMipLevel = 0;
+  barrier.subresourceRange.levelCount = description.levelCount;
+  barrier.subresourceRange.baseArrayLayer = 0;
+  barrier.subresourceRange.layerCount = texture->getDescription().layerCount;
 
-  submitFn(commandBuffer);
+  VkDependencyInfo dependencyInfo{};
+  dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  dependencyInfo.pNext = nullptr;
+  dependencyInfo.imageMemoryBarrierCount = 1;
+  dependencyInfo.pImageMemoryBarriers = &barrier;
 
-  checkForVulkanError(vkEndCommandBuffer(commandBuffer),
-                      "Failed to stop recording command buffer");
+  vkCmdPipelineBarrier2KHR(batch.commandBuffer, &dependencyInfo);
+
+  std::vector<VkBufferImageCopy> copies(description.regions.size());
+  for (usize i = 0; i < copies.size(); ++i) {
+    const auto &region = description.regions.at(i);
+    auto &copy = copies.at(i);
+    copy.bufferOffset = stagingOffset + region.bufferOffset;
+    copy.bufferRowLength = 0;
+    copy.bufferImageHeight = 0;
+    copy.imageSubresource.aspectMask = texture->getImageAspectFlags();
+    copy.imageSubresource.baseArrayLayer = region.imageBaseArrayLayer;
+    copy.imageSubresource.layerCount = region.imageLayerCount;
+    copy.imageSubresource.mipLevel = region.imageLevel;
+    copy.imageOffset = VkOffset3D{region.imageOffset.x, region.imageOffset.y,
+                                  region.imageOffset.z};
+    copy.imageExtent = VkExtent3D{region.imageExtent.x, region.imageExtent.y,
+                                  region.imageExtent.z};
+  }
 
-  VkSubmitInfo submitInfo{};
-  submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-  submitInfo.commandBufferCount = 1;
-  submitInfo.pCommandBuffers = &commandBuffer;
+  vkCmdCopyBufferToImage(batch.commandBuffer, stagingBuffer,
+                         texture->getImage(),
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                         static_cast<u32>(copies.size()), copies.data());
 
-  vkQueueSubmit(mQueue, 1, &submitInfo, mUploadFence);
+  // Queues that use the texture wait for
+  // upload timeline before executing any
+  // command; so, no destination stage is needed
+  barrier.srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+  barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+  barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+  barrier.dstAccessMask = VK_ACCESS_2_NONE;
+  barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  barrier.newLayout = VulkanMapping::getImageLayout(description.layout);
 
-  vkWaitForFences(mDevice, 1, &mUploadFence, true,
-                  std::numeric_limits<u32>::max());
+  vkCmdPipelineBarrier2KHR(batch.commandBuffer, &dependencyInfo);
 
-  vkResetCommandBuffer(commandBuffer, 0);
+  return batch.value;
 }
 
-void VulkanUploadContext::createFence() {
-  VkFenceCreateInfo fenceInfo{};
-  fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-  fenceInfo.pNext = nullptr;
-  fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+u64 VulkanUploadContext::flush() {
+  std::lock_guard lock(mMutex);
+  submitPendingBatch();
 
-  checkForVulkanError(
-      vkCreateFence(mDevice, &fenceInfo, nullptr, &mUploadFence),
-      "Failed to create upload fence");
+  return mTimeline.getValue();
+}
+
+bool VulkanUploadContext::isComplete(u64 value) {
+  std::lock_guard lock(mMutex);
+
+  if (value > mTimeline.getValue()) {
+    return false;
+  }
+
+  retire(false);
+  return mTimeline.getCompletedValue() >= value;
+}
+
+void VulkanUploadContext::wait(u64 value) {
+  {
+    std::lock_guard lock(mMutex);
+    if (value > mTimeline.getValue()) {
+      submitPendingBatch();
+    }
+  }
+
+  mTimeline.wait(value);
+
+  std::lock_guard lock(mMutex);
+  retire(false);
+}
+
+void VulkanUploadContext::waitForIdle() { wait(flush()); }
+
+void VulkanUploadContext::submitPendingBatch() {
+  if (!mPendingBatch.has_value()) {
+    return;
+  }
+
+  QUOLL_PROFILE_EVENT("VulkanUploadContext::submitPendingBatch");
 
-  LOG_DEBUG_VK("Upload fence created", mUploadFence);
+  auto &batch = mPendingBatch.value();
+  checkForVulkanError(vkEndCommandBuffer(batch.commandBuffer),
+                      "Failed to stop recording upload command buffer");
+
+  VkCommandBufferSubmitInfo commandBufferInfo{};
+  commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+  commandBufferInfo.pNext = nullptr;
+  commandBufferInfo.commandBuffer = batch.commandBuffer;
+  commandBufferInfo.deviceMask = 0;
+
+  VkSemaphoreSubmitInfo signalInfo{};
+  signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+  signalInfo.pNext = nullptr;
+  signalInfo.semaphore = mTimeline.getSemaphore();
+  signalInfo.value = mTimeline.next();
+  signalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+  signalInfo.deviceIndex = 0;
+
+  QuollAssert(signalInfo.value == batch.value,
+              "Upload batch value must match timeline value");
+
+  std::array<VkCommandBufferSubmitInfo, 1> commandBufferInfos{
+      commandBufferInfo};
+  std::array<VkSemaphoreSubmitInfo, 1> signalInfos{signalInfo};
+  mQueue->submit(VK_NULL_HANDLE, commandBufferInfos, {}, signalInfos);
+
+  mInFlightBatches.push_back(std::move(batch));
+  mPendingBatch.reset();
+}
+
+usize VulkanUploadContext::allocateStaging(usize size) {
+  while (true) {
+    if (mStagingUsed == 0) {
+      mStagingHead = 0;
+    }
+
+    usize offset = alignOffset(mStagingHead, StagingAlignment);
+    if (offset + size > StagingBufferSize) {
+      // Skip the remaining space at the end
+      // of the buffer and start from beginning
+      offset = 0;
+    }
+
+    usize padding = offset >= mStagingHead
+                        ? offset - mStagingHead
+                        : StagingBufferSize - mStagingHead;
+    usize required = padding + size;
+
+    if (StagingBufferSize - mStagingUsed >= required) {
+      mStagingHead = offset + size;
+      mStagingUsed += required;
+      getPendingBatch().stagingSize += required;
+
+      return offset;
+    }
+
+    // Pending batch uses the rest of staging
+    // memory; so, it needs to be submitted
+    if (mInFlightBatches.empty()) {
+      submitPendingBatch();
+    }
+
+    retire(true);
+  }
+}
+
+VulkanUploadContext::Batch &VulkanUploadContext::getPendingBatch() {
+  if (mPendingBatch.has_value()) {
+    return mPendingBatch.value();
+  }
+
+  Batch batch{};
+  batch.value = mTimeline.getValue() + 1;
+
+  if (mFreeCommandBuffers.empty()) {
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = mCommandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    checkForVulkanError(
+        vkAllocateCommandBuffers(mDevice, &allocInfo, &batch.commandBuffer),
+        "Failed to allocate upload command buffer");
+  } else {
+    batch.commandBuffer = mFreeCommandBuffers.back();
+    mFreeCommandBuffers.pop_back();
+  }
+
+  VkCommandBufferBeginInfo beginInfo{};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+  checkForVulkanError(vkBeginCommandBuffer(batch.commandBuffer, &beginInfo),
+                      "Failed to start recording upload command buffer");
+
+  mPendingBatch = std::move(batch);
+  return mPendingBatch.value();
+}
+
+void VulkanUploadContext::retire(bool waitForOldest) {
+  if (waitForOldest && !mInFlightBatches.empty()) {
+    mTimeline.wait(mInFlightBatches.front().value);
+  }
+
+  u64 completedValue = mTimeline.getCompletedValue();
+  while (!mInFlightBatches.empty() &&
+         mInFlightBatches.front().value <= completedValue) {
+    auto &batch = mInFlightBatches.front();
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+    mFreeCommandBuffers.push_back(batch.commandBuffer);
+    mStagingUsed -= batch.stagingSize;
+
+    mInFlightBatches.pop_front();
+  }
 }
 
 } // namespace quoll::rhi
@@ -118,10 +118,38 @@ void AssetRegistry::syncWithDevice(RenderStorage &renderStorage) {
     }
 
     usize ibSize = 0;
+    glm::vec3 minBounds{std::numeric_limits<f32>::max()};
+    glm::vec3 maxBounds{std::numeric_limits<f32>::lowest()};
     for (auto &g : mesh.data.geometries) {
       ibSize += g.indices.size() * sizeof(u32);
+
+      for (const auto &position : g.positions) {
+        minBounds = glm::min(minBounds, position);
+        maxBounds = glm::max(maxBounds, position);
+      }
+    }
+
+    // Bounding sphere is used for culling
+    // shadow casters per shadow map
+    if (minBounds.x <= maxBounds.x) {
+      glm::vec3 center = (minBounds + maxBounds) * 0.5f;
+      f32 radius = 0.0f;
+      for (auto &g : mesh.data.geometries) {
+        for (const auto &position : g.positions) {
+          radius = std::max(radius, glm::length(position - center));
+        }
+      }
+
+      mesh.data.boundingSphere = glm::vec4(center, radius);
     }
 
+    // Skinned mesh vertices are also read
+    // by skinning compute shader
+    auto vertexUsage =
+        mesh.type == AssetType::SkinnedMesh
+            ? rhi::BufferUsage::Vertex | rhi::BufferUsage::Storage
+            : rhi::BufferUsage::Vertex;
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CreateBuffer(FieldName, Type)                                          \
   {                                                                            \
@@ -131,7 +159,7 @@ void AssetRegistry::syncWithDevice(RenderStorage &renderStorage) {
       vbSize += vertexSize * sizeof(Type);                                     \
     }                                                                          \
     rhi::BufferDescription description;                                        \
-    description.usage = rhi::BufferUsage::Vertex;                              \
+    description.usage = vertexUsage;                                           \
     description.size = vbSize;                                                 \
     description.data = nullptr;                                                \
     description.debugName = mesh.name + " vertices";                           \
@@ -147,6 +175,7 @@ void AssetRegistry::syncWithDevice(RenderStorage &renderStorage) {
     }                                                                          \
     buffer.unmap();                                                            \
     mesh.data.vertexBuffers.push_back(buffer.getHandle());                     \
+    mesh.data.vertexBufferAddresses.push_back(buffer.getAddress());            \
   }
 
     CreateBuffer(positions, glm::vec3);
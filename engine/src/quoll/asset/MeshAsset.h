@@ -71,6 +71,22 @@ struct MeshAsset {
    */
   std::vector<u64> vertexBufferOffsets;
 
+  /**
+   * Vertex buffer device addresses
+   *
+   * Used by skinning compute shader
+   * to read skinned mesh vertices
+   */
+  std::vector<rhi::DeviceAddress> vertexBufferAddresses;
+
+  /**
+   * Bounding sphere of all geometries
+   *
+   * First three values are center
+   * Last value is radius
+   */
+  glm::vec4 boundingSphere{0.0f};
+
   /**
    * @brief Index buffer for all geometries
    */
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "quoll/asset/AudioAsset.h"
+
+namespace quoll {
+
+/**
+ * @brief Audio backend without output
+ *
+ * Sounds finish as soon as they are played.
+ * Used when there is no audio device; for
+ * example, in headless runtime.
+ */
+class NullAudioBackend {
+public:
+  /**
+   * @brief Play sound
+   *
+   * @param asset Audio asset
+   * @return Sound instance
+   */
+  inline void *playSound(const AudioAsset &asset) { return nullptr; }
+
+  /**
+   * @brief Destroy sound
+   *
+   * @param instance Sound instance
+   */
+  inline void destroySound(void *instance) {}
+
+  /**
+   * @brief Check if sound is playing
+   *
+   * @param instance Sound instance
+   * @retval false Sounds are never playing
+   */
+  inline bool isPlaying(void *instance) { return false; }
+};
+
+} // namespace quoll
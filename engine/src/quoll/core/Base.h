@@ -35,6 +35,11 @@
 #include <unordered_map>
 #include <memory>
 #include <list>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <type_traits>
 #include <variant>
 #include <random>
@@ -42,6 +47,7 @@
 #include <typeinfo>
 #include <typeindex>
 #include <span>
+#include <charconv>
 
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/glm.hpp>
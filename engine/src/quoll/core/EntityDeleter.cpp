@@ -1,4 +1,5 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/FrameAllocator.h"
 #include "quoll/scene/Children.h"
 #include "quoll/scene/Parent.h"
 
@@ -8,7 +9,7 @@
 namespace quoll {
 
 void addToDeleteList(Entity entity, EntityDatabase &entityDatabase,
-                     std::vector<Entity> &deleteList) {
+                     FrameVector<Entity> &deleteList) {
   if (entityDatabase.has<Children>(entity)) {
     for (auto &child : entityDatabase.get<Children>(entity).children) {
       addToDeleteList(child, entityDatabase, deleteList);
@@ -27,7 +28,7 @@ void EntityDeleter::update(Scene &scene) {
     return;
   }
 
-  std::vector<Entity> deleteList;
+  FrameVector<Entity> deleteList;
   deleteList.reserve(count);
 
   bool cameraDeleted = false;
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "FrameArena.h"
+
+namespace quoll {
+
+/**
+ * @brief Allocator that allocates from frame arena
+ *
+ * Adapts frame arena to standard library
+ * containers. Deallocation does nothing
+ * because arena releases memory on reset;
+ * so, containers that use this allocator
+ * must not outlive the frame.
+ *
+ * @tparam T Value type
+ */
+template <class T> class FrameAllocator {
+public:
+  using value_type = T;
+
+public:
+  /**
+   * @brief Create allocator for arena of current thread
+   */
+  FrameAllocator() : mArena(&FrameArena::get()) {}
+
+  /**
+   * @brief Create allocator for arena
+   *
+   * @param arena Frame arena
+   */
+  FrameAllocator(FrameArena &arena) : mArena(&arena) {}
+
+  /**
+   * @brief Create allocator from allocator of other type
+   *
+   * @tparam U Value type of other allocator
+   * @param other Other allocator
+   */
+  template <class U>
+  FrameAllocator(const FrameAllocator<U> &other) : mArena(other.getArena()) {}
+
+  /**
+   * @brief Allocate values
+   *
+   * @param n Number of values
+   * @return Allocated values
+   */
+  T *allocate(usize n) {
+    return static_cast<T *>(mArena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  /**
+   * @brief Deallocate values
+   *
+   * Memory is released when arena is reset
+   */
+  void deallocate(T *, usize) {}
+
+  /**
+   * @brief Get frame arena
+   *
+   * @return Frame arena
+   */
+  inline FrameArena *getArena() const { return mArena; }
+
+  /**
+   * @brief Check if allocators use the same arena
+   *
+   * @tparam U Value type of other allocator
+   * @param other Other allocator
+   * @retval true Allocators use the same arena
+   * @retval false Allocators use different arenas
+   */
+  template <class U> bool operator==(const FrameAllocator<U> &other) const {
+    return mArena == other.getArena();
+  }
+
+private:
+  FrameArena *mArena;
+};
+
+/**
+ * @brief Vector that allocates from frame arena
+ *
+ * @tparam T Value type
+ */
+template <class T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // namespace quoll
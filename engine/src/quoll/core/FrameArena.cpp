@@ -0,0 +1,66 @@
+#include "quoll/core/Base.h"
+#include "FrameArena.h"
+
+namespace quoll {
+
+FrameArena &FrameArena::get() {
+  static thread_local FrameArena arena;
+  return arena;
+}
+
+FrameArena::FrameArena(usize blockSize) : mBlockSize(blockSize) {
+  QuollAssert(blockSize > 0, "Block size must be positive");
+  addBlock(mBlockSize);
+}
+
+void *FrameArena::allocate(usize size, usize alignment) {
+  QuollAssert(alignment > 0 && (alignment & (alignment - 1)) == 0,
+              "Alignment must be a power of two");
+
+  auto align = [alignment](std::uintptr_t address) {
+    return (address + alignment - 1) & ~(alignment - 1);
+  };
+
+  auto *block = &mBlocks.at(mCurrentBlock);
+  auto base = reinterpret_cast<std::uintptr_t>(block->data.get());
+  auto start = align(base + mOffset);
+
+  if (start + size > base + block->size) {
+    // Blocks that are added during the frame
+    // are merged on reset; so, current block
+    // is always the last block
+    addBlock(std::max(mBlockSize, size + alignment));
+    mCurrentBlock = mBlocks.size() - 1;
+
+    block = &mBlocks.at(mCurrentBlock);
+    base = reinterpret_cast<std::uintptr_t>(block->data.get());
+    start = align(base);
+  }
+
+  mOffset = start + size - base;
+  mStats.allocationsCount++;
+  mStats.allocatedSize += size;
+
+  return reinterpret_cast<void *>(start);
+}
+
+void FrameArena::reset() {
+  mLastFrameStats = mStats;
+  mStats = {};
+  mCurrentBlock = 0;
+  mOffset = 0;
+
+  if (mBlocks.size() > 1) {
+    usize capacity = mCapacity;
+    mBlocks.clear();
+    mCapacity = 0;
+    addBlock(capacity);
+  }
+}
+
+void FrameArena::addBlock(usize size) {
+  mBlocks.push_back({std::make_unique<std::byte[]>(size), size});
+  mCapacity += size;
+}
+
+} // namespace quoll
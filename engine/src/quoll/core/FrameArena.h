@@ -0,0 +1,141 @@
+#pragma once
+
+namespace quoll {
+
+/**
+ * @brief Frame arena statistics
+ */
+struct FrameArenaStats {
+  /**
+   * Number of allocations
+   */
+  usize allocationsCount = 0;
+
+  /**
+   * Allocated size in bytes
+   */
+  usize allocatedSize = 0;
+};
+
+/**
+ * @brief Frame arena
+ *
+ * Linear allocator for transient data that
+ * lives until the end of a frame. Allocations
+ * bump an offset in a memory block and are
+ * never freed individually; instead, all
+ * allocations are released when the arena
+ * is reset.
+ *
+ * Every thread has its own arena; so,
+ * allocations do not need a lock. Threads
+ * that allocate from their arena must reset
+ * it at the end of every frame.
+ */
+class FrameArena {
+public:
+  /**
+   * Default size of memory block
+   */
+  static constexpr usize DefaultBlockSize = 64 * 1024;
+
+public:
+  /**
+   * @brief Get arena of current thread
+   *
+   * @return Frame arena
+   */
+  static FrameArena &get();
+
+public:
+  /**
+   * @brief Create frame arena
+   *
+   * @param blockSize Size of memory block
+   */
+  FrameArena(usize blockSize = DefaultBlockSize);
+
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+  FrameArena(FrameArena &&) = delete;
+  FrameArena &operator=(FrameArena &&) = delete;
+
+  /**
+   * @brief Allocate memory
+   *
+   * Adds a new block if current block
+   * does not have enough space
+   *
+   * @param size Size in bytes
+   * @param alignment Alignment in bytes
+   * @return Allocated memory
+   */
+  void *allocate(usize size, usize alignment);
+
+  /**
+   * @brief Release all allocations
+   *
+   * Memory that is allocated from the
+   * arena must not be used after reset.
+   * Blocks that were added during the
+   * frame are merged into one block; so,
+   * frames of similar size only use one
+   * block.
+   */
+  void reset();
+
+  /**
+   * @brief Get statistics of current frame
+   *
+   * @return Statistics of current frame
+   */
+  inline const FrameArenaStats &getStats() const { return mStats; }
+
+  /**
+   * @brief Get statistics of last reset frame
+   *
+   * @return Statistics of last frame
+   */
+  inline const FrameArenaStats &getLastFrameStats() const {
+    return mLastFrameStats;
+  }
+
+  /**
+   * @brief Get capacity
+   *
+   * @return Total size of memory blocks in bytes
+   */
+  inline usize getCapacity() const { return mCapacity; }
+
+  /**
+   * @brief Get number of memory blocks
+   *
+   * @return Number of memory blocks
+   */
+  inline usize getBlocksCount() const { return mBlocks.size(); }
+
+private:
+  /**
+   * @brief Add memory block
+   *
+   * @param size Size of memory block
+   */
+  void addBlock(usize size);
+
+private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data;
+    usize size = 0;
+  };
+
+  usize mBlockSize;
+  std::vector<Block> mBlocks;
+  usize mCurrentBlock = 0;
+  usize mOffset = 0;
+  usize mCapacity = 0;
+
+  FrameArenaStats mStats;
+  FrameArenaStats mLastFrameStats;
+};
+
+} // namespace quoll
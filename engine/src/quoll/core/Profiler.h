@@ -17,6 +17,27 @@
 #define QUOLL_PROFILE_GPU_EVENT OPTICK_GPU_EVENT
 #define QUOLL_PROFILE_GPU_FLIP OPTICK_GPU_FLIP
 
+#elif !defined(QUOLL_NO_TRACER)
+#include "quoll/profiler/Tracer.h"
+
+// Built-in tracer is used when Optick is not
+// enabled. It is cheap enough to stay enabled
+// in release builds.
+#define QUOLL_TRACE_CONCAT_IMPL(a, b) a##b
+#define QUOLL_TRACE_CONCAT(a, b) QUOLL_TRACE_CONCAT_IMPL(a, b)
+
+#define QUOLL_PROFILE_EVENT(name)                                              \
+  ::quoll::TraceScope QUOLL_TRACE_CONCAT(quollTraceScope, __LINE__)(name)
+#define QUOLL_PROFILE_FRAME(name) ::quoll::Tracer::markFrame(name)
+#define QUOLL_PROFILE_CATEGORY(name, ...) QUOLL_PROFILE_EVENT(name)
+#define QUOLL_PROFILE_TAG(...)
+#define QUOLL_PROFILE_INIT_VULKAN(...)
+
+#define QUOLL_PROFILE_GPU_INIT_VULKAN(...)
+#define QUOLL_PROFILE_GPU_CONTEXT(...)
+#define QUOLL_PROFILE_GPU_EVENT(...)
+#define QUOLL_PROFILE_GPU_FLIP(...)
+
 #else
 
 #define QUOLL_PROFILE_EVENT(...)
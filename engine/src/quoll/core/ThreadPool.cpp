@@ -0,0 +1,73 @@
+#include "quoll/core/Base.h"
+#include "ThreadPool.h"
+
+namespace quoll {
+
+ThreadPool::ThreadPool(u32 numThreads) {
+  QuollAssert(numThreads > 0, "Thread pool must have at least one thread");
+
+  mThreads.reserve(numThreads);
+  for (u32 i = 0; i < numThreads; ++i) {
+    mThreads.emplace_back([this, i] { run(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(mMutex);
+    mStopped = true;
+  }
+
+  mTaskAvailable.notify_all();
+  for (auto &thread : mThreads) {
+    thread.join();
+  }
+}
+
+void ThreadPool::push(Task &&task) {
+  {
+    std::lock_guard lock(mMutex);
+    mTasks.push_back(std::move(task));
+    mNumPendingTasks++;
+  }
+
+  mTaskAvailable.notify_one();
+}
+
+void ThreadPool::wait() {
+  std::unique_lock lock(mMutex);
+  mTasksFinished.wait(lock, [this] { return mNumPendingTasks == 0; });
+}
+
+void ThreadPool::run(u32 threadIndex) {
+  while (true) {
+    Task task;
+
+    {
+      std::unique_lock lock(mMutex);
+      mTaskAvailable.wait(lock, [this] { return mStopped || !mTasks.empty(); });
+
+      if (mStopped && mTasks.empty()) {
+        return;
+      }
+
+      task = std::move(mTasks.front());
+      mTasks.pop_front();
+    }
+
+    task(threadIndex);
+
+    bool finished = false;
+    {
+      std::lock_guard lock(mMutex);
+      mNumPendingTasks--;
+      finished = mNumPendingTasks == 0;
+    }
+
+    if (finished) {
+      mTasksFinished.notify_all();
+    }
+  }
+}
+
+} // namespace quoll
@@ -0,0 +1,78 @@
+#pragma once
+
+namespace quoll {
+
+/**
+ * @brief Fixed size thread pool
+ *
+ * Runs pushed tasks in worker threads. Every
+ * task receives index of the worker thread
+ * that runs it, which can be used to access
+ * per thread resources without locking.
+ */
+class ThreadPool {
+public:
+  /**
+   * @brief Task function
+   */
+  using Task = std::function<void(u32 threadIndex)>;
+
+public:
+  /**
+   * @brief Create thread pool
+   *
+   * @param numThreads Number of worker threads
+   */
+  ThreadPool(u32 numThreads);
+
+  /**
+   * @brief Stop and join worker threads
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+
+  /**
+   * @brief Push task
+   *
+   * @param task Task
+   */
+  void push(Task &&task);
+
+  /**
+   * @brief Wait until all pushed tasks are finished
+   */
+  void wait();
+
+  /**
+   * @brief Get number of worker threads
+   *
+   * @return Number of worker threads
+   */
+  inline u32 getNumThreads() const {
+    return static_cast<u32>(mThreads.size());
+  }
+
+private:
+  /**
+   * @brief Run tasks in worker thread
+   *
+   * @param threadIndex Worker thread index
+   */
+  void run(u32 threadIndex);
+
+private:
+  std::vector<std::thread> mThreads;
+  std::deque<Task> mTasks;
+  usize mNumPendingTasks = 0;
+  bool mStopped = false;
+
+  std::mutex mMutex;
+  std::condition_variable mTaskAvailable;
+  std::condition_variable mTasksFinished;
+};
+
+} // namespace quoll
@@ -2,6 +2,67 @@
 
 namespace quoll {
 
+/**
+ * @brief Entity handle
+ *
+ * Lower bits of the handle store entity slot
+ * index and upper bits store generation of the
+ * slot. Generation is incremented every time
+ * a slot is recycled, which makes handles to
+ * deleted entities invalid. Slots whose generation
+ * is exhausted are not recycled; so, generations
+ * never wrap around and stale handles never alias
+ * new entities.
+ */
 enum class Entity : u32 { Null = 0 };
 
+/**
+ * @brief Number of bits used by entity index
+ */
+static constexpr u32 EntityIndexBits = 20;
+
+/**
+ * @brief Entity index mask
+ */
+static constexpr u32 EntityIndexMask = (1u << EntityIndexBits) - 1;
+
+/**
+ * @brief Entity generation mask
+ */
+static constexpr u32 EntityGenerationMask =
+    (1u << (32u - EntityIndexBits)) - 1;
+
+/**
+ * @brief Get entity slot index
+ *
+ * @param entity Entity
+ * @return Entity slot index
+ */
+constexpr usize getEntityIndex(Entity entity) {
+  return static_cast<usize>(static_cast<u32>(entity) & EntityIndexMask);
+}
+
+/**
+ * @brief Get entity generation
+ *
+ * @param entity Entity
+ * @return Entity generation
+ */
+constexpr u32 getEntityGeneration(Entity entity) {
+  return static_cast<u32>(entity) >> EntityIndexBits;
+}
+
+/**
+ * @brief Create entity from index and generation
+ *
+ * @param index Entity slot index
+ * @param generation Entity generation
+ * @return Entity
+ */
+constexpr Entity createEntity(usize index, u32 generation) {
+  return static_cast<Entity>(
+      (static_cast<u32>(index) & EntityIndexMask) |
+      ((generation & EntityGenerationMask) << EntityIndexBits));
+}
+
 } // namespace quoll
@@ -17,6 +17,7 @@
 #include "quoll/scene/Children.h"
 #include "quoll/scene/LocalTransform.h"
 #include "quoll/scene/WorldTransform.h"
+#include "quoll/scene/PreviousWorldTransform.h"
 #include "quoll/scene/EnvironmentSkybox.h"
 #include "quoll/scene/EnvironmentLighting.h"
 #include "quoll/scene/Sprite.h"
@@ -58,6 +59,7 @@ EntityDatabase::EntityDatabase() {
   reg<PerspectiveLens>();
   reg<LocalTransform>();
   reg<WorldTransform>();
+  reg<PreviousWorldTransform>();
   reg<Parent>();
   reg<Children>();
   reg<EnvironmentSkybox>();
@@ -86,6 +88,10 @@ EntityDatabase::EntityDatabase() {
   reg<InputMap>();
   reg<UICanvas>();
   reg<UICanvasRenderRequest>();
+
+  // Keep hot component sets packed for iteration
+  group<LocalTransform, WorldTransform>();
+  group<Mesh, MeshRenderer>(include<WorldTransform>);
 }
 
 } // namespace quoll
@@ -24,4 +24,8 @@ public:
 template <class TComponent>
 using EntityDatabaseObserver = EntityStorageSparseSetObserver<TComponent>;
 
+template <class TComponent>
+using EntityDatabaseChangeObserver =
+    EntityStorageSparseSetChangeObserver<TComponent>;
+
 } // namespace quoll
@@ -1,46 +1,83 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/Engine.h"
 #include "EntityStorageSparseSet.h"
 
 namespace quoll {
 
+/**
+ * @brief Swap two items in component pool
+ *
+ * @param pool Component pool
+ * @param a First item index
+ * @param b Second item index
+ */
+static void swapPoolItems(EntityStorageSparseSetComponentPool &pool, usize a,
+                          usize b) {
+  if (a == b) {
+    return;
+  }
+
+  std::swap(pool.entities[a], pool.entities[b]);
+  std::swap(pool.components[a], pool.components[b]);
+  pool.swapVersions(a, b);
+
+  pool.entityIndices[getEntityIndex(pool.entities[a])] = a;
+  pool.entityIndices[getEntityIndex(pool.entities[b])] = b;
+}
+
 EntityStorageSparseSet::~EntityStorageSparseSet() { destroy(); }
 
 void EntityStorageSparseSet::duplicate(EntityStorageSparseSet &rhs) {
   rhs.mComponentPools = mComponentPools;
-  rhs.mLastEntity = mLastEntity;
+  rhs.mGroups = mGroups;
+  rhs.mGenerations = mGenerations;
   rhs.mDeleted = mDeleted;
   rhs.mNumEntities = mNumEntities;
 }
 
 Entity EntityStorageSparseSet::create() {
-  mNumEntities++;
   if (mDeleted.size() > 0) {
-    auto eid = mDeleted.front();
+    auto index = mDeleted.front();
     mDeleted.pop_front();
-    return eid;
-  }
+    mNumEntities++;
 
-  auto eid = mLastEntity;
-  mLastEntity = Entity{static_cast<u32>(mLastEntity) + 1};
-  return eid;
-}
+    // Generation is already advanced when entity is deleted
+    mGenerations[index] &= ~DeadGenerationFlag;
+    return createEntity(index, mGenerations[index]);
+  }
 
-bool EntityStorageSparseSet::exists(Entity entity) const {
-  for (auto &deletedEntity : mDeleted) {
-    if (deletedEntity == entity)
-      return false;
+  // Indices beyond index bits would alias live entities
+  if (mGenerations.size() > EntityIndexMask) {
+    Engine::getLogger().error()
+        << "Entity is not created because maximum number of entities is "
+           "reached";
+    return Entity::Null;
   }
 
-  return entity > Entity::Null && entity < mLastEntity;
+  mNumEntities++;
+  mGenerations.push_back(0);
+  return createEntity(mGenerations.size() - 1, 0);
 }
 
 void EntityStorageSparseSet::deleteEntity(Entity entity) {
-  if (entity == Entity::Null)
+  if (!exists(entity))
     return;
 
   deleteAllEntityComponents(entity);
-  mDeleted.push_back(entity);
+
+  usize index = getEntityIndex(entity);
   this->mNumEntities--;
+
+  // Slot is retired when its generation is exhausted
+  // because wrapping the generation around would make
+  // the oldest stale handles of the slot valid again
+  if (mGenerations[index] == EntityGenerationMask) {
+    mGenerations[index] = DeadGenerationFlag;
+    return;
+  }
+
+  mGenerations[index] = (mGenerations[index] + 1) | DeadGenerationFlag;
+  mDeleted.push_back(index);
 }
 
 void EntityStorageSparseSet::destroy() {
@@ -51,12 +88,15 @@ void EntityStorageSparseSet::destroy() {
 
 void EntityStorageSparseSet::deleteAllEntityComponents(Entity entity) {
   for (auto &[index, pool] : mComponentPools) {
-    usize sEntity = static_cast<usize>(entity);
+    usize sEntity = getEntityIndex(entity);
 
     if (sEntity < pool.entityIndices.size() &&
         pool.entityIndices[sEntity] < DeadIndex) {
+      for (auto group : pool.groups) {
+        removeFromGroup(group, entity);
+      }
 
-      usize movedEntity = static_cast<usize>(pool.entities.back());
+      Entity movedEntity = pool.entities.back();
       usize entityIndexToDelete = pool.entityIndices[sEntity];
 
       auto &observers = mRemoveObserverPools.at(index);
@@ -66,10 +106,10 @@ void EntityStorageSparseSet::deleteAllEntityComponents(Entity entity) {
       }
 
       // Move last entity in the array to place of deleted entity
-      pool.entities[entityIndexToDelete] = static_cast<Entity>(movedEntity);
+      pool.entities[entityIndexToDelete] = movedEntity;
 
       // Change index of moved entity to the index of deleted entity
-      pool.entityIndices[movedEntity] = entityIndexToDelete;
+      pool.entityIndices[getEntityIndex(movedEntity)] = entityIndexToDelete;
 
       // Delete last item from entities array
       pool.entities.pop_back();
@@ -80,13 +120,16 @@ void EntityStorageSparseSet::deleteAllEntityComponents(Entity entity) {
       // Delete last item from components array
       pool.components.pop_back();
 
+      // Move versions of last component
+      pool.popVersions(entityIndexToDelete);
+
       pool.entityIndices[sEntity] = DeadIndex;
     }
   }
 }
 
 void EntityStorageSparseSet::deleteAllEntities() {
-  mLastEntity = Entity{1};
+  mGenerations.assign(1, DeadGenerationFlag);
   mDeleted.clear();
   mNumEntities = 0;
 }
@@ -96,6 +139,12 @@ void EntityStorageSparseSet::deleteAllComponents() {
     pool.components.clear();
     pool.entities.clear();
     pool.entityIndices.clear();
+    pool.clearVersions();
+    pool.groupVersion++;
+  }
+
+  for (auto &group : mGroups) {
+    group.size = 0;
   }
 }
 
@@ -105,4 +154,87 @@ void EntityStorageSparseSet::deleteAllObservers() {
   }
 }
 
+usize EntityStorageSparseSet::createGroup(
+    std::vector<std::type_index> owned, std::vector<std::type_index> included) {
+  QuollAssert(!owned.empty(), "Group must own at least one component");
+
+  for (auto id : owned) {
+    for (const auto &group : mGroups) {
+      QuollAssert(std::find(group.owned.begin(), group.owned.end(), id) ==
+                      group.owned.end(),
+                  "Component " + String(id.name()) +
+                      " is already owned by another group");
+    }
+  }
+
+  usize groupIndex = mGroups.size();
+  mGroups.push_back({std::move(owned), std::move(included), 0});
+
+  const auto &group = mGroups.at(groupIndex);
+  for (auto id : group.owned) {
+    mComponentPools.at(id).groups.push_back(groupIndex);
+  }
+
+  for (auto id : group.included) {
+    mComponentPools.at(id).groups.push_back(groupIndex);
+  }
+
+  // Entities that are added to the group are moved
+  // to indices that are already visited
+  const auto &entities = mComponentPools.at(group.owned.front()).entities;
+  for (usize i = 0; i < entities.size(); ++i) {
+    addToGroup(groupIndex, entities.at(i));
+  }
+
+  return groupIndex;
+}
+
+void EntityStorageSparseSet::addToGroup(usize groupIndex, Entity entity) {
+  auto &group = mGroups.at(groupIndex);
+  usize sEntity = getEntityIndex(entity);
+
+  auto hasComponent = [this, sEntity](std::type_index id) {
+    const auto &pool = mComponentPools.at(id);
+    return sEntity < pool.entityIndices.size() &&
+           pool.entityIndices[sEntity] != DeadIndex;
+  };
+
+  if (!std::all_of(group.owned.begin(), group.owned.end(), hasComponent) ||
+      !std::all_of(group.included.begin(), group.included.end(),
+                   hasComponent)) {
+    return;
+  }
+
+  if (mComponentPools.at(group.owned.front()).entityIndices[sEntity] <
+      group.size) {
+    return;
+  }
+
+  for (auto id : group.owned) {
+    auto &pool = mComponentPools.at(id);
+    swapPoolItems(pool, pool.entityIndices[sEntity], group.size);
+    pool.groupVersion++;
+  }
+
+  group.size++;
+}
+
+void EntityStorageSparseSet::removeFromGroup(usize groupIndex, Entity entity) {
+  auto &group = mGroups.at(groupIndex);
+  usize sEntity = getEntityIndex(entity);
+
+  const auto &firstPool = mComponentPools.at(group.owned.front());
+  if (sEntity >= firstPool.entityIndices.size() ||
+      firstPool.entityIndices[sEntity] >= group.size) {
+    return;
+  }
+
+  group.size--;
+  for (auto id : group.owned) {
+    auto &pool = mComponentPools.at(id);
+    swapPoolItems(pool, pool.entityIndices[sEntity], group.size);
+    pool.groupVersion++;
+  }
+}
+
 } // namespace quoll
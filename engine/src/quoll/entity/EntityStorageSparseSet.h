@@ -4,7 +4,9 @@
 #include "EntityUtils.h"
 #include "EntityStorageSparseSetComponentPool.h"
 #include "EntityStorageSparseSetView.h"
+#include "EntityStorageSparseSetGroup.h"
 #include "EntityStorageSparseSetObserver.h"
+#include "EntityStorageSparseSetChangeObserver.h"
 
 namespace quoll {
 
@@ -14,6 +16,8 @@ namespace quoll {
 class EntityStorageSparseSet {
   static constexpr usize DeadIndex = std::numeric_limits<usize>::max();
 
+  static constexpr u32 DeadGenerationFlag = 1u << 31;
+
   static constexpr usize MaxObserverPoolSizePerComponent = 100;
 
 public:
@@ -59,18 +63,26 @@ public:
   /**
    * @brief Create entity
    *
-   * @return Newly created entity
+   * @return Newly created entity or null entity
+   *         if maximum number of entities is reached
    */
   Entity create();
 
   /**
    * @brief Check if entity exists
    *
+   * Entity exists if generation of the handle
+   * matches generation of the entity slot.
+   *
    * @param entity Entity
    * @retval true Entity exists
    * @retval false Entity does not exist
    */
-  bool exists(Entity entity) const;
+  inline bool exists(Entity entity) const {
+    usize index = getEntityIndex(entity);
+    return index < mGenerations.size() &&
+           mGenerations[index] == getEntityGeneration(entity);
+  }
 
   /**
    * @brief Get number of entities
@@ -91,7 +103,8 @@ public:
    *
    * Adds component if component does not
    * exist or updates component if it exists
-   * in entity
+   * in entity. Marks component as added or
+   * updated respectively.
    *
    * @tparam ComponentType Component type
    * @param entity Entity
@@ -105,7 +118,7 @@ public:
 
     auto &pool = getPoolForComponent<TComponentType>();
 
-    usize sEntity = static_cast<usize>(entity);
+    usize sEntity = getEntityIndex(entity);
     if (sEntity >= pool.entityIndices.size()) {
       // TODO: Make this better
       pool.entityIndices.resize((sEntity + 1) * 2, DeadIndex);
@@ -115,10 +128,16 @@ public:
     if (index != DeadIndex) {
       pool.components[index] = value;
       pool.entities[index] = entity;
+      pool.markUpdated(index);
     } else {
       pool.entities.push_back(entity);
       pool.components.push_back(value);
+      pool.pushVersions();
       pool.entityIndices[sEntity] = pool.entities.size() - 1;
+
+      for (auto group : pool.groups) {
+        addToGroup(group, entity);
+      }
     }
   }
 
@@ -138,12 +157,14 @@ public:
     const auto &pool = getPoolForComponent<TComponentType>();
 
     return std::any_cast<const TComponentType &>(
-        pool.components[pool.entityIndices[static_cast<usize>(entity)]]);
+        pool.components[pool.entityIndices[getEntityIndex(entity)]]);
   }
 
   /**
    * @brief Get component
    *
+   * Marks component as updated
+   *
    * @tparam ComponentType Component type
    * @param entity Entity
    * @return Component value
@@ -155,23 +176,46 @@ public:
                     std::to_string(static_cast<u32>(entity)));
     auto &pool = getPoolForComponent<TComponentType>();
 
-    return std::any_cast<TComponentType &>(
-        pool.components[pool.entityIndices[static_cast<usize>(entity)]]);
+    usize index = pool.entityIndices[getEntityIndex(entity)];
+    pool.markUpdated(index);
+    return std::any_cast<TComponentType &>(pool.components[index]);
+  }
+
+  /**
+   * @brief Update component in place
+   *
+   * Marks component as updated
+   *
+   * @tparam TComponentType Component type
+   * @tparam TPatchFn Patch function type
+   * @param entity Entity
+   * @param patchFn Function that modifies component
+   * @return Component value
+   */
+  template <class TComponentType, class TPatchFn>
+  TComponentType &patch(Entity entity, TPatchFn &&patchFn) {
+    auto &component = get<TComponentType>(entity);
+    patchFn(component);
+    return component;
   }
 
   /**
    * @brief Check if component exists in entity
    *
+   * Stale entity handles never have components
+   * even if their slot is reused by another entity
+   *
    * @tparam ComponentType Component type
    * @param entity Entity
    * @retval true Entity has component
    * @retval false Entity does not have component
    */
   template <class TComponentType> bool has(Entity entity) const {
-    usize sEntity = static_cast<usize>(entity);
+    usize sEntity = getEntityIndex(entity);
     const auto &pool = getPoolForComponent<TComponentType>();
     return sEntity < pool.entityIndices.size() &&
-           pool.entityIndices[sEntity] != DeadIndex;
+           pool.entityIndices[sEntity] != DeadIndex &&
+           pool.entities[pool.entityIndices[sEntity]] == entity;
   }
 
   /**
@@ -181,14 +225,18 @@ public:
    * @param entity Entity
    */
   template <class TComponentType> void remove(Entity entity) {
-    usize sEntity = static_cast<usize>(entity);
+    usize sEntity = getEntityIndex(entity);
 
     auto &pool = getPoolForComponent<TComponentType>();
-    QuollAssert(sEntity < pool.entityIndices.size(),
+    QuollAssert(has<TComponentType>(entity),
                 "Component named " + String(typeid(TComponentType).name()) +
                     " does not exist for entity " +
                     std::to_string(static_cast<u32>(entity)));
 
+    for (auto group : pool.groups) {
+      removeFromGroup(group, entity);
+    }
+
     usize entityIndexToDelete = pool.entityIndices[sEntity];
 
     auto &observers = getRemoveObserverPoolForComponent<TComponentType>();
@@ -203,7 +251,7 @@ public:
     pool.entities[entityIndexToDelete] = movedEntity;
 
     // Change index of moved entity to the index of deleted entity
-    pool.entityIndices[static_cast<usize>(movedEntity)] = entityIndexToDelete;
+    pool.entityIndices[getEntityIndex(movedEntity)] = entityIndexToDelete;
 
     // Delete last item from entities array
     pool.entities.pop_back();
@@ -214,6 +262,9 @@ public:
     // Delete last item from components array
     pool.components.pop_back();
 
+    // Move versions of last component
+    pool.popVersions(entityIndexToDelete);
+
     pool.entityIndices[sEntity] = DeadIndex;
   }
 
@@ -243,6 +294,14 @@ public:
     pool.components.clear();
     pool.entities.clear();
     pool.entityIndices.clear();
+    pool.clearVersions();
+
+    for (auto group : pool.groups) {
+      mGroups.at(group).size = 0;
+      for (auto id : mGroups.at(group).owned) {
+        mComponentPools.at(id).groupVersion++;
+      }
+    }
   }
 
   /**
@@ -259,6 +318,84 @@ public:
     return EntityStorageSparseSetView<TPickComponents...>(pickedPools);
   }
 
+  /**
+   * @brief Get view with excluded components
+   *
+   * @tparam ...TPickComponents Picked components
+   * @tparam ...TExcludeComponents Excluded components
+   * @param exclude Excluded components
+   * @return View
+   */
+  template <class... TPickComponents, class... TExcludeComponents>
+  EntityStorageSparseSetView<TPickComponents...>
+  view(EntityStorageSparseSetExclude<TExcludeComponents...> exclude) {
+    std::array<EntityStorageSparseSetComponentPool *,
+               sizeof...(TPickComponents)>
+        pickedPools{&getPoolForComponent<TPickComponents>()...};
+    return EntityStorageSparseSetView<TPickComponents...>(
+        pickedPools, getExcludedPools<TExcludeComponents...>());
+  }
+
+  /**
+   * @brief Get owned group
+   *
+   * Group is created on first access. Owned
+   * components of entities in the group are
+   * kept packed in the same order, which allows
+   * iterating them without sparse lookups.
+   *
+   * A component can only be owned by one group.
+   *
+   * Entities must not enter or leave the group
+   * while it is iterated because that reorders
+   * owned pools. Adding or removing components
+   * of the group and deleting entities in the
+   * group assert during iteration. Defer these
+   * changes until iteration is finished.
+   *
+   * @tparam ...TOwnedComponents Owned components
+   * @tparam ...TIncludeComponents Included components
+   * @param include Included components
+   * @param exclude Excluded components
+   * @return Group
+   */
+  template <class... TOwnedComponents, class... TIncludeComponents,
+            class... TExcludeComponents>
+  EntityStorageSparseSetGroup<sizeof...(TOwnedComponents),
+                              TOwnedComponents..., TIncludeComponents...>
+  group(EntityStorageSparseSetInclude<TIncludeComponents...> include = {},
+        EntityStorageSparseSetExclude<TExcludeComponents...> exclude = {}) {
+    usize groupIndex =
+        getOrCreateGroup<std::tuple<TOwnedComponents...>,
+                         std::tuple<TIncludeComponents...>>();
+
+    std::array<EntityStorageSparseSetComponentPool *,
+               sizeof...(TOwnedComponents) + sizeof...(TIncludeComponents)>
+        pickedPools{&getPoolForComponent<TOwnedComponents>()...,
+                    &getPoolForComponent<TIncludeComponents>()...};
+
+    return EntityStorageSparseSetGroup<sizeof...(TOwnedComponents),
+                                       TOwnedComponents...,
+                                       TIncludeComponents...>(
+        pickedPools, mGroups.at(groupIndex).size,
+        getExcludedPools<TExcludeComponents...>());
+  }
+
+  /**
+   * @brief Get owned group with excluded components
+   *
+   * @tparam ...TOwnedComponents Owned components
+   * @tparam ...TExcludeComponents Excluded components
+   * @param exclude Excluded components
+   * @return Group
+   */
+  template <class... TOwnedComponents, class... TExcludeComponents>
+  EntityStorageSparseSetGroup<sizeof...(TOwnedComponents), TOwnedComponents...>
+  group(EntityStorageSparseSetExclude<TExcludeComponents...> exclude) {
+    return group<TOwnedComponents...>(EntityStorageSparseSetInclude<>{},
+                                      exclude);
+  }
+
   /**
    * @brief Observe component remove
    *
@@ -278,6 +415,43 @@ public:
         &observers.at(observers.size() - 1));
   }
 
+  /**
+   * @brief Observe component add
+   *
+   * Observer visits components that are
+   * added after the observer is created or
+   * last cleared
+   *
+   * @tparam TComponentType Component type to observe
+   * @return Observer
+   */
+  template <class TComponentType>
+  EntityStorageSparseSetChangeObserver<TComponentType> observeAdd() {
+    return EntityStorageSparseSetChangeObserver<TComponentType>(
+        &getPoolForComponent<TComponentType>(),
+        EntityStorageSparseSetChangeType::Added);
+  }
+
+  /**
+   * @brief Observe component update
+   *
+   * Observer visits components that are set,
+   * patched, or retrieved mutably after the
+   * observer is created or last cleared. This
+   * includes non-constant components accessed
+   * through views and groups. Added components
+   * are visited as well.
+   *
+   * @tparam TComponentType Component type to observe
+   * @return Observer
+   */
+  template <class TComponentType>
+  EntityStorageSparseSetChangeObserver<TComponentType> observeUpdate() {
+    return EntityStorageSparseSetChangeObserver<TComponentType>(
+        &getPoolForComponent<TComponentType>(),
+        EntityStorageSparseSetChangeType::Updated);
+  }
+
 private:
   /**
    * @brief Get component id from type
@@ -344,6 +518,100 @@ private:
     return mRemoveObserverPools.at(id);
   }
 
+  /**
+   * @brief Get excluded pools
+   *
+   * @tparam ...TExcludeComponents Excluded components
+   * @return Excluded pools
+   */
+  template <class... TExcludeComponents>
+  EntityStorageSparseSetExcludedPools getExcludedPools() {
+    static_assert(sizeof...(TExcludeComponents) <=
+                      EntityStorageSparseSetExcludedPools::MaxSize,
+                  "Too many excluded components");
+
+    return EntityStorageSparseSetExcludedPools{
+        {&getPoolForComponent<TExcludeComponents>()...},
+        sizeof...(TExcludeComponents)};
+  }
+
+  /**
+   * @brief Get or create group
+   *
+   * @tparam TOwnedTuple Tuple of owned components
+   * @tparam TIncludeTuple Tuple of included components
+   * @return Group index
+   */
+  template <class TOwnedTuple, class TIncludeTuple> usize getOrCreateGroup() {
+    auto owned = getComponentIds(static_cast<TOwnedTuple *>(nullptr));
+    auto included = getComponentIds(static_cast<TIncludeTuple *>(nullptr));
+
+    // Groups store sorted component types; so, the
+    // same types in different order share the group
+    std::sort(owned.begin(), owned.end());
+    std::sort(included.begin(), included.end());
+
+    for (usize i = 0; i < mGroups.size(); ++i) {
+      const auto &group = mGroups.at(i);
+      if (std::equal(group.owned.begin(), group.owned.end(), owned.begin(),
+                     owned.end()) &&
+          std::equal(group.included.begin(), group.included.end(),
+                     included.begin(), included.end())) {
+        return i;
+      }
+    }
+
+    return createGroup({owned.begin(), owned.end()},
+                       {included.begin(), included.end()});
+  }
+
+  /**
+   * @brief Get component ids from tuple
+   *
+   * @tparam ...TComponentTypes Component types
+   * @param tuple Tuple type tag
+   * @return Component ids
+   */
+  template <class... TComponentTypes>
+  static std::array<std::type_index, sizeof...(TComponentTypes)>
+  getComponentIds(std::tuple<TComponentTypes...> *tuple) {
+    return {getComponentId<TComponentTypes>()...};
+  }
+
+  /**
+   * @brief Create group
+   *
+   * Packs all existing entities that belong to the group
+   *
+   * @param owned Owned component ids
+   * @param included Included component ids
+   * @return Group index
+   */
+  usize createGroup(std::vector<std::type_index> owned,
+                    std::vector<std::type_index> included);
+
+  /**
+   * @brief Add entity to group
+   *
+   * Moves components of the entity to the end of the
+   * packed range if entity has all group components
+   *
+   * @param groupIndex Group index
+   * @param entity Entity
+   */
+  void addToGroup(usize groupIndex, Entity entity);
+
+  /**
+   * @brief Remove entity from group
+   *
+   * Moves components of the entity out of the
+   * packed range if entity is in the group
+   *
+   * @param groupIndex Group index
+   * @param entity Entity
+   */
+  void removeFromGroup(usize groupIndex, Entity entity);
+
   /**
    * @brief Check if component pool exists
    *
@@ -387,12 +655,13 @@ private:
 
     for (usize i = 0; i < smallestEntities.size(); ++i) {
       Entity entity = smallestEntities[i];
+      usize sEntity = getEntityIndex(entity);
 
       bool isDead = false;
       for (usize i = 0; i < pickedPools.size() && !isDead; ++i) {
         auto *pool = pickedPools.at(i);
-        isDead = entity >= pool->entityIndices.size() ||
-                 pool->entityIndices[entity] == DeadIndex;
+        isDead = sEntity >= pool->entityIndices.size() ||
+                 pool->entityIndices[sEntity] == DeadIndex;
       }
 
       if (isDead) {
@@ -401,7 +670,7 @@ private:
 
       const auto &indices =
           std::array{std::get<TPickComponentIndices>(pickedPools)
-                         ->entityIndices[entity]...};
+                         ->entityIndices[sEntity]...};
 
       std::tuple<TPickComponents &...> components = {
           std::any_cast<TPickComponents &>(
@@ -445,8 +714,10 @@ private:
                      std::vector<EntityStorageSparseSetComponentPool>>
       mRemoveObserverPools;
 
-  Entity mLastEntity{1};
-  std::list<Entity> mDeleted;
+  std::vector<EntityStorageSparseSetGroupData> mGroups;
+
+  std::vector<u32> mGenerations{DeadGenerationFlag};
+  std::deque<usize> mDeleted;
   usize mNumEntities = 0;
 };
 
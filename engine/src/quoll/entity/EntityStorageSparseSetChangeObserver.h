@@ -0,0 +1,209 @@
+#pragma once
+
+#include "EntityStorageSparseSetComponentPool.h"
+
+namespace quoll {
+
+/**
+ * @brief Type of observed component change
+ */
+enum class EntityStorageSparseSetChangeType { Added, Updated };
+
+/**
+ * @brief Change observer for sparse set based entity storage
+ *
+ * Observer does not store any data. It remembers
+ * the pool version at the time it was last cleared
+ * and visits components whose per-slot version is
+ * newer than the remembered one. Chunks of slots
+ * that have no newer versions are skipped.
+ *
+ * @tparam TComponent Component type
+ */
+template <class TComponent> class EntityStorageSparseSetChangeObserver {
+public:
+  /**
+   * @brief Observer iterator
+   */
+  class Iterator {
+  public:
+    /**
+     * @brief Create iterator
+     *
+     * @param index Index
+     * @param observer Observer
+     */
+    Iterator(usize index, const EntityStorageSparseSetChangeObserver &observer)
+        : mIndex(index), mObserver(observer) {}
+
+    /**
+     * @brief Increment iterator
+     *
+     * Increment over unchanged components
+     *
+     * @return This iterator
+     */
+    Iterator &operator++() {
+      mIndex = mObserver.findNextChanged(mIndex + 1);
+      return *this;
+    }
+
+    /**
+     * @brief Check if iterators are equal
+     *
+     * @param rhs Other iterator
+     * @retval true Iterators are equal
+     * @retval false Iterators are not equal
+     */
+    bool operator==(Iterator &rhs) { return mIndex == rhs.mIndex; }
+
+    /**
+     * @brief Check if iterators are not equal
+     *
+     * @param rhs Other iterator
+     * @retval true Iterators are not equal
+     * @retval false Iterators are equal
+     */
+    bool operator!=(Iterator &rhs) { return mIndex != rhs.mIndex; }
+
+    /**
+     * @brief Get value
+     *
+     * @return Tuple with first item as entity and second as component
+     */
+    std::tuple<Entity, TComponent &> operator*() {
+      return {mObserver.mPool->entities[mIndex],
+              std::any_cast<TComponent &>(
+                  mObserver.mPool->components[mIndex])};
+    }
+
+  private:
+    usize mIndex = 0;
+    const EntityStorageSparseSetChangeObserver &mObserver;
+  };
+
+public:
+  /**
+   * @brief Create observer
+   */
+  EntityStorageSparseSetChangeObserver() = default;
+
+  /**
+   * @brief Create observer
+   *
+   * @param pool Component pool
+   * @param type Change type
+   */
+  EntityStorageSparseSetChangeObserver(
+      EntityStorageSparseSetComponentPool *pool,
+      EntityStorageSparseSetChangeType type)
+      : mPool(pool), mType(type), mLastVersion(pool->version) {}
+
+  /**
+   * @brief Get begin iterator
+   *
+   * @return Begin iterator
+   */
+  Iterator begin() {
+    QuollAssert(mPool != nullptr, "Observer is not initialized");
+
+    return Iterator(findNextChanged(0), *this);
+  }
+
+  /**
+   * @brief Get end iterator
+   *
+   * @return End iterator
+   */
+  Iterator end() { return Iterator(mPool->entities.size(), *this); }
+
+  /**
+   * @brief Get number of changed components
+   *
+   * @return Number of changed components
+   */
+  usize size() const {
+    usize count = 0;
+    for (usize index = findNextChanged(0); index < mPool->entities.size();
+         index = findNextChanged(index + 1)) {
+      count++;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief Check if there are no changes
+   *
+   * @retval true No changes since last clear
+   * @retval false There are changes since last clear
+   */
+  inline bool empty() const {
+    return findNextChanged(0) == mPool->entities.size();
+  }
+
+  /**
+   * @brief Clear observed changes
+   */
+  inline void clear() { mLastVersion = mPool->version; }
+
+private:
+  /**
+   * @brief Get versions of observed change type
+   *
+   * @return Per slot versions
+   */
+  inline const std::vector<u64> &getVersions() const {
+    return mType == EntityStorageSparseSetChangeType::Added
+               ? mPool->addedVersions
+               : mPool->updatedVersions;
+  }
+
+  /**
+   * @brief Get chunk versions of observed change type
+   *
+   * @return Per chunk versions
+   */
+  inline const std::vector<u64> &getChunkVersions() const {
+    return mType == EntityStorageSparseSetChangeType::Added
+               ? mPool->addedChunkVersions
+               : mPool->updatedChunkVersions;
+  }
+
+  /**
+   * @brief Find next changed component
+   *
+   * @param index Index to start searching from
+   * @return Index of next changed component
+   */
+  usize findNextChanged(usize index) const {
+    if (mPool->version == mLastVersion) {
+      return mPool->entities.size();
+    }
+
+    static constexpr usize ChunkSize =
+        EntityStorageSparseSetComponentPool::VersionChunkSize;
+
+    const auto &versions = getVersions();
+    const auto &chunkVersions = getChunkVersions();
+    while (index < versions.size()) {
+      if (chunkVersions[index / ChunkSize] <= mLastVersion) {
+        index = (index / ChunkSize + 1) * ChunkSize;
+      } else if (versions[index] <= mLastVersion) {
+        index++;
+      } else {
+        return index;
+      }
+    }
+
+    return mPool->entities.size();
+  }
+
+private:
+  EntityStorageSparseSetComponentPool *mPool = nullptr;
+  EntityStorageSparseSetChangeType mType =
+      EntityStorageSparseSetChangeType::Updated;
+  u64 mLastVersion = 0;
+};
+
+} // namespace quoll
@@ -20,6 +20,149 @@ struct EntityStorageSparseSetComponentPool {
    * List of components
    */
   std::vector<std::any> components;
+
+  /**
+   * Indices of groups that use this component
+   */
+  std::vector<usize> groups;
+
+  /**
+   * Version at which component is added
+   *
+   * Stored per dense slot
+   */
+  std::vector<u64> addedVersions;
+
+  /**
+   * Version at which component is last updated
+   *
+   * Stored per dense slot
+   */
+  std::vector<u64> updatedVersions;
+
+  /**
+   * Highest added version in each chunk of dense slots
+   *
+   * Lets change observers skip unchanged chunks
+   */
+  std::vector<u64> addedChunkVersions;
+
+  /**
+   * Highest updated version in each chunk of dense slots
+   *
+   * Lets change observers skip unchanged chunks
+   */
+  std::vector<u64> updatedChunkVersions;
+
+  /**
+   * Last change version
+   */
+  u64 version = 0;
+
+  /**
+   * Version of the group that owns this pool
+   *
+   * Changes when entities enter or leave the group
+   */
+  u64 groupVersion = 0;
+
+  /**
+   * Number of dense slots in a version chunk
+   */
+  static constexpr usize VersionChunkSize = 64;
+
+  /**
+   * @brief Add versions for new component
+   *
+   * Component is pushed to the back of the pool
+   * and is marked as added and updated
+   */
+  void pushVersions() {
+    version++;
+    addedVersions.push_back(version);
+    updatedVersions.push_back(version);
+
+    usize chunk = (addedVersions.size() - 1) / VersionChunkSize;
+    if (chunk >= addedChunkVersions.size()) {
+      addedChunkVersions.resize(chunk + 1, 0);
+      updatedChunkVersions.resize(chunk + 1, 0);
+    }
+
+    addedChunkVersions[chunk] = version;
+    updatedChunkVersions[chunk] = version;
+  }
+
+  /**
+   * @brief Mark component as updated
+   *
+   * @param index Dense slot index
+   */
+  void markUpdated(usize index) {
+    updatedVersions[index] = ++version;
+    updatedChunkVersions[index / VersionChunkSize] = version;
+  }
+
+  /**
+   * @brief Move versions of last component
+   *
+   * Moves versions of the last component to the
+   * removed slot and pops the last versions
+   *
+   * @param index Dense slot index of removed component
+   */
+  void popVersions(usize index) {
+    addedVersions[index] = addedVersions.back();
+    addedVersions.pop_back();
+    updatedVersions[index] = updatedVersions.back();
+    updatedVersions.pop_back();
+
+    if (index < addedVersions.size()) {
+      touchChunks(index);
+    }
+  }
+
+  /**
+   * @brief Swap versions of two components
+   *
+   * @param a First dense slot index
+   * @param b Second dense slot index
+   */
+  void swapVersions(usize a, usize b) {
+    std::swap(addedVersions[a], addedVersions[b]);
+    std::swap(updatedVersions[a], updatedVersions[b]);
+    touchChunks(a);
+    touchChunks(b);
+  }
+
+  /**
+   * @brief Clear all versions
+   *
+   * Pool version is kept so that existing
+   * observers do not see stale changes
+   */
+  void clearVersions() {
+    addedVersions.clear();
+    updatedVersions.clear();
+    addedChunkVersions.clear();
+    updatedChunkVersions.clear();
+  }
+
+private:
+  /**
+   * @brief Raise chunk versions to versions of slot
+   *
+   * Chunk versions are upper bounds. They are
+   * never lowered when slots move out of a chunk.
+   *
+   * @param index Dense slot index
+   */
+  void touchChunks(usize index) {
+    usize chunk = index / VersionChunkSize;
+    addedChunkVersions[chunk] =
+        std::max(addedChunkVersions[chunk], addedVersions[index]);
+    updatedChunkVersions[chunk] =
+        std::max(updatedChunkVersions[chunk], updatedVersions[index]);
+  }
 };
 
 } // namespace quoll
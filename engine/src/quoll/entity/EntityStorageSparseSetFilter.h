@@ -0,0 +1,84 @@
+#pragma once
+
+#include "EntityStorageSparseSetComponentPool.h"
+
+namespace quoll {
+
+/**
+ * @brief Components that must not exist in entity
+ *
+ * Used to filter entities out of views and groups
+ *
+ * @tparam ...TComponentTypes Excluded component types
+ */
+template <class... TComponentTypes> struct EntityStorageSparseSetExclude {};
+
+/**
+ * @brief Components that are required but not owned by group
+ *
+ * Group keeps owned components packed in the same order
+ * while included components are accessed through their
+ * sparse arrays.
+ *
+ * @tparam ...TComponentTypes Included component types
+ */
+template <class... TComponentTypes> struct EntityStorageSparseSetInclude {};
+
+/**
+ * @brief Exclude components from view or group
+ *
+ * @tparam ...TComponentTypes Excluded component types
+ */
+template <class... TComponentTypes>
+inline constexpr EntityStorageSparseSetExclude<TComponentTypes...> exclude{};
+
+/**
+ * @brief Include non-owned components in group
+ *
+ * @tparam ...TComponentTypes Included component types
+ */
+template <class... TComponentTypes>
+inline constexpr EntityStorageSparseSetInclude<TComponentTypes...> include{};
+
+/**
+ * @brief Pools of excluded components
+ */
+struct EntityStorageSparseSetExcludedPools {
+  static constexpr usize DeadIndex = std::numeric_limits<usize>::max();
+
+  /**
+   * @brief Maximum number of excluded components
+   */
+  static constexpr usize MaxSize = 4;
+
+  /**
+   * Excluded pools
+   */
+  std::array<EntityStorageSparseSetComponentPool *, MaxSize> pools{};
+
+  /**
+   * Number of excluded pools
+   */
+  usize size = 0;
+
+  /**
+   * @brief Check if any of the excluded pools has entity
+   *
+   * @param entityIndex Entity index
+   * @retval true Entity exists in one of the pools
+   * @retval false Entity does not exist in any of the pools
+   */
+  inline bool contains(usize entityIndex) const {
+    for (usize i = 0; i < size; ++i) {
+      auto *pool = pools[i];
+      if (entityIndex < pool->entityIndices.size() &&
+          pool->entityIndices[entityIndex] != DeadIndex) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+};
+
+} // namespace quoll
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "EntityStorageSparseSetComponentPool.h"
+#include "EntityStorageSparseSetFilter.h"
+
+namespace quoll {
+
+/**
+ * @brief Group data for sparse set based entity storage
+ *
+ * First `size` items of every owned pool store
+ * entities that have all the owned and included
+ * components in the same order.
+ */
+struct EntityStorageSparseSetGroupData {
+  /**
+   * Owned component types
+   *
+   * Sorted by type index
+   */
+  std::vector<std::type_index> owned;
+
+  /**
+   * Included component types
+   *
+   * Sorted by type index
+   */
+  std::vector<std::type_index> included;
+
+  /**
+   * Number of entities in group
+   */
+  usize size = 0;
+};
+
+/**
+ * @brief Group for sparse set based entity storage
+ *
+ * Iterates over packed owned pools in lockstep. Owned
+ * components are accessed without sparse lookups.
+ * Accessing a component marks it as updated unless
+ * the component type is constant. Group must not be
+ * modified during iteration.
+ *
+ * @tparam TNumOwned Number of owned components
+ * @tparam ...TComponentTypes Owned components followed by included ones
+ */
+template <usize TNumOwned, class... TComponentTypes>
+class EntityStorageSparseSetGroup {
+  static_assert(TNumOwned > 0, "Group must own at least one component");
+
+  using PickedPools = std::array<EntityStorageSparseSetComponentPool *,
+                                 sizeof...(TComponentTypes)>;
+
+public:
+  /**
+   * @brief Group iterator
+   */
+  class Iterator {
+  public:
+    /**
+     * @brief Create iterator
+     *
+     * @param index Index
+     * @param group Group
+     */
+    Iterator(usize index, EntityStorageSparseSetGroup &group)
+        : mIndex(index), mGroup(group) {}
+
+    /**
+     * @brief Increment iterator
+     *
+     * Increment over excluded entities
+     *
+     * @return This iterator
+     */
+    Iterator &operator++() {
+      mGroup.assertNotModified();
+
+      do {
+        mIndex++;
+      } while (mIndex < mGroup.mSize && mGroup.isExcluded(mIndex));
+
+      return *this;
+    }
+
+    /**
+     * @brief Check if iterators are equal
+     *
+     * @param rhs Other iterator
+     * @retval true Iterators are equal
+     * @retval false Iterators are not equal
+     */
+    bool operator==(Iterator &rhs) { return mIndex == rhs.mIndex; }
+
+    /**
+     * @brief Check if iterators are not equal
+     *
+     * @param rhs Other iterator
+     * @retval true Iterators are not equal
+     * @retval false Iterators are equal
+     */
+    bool operator!=(Iterator &rhs) { return mIndex != rhs.mIndex; }
+
+    /**
+     * @brief Get value
+     *
+     * @return Tuple with first item as entity and rest as components
+     */
+    std::tuple<Entity, TComponentTypes &...> operator*() {
+      mGroup.assertNotModified();
+
+      return get(std::index_sequence_for<TComponentTypes...>{});
+    }
+
+  private:
+    /**
+     * @brief Get value
+     *
+     * @tparam ...TComponentIndices Component indices
+     * @param sequence Index sequence
+     * @return Tuple with first item as entity and rest as components
+     */
+    template <usize... TComponentIndices>
+    std::tuple<Entity, TComponentTypes &...>
+    get(std::index_sequence<TComponentIndices...> sequence) {
+      auto entity = mGroup.mPools.at(0)->entities[mIndex];
+
+      return {entity, getComponent<TComponentIndices>(entity)...};
+    }
+
+    /**
+     * @brief Get component
+     *
+     * Owned components are stored at iterator index
+     * while included components are found through
+     * the sparse array. Non-constant components are
+     * marked as updated.
+     *
+     * @tparam TIndex Component index
+     * @param entity Entity
+     * @return Component
+     */
+    template <usize TIndex> auto &getComponent(Entity entity) {
+      using TComponent =
+          std::tuple_element_t<TIndex, std::tuple<TComponentTypes...>>;
+      auto *pool = std::get<TIndex>(mGroup.mPools);
+
+      usize index = mIndex;
+      if constexpr (TIndex >= TNumOwned) {
+        index = pool->entityIndices[getEntityIndex(entity)];
+      }
+
+      if constexpr (!std::is_const_v<TComponent>) {
+        pool->markUpdated(index);
+      }
+
+      return std::any_cast<TComponent &>(pool->components[index]);
+    }
+
+  private:
+    usize mIndex = 0;
+    EntityStorageSparseSetGroup &mGroup;
+  };
+
+public:
+  /**
+   * @brief Create group for sparse set entity storage
+   *
+   * @param pools Owned pools followed by included pools
+   * @param size Number of entities in group
+   * @param excludedPools Excluded pools
+   */
+  EntityStorageSparseSetGroup(
+      PickedPools pools, usize size,
+      EntityStorageSparseSetExcludedPools excludedPools = {})
+      : mPools(pools), mSize(size), mExcludedPools(excludedPools),
+        mGroupVersion(pools.at(0)->groupVersion) {}
+
+  /**
+   * @brief Get begin iterator
+   *
+   * @return Begin iterator
+   */
+  Iterator begin() {
+    usize index = 0;
+    while (index < mSize && isExcluded(index)) {
+      index++;
+    }
+
+    return Iterator(index, *this);
+  }
+
+  /**
+   * @brief Get end iterator
+   *
+   * @return End iterator
+   */
+  Iterator end() { return Iterator(mSize, *this); }
+
+  /**
+   * @brief Get number of entities in group
+   *
+   * Excluded components are not taken into account
+   *
+   * @return Number of entities in group
+   */
+  inline usize size() const { return mSize; }
+
+private:
+  /**
+   * @brief Assert that group is not modified
+   *
+   * Entities that enter or leave the group are
+   * swapped in owned pools, which invalidates
+   * iterator indices and group size
+   */
+  inline void assertNotModified() const {
+    QuollAssert(mPools.at(0)->groupVersion == mGroupVersion,
+                "Group is modified during iteration");
+  }
+
+  /**
+   * @brief Check if entity at index is excluded
+   *
+   * @param index Index in owned pools
+   * @retval true Entity is excluded
+   * @retval false Entity is not excluded
+   */
+  inline bool isExcluded(usize index) const {
+    return mExcludedPools.contains(
+        getEntityIndex(mPools.at(0)->entities[index]));
+  }
+
+private:
+  PickedPools mPools;
+  usize mSize = 0;
+  EntityStorageSparseSetExcludedPools mExcludedPools;
+  u64 mGroupVersion = 0;
+};
+
+} // namespace quoll
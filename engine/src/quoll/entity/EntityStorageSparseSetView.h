@@ -1,12 +1,16 @@
 #pragma once
 
 #include "EntityStorageSparseSetComponentPool.h"
+#include "EntityStorageSparseSetFilter.h"
 
 namespace quoll {
 
 /**
  * @brief View for sparse set based entity storage
  *
+ * Accessing a component marks it as updated
+ * unless the component type is constant.
+ *
  * @tparam ...TComponentTypes Component types
  */
 template <class... TComponentTypes> class EntityStorageSparseSetView {
@@ -25,12 +29,10 @@ public:
      * @brief Create iterator
      *
      * @param index Index
-     * @param pools Picked pools
-     * @param smallestPool Smallest pool
+     * @param view View
      */
-    Iterator(usize index, PickedPools &pools,
-             EntityStorageSparseSetComponentPool *smallestPool)
-        : mIndex(index), mPools(pools), mSmallestPool(smallestPool) {}
+    Iterator(usize index, EntityStorageSparseSetView &view)
+        : mIndex(index), mView(view) {}
 
     /**
      * @brief Increment iterator
@@ -42,8 +44,8 @@ public:
     Iterator &operator++() {
       do {
         mIndex++;
-      } while (mIndex < mSmallestPool->entities.size() &&
-               !isValidIndex(mIndex, mPools, mSmallestPool));
+      } while (mIndex < mView.mSmallestPool->entities.size() &&
+               !mView.isValidIndex(mIndex));
 
       return *this;
     }
@@ -86,22 +88,42 @@ public:
     template <usize... TComponentIndices>
     std::tuple<Entity, TComponentTypes &...>
     get(std::index_sequence<TComponentIndices...> sequence) {
-      auto entity = mSmallestPool->entities.at(mIndex);
+      auto entity = mView.mSmallestPool->entities.at(mIndex);
 
       const auto &indices =
-          std::array{std::get<TComponentIndices>(mPools)
-                         ->entityIndices[static_cast<usize>(entity)]...};
+          std::array{std::get<TComponentIndices>(mView.mPools)
+                         ->entityIndices[getEntityIndex(entity)]...};
+
+      (markUpdated<TComponentIndices>(std::get<TComponentIndices>(indices)),
+       ...);
 
-      return {mSmallestPool->entities.at(mIndex),
+      return {entity,
               std::any_cast<TComponentTypes &>(
-                  std::get<TComponentIndices>(mPools)
+                  std::get<TComponentIndices>(mView.mPools)
                       ->components[std::get<TComponentIndices>(indices)])...};
     }
 
+    /**
+     * @brief Mark component as updated
+     *
+     * Constant components are only read
+     * and are not marked
+     *
+     * @tparam TIndex Component index
+     * @param index Dense slot index
+     */
+    template <usize TIndex> void markUpdated(usize index) {
+      using TComponent =
+          std::tuple_element_t<TIndex, std::tuple<TComponentTypes...>>;
+
+      if constexpr (!std::is_const_v<TComponent>) {
+        std::get<TIndex>(mView.mPools)->markUpdated(index);
+      }
+    }
+
   private:
     usize mIndex = 0;
-    PickedPools &mPools;
-    EntityStorageSparseSetComponentPool *mSmallestPool = nullptr;
+    EntityStorageSparseSetView &mView;
   };
 
 public:
@@ -109,8 +131,11 @@ public:
    * @brief Create view for sparse set entity storage
    *
    * @param pools Picked pools
+   * @param excludedPools Excluded pools
    */
-  EntityStorageSparseSetView(PickedPools pools) : mPools(pools) {}
+  EntityStorageSparseSetView(
+      PickedPools pools, EntityStorageSparseSetExcludedPools excludedPools = {})
+      : mPools(pools), mExcludedPools(excludedPools) {}
 
   /**
    * @brief Get begin iterator
@@ -129,12 +154,11 @@ public:
     }
 
     usize index = 0;
-    while (index < mSmallestPool->entities.size() &&
-           !isValidIndex(index, mPools, mSmallestPool)) {
+    while (index < mSmallestPool->entities.size() && !isValidIndex(index)) {
       index++;
     }
 
-    return Iterator(index, mPools, mSmallestPool);
+    return Iterator(index, *this);
   }
 
   /**
@@ -147,34 +171,36 @@ public:
   Iterator end() {
     QuollAssert(mSmallestPool != nullptr, "Begin is not called");
 
-    return Iterator(mSmallestPool->entities.size(), mPools, mSmallestPool);
+    return Iterator(mSmallestPool->entities.size(), *this);
   }
 
 private:
   /**
    * @brief Check if index is valid
    *
-   * @param index Index
-   * @param pools Component pools
-   * @param smallestPool Smallest pools
+   * Entity at index is valid if it exists in all
+   * picked pools and does not exist in any of the
+   * excluded pools
+   *
+   * @param index Index in smallest pool
    * @retval true Index is valid
    * @retval false Index is not valid
    */
-  static bool isValidIndex(usize index, PickedPools &pools,
-                           EntityStorageSparseSetComponentPool *smallestPool) {
+  bool isValidIndex(usize index) const {
     bool isValid = true;
-    auto entity = static_cast<usize>(smallestPool->entities.at(index));
-    for (usize i = 0; i < pools.size() && isValid; ++i) {
-      auto *pool = pools.at(i);
+    auto entity = getEntityIndex(mSmallestPool->entities.at(index));
+    for (usize i = 0; i < mPools.size() && isValid; ++i) {
+      auto *pool = mPools.at(i);
       isValid = entity < pool->entityIndices.size() &&
                 pool->entityIndices[entity] != DeadIndex;
     }
 
-    return isValid;
+    return isValid && !mExcludedPools.contains(entity);
   }
 
 private:
   PickedPools mPools;
+  EntityStorageSparseSetExcludedPools mExcludedPools;
 
   EntityStorageSparseSetComponentPool *mSmallestPool = nullptr;
 };
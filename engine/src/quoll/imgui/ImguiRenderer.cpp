@@ -127,27 +127,77 @@ void ImguiRenderer::beginRendering() {
 
 void ImguiRenderer::endRendering() { ImGui::Render(); }
 
-void ImguiRenderer::updateFrameData(u32 frameIndex) {
-  auto *data = ImGui::GetDrawData();
+void ImguiRenderer::extractFrameData(u32 frameIndex) {
+  auto &frameObj = mFrameData.at(frameIndex);
+  frameObj.vertices.clear();
+  frameObj.indices.clear();
+  frameObj.commands.clear();
 
+  auto *data = ImGui::GetDrawData();
   if (!data)
     return;
 
-  int fbWidth = (int)(data->DisplaySize.x * data->FramebufferScale.x);
-  int fbHeight = (int)(data->DisplaySize.y * data->FramebufferScale.y);
-  if (fbWidth <= 0 || fbHeight <= 0)
+  frameObj.displayPos = {data->DisplayPos.x, data->DisplayPos.y};
+  frameObj.displaySize = {data->DisplaySize.x, data->DisplaySize.y};
+  frameObj.framebufferScale = {data->FramebufferScale.x,
+                               data->FramebufferScale.y};
+
+  if (data->TotalVtxCount <= 0) {
     return;
+  }
+
+  frameObj.vertices.reserve(data->TotalVtxCount);
+  frameObj.indices.reserve(data->TotalIdxCount);
+
+  u32 indexOffset = 0;
+  u32 vertexOffset = 0;
+  for (int n = 0; n < data->CmdListsCount; n++) {
+    const ImDrawList *cmdList = data->CmdLists[n];
+    frameObj.vertices.insert(frameObj.vertices.end(),
+                             cmdList->VtxBuffer.begin(),
+                             cmdList->VtxBuffer.end());
+    frameObj.indices.insert(frameObj.indices.end(), cmdList->IdxBuffer.begin(),
+                            cmdList->IdxBuffer.end());
+
+    for (const auto &cmd : cmdList->CmdBuffer) {
+      DrawCommand command{};
+      if (cmd.UserCallback != NULL) {
+        // Only render state reset can be replayed
+        // without imgui context; other callbacks
+        // are skipped
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+        if (cmd.UserCallback == ImDrawCallback_ResetRenderState) {
+          command.resetRenderState = true;
+          frameObj.commands.push_back(command);
+        }
+        continue;
+      }
+
+      command.clipRect = {cmd.ClipRect.x, cmd.ClipRect.y, cmd.ClipRect.z,
+                          cmd.ClipRect.w};
+      command.texture = static_cast<u32>(reinterpret_cast<uptr>(cmd.TextureId));
+      command.elemCount = cmd.ElemCount;
+      command.indexOffset = cmd.IdxOffset + indexOffset;
+      command.vertexOffset = cmd.VtxOffset + vertexOffset;
+      frameObj.commands.push_back(command);
+    }
+
+    indexOffset += cmdList->IdxBuffer.Size;
+    vertexOffset += cmdList->VtxBuffer.Size;
+  }
+}
 
+void ImguiRenderer::uploadFrameData(u32 frameIndex) {
   auto &frameObj = mFrameData.at(frameIndex);
 
-  if (data->TotalVtxCount <= 0) {
+  if (frameObj.vertices.empty()) {
     return;
   }
 
   usize vertexSize =
-      getAlignedBufferSize(data->TotalVtxCount * sizeof(ImDrawVert));
+      getAlignedBufferSize(frameObj.vertices.size() * sizeof(ImDrawVert));
   usize indexSize =
-      getAlignedBufferSize(data->TotalIdxCount * sizeof(ImDrawIdx));
+      getAlignedBufferSize(frameObj.indices.size() * sizeof(ImDrawIdx));
 
   if (frameObj.vertexBufferSize < vertexSize) {
     frameObj.vertexBuffer.resize(vertexSize);
@@ -159,33 +209,28 @@ void ImguiRenderer::updateFrameData(u32 frameIndex) {
     frameObj.indexBufferSize = indexSize;
   }
 
-  auto *vbDst = static_cast<ImDrawVert *>(frameObj.vertexBuffer.map());
-  auto *ibDst = static_cast<ImDrawIdx *>(frameObj.indexBuffer.map());
-
-  for (int n = 0; n < data->CmdListsCount; n++) {
-    const ImDrawList *cmd_list = data->CmdLists[n];
-    memcpy(vbDst, cmd_list->VtxBuffer.Data,
-           cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
-    memcpy(ibDst, cmd_list->IdxBuffer.Data,
-           cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
-    vbDst += cmd_list->VtxBuffer.Size;
-    ibDst += cmd_list->IdxBuffer.Size;
-  }
+  memcpy(frameObj.vertexBuffer.map(), frameObj.vertices.data(),
+         frameObj.vertices.size() * sizeof(ImDrawVert));
+  memcpy(frameObj.indexBuffer.map(), frameObj.indices.data(),
+         frameObj.indices.size() * sizeof(ImDrawIdx));
 
   frameObj.vertexBuffer.unmap();
   frameObj.indexBuffer.unmap();
 }
 
+void ImguiRenderer::updateFrameData(u32 frameIndex) {
+  extractFrameData(frameIndex);
+  uploadFrameData(frameIndex);
+}
+
 void ImguiRenderer::draw(rhi::RenderCommandList &commandList,
                          rhi::PipelineHandle pipeline, u32 frameIndex) {
-  auto *data = ImGui::GetDrawData();
+  const auto &frameObj = mFrameData.at(frameIndex);
+  const auto &displayPos = frameObj.displayPos;
+  const auto &scale = frameObj.framebufferScale;
 
-  if (!data)
-    return;
-
-  auto &frameObj = mFrameData.at(frameIndex);
-  int fbWidth = (int)(data->DisplaySize.x * data->FramebufferScale.x);
-  int fbHeight = (int)(data->DisplaySize.y * data->FramebufferScale.y);
+  int fbWidth = (int)(frameObj.displaySize.x * scale.x);
+  int fbHeight = (int)(frameObj.displaySize.y * scale.y);
 
   f32 realFbWidth = static_cast<f32>(fbWidth);
   f32 realFbHeight = static_cast<f32>(fbHeight);
@@ -196,95 +241,75 @@ void ImguiRenderer::draw(rhi::RenderCommandList &commandList,
   commandList.bindDescriptor(pipeline, 0,
                              mRenderStorage.getGlobalTexturesDescriptor());
 
-  setupRenderStates(data, commandList, fbWidth, fbHeight, pipeline, frameIndex);
+  setupRenderStates(frameObj, commandList, fbWidth, fbHeight, pipeline);
 
-  u32 indexOffset = 0;
-  u32 vertexOffset = 0;
-  for (int cmdListIdx = 0; cmdListIdx < data->CmdListsCount; ++cmdListIdx) {
-    const ImDrawList *cmdList = data->CmdLists[cmdListIdx];
-    for (int cmdIdx = 0; cmdIdx < cmdList->CmdBuffer.Size; ++cmdIdx) {
-      const ImDrawCmd *cmd = &cmdList->CmdBuffer[cmdIdx];
-      if (cmd->UserCallback != NULL) {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-        if (cmd->UserCallback == ImDrawCallback_ResetRenderState) {
-          setupRenderStates(data, commandList, fbWidth, fbHeight, pipeline,
-                            frameIndex);
-        } else {
-          cmd->UserCallback(cmdList, cmd);
-        }
-      } else {
-        glm::vec2 clipRectMin;
-        glm::vec2 clipRectMax;
-
-        clipRectMin.x =
-            (cmd->ClipRect.x - data->DisplayPos.x) * data->FramebufferScale.x;
-        clipRectMin.y =
-            (cmd->ClipRect.y - data->DisplayPos.y) * data->FramebufferScale.y;
-        clipRectMax.x =
-            (cmd->ClipRect.z - data->DisplayPos.x) * data->FramebufferScale.x;
-        clipRectMax.y =
-            (cmd->ClipRect.w - data->DisplayPos.y) * data->FramebufferScale.y;
-
-        if (clipRectMin.x < 0.0f) {
-          clipRectMin.x = 0.0f;
-        }
-        if (clipRectMin.y < 0.0f) {
-          clipRectMin.y = 0.0f;
-        }
+  for (const auto &cmd : frameObj.commands) {
+    if (cmd.resetRenderState) {
+      setupRenderStates(frameObj, commandList, fbWidth, fbHeight, pipeline);
+      continue;
+    }
 
-        if (clipRectMax.x > realFbWidth) {
-          clipRectMax.x = realFbWidth;
-        }
-        if (clipRectMax.y > realFbHeight) {
-          clipRectMax.y = realFbHeight;
-        }
+    glm::vec2 clipRectMin;
+    glm::vec2 clipRectMax;
 
-        if (clipRectMax.x <= clipRectMin.x || clipRectMax.y <= clipRectMin.y)
-          continue;
+    clipRectMin.x = (cmd.clipRect.x - displayPos.x) * scale.x;
+    clipRectMin.y = (cmd.clipRect.y - displayPos.y) * scale.y;
+    clipRectMax.x = (cmd.clipRect.z - displayPos.x) * scale.x;
+    clipRectMax.y = (cmd.clipRect.w - displayPos.y) * scale.y;
 
-        commandList.setScissor(clipRectMin, clipRectMax - clipRectMin);
-        commandList.bindPipeline(pipeline);
+    if (clipRectMin.x < 0.0f) {
+      clipRectMin.x = 0.0f;
+    }
+    if (clipRectMin.y < 0.0f) {
+      clipRectMin.y = 0.0f;
+    }
 
-        glm::uvec4 textureData{
-            static_cast<u32>(reinterpret_cast<uptr>(cmd->TextureId)),
-            rhi::castHandleToUint(mRenderStorage.getDefaultSampler()), 0, 0};
+    if (clipRectMax.x > realFbWidth) {
+      clipRectMax.x = realFbWidth;
+    }
+    if (clipRectMax.y > realFbHeight) {
+      clipRectMax.y = realFbHeight;
+    }
 
-        commandList.pushConstants(pipeline, rhi::ShaderStage::Fragment,
-                                  sizeof(glm::mat4), sizeof(glm::uvec4),
-                                  glm::value_ptr(textureData));
+    if (clipRectMax.x <= clipRectMin.x || clipRectMax.y <= clipRectMin.y)
+      continue;
 
-        commandList.drawIndexed(
-            cmd->ElemCount, cmd->IdxOffset + indexOffset,
-            static_cast<i32>(cmd->VtxOffset + vertexOffset));
-      }
-    }
-    indexOffset += cmdList->IdxBuffer.Size;
-    vertexOffset += cmdList->VtxBuffer.Size;
+    commandList.setScissor(clipRectMin, clipRectMax - clipRectMin);
+    commandList.bindPipeline(pipeline);
+
+    glm::uvec4 textureData{
+        cmd.texture, rhi::castHandleToUint(mRenderStorage.getDefaultSampler()),
+        0, 0};
+
+    commandList.pushConstants(pipeline, rhi::ShaderStage::Fragment,
+                              sizeof(glm::mat4), sizeof(glm::uvec4),
+                              glm::value_ptr(textureData));
+
+    commandList.drawIndexed(cmd.elemCount, cmd.indexOffset,
+                            static_cast<i32>(cmd.vertexOffset));
   }
 }
 
-void ImguiRenderer::setupRenderStates(ImDrawData *data,
+void ImguiRenderer::setupRenderStates(const FrameData &frameObj,
                                       rhi::RenderCommandList &commandList,
                                       int fbWidth, int fbHeight,
-                                      rhi::PipelineHandle pipeline,
-                                      u32 frameIndex) {
-  if (data->TotalVtxCount > 0) {
+                                      rhi::PipelineHandle pipeline) {
+  if (!frameObj.vertices.empty()) {
     std::array<u64, 1> offsets{0};
     commandList.bindVertexBuffers(
-        std::array{mFrameData.at(frameIndex).vertexBuffer.getHandle()},
-        offsets);
-    commandList.bindIndexBuffer(
-        mFrameData.at(frameIndex).indexBuffer.getHandle(),
-        sizeof(ImDrawIdx) == 2 ? rhi::IndexType::Uint16
-                               : rhi::IndexType::Uint32);
+        std::array{frameObj.vertexBuffer.getHandle()}, offsets);
+    commandList.bindIndexBuffer(frameObj.indexBuffer.getHandle(),
+                                sizeof(ImDrawIdx) == 2
+                                    ? rhi::IndexType::Uint16
+                                    : rhi::IndexType::Uint32);
   }
 
   commandList.setViewport({0, 0}, {fbWidth, fbHeight}, {0.0f, 1.0f});
 
-  f32 L = data->DisplayPos.x;
-  f32 R = data->DisplayPos.x + data->DisplaySize.x;
-  f32 T = data->DisplayPos.y;
-  f32 B = data->DisplayPos.y + data->DisplaySize.y;
+  f32 L = frameObj.displayPos.x;
+  f32 R = frameObj.displayPos.x + frameObj.displaySize.x;
+  f32 T = frameObj.displayPos.y;
+  f32 B = frameObj.displayPos.y + frameObj.displaySize.y;
 
   static constexpr usize MatrixSize = 16;
   const f32 SCALE_FACTOR = 2.0f;
@@ -31,10 +31,79 @@ struct ImguiRenderPassData {
  * @brief Imgui renderer
  */
 class ImguiRenderer {
+  /**
+   * @brief Imgui draw command
+   */
+  struct DrawCommand {
+    /**
+     * Clip rectangle
+     */
+    glm::vec4 clipRect{0.0f};
+
+    /**
+     * Texture
+     */
+    u32 texture = 0;
+
+    /**
+     * Number of indices
+     */
+    u32 elemCount = 0;
+
+    /**
+     * Index offset
+     */
+    u32 indexOffset = 0;
+
+    /**
+     * Vertex offset
+     */
+    u32 vertexOffset = 0;
+
+    /**
+     * Reset render state
+     */
+    bool resetRenderState = false;
+  };
+
   /**
    * @brief Imgui frame data
+   *
+   * Stores copy of imgui draw data; so,
+   * frame is drawn without accessing
+   * imgui context
    */
   struct FrameData {
+    /**
+     * Vertices
+     */
+    std::vector<ImDrawVert> vertices;
+
+    /**
+     * Indices
+     */
+    std::vector<ImDrawIdx> indices;
+
+    /**
+     * Draw commands
+     */
+    std::vector<DrawCommand> commands;
+
+    /**
+     * Display position
+     */
+    glm::vec2 displayPos{0.0f};
+
+    /**
+     * Display size
+     */
+    glm::vec2 displaySize{0.0f};
+
+    /**
+     * Framebuffer scale
+     */
+    glm::vec2 framebufferScale{1.0f};
+
     /**
      * Vertex buffer
      */
@@ -122,15 +191,37 @@ public:
   void endRendering();
 
   /**
-   * @brief Update frame data
+   * @brief Extract frame data from imgui
+   *
+   * Copies draw data of the last ended
+   * frame. Draw callbacks other than
+   * render state reset are not copied.
    *
-   * @param frameIndex
+   * @param frameIndex Frame index
+   */
+  void extractFrameData(u32 frameIndex);
+
+  /**
+   * @brief Upload extracted frame data
+   *
+   * Does not access imgui context
+   *
+   * @param frameIndex Frame index
+   */
+  void uploadFrameData(u32 frameIndex);
+
+  /**
+   * @brief Extract and upload frame data
+   *
+   * @param frameIndex Frame index
    */
   void updateFrameData(u32 frameIndex);
 
   /**
    * @brief Send imgui data to command list
    *
+   * Draws extracted frame data
+   *
    * @param commandList Command list
    * @param pipeline Pipeline
    * @param frameIndex Frame index
@@ -142,16 +233,15 @@ private:
   /**
    * @brief Setup remder states
    *
-   * @param data Imgui data
+   * @param frameObj Frame data
    * @param commandList Command list
    * @param fbWidth Framebuffer width
    * @param fbHeight Framebuffer height
    * @param pipeline Pipeline
-   * @param frameIndex Frame index
    */
-  void setupRenderStates(ImDrawData *data, rhi::RenderCommandList &commandList,
-                         int fbWidth, int fbHeight,
-                         rhi::PipelineHandle pipeline, u32 frameIndex);
+  void setupRenderStates(const FrameData &frameObj,
+                         rhi::RenderCommandList &commandList, int fbWidth,
+                         int fbHeight, rhi::PipelineHandle pipeline);
 
 private:
   RenderStorage &mRenderStorage;
@@ -1,4 +1,5 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/FrameAllocator.h"
 #include "InputMapSystem.h"
 
 namespace quoll {
@@ -18,7 +19,7 @@ void InputMapSystem::update(EntityDatabase &entityDatabase) {
     }
   }
 
-  std::vector<Entity> componentsToDelete(0);
+  FrameVector<Entity> componentsToDelete;
   for (auto [entity, ref] : entityDatabase.view<InputMap>()) {
     if (!entityDatabase.has<InputMapAssetRef>(entity)) {
       componentsToDelete.push_back(entity);
@@ -0,0 +1,144 @@
+#include "quoll/core/Base.h"
+#include "quoll/core/FrameArena.h"
+#include "quoll/profiler/Tracer.h"
+
+#include "FramePipeline.h"
+
+namespace quoll {
+
+FramePipeline::FramePipeline(u32 numSlots) : mNumSlots(numSlots) {
+  QuollAssert(numSlots > 0, "Frame pipeline must have at least one slot");
+}
+
+FramePipeline::~FramePipeline() { stop(); }
+
+void FramePipeline::setPrepareFn(const PrepareFn &prepareFn) {
+  mPrepareFn = prepareFn;
+}
+
+void FramePipeline::setRenderFn(const RenderFn &renderFn) {
+  mRenderFn = renderFn;
+}
+
+void FramePipeline::setSubmitFn(const SubmitFn &submitFn) {
+  mSubmitFn = submitFn;
+}
+
+void FramePipeline::enableRenderThread() {
+  QuollAssert(!mRenderThread.joinable(),
+              "Render thread must be enabled before pipeline is started");
+  mRenderThreadEnabled = true;
+}
+
+void FramePipeline::start() {
+  mFramePrepared = false;
+  mStopped = false;
+
+  if (mRenderThreadEnabled && !mRenderThread.joinable()) {
+    mRenderThread = std::thread([this] { runRenderThread(); });
+  }
+}
+
+void FramePipeline::stop() {
+  if (!mRenderThread.joinable()) {
+    return;
+  }
+
+  {
+    std::unique_lock lock(mFrameMutex);
+    mFrameCondition.wait(lock, [this] { return !mFramePrepared; });
+    mStopped = true;
+  }
+
+  mFrameCondition.notify_all();
+  mRenderThread.join();
+}
+
+void FramePipeline::frame(f32 alpha) {
+  if (!mRenderThread.joinable()) {
+    if (mPrepareFn) {
+      mPrepareFn(alpha, mSlot);
+    }
+
+    bool submitted = mRenderFn && mRenderFn(mSlot);
+    if (!submitted) {
+      return;
+    }
+
+    u32 slot = mSlot;
+    mSlot = (mSlot + 1) % mNumSlots;
+
+    if (mSubmitFn) {
+      mSubmitFn(slot);
+    }
+    return;
+  }
+
+  // Slot is only written by render thread
+  // while no frame is prepared
+  u32 slot = 0;
+  {
+    std::unique_lock lock(mFrameMutex);
+    mFrameCondition.wait(lock, [this] { return !mFramePrepared; });
+    slot = mSlot;
+  }
+
+  if (mPrepareFn) {
+    mPrepareFn(alpha, slot);
+  }
+
+  {
+    std::lock_guard lock(mFrameMutex);
+    mFramePrepared = true;
+  }
+
+  mFrameCondition.notify_all();
+}
+
+u32 FramePipeline::getSlot() {
+  std::lock_guard lock(mFrameMutex);
+  return mSlot;
+}
+
+void FramePipeline::runRenderThread() {
+  Tracer::setThreadName("Render");
+
+  while (true) {
+    u32 slot = 0;
+    {
+      std::unique_lock lock(mFrameMutex);
+      mFrameCondition.wait(lock, [this] { return mStopped || mFramePrepared; });
+
+      if (mStopped) {
+        return;
+      }
+
+      slot = mSlot;
+    }
+
+    bool submitted = mRenderFn && mRenderFn(slot);
+
+    // Prepared frame is released after render
+    // function; so, next frame is prepared
+    // while this frame is submitted. Skipped
+    // frames keep the slot; so, the next frame
+    // is prepared into the same slot.
+    {
+      std::lock_guard lock(mFrameMutex);
+      if (submitted) {
+        mSlot = (mSlot + 1) % mNumSlots;
+      }
+      mFramePrepared = false;
+    }
+
+    mFrameCondition.notify_all();
+
+    if (submitted && mSubmitFn) {
+      mSubmitFn(slot);
+    }
+
+    FrameArena::get().reset();
+  }
+}
+
+} // namespace quoll
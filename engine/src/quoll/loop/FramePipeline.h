@@ -0,0 +1,154 @@
+#pragma once
+
+namespace quoll {
+
+/**
+ * @brief Frame pipeline
+ *
+ * Every frame is prepared, rendered, and
+ * submitted. Prepare function extracts
+ * data that render function reads; so, the
+ * two never run at the same time. Submit
+ * function must not read data that prepare
+ * function writes.
+ *
+ * Frames are prepared into slots. Slot only
+ * advances when render function reports that
+ * the frame is submitted; so, slot of a frame
+ * matches frame index of the device, which
+ * also only advances on submitted frames.
+ * Skipped frames are prepared again into
+ * the same slot.
+ *
+ * With render thread, prepare function runs
+ * in the calling thread while render and
+ * submit functions run in render thread.
+ * Prepared frame is handed over to render
+ * thread; so, submission of a frame overlaps
+ * with updates of the next frame.
+ */
+class FramePipeline {
+public:
+  /**
+   * Prepare function
+   *
+   * Receives interpolation factor
+   * and frame slot
+   */
+  using PrepareFn = std::function<void(f32, u32)>;
+
+  /**
+   * Render function
+   *
+   * Receives frame slot and returns
+   * whether the frame will be submitted
+   */
+  using RenderFn = std::function<bool(u32)>;
+
+  /**
+   * Submit function
+   *
+   * Receives frame slot
+   */
+  using SubmitFn = std::function<void(u32)>;
+
+public:
+  /**
+   * @brief Create frame pipeline
+   *
+   * @param numSlots Number of frame slots
+   */
+  FramePipeline(u32 numSlots);
+
+  /**
+   * @brief Stop frame pipeline
+   */
+  ~FramePipeline();
+
+  FramePipeline(const FramePipeline &) = delete;
+  FramePipeline &operator=(const FramePipeline &) = delete;
+  FramePipeline(FramePipeline &&) = delete;
+  FramePipeline &operator=(FramePipeline &&) = delete;
+
+  /**
+   * @brief Set prepare function
+   *
+   * @param prepareFn Prepare function
+   */
+  void setPrepareFn(const PrepareFn &prepareFn);
+
+  /**
+   * @brief Set render function
+   *
+   * @param renderFn Render function
+   */
+  void setRenderFn(const RenderFn &renderFn);
+
+  /**
+   * @brief Set submit function
+   *
+   * @param submitFn Submit function
+   */
+  void setSubmitFn(const SubmitFn &submitFn);
+
+  /**
+   * @brief Render and submit in render thread
+   *
+   * Must be called before pipeline is started
+   */
+  void enableRenderThread();
+
+  /**
+   * @brief Start pipeline
+   */
+  void start();
+
+  /**
+   * @brief Stop pipeline
+   *
+   * Waits until the last prepared
+   * frame is rendered and submitted
+   */
+  void stop();
+
+  /**
+   * @brief Prepare frame and render it
+   *
+   * With render thread, waits until render
+   * thread releases the previous frame and
+   * hands over the prepared frame
+   *
+   * @param alpha Interpolation factor
+   */
+  void frame(f32 alpha);
+
+  /**
+   * @brief Get slot of next prepared frame
+   *
+   * @return Frame slot
+   */
+  u32 getSlot();
+
+private:
+  /**
+   * @brief Render and submit frames
+   */
+  void runRenderThread();
+
+private:
+  PrepareFn mPrepareFn;
+  RenderFn mRenderFn;
+  SubmitFn mSubmitFn;
+
+  u32 mNumSlots;
+  u32 mSlot = 0;
+
+  bool mRenderThreadEnabled = false;
+  bool mFramePrepared = false;
+  bool mStopped = false;
+  std::mutex mFrameMutex;
+  std::condition_variable mFrameCondition;
+  std::thread mRenderThread;
+};
+
+} // namespace quoll
@@ -1,7 +1,10 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/FrameArena.h"
 #include "quoll/window/Window.h"
 #include "quoll/profiler/FPSCounter.h"
+#include "quoll/profiler/Tracer.h"
 
+#include "FramePipeline.h"
 #include "MainLoop.h"
 
 namespace quoll {
@@ -17,16 +20,31 @@ void MainLoop::setRenderFn(const std::function<void()> &renderFn) {
   mRenderFn = renderFn;
 }
 
+void MainLoop::setFramePipeline(FramePipeline &framePipeline) {
+  mFramePipeline = &framePipeline;
+}
+
+void MainLoop::setTimeDelta(f64 timeDelta) {
+  QuollAssert(timeDelta > 0.0, "Time step must be positive");
+  mTimeDelta = timeDelta;
+}
+
 void MainLoop::run() {
   bool running = true;
 
   static constexpr u32 OneSecondInMs = 1000;
   static constexpr f64 MaxUpdateTime = 0.25;
-  static constexpr f64 TimeDelta = 0.01;
+  const f64 timeDelta = mTimeDelta;
 
   u32 frames = 0;
   f64 accumulator = 0.0;
 
+  Tracer::setThreadName("Main");
+
+  if (mFramePipeline) {
+    mFramePipeline->start();
+  }
+
   auto prevGameTime = std::chrono::high_resolution_clock::now();
   auto prevFrameTime = prevGameTime;
   while (running) {
@@ -46,16 +64,26 @@ void MainLoop::run() {
     prevGameTime = currentTime;
     accumulator += frameTime;
 
-    while (accumulator >= TimeDelta) {
-      running = mUpdateFn(static_cast<f32>(TimeDelta));
-      accumulator -= TimeDelta;
+    while (accumulator >= timeDelta) {
+      running = mUpdateFn(static_cast<f32>(timeDelta));
+      accumulator -= timeDelta;
     }
 
+    // Remaining time is rendered by blending
+    // states of the last two updates
+    f32 alpha = static_cast<f32>(accumulator / timeDelta);
+
     const auto &size = mWindow.getFramebufferSize();
     if (size.x > 0 && size.y > 0) {
-      mRenderFn();
+      if (mFramePipeline) {
+        mFramePipeline->frame(alpha);
+      } else {
+        mRenderFn();
+      }
     }
 
+    FrameArena::get().reset();
+
     if (std::chrono::duration_cast<std::chrono::milliseconds>(currentTime -
                                                               prevFrameTime)
             .count() >= OneSecondInMs) {
@@ -66,6 +94,10 @@ void MainLoop::run() {
       frames++;
     }
   }
+
+  if (mFramePipeline) {
+    mFramePipeline->stop();
+  }
 }
 
 } // namespace quoll
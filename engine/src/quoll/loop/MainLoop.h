@@ -4,6 +4,12 @@ namespace quoll {
 
 class Window;
 class FPSCounter;
+class FramePipeline;
+
+/**
+ * Default time step of updates in seconds
+ */
+static constexpr f64 DefaultTimeDelta = 0.01;
 
 /**
  * @brief Main loop
@@ -11,6 +17,16 @@ class FPSCounter;
  * Calls updater and renderer
  * in a loop and provides
  * performance metrics
+ *
+ * Updates run at fixed time steps. Frames
+ * are rendered either by render function or
+ * by frame pipeline. Frame pipeline receives
+ * interpolation factor between the last two
+ * updates, which is the fraction of time step
+ * that has passed since the last update.
+ *
+ * Frame arena of the calling thread is
+ * reset at the end of every iteration.
  */
 class MainLoop {
 public:
@@ -37,14 +53,46 @@ public:
   /**
    * @brief Set render function
    *
+   * Render function is called in the calling
+   * thread when there is no frame pipeline
+   *
    * @param renderFn Render function
    */
   void setRenderFn(const std::function<void()> &renderFn);
 
+  /**
+   * @brief Set frame pipeline
+   *
+   * Frame pipeline is started when loop
+   * starts and stopped when loop stops
+   *
+   * @param framePipeline Frame pipeline
+   */
+  void setFramePipeline(FramePipeline &framePipeline);
+
+  /**
+   * @brief Set time step of updates
+   *
+   * Must be called before running the loop
+   *
+   * @param timeDelta Time step in seconds
+   */
+  void setTimeDelta(f64 timeDelta);
+
+  /**
+   * @brief Get time step of updates
+   *
+   * @return Time step in seconds
+   */
+  inline f64 getTimeDelta() const { return mTimeDelta; }
+
 private:
   Window &mWindow;
   FPSCounter &mFpsCounter;
   std::function<bool(f32)> mUpdateFn;
   std::function<void()> mRenderFn;
+  FramePipeline *mFramePipeline = nullptr;
+
+  f64 mTimeDelta = DefaultTimeDelta;
 };
 } // namespace quoll
@@ -1,4 +1,5 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/FrameAllocator.h"
 #include "LuaScriptingSystem.h"
 #include "ScriptDecorator.h"
 
@@ -16,8 +17,8 @@ void LuaScriptingSystem::start(EntityDatabase &entityDatabase,
                               mScriptLoop};
   QUOLL_PROFILE_EVENT("LuaScriptingSystem::start");
   lua::ScriptDecorator scriptDecorator;
-  std::vector<Entity> deleteList;
-  std::vector<lua::DeferredLoader *> loaders;
+  FrameVector<Entity> deleteList;
+  FrameVector<lua::DeferredLoader *> loaders;
   for (auto [entity, component] : entityDatabase.view<LuaScript>()) {
     if (component.started) {
       continue;
@@ -55,7 +56,7 @@ void LuaScriptingSystem::start(EntityDatabase &entityDatabase,
           mLuaInterpreter.evaluate(script.data.bytes, component.state);
       QuollAssert(success, "Cannot evaluate script");
       scriptDecorator.removeVariableInjectors(state);
-      createScriptingData(component, entity);
+      createScriptingData(component, entity, entityDatabase);
     };
 
     loaders.push_back(&component.loader);
@@ -93,42 +94,53 @@ void LuaScriptingSystem::observeChanges(EntityDatabase &entityDatabase) {
   mScriptRemoveObserver = entityDatabase.observeRemove<LuaScript>();
 }
 
+/**
+ * @brief Get script state of entity
+ *
+ * Events are polled after they are dispatched;
+ * so, entity or its script might be deleted in
+ * between. Stale entity handles never have
+ * components, which rejects deleted entities.
+ *
+ * @param entityDatabase Entity database
+ * @param entity Entity
+ * @return Script state or null if script does not exist
+ */
+static lua_State *getScriptState(const EntityDatabase &entityDatabase,
+                                 Entity entity) {
+  if (!entityDatabase.has<LuaScript>(entity)) {
+    return nullptr;
+  }
+
+  return entityDatabase.get<LuaScript>(entity).state;
+}
+
 void LuaScriptingSystem::createScriptingData(LuaScript &component,
-                                             Entity entity) {
+                                             Entity entity,
+                                             EntityDatabase &entityDatabase) {
   auto state = sol::state_view(component.state);
 
   if (state["on_collision_start"].get_type() == sol::type::function) {
-    component.onCollisionStart = mEventSystem.observe(
-        CollisionEvent::CollisionStarted,
-        [this, &component, entity](const CollisionObject &data) {
-          if (data.a == entity || data.b == entity) {
-            auto state = sol::state_view(component.state);
-            Entity target = data.a == entity ? data.b : data.a;
-            auto table = state.create_table_with("target", target);
-            state["on_collision_start"](table);
-          }
-        });
+    component.onCollisionStart = observeCollision(
+        CollisionEvent::CollisionStarted, "on_collision_start", entity,
+        entityDatabase);
   }
 
   if (state["on_collision_end"].get_type() == sol::type::function) {
-    component.onCollisionEnd = mEventSystem.observe(
-        CollisionEvent::CollisionEnded,
-        [this, &component, entity](const CollisionObject &data) {
-          auto state = sol::state_view(component.state);
-
-          if (data.a == entity || data.b == entity) {
-            Entity target = data.a == entity ? data.b : data.a;
-            auto table = state.create_table_with("target", target);
-            state["on_collision_end"](table);
-          }
-        });
+    component.onCollisionEnd =
+        observeCollision(CollisionEvent::CollisionEnded, "on_collision_end",
+                         entity, entityDatabase);
   }
 
   if (state["on_key_press"].get_type() == sol::type::function) {
     component.onKeyPress = mEventSystem.observe(
-        KeyboardEvent::Pressed, [this, &component](const auto &data) {
-          auto state = sol::state_view(component.state);
+        KeyboardEvent::Pressed, [entity, &entityDatabase](const auto &data) {
+          auto *scriptState = getScriptState(entityDatabase, entity);
+          if (!scriptState) {
+            return;
+          }
 
+          auto state = sol::state_view(scriptState);
           auto table =
               state.create_table_with("key", data.key, "mods", data.mods);
           state["on_key_press"](table);
@@ -137,9 +149,13 @@ void LuaScriptingSystem::createScriptingData(LuaScript &component,
 
   if (state["on_key_release"].get_type() == sol::type::function) {
     component.onKeyRelease = mEventSystem.observe(
-        KeyboardEvent::Released, [this, &component](const auto &data) {
-          auto state = sol::state_view(component.state);
+        KeyboardEvent::Released, [entity, &entityDatabase](const auto &data) {
+          auto *scriptState = getScriptState(entityDatabase, entity);
+          if (!scriptState) {
+            return;
+          }
 
+          auto state = sol::state_view(scriptState);
           auto table =
               state.create_table_with("key", data.key, "mods", data.mods);
           state["on_key_release"](table);
@@ -147,6 +163,29 @@ void LuaScriptingSystem::createScriptingData(LuaScript &component,
   }
 }
 
+EventObserverId
+LuaScriptingSystem::observeCollision(CollisionEvent type,
+                                     const char *functionName, Entity entity,
+                                     EntityDatabase &entityDatabase) {
+  return mEventSystem.observe(
+      type, [functionName, entity,
+             &entityDatabase](const CollisionObject &data) {
+        if (data.a != entity && data.b != entity) {
+          return;
+        }
+
+        Entity target = data.a == entity ? data.b : data.a;
+        auto *scriptState = getScriptState(entityDatabase, entity);
+        if (!scriptState || !entityDatabase.exists(target)) {
+          return;
+        }
+
+        auto state = sol::state_view(scriptState);
+        auto table = state.create_table_with("target", target);
+        state[functionName](table);
+      });
+}
+
 void LuaScriptingSystem::destroyScriptingData(LuaScript &component) {
   for (auto slot : component.signalSlots) {
     slot.disconnect();
@@ -77,8 +77,26 @@ private:
    *
    * @param component Scripting component
    * @param entity Entity
+   * @param entityDatabase Entity database
+   */
+  void createScriptingData(LuaScript &component, Entity entity,
+                           EntityDatabase &entityDatabase);
+
+  /**
+   * @brief Observe collision event of entity
+   *
+   * Events whose entity or target are deleted
+   * before events are polled are dropped
+   *
+   * @param type Collision event type
+   * @param functionName Script function name
+   * @param entity Entity
+   * @param entityDatabase Entity database
+   * @return Observer id
    */
-  void createScriptingData(LuaScript &component, Entity event);
+  EventObserverId observeCollision(CollisionEvent type,
+                                   const char *functionName, Entity entity,
+                                   EntityDatabase &entityDatabase);
 
 private:
   EventSystem &mEventSystem;
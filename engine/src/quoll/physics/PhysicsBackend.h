@@ -26,14 +26,25 @@ public:
   PhysicsBackend &operator=(PhysicsBackend &&) = delete;
 
   /**
-   * @brief Update physics
+   * @brief Begin physics update
    *
-   * Performs physics simulation
+   * Synchronizes components and starts
+   * physics simulation
    *
    * @param dt Time delta
    * @param entityDatabase Entity database
    */
-  virtual void update(f32 dt, EntityDatabase &entityDatabase) = 0;
+  virtual void beginUpdate(f32 dt, EntityDatabase &entityDatabase) = 0;
+
+  /**
+   * @brief End physics update
+   *
+   * Waits for physics simulation to finish
+   * and synchronizes simulation results
+   *
+   * @param entityDatabase Entity database
+   */
+  virtual void endUpdate(EntityDatabase &entityDatabase) = 0;
 
   /**
    * @brief Cleanup physics data
@@ -0,0 +1,100 @@
+#include "quoll/core/Base.h"
+#include "PhysicsChangeTracker.h"
+
+namespace quoll {
+
+/**
+ * @brief Sort entities and remove duplicates
+ *
+ * @param entities Entities
+ */
+static void removeDuplicates(std::vector<Entity> &entities) {
+  std::sort(entities.begin(), entities.end());
+  entities.erase(std::unique(entities.begin(), entities.end()),
+                 entities.end());
+}
+
+void PhysicsChangeTracker::observeChanges(EntityDatabase &entityDatabase) {
+  mCollidableObserver = entityDatabase.observeUpdate<Collidable>();
+  mRigidBodyObserver = entityDatabase.observeUpdate<RigidBody>();
+  mWorldTransformObserver = entityDatabase.observeUpdate<WorldTransform>();
+  mObserving = true;
+  mFullSync = true;
+}
+
+void PhysicsChangeTracker::requestFullSync() { mFullSync = true; }
+
+void PhysicsChangeTracker::collect(EntityDatabase &entityDatabase) {
+  QUOLL_PROFILE_EVENT("PhysicsChangeTracker::collect");
+
+  mCollidables.clear();
+  mRigidBodies.clear();
+
+  if (mFullSync || !mObserving) {
+    collectAll(entityDatabase);
+  } else {
+    collectChanges(entityDatabase);
+  }
+
+  clearObservers();
+  mFullSync = false;
+}
+
+void PhysicsChangeTracker::collectAll(EntityDatabase &entityDatabase) {
+  for (auto [entity, collidable, world] :
+       entityDatabase.view<const Collidable, const WorldTransform>()) {
+    mCollidables.push_back(entity);
+  }
+
+  for (auto [entity, rigidBody, world] :
+       entityDatabase.view<const RigidBody, const WorldTransform>()) {
+    mRigidBodies.push_back(entity);
+  }
+}
+
+void PhysicsChangeTracker::collectChanges(EntityDatabase &entityDatabase) {
+  const auto &database = entityDatabase;
+
+  // Shape and actor of an entity are created from
+  // both collidable and rigid body components
+  auto addEntity = [this, &database](Entity entity) {
+    if (!database.has<WorldTransform>(entity)) {
+      return;
+    }
+
+    if (database.has<Collidable>(entity)) {
+      mCollidables.push_back(entity);
+    }
+
+    if (database.has<RigidBody>(entity)) {
+      mRigidBodies.push_back(entity);
+    }
+  };
+
+  for (auto [entity, collidable] : mCollidableObserver) {
+    addEntity(entity);
+  }
+
+  for (auto [entity, rigidBody] : mRigidBodyObserver) {
+    addEntity(entity);
+  }
+
+  for (auto [entity, world] : mWorldTransformObserver) {
+    addEntity(entity);
+  }
+
+  removeDuplicates(mCollidables);
+  removeDuplicates(mRigidBodies);
+}
+
+void PhysicsChangeTracker::clearObservers() {
+  if (!mObserving) {
+    return;
+  }
+
+  mCollidableObserver.clear();
+  mRigidBodyObserver.clear();
+  mWorldTransformObserver.clear();
+}
+
+} // namespace quoll
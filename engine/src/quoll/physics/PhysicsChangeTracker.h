@@ -0,0 +1,95 @@
+#pragma once
+
+#include "quoll/entity/EntityDatabase.h"
+#include "quoll/scene/WorldTransform.h"
+#include "Collidable.h"
+#include "RigidBody.h"
+
+namespace quoll {
+
+/**
+ * @brief Tracks physics components that need synchronization
+ *
+ * Uses update observers of collidable, rigid body,
+ * and world transform components to find entities
+ * whose physics objects are out of date. Every
+ * entity is collected when changes are not observed
+ * or a full synchronization is requested.
+ */
+class PhysicsChangeTracker {
+public:
+  /**
+   * @brief Observe changes in entity database
+   *
+   * Next collection returns all entities
+   *
+   * @param entityDatabase Entity database
+   */
+  void observeChanges(EntityDatabase &entityDatabase);
+
+  /**
+   * @brief Request full synchronization
+   *
+   * Next collection returns all entities
+   */
+  void requestFullSync();
+
+  /**
+   * @brief Collect changed entities
+   *
+   * Clears observed changes
+   *
+   * @param entityDatabase Entity database
+   */
+  void collect(EntityDatabase &entityDatabase);
+
+  /**
+   * @brief Get changed collidables
+   *
+   * @return Entities with collidable and world transform
+   */
+  inline const std::vector<Entity> &getCollidables() const {
+    return mCollidables;
+  }
+
+  /**
+   * @brief Get changed rigid bodies
+   *
+   * @return Entities with rigid body and world transform
+   */
+  inline const std::vector<Entity> &getRigidBodies() const {
+    return mRigidBodies;
+  }
+
+private:
+  /**
+   * @brief Collect all entities
+   *
+   * @param entityDatabase Entity database
+   */
+  void collectAll(EntityDatabase &entityDatabase);
+
+  /**
+   * @brief Collect observed changes
+   *
+   * @param entityDatabase Entity database
+   */
+  void collectChanges(EntityDatabase &entityDatabase);
+
+  /**
+   * @brief Clear observed changes
+   */
+  void clearObservers();
+
+private:
+  EntityDatabaseChangeObserver<Collidable> mCollidableObserver;
+  EntityDatabaseChangeObserver<RigidBody> mRigidBodyObserver;
+  EntityDatabaseChangeObserver<WorldTransform> mWorldTransformObserver;
+  bool mObserving = false;
+  bool mFullSync = true;
+
+  std::vector<Entity> mCollidables;
+  std::vector<Entity> mRigidBodies;
+};
+
+} // namespace quoll
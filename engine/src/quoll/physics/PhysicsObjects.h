@@ -20,6 +20,15 @@ struct PhysicsMaterialDesc {
    * Restitution
    */
   f32 restitution = 1.0f;
+
+  /**
+   * @brief Check if material description is equal to another one
+   *
+   * @param rhs Other material description
+   * @retval true Descriptions are equal
+   * @retval false Descriptions are not equal
+   */
+  bool operator==(const PhysicsMaterialDesc &rhs) const = default;
 };
 
 /**
@@ -56,6 +65,15 @@ struct PhysicsGeometrySphere {
    * Sphere radius
    */
   f32 radius = 1.0f;
+
+  /**
+   * @brief Check if sphere data is equal to another one
+   *
+   * @param rhs Other sphere data
+   * @retval true Descriptions are equal
+   * @retval false Descriptions are not equal
+   */
+  bool operator==(const PhysicsGeometrySphere &rhs) const = default;
 };
 
 /**
@@ -64,7 +82,15 @@ struct PhysicsGeometrySphere {
  * Planes do not have any data; they are only used
  * for representation
  */
-struct PhysicsGeometryPlane {};
+struct PhysicsGeometryPlane {
+  /**
+   * @brief Check if plane data is equal to another one
+   *
+   * @param rhs Other plane data
+   * @retval true Planes are always equal
+   */
+  bool operator==(const PhysicsGeometryPlane &rhs) const = default;
+};
 
 /**
  * @brief Capsule geometry data
@@ -79,6 +105,15 @@ struct PhysicsGeometryCapsule {
    * Capsule half height
    */
   f32 halfHeight = 0.5f;
+
+  /**
+   * @brief Check if capsule data is equal to another one
+   *
+   * @param rhs Other capsule data
+   * @retval true Descriptions are equal
+   * @retval false Descriptions are not equal
+   */
+  bool operator==(const PhysicsGeometryCapsule &rhs) const = default;
 };
 
 /**
@@ -89,6 +124,15 @@ struct PhysicsGeometryBox {
    * Box extents halved
    */
   glm::vec3 halfExtents{0.5f};
+
+  /**
+   * @brief Check if box data is equal to another one
+   *
+   * @param rhs Other box data
+   * @retval true Descriptions are equal
+   * @retval false Descriptions are not equal
+   */
+  bool operator==(const PhysicsGeometryBox &rhs) const = default;
 };
 
 using PhysicsGeometryParams =
@@ -113,6 +157,15 @@ struct PhysicsGeometryDesc {
    * Geometry parameters
    */
   PhysicsGeometryParams params = PhysicsGeometryBox{};
+
+  /**
+   * @brief Check if geometry description is equal to another one
+   *
+   * @param rhs Other geometry description
+   * @retval true Descriptions are equal
+   * @retval false Descriptions are not equal
+   */
+  bool operator==(const PhysicsGeometryDesc &rhs) const = default;
 };
 
 /**
@@ -133,6 +186,15 @@ struct PhysicsDynamicRigidBodyDesc {
    * Apply gravity
    */
   bool applyGravity = true;
+
+  /**
+   * @brief Check if rigid body description is equal to another one
+   *
+   * @param rhs Other rigid body description
+   * @retval true Descriptions are equal
+   * @retval false Descriptions are not equal
+   */
+  bool operator==(const PhysicsDynamicRigidBodyDesc &rhs) const = default;
 };
 
 } // namespace quoll
@@ -6,7 +6,12 @@
 namespace quoll {
 
 PhysicsSystem PhysicsSystem::createPhysxBackend(EventSystem &eventSystem) {
-  return std::move(PhysicsSystem(new PhysxBackend(eventSystem)));
+  return createPhysxBackend(eventSystem, PhysxBackendDesc{});
+}
+
+PhysicsSystem PhysicsSystem::createPhysxBackend(EventSystem &eventSystem,
+                                                const PhysxBackendDesc &desc) {
+  return std::move(PhysicsSystem(new PhysxBackend(eventSystem, desc)));
 }
 
 PhysicsSystem::PhysicsSystem(PhysicsBackend *backend) : mBackend(backend) {}
@@ -5,6 +5,8 @@
 
 namespace quoll {
 
+struct PhysxBackendDesc;
+
 /**
  * @brief Physics system
  */
@@ -18,6 +20,16 @@ public:
    */
   static PhysicsSystem createPhysxBackend(EventSystem &eventSystem);
 
+  /**
+   * @brief Create physx backend
+   *
+   * @param eventSystem Event system
+   * @param desc PhysX backend description
+   * @return Physx backend
+   */
+  static PhysicsSystem createPhysxBackend(EventSystem &eventSystem,
+                                          const PhysxBackendDesc &desc);
+
 public:
   /**
    * @brief Create physics system
@@ -35,7 +47,33 @@ public:
    * @param entityDatabase Entity database
    */
   inline void update(f32 dt, EntityDatabase &entityDatabase) {
-    mBackend->update(dt, entityDatabase);
+    mBackend->beginUpdate(dt, entityDatabase);
+    mBackend->endUpdate(entityDatabase);
+  }
+
+  /**
+   * @brief Begin physics update
+   *
+   * Starts physics simulation. Systems that do not
+   * access physics components can run until
+   * the update is ended.
+   *
+   * @param dt Time delta
+   * @param entityDatabase Entity database
+   */
+  inline void beginUpdate(f32 dt, EntityDatabase &entityDatabase) {
+    mBackend->beginUpdate(dt, entityDatabase);
+  }
+
+  /**
+   * @brief End physics update
+   *
+   * Waits for physics simulation to finish
+   *
+   * @param entityDatabase Entity database
+   */
+  inline void endUpdate(EntityDatabase &entityDatabase) {
+    mBackend->endUpdate(entityDatabase);
   }
 
   /**
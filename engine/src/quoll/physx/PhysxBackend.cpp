@@ -105,30 +105,45 @@ static PxFilterFlags phyxFilterAllCollisionShader(
   return PxFilterFlag::eDEFAULT;
 }
 
-PhysxBackend::PhysxBackend(EventSystem &eventSystem)
+PhysxBackend::PhysxBackend(EventSystem &eventSystem,
+                           const PhysxBackendDesc &desc)
     : mSimulationEventCallback(eventSystem) {
-  static constexpr u32 PvdPort = 5425;
   static constexpr u32 PvdTimeoutInMs = 2000;
   static constexpr glm::vec3 Gravity(0.0f, -9.8f, 0.0f);
 
   mFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, mDefaultAllocator,
                                    mDefaultErrorCallback);
 
-  mPvd = PxCreatePvd(*mFoundation);
-  PxPvdTransport *transport =
-      PxDefaultPvdSocketTransportCreate("127.0.0.1", PvdPort, PvdTimeoutInMs);
-  mPvd->connect(*transport, PxPvdInstrumentationFlag::eALL);
-
-  Engine::getLogger().info()
-      << "PhysX initialized. Visual debugger connected connected to "
-         "127.0.0.1:"
-      << PvdPort;
+  if (desc.enableVisualDebugger) {
+    mPvd = PxCreatePvd(*mFoundation);
+    PxPvdTransport *transport = PxDefaultPvdSocketTransportCreate(
+        desc.visualDebuggerHost.c_str(),
+        static_cast<i32>(desc.visualDebuggerPort), PvdTimeoutInMs);
+    if (transport &&
+        mPvd->connect(*transport, PxPvdInstrumentationFlag::eALL)) {
+      Engine::getLogger().info()
+          << "PhysX visual debugger connected to " << desc.visualDebuggerHost
+          << ":" << desc.visualDebuggerPort;
+    } else {
+      Engine::getLogger().warning()
+          << "Failed to connect to PhysX visual debugger at "
+          << desc.visualDebuggerHost << ":" << desc.visualDebuggerPort;
+    }
+  }
 
   mPhysics =
       PxCreatePhysics(PX_PHYSICS_VERSION, *mFoundation, PxTolerancesScale(),
                       RECORD_MEMORY_ALLOCATIONS, mPvd);
 
-  mDispatcher = PxDefaultCpuDispatcherCreate(1);
+  u32 numThreads = desc.numThreads;
+  if (numThreads == 0) {
+    numThreads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+  }
+
+  mDispatcher = PxDefaultCpuDispatcherCreate(numThreads);
+
+  Engine::getLogger().info()
+      << "PhysX initialized with " << numThreads << " worker threads";
 
   PxSceneDesc sceneDesc(mPhysics->getTolerancesScale());
   sceneDesc.cpuDispatcher = mDispatcher;
@@ -138,7 +153,7 @@ PhysxBackend::PhysxBackend(EventSystem &eventSystem)
   sceneDesc.simulationEventCallback = &mSimulationEventCallback;
   mScene = mPhysics->createScene(sceneDesc);
 
-  auto *pvdClient = mScene->getScenePvdClient();
+  auto *pvdClient = mPvd ? mScene->getScenePvdClient() : nullptr;
   if (pvdClient) {
     pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_CONSTRAINTS, true);
     pvdClient->setScenePvdFlag(PxPvdSceneFlag::eTRANSMIT_CONTACTS, true);
@@ -147,21 +162,37 @@ PhysxBackend::PhysxBackend(EventSystem &eventSystem)
 }
 
 PhysxBackend::~PhysxBackend() {
+  if (mSimulating) {
+    mScene->fetchResults(true);
+  }
+
   mScene->release();
   mDispatcher->release();
   mPhysics->release();
-  mPvd->release();
+  if (mPvd) {
+    mPvd->release();
+  }
   mFoundation->release();
 }
 
-void PhysxBackend::update(f32 dt, EntityDatabase &entityDatabase) {
-  QUOLL_PROFILE_EVENT("PhysicsSystem::update");
+void PhysxBackend::beginUpdate(f32 dt, EntityDatabase &entityDatabase) {
+  QUOLL_PROFILE_EVENT("PhysicsSystem::beginUpdate");
+  QuollAssert(!mSimulating, "Previous physics update is not ended");
 
   synchronizeComponents(entityDatabase);
 
   mScene->simulate(dt);
+  mSimulating = true;
+}
+
+void PhysxBackend::endUpdate(EntityDatabase &entityDatabase) {
+  QUOLL_PROFILE_EVENT("PhysicsSystem::endUpdate");
+  QuollAssert(mSimulating, "Physics update is not started");
+
   mScene->fetchResults(true);
+  mSimulating = false;
 
+  mSimulationEventCallback.dispatchEvents(entityDatabase);
   synchronizeTransforms(entityDatabase);
 }
 
@@ -186,10 +217,12 @@ void PhysxBackend::cleanup(EntityDatabase &entityDatabase) {
 
   entityDatabase.destroyComponents<PhysxInstance>();
   mPhysxInstanceRemoveObserver.clear();
+  mChangeTracker.requestFullSync();
 }
 
 void PhysxBackend::observeChanges(EntityDatabase &entityDatabase) {
   mPhysxInstanceRemoveObserver = entityDatabase.observeRemove<PhysxInstance>();
+  mChangeTracker.observeChanges(entityDatabase);
 }
 
 bool PhysxBackend::sweep(EntityDatabase &entityDatabase, Entity entity,
@@ -241,10 +274,18 @@ void PhysxBackend::synchronizeComponents(EntityDatabase &entityDatabase) {
     mPhysxInstanceRemoveObserver.clear();
   }
 
+  // Components are read through constant database
+  // so that synchronization does not mark them as
+  // updated
+  const auto &database = entityDatabase;
+  mChangeTracker.collect(entityDatabase);
+
   {
     QUOLL_PROFILE_EVENT("Synchronize collidable components");
-    for (auto [entity, collidable, world] :
-         entityDatabase.view<Collidable, WorldTransform>()) {
+    for (auto entity : mChangeTracker.getCollidables()) {
+      const auto &collidable = database.get<Collidable>(entity);
+      const auto &world = database.get<WorldTransform>(entity);
+
       if (!entityDatabase.has<PhysxInstance>(entity)) {
         entityDatabase.set<PhysxInstance>(entity, {});
       }
@@ -256,40 +297,50 @@ void PhysxBackend::synchronizeComponents(EntityDatabase &entityDatabase) {
             mPhysics->createMaterial(collidable.materialDesc.staticFriction,
                                      collidable.materialDesc.dynamicFriction,
                                      collidable.materialDesc.restitution);
-      } else {
+      } else if (physx.materialDesc != collidable.materialDesc) {
         physx.material->setRestitution(collidable.materialDesc.restitution);
         physx.material->setStaticFriction(
             collidable.materialDesc.staticFriction);
         physx.material->setDynamicFriction(
             collidable.materialDesc.dynamicFriction);
       }
+      physx.materialDesc = collidable.materialDesc;
 
       // Create or set shape
       if (!physx.shape) {
         physx.shape = createShape(collidable.geometryDesc, *physx.material,
                                   world.worldTransform);
+        physx.shape->setLocalPose(getShapeLocalTransform(
+            collidable.geometryDesc.center, collidable.geometryDesc.type));
 
         physx.material->release();
-      } else if (PhysxMapping::getPhysxGeometryType(
-                     collidable.geometryDesc.type) ==
-                 physx.shape->getGeometryType()) {
-        updateShapeWithGeometryData(collidable.geometryDesc, physx.shape,
-                                    world.worldTransform);
-      } else {
-        auto *newShape = createShape(collidable.geometryDesc, *physx.material,
-                                     world.worldTransform);
-
-        if (entityDatabase.has<RigidBody>(entity)) {
-          physx.rigidDynamic->detachShape(*physx.shape);
-          physx.rigidDynamic->attachShape(*newShape);
+      } else if (physx.geometryDesc != collidable.geometryDesc ||
+                 physx.shapeTransform != world.worldTransform) {
+        if (PhysxMapping::getPhysxGeometryType(collidable.geometryDesc.type) ==
+            physx.shape->getGeometryType()) {
+          updateShapeWithGeometryData(collidable.geometryDesc, physx.shape,
+                                      world.worldTransform);
         } else {
-          physx.rigidStatic->detachShape(*physx.shape);
-          physx.rigidStatic->attachShape(*newShape);
+          auto *newShape = createShape(collidable.geometryDesc,
+                                       *physx.material, world.worldTransform);
+
+          if (entityDatabase.has<RigidBody>(entity)) {
+            physx.rigidDynamic->detachShape(*physx.shape);
+            physx.rigidDynamic->attachShape(*newShape);
+          } else {
+            physx.rigidStatic->detachShape(*physx.shape);
+            physx.rigidStatic->attachShape(*newShape);
+          }
+
+          physx.shape->release();
+          physx.shape = newShape;
         }
 
-        physx.shape->release();
-        physx.shape = newShape;
+        physx.shape->setLocalPose(getShapeLocalTransform(
+            collidable.geometryDesc.center, collidable.geometryDesc.type));
       }
+      physx.geometryDesc = collidable.geometryDesc;
+      physx.shapeTransform = world.worldTransform;
 
       if (physx.useShapeInSimulation != collidable.useInSimulation) {
         physx.shape->setFlag(PxShapeFlag::eSIMULATION_SHAPE,
@@ -302,8 +353,6 @@ void PhysxBackend::synchronizeComponents(EntityDatabase &entityDatabase) {
                              collidable.useInQueries);
       }
       physx.useShapeInQueries = collidable.useInQueries;
-      physx.shape->setLocalPose(getShapeLocalTransform(
-          collidable.geometryDesc.center, collidable.geometryDesc.type));
 
       // Create rigid static if no rigid body
       if (!entityDatabase.has<RigidBody>(entity) && !physx.rigidStatic) {
@@ -314,24 +363,30 @@ void PhysxBackend::synchronizeComponents(EntityDatabase &entityDatabase) {
             reinterpret_cast<void *>(static_cast<uptr>(entity));
 
         mScene->addActor(*physx.rigidStatic);
-      } else if (physx.rigidStatic) {
-        // Update transform of rigid static if exists
+        physx.actorTransform = world.worldTransform;
+      } else if (physx.rigidStatic &&
+                 physx.actorTransform != world.worldTransform) {
+        // Update transform of rigid static if it is moved
         physx.rigidStatic->setGlobalPose(
             PhysxMapping::getPhysxTransform(world.worldTransform));
+        physx.actorTransform = world.worldTransform;
       }
     }
   }
 
   {
     QUOLL_PROFILE_EVENT("Synchronize rigid body components");
-    for (auto [entity, rigidBody, world] :
-         entityDatabase.view<RigidBody, WorldTransform>()) {
+    for (auto entity : mChangeTracker.getRigidBodies()) {
+      const auto &rigidBody = database.get<RigidBody>(entity);
+      const auto &world = database.get<WorldTransform>(entity);
+
       if (!entityDatabase.has<PhysxInstance>(entity)) {
         entityDatabase.set<PhysxInstance>(entity, {});
       }
 
       auto &physx = entityDatabase.get<PhysxInstance>(entity);
 
+      bool created = false;
       if (!physx.rigidDynamic) {
         physx.rigidDynamic = mPhysics->createRigidDynamic(
             PhysxMapping::getPhysxTransform(world.worldTransform));
@@ -339,6 +394,8 @@ void PhysxBackend::synchronizeComponents(EntityDatabase &entityDatabase) {
             reinterpret_cast<void *>(static_cast<uptr>(entity));
 
         mScene->addActor(*physx.rigidDynamic);
+        physx.actorTransform = world.worldTransform;
+        created = true;
 
         // Remove rigid static if exists
         if (physx.rigidStatic) {
@@ -353,14 +410,21 @@ void PhysxBackend::synchronizeComponents(EntityDatabase &entityDatabase) {
         physx.rigidDynamic->attachShape(*physx.shape);
       }
 
-      physx.rigidDynamic->setActorFlag(PxActorFlag::eDISABLE_GRAVITY,
-                                       !rigidBody.dynamicDesc.applyGravity);
-      physx.rigidDynamic->setMass(rigidBody.dynamicDesc.mass);
-      physx.rigidDynamic->setMassSpaceInertiaTensor(
-          {rigidBody.dynamicDesc.inertia.x, rigidBody.dynamicDesc.inertia.y,
-           rigidBody.dynamicDesc.inertia.z});
-      physx.rigidDynamic->setGlobalPose(
-          PhysxMapping::getPhysxTransform(world.worldTransform));
+      if (created || physx.dynamicDesc != rigidBody.dynamicDesc) {
+        physx.rigidDynamic->setActorFlag(PxActorFlag::eDISABLE_GRAVITY,
+                                         !rigidBody.dynamicDesc.applyGravity);
+        physx.rigidDynamic->setMass(rigidBody.dynamicDesc.mass);
+        physx.rigidDynamic->setMassSpaceInertiaTensor(
+            {rigidBody.dynamicDesc.inertia.x, rigidBody.dynamicDesc.inertia.y,
+             rigidBody.dynamicDesc.inertia.z});
+        physx.dynamicDesc = rigidBody.dynamicDesc;
+      }
+
+      if (physx.actorTransform != world.worldTransform) {
+        physx.rigidDynamic->setGlobalPose(
+            PhysxMapping::getPhysxTransform(world.worldTransform));
+        physx.actorTransform = world.worldTransform;
+      }
     };
   }
 
@@ -453,6 +517,13 @@ void PhysxBackend::synchronizeTransforms(EntityDatabase &entityDatabase) {
         world.worldTransform = glm::translate(glm::mat4{1.0f}, position) *
                                glm::toMat4(rotation) *
                                glm::scale(glm::mat4{1.0f}, scale);
+
+        // Simulated pose is already applied to the actor
+        if (entityDatabase.has<PhysxInstance>(entity)) {
+          auto &physx = entityDatabase.get<PhysxInstance>(entity);
+          physx.actorTransform = world.worldTransform;
+          physx.shapeTransform = world.worldTransform;
+        }
       }
     }
   }
@@ -478,9 +549,14 @@ void PhysxBackend::synchronizeTransforms(EntityDatabase &entityDatabase) {
       if (entityDatabase.has<LocalTransform>(entity)) {
         auto &transform = entityDatabase.get<LocalTransform>(entity);
 
-        if (entityDatabase.has<Parent>(entity)) {
-          const auto &parentTransform = entityDatabase.get<WorldTransform>(
-              entityDatabase.get<Parent>(entity).parent);
+        // Stale parent handles have no components
+        const auto &database = entityDatabase;
+        Entity parent = database.has<Parent>(entity)
+                            ? database.get<Parent>(entity).parent
+                            : Entity::Null;
+
+        if (database.has<WorldTransform>(parent)) {
+          const auto &parentTransform = database.get<WorldTransform>(parent);
 
           const auto &invParentTransform =
               glm::inverse(parentTransform.worldTransform);
@@ -4,12 +4,14 @@
 #include "quoll/events/EventSystem.h"
 #include "quoll/physics/PhysicsObjects.h"
 #include "quoll/physics/PhysicsBackend.h"
+#include "quoll/physics/PhysicsChangeTracker.h"
 
 #include <PxConfig.h>
 #include <PxPhysicsAPI.h>
 #include <extensions/PxDefaultAllocator.h>
 #include <extensions/PxDefaultErrorCallback.h>
 
+#include "PhysxBackendDesc.h"
 #include "PhysxInstance.h"
 #include "PhysxSimulationEventCallback.h"
 
@@ -24,8 +26,9 @@ public:
    * @brief Create physics system
    *
    * @param eventSystem Event system
+   * @param desc Backend description
    */
-  PhysxBackend(EventSystem &eventSystem);
+  PhysxBackend(EventSystem &eventSystem, const PhysxBackendDesc &desc = {});
 
   /**
    * @brief Destroy physics system
@@ -38,14 +41,25 @@ public:
   PhysxBackend &operator=(PhysxBackend &&) = delete;
 
   /**
-   * @brief Update physics
+   * @brief Begin physics update
    *
-   * Performs physics simulation
+   * Synchronizes components and starts
+   * physics simulation
    *
    * @param dt Time delta
    * @param entityDatabase Entity database
    */
-  void update(f32 dt, EntityDatabase &entityDatabase) override;
+  void beginUpdate(f32 dt, EntityDatabase &entityDatabase) override;
+
+  /**
+   * @brief End physics update
+   *
+   * Waits for physics simulation to finish
+   * and synchronizes transforms
+   *
+   * @param entityDatabase Entity database
+   */
+  void endUpdate(EntityDatabase &entityDatabase) override;
 
   /**
    * @brief Cleanup Physx actors and shapes
@@ -80,6 +94,9 @@ private:
   /**
    * @brief Synchronize physics components
    *
+   * Only entities with changed collidable, rigid
+   * body, or world transform are synchronized
+   *
    * @param entityDatabase Entity database
    */
   void synchronizeComponents(EntityDatabase &entityDatabase);
@@ -115,8 +132,10 @@ private:
   physx::PxDefaultCpuDispatcher *mDispatcher = nullptr;
 
   physx::PxScene *mScene = nullptr;
+  bool mSimulating = false;
 
   EntityDatabaseObserver<PhysxInstance> mPhysxInstanceRemoveObserver;
+  PhysicsChangeTracker mChangeTracker;
 };
 
 } // namespace quoll
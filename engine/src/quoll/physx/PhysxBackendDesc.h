@@ -0,0 +1,33 @@
+#pragma once
+
+namespace quoll {
+
+/**
+ * @brief PhysX backend description
+ */
+struct PhysxBackendDesc {
+  /**
+   * Number of simulation worker threads
+   *
+   * If zero, all hardware threads except
+   * the calling one are used
+   */
+  u32 numThreads = 0;
+
+  /**
+   * Connect to PhysX visual debugger
+   */
+  bool enableVisualDebugger = false;
+
+  /**
+   * Visual debugger host
+   */
+  String visualDebuggerHost = "127.0.0.1";
+
+  /**
+   * Visual debugger port
+   */
+  u32 visualDebuggerPort = 5425;
+};
+
+} // namespace quoll
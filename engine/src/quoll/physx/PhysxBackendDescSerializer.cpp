@@ -0,0 +1,37 @@
+#include "quoll/core/Base.h"
+#include "PhysxBackendDescSerializer.h"
+
+namespace quoll {
+
+YAML::Node PhysxBackendDescSerializer::serialize(const PhysxBackendDesc &desc) {
+  YAML::Node node;
+  node["threads"] = desc.numThreads;
+  node["visualDebugger"]["enabled"] = desc.enableVisualDebugger;
+  node["visualDebugger"]["host"] = desc.visualDebuggerHost;
+  node["visualDebugger"]["port"] = desc.visualDebuggerPort;
+  return node;
+}
+
+PhysxBackendDesc
+PhysxBackendDescSerializer::deserialize(const YAML::Node &node) {
+  PhysxBackendDesc desc{};
+  if (!node || !node.IsMap()) {
+    return desc;
+  }
+
+  desc.numThreads = node["threads"].as<u32>(desc.numThreads);
+
+  const auto &debugger = node["visualDebugger"];
+  if (debugger && debugger.IsMap()) {
+    desc.enableVisualDebugger =
+        debugger["enabled"].as<bool>(desc.enableVisualDebugger);
+    desc.visualDebuggerHost =
+        debugger["host"].as<String>(desc.visualDebuggerHost);
+    desc.visualDebuggerPort =
+        debugger["port"].as<u32>(desc.visualDebuggerPort);
+  }
+
+  return desc;
+}
+
+} // namespace quoll
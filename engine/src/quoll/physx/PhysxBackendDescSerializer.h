@@ -0,0 +1,36 @@
+#pragma once
+
+#include "quoll/yaml/Yaml.h"
+#include "PhysxBackendDesc.h"
+
+namespace quoll {
+
+/**
+ * @brief PhysX backend description serializer
+ *
+ * Stores PhysX options in project
+ * and launch files
+ */
+class PhysxBackendDescSerializer {
+public:
+  /**
+   * @brief Serialize PhysX backend description
+   *
+   * @param desc PhysX backend description
+   * @return YAML node
+   */
+  static YAML::Node serialize(const PhysxBackendDesc &desc);
+
+  /**
+   * @brief Deserialize PhysX backend description
+   *
+   * Missing or invalid options
+   * are set to default values
+   *
+   * @param node YAML node
+   * @return PhysX backend description
+   */
+  static PhysxBackendDesc deserialize(const YAML::Node &node);
+};
+
+} // namespace quoll
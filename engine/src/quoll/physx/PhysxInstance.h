@@ -4,6 +4,8 @@
 #include <PxShape.h>
 #include <PxMaterial.h>
 
+#include "quoll/physics/PhysicsObjects.h"
+
 namespace quoll {
 
 /**
@@ -39,6 +41,31 @@ struct PhysxInstance {
    * Use shape in queries
    */
   bool useShapeInQueries = true;
+
+  /**
+   * Last applied material description
+   */
+  PhysicsMaterialDesc materialDesc;
+
+  /**
+   * Last applied geometry description
+   */
+  PhysicsGeometryDesc geometryDesc;
+
+  /**
+   * Last applied dynamic rigid body description
+   */
+  PhysicsDynamicRigidBodyDesc dynamicDesc;
+
+  /**
+   * World transform that shape geometry is scaled with
+   */
+  glm::mat4 shapeTransform{1.0f};
+
+  /**
+   * Last applied actor global pose
+   */
+  glm::mat4 actorTransform{1.0f};
 };
 
 } // namespace quoll
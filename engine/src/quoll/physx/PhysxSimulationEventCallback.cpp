@@ -31,9 +31,9 @@ void PhysxSimulationEventCallback::onContact(
     const PxContactPair &cp = pairs[i];
 
     if (cp.events & PxPairFlag::eNOTIFY_TOUCH_FOUND) {
-      mEventSystem.dispatch(CollisionEvent::CollisionStarted, {e1, e2});
+      mEvents.push_back({CollisionEvent::CollisionStarted, {e1, e2}});
     } else if (cp.events & PxPairFlag::eNOTIFY_TOUCH_LOST) {
-      mEventSystem.dispatch(CollisionEvent::CollisionEnded, {e1, e2});
+      mEvents.push_back({CollisionEvent::CollisionEnded, {e1, e2}});
     }
   }
 }
@@ -45,4 +45,15 @@ void PhysxSimulationEventCallback::onAdvance(
     const PxRigidBody *const *bodyBuffer, const PxTransform *poseBuffer,
     const PxU32 count) {}
 
+void PhysxSimulationEventCallback::dispatchEvents(
+    const EntityDatabase &entityDatabase) {
+  for (const auto &[type, data] : mEvents) {
+    if (entityDatabase.exists(data.a) && entityDatabase.exists(data.b)) {
+      mEventSystem.dispatch(type, data);
+    }
+  }
+
+  mEvents.clear();
+}
+
 } // namespace quoll
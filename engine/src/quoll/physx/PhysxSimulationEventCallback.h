@@ -5,6 +5,7 @@
 #include <extensions/PxDefaultAllocator.h>
 #include <extensions/PxDefaultErrorCallback.h>
 
+#include "quoll/entity/EntityDatabase.h"
 #include "quoll/events/EventSystem.h"
 
 namespace quoll {
@@ -12,7 +13,9 @@ namespace quoll {
 /**
  * @brief Physx simulation event callback
  *
- * Used for finding collisions
+ * Used for finding collisions. Contacts are
+ * collected while simulation results are
+ * fetched and dispatched afterwards.
  */
 class PhysxSimulationEventCallback : public physx::PxSimulationEventCallback {
 public:
@@ -77,8 +80,20 @@ public:
                  const physx::PxTransform *poseBuffer,
                  const physx::PxU32 count) override;
 
+  /**
+   * @brief Dispatch collected collision events
+   *
+   * Actors of deleted entities stay in the scene
+   * until next synchronization; so, events whose
+   * entities do not exist are dropped
+   *
+   * @param entityDatabase Entity database
+   */
+  void dispatchEvents(const EntityDatabase &entityDatabase);
+
 private:
   EventSystem &mEventSystem;
+  std::vector<std::pair<CollisionEvent, CollisionObject>> mEvents;
 };
 
 } // namespace quoll
@@ -1,5 +1,6 @@
 #include "quoll/core/Base.h"
 #include "quoll/core/Property.h"
+#include "quoll/core/FrameArena.h"
 #include "ImguiDebugLayer.h"
 #include "quoll/imgui/Imgui.h"
 
@@ -7,9 +8,10 @@ namespace quoll {
 
 ImguiDebugLayer::ImguiDebugLayer(
     const rhi::PhysicalDeviceInformation &physicalDeviceInfo,
-    const rhi::DeviceStats &deviceStats, const FPSCounter &fpsCounter)
+    const rhi::DeviceStats &deviceStats, const FPSCounter &fpsCounter,
+    const RenderGraph &renderGraph)
     : mPhysicalDeviceInfo(physicalDeviceInfo), mFpsCounter(fpsCounter),
-      mDeviceStats(deviceStats) {}
+      mDeviceStats(deviceStats), mRenderGraph(renderGraph) {}
 
 void ImguiDebugLayer::renderMenu() {
   if (ImGui::BeginMenu("Debug")) {
@@ -19,6 +21,7 @@ void ImguiDebugLayer::renderMenu() {
 
     ImGui::MenuItem("Performance Metrics", nullptr,
                     &mPerformanceMetricsVisible);
+    ImGui::MenuItem("GPU Pass Timings", nullptr, &mPassTimingsVisible);
     ImGui::EndMenu();
   }
 }
@@ -27,6 +30,7 @@ void ImguiDebugLayer::render() {
   renderPhysicalDeviceInfo();
   renderUsageMetrics();
   renderPerformanceMetrics();
+  renderPassTimings();
 }
 
 void ImguiDebugLayer::renderPerformanceMetrics() {
@@ -53,6 +57,38 @@ void ImguiDebugLayer::renderPerformanceMetrics() {
   }
 }
 
+void ImguiDebugLayer::renderPassTimings() {
+  if (!mPassTimingsVisible)
+    return;
+
+  if (ImGui::Begin("GPU Pass Timings", &mPassTimingsVisible,
+                   ImGuiWindowFlags_NoDocking)) {
+    if (ImGui::BeginTable("Table", 2,
+                          ImGuiTableFlags_Borders |
+                              ImGuiTableFlags_SizingStretchSame |
+                              ImGuiTableFlags_RowBg)) {
+      f32 total = 0.0f;
+      for (const auto &timing : mRenderGraph.getPassTimings()) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << timing.time << "ms";
+        if (timing.queue == rhi::QueueType::Compute) {
+          ss << " (async compute)";
+        }
+
+        renderTableRow(timing.name, ss.str());
+        total += timing.time;
+      }
+
+      std::stringstream ss;
+      ss << std::fixed << std::setprecision(3) << total << "ms";
+      renderTableRow("Total", ss.str());
+
+      ImGui::EndTable();
+    }
+    ImGui::End();
+  }
+}
+
 void ImguiDebugLayer::renderUsageMetrics() {
   if (!mUsageMetricsVisible)
     return;
@@ -107,11 +143,28 @@ void ImguiDebugLayer::renderUsageMetrics() {
                      std::to_string(mDeviceStats.getDrawnPrimitivesCount()));
       renderTableRow("Number of command calls",
                      std::to_string(mDeviceStats.getCommandCallsCount()));
+      renderTableRow("Changed bytes uploaded per frame",
+                     getSizeString(mDeviceStats.getUploadedBytes()));
+      renderTableRow("Number of visible instances",
+                     std::to_string(mDeviceStats.getVisibleInstancesCount()));
+      renderTableRow("Number of culled instances",
+                     std::to_string(mDeviceStats.getCulledInstancesCount()));
       renderTableRow(
           "Number of descriptors",
           std::to_string(
               mDeviceStats.getResourceMetrics()->getDescriptorsCount()));
 
+      // Frame arena
+      const auto &frameArena = FrameArena::get();
+      renderTableRow(
+          "Frame arena allocations per frame",
+          std::to_string(frameArena.getLastFrameStats().allocationsCount));
+      renderTableRow(
+          "Frame arena allocated size per frame",
+          getSizeString(frameArena.getLastFrameStats().allocatedSize));
+      renderTableRow("Frame arena capacity",
+                     getSizeString(frameArena.getCapacity()));
+
       ImGui::EndTable();
     }
 
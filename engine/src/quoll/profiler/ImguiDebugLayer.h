@@ -3,6 +3,7 @@
 #include "quoll/profiler/FPSCounter.h"
 #include "quoll/rhi/PhysicalDeviceInformation.h"
 #include "quoll/rhi/DeviceStats.h"
+#include "quoll/renderer/RenderGraph.h"
 
 namespace quoll {
 
@@ -20,10 +21,12 @@ public:
    * @param physicalDeviceInfo Physical device information
    * @param deviceStats Device stats
    * @param fpsCounter FPS counter
+   * @param renderGraph Render graph
    */
   ImguiDebugLayer(const rhi::PhysicalDeviceInformation &physicalDeviceInfo,
                   const rhi::DeviceStats &deviceStats,
-                  const FPSCounter &fpsCounter);
+                  const FPSCounter &fpsCounter,
+                  const RenderGraph &renderGraph);
 
   /**
    * @brief Render debug menu
@@ -41,6 +44,11 @@ private:
    */
   void renderPerformanceMetrics();
 
+  /**
+   * @brief Render GPU times of render graph passes
+   */
+  void renderPassTimings();
+
   /**
    * @brief Render physical device information
    */
@@ -63,10 +71,12 @@ private:
   rhi::PhysicalDeviceInformation mPhysicalDeviceInfo;
   const FPSCounter &mFpsCounter;
   const rhi::DeviceStats &mDeviceStats;
+  const RenderGraph &mRenderGraph;
 
   bool mUsageMetricsVisible = false;
   bool mPhysicalDeviceInfoVisible = false;
   bool mPerformanceMetricsVisible = false;
+  bool mPassTimingsVisible = false;
 };
 
 } // namespace quoll
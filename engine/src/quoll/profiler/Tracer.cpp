@@ -0,0 +1,325 @@
+#include "quoll/core/Base.h"
+#include "Tracer.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#define QUOLL_TRACER_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define QUOLL_TRACER_TSC
+#endif
+
+namespace quoll {
+
+namespace {
+
+/**
+ * @brief Ring buffer slot
+ *
+ * Fields are atomic because captures read
+ * slots that owning thread can overwrite
+ */
+struct TraceSlot {
+  std::atomic<const char *> name{nullptr};
+  std::atomic<u64> start{0};
+  std::atomic<u64> end{0};
+  std::atomic<bool> frame{false};
+};
+
+/**
+ * @brief Ring buffer of a thread
+ */
+struct TraceBuffer {
+  u32 index = 0;
+  String name;
+  std::atomic<u64> head{0};
+  std::atomic<bool> active{true};
+  std::array<TraceSlot, Tracer::BufferSize> slots;
+};
+
+/**
+ * @brief Ring buffers of all threads
+ *
+ * Buffers are never freed because captures
+ * can read them after their thread exits.
+ * Buffers of exited threads are reused by
+ * new threads.
+ */
+struct TraceRegistry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<TraceBuffer>> buffers;
+  std::atomic<bool> enabled{true};
+
+  u64 startTicks = Tracer::now();
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+};
+
+TraceRegistry &getRegistry() {
+  static TraceRegistry registry;
+  return registry;
+}
+
+/**
+ * @brief Releases ring buffer when thread exits
+ */
+struct TraceBufferOwner {
+  TraceBuffer *buffer = nullptr;
+
+  ~TraceBufferOwner() {
+    if (buffer) {
+      buffer->active.store(false, std::memory_order_release);
+    }
+  }
+};
+
+TraceBuffer &getThreadBuffer() {
+  static thread_local TraceBufferOwner owner;
+  if (owner.buffer) {
+    return *owner.buffer;
+  }
+
+  auto &registry = getRegistry();
+  std::lock_guard lock(registry.mutex);
+
+  for (auto &buffer : registry.buffers) {
+    bool active = buffer->active.load(std::memory_order_acquire);
+    if (!active && buffer->active.compare_exchange_strong(active, true)) {
+      buffer->name = "Thread " + std::to_string(buffer->index);
+      owner.buffer = buffer.get();
+      return *owner.buffer;
+    }
+  }
+
+  auto buffer = std::make_unique<TraceBuffer>();
+  buffer->index = static_cast<u32>(registry.buffers.size());
+  buffer->name = "Thread " + std::to_string(buffer->index);
+  owner.buffer = buffer.get();
+  registry.buffers.push_back(std::move(buffer));
+
+  return *owner.buffer;
+}
+
+/**
+ * @brief Write event to ring buffer of current thread
+ *
+ * @param name Event name
+ * @param start Start timestamp
+ * @param end End timestamp
+ * @param frame Event is a frame marker
+ */
+void writeEvent(const char *name, u64 start, u64 end, bool frame) {
+  auto &buffer = getThreadBuffer();
+  u64 head = buffer.head.load(std::memory_order_relaxed);
+
+  // Captures validate copied slots by reading
+  // head after copying; so, slot writes must
+  // not become visible before previous head
+  std::atomic_thread_fence(std::memory_order_release);
+
+  auto &slot = buffer.slots.at(head % Tracer::BufferSize);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.start.store(start, std::memory_order_relaxed);
+  slot.end.store(end, std::memory_order_relaxed);
+  slot.frame.store(frame, std::memory_order_relaxed);
+
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Write JSON string
+ *
+ * @param stream Output stream
+ * @param value String value
+ */
+void writeJsonString(std::ostream &stream, StringView value) {
+  stream << '"';
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      stream << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << static_cast<u32>(c) << std::dec << std::setfill(' ');
+    } else {
+      stream << c;
+    }
+  }
+  stream << '"';
+}
+
+} // namespace
+
+u64 Tracer::now() {
+#ifdef QUOLL_TRACER_TSC
+  return __rdtsc();
+#else
+  return static_cast<u64>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+void Tracer::setEnabled(bool enabled) {
+  getRegistry().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Tracer::isEnabled() {
+  return getRegistry().enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::setThreadName(const String &name) {
+  auto &buffer = getThreadBuffer();
+
+  std::lock_guard lock(getRegistry().mutex);
+  buffer.name = name;
+}
+
+void Tracer::record(const char *name, u64 start, u64 end) {
+  writeEvent(name, start, end, false);
+}
+
+void Tracer::markFrame(const char *name) {
+  if (!isEnabled()) {
+    return;
+  }
+
+  u64 timestamp = now();
+  writeEvent(name, timestamp, timestamp, true);
+}
+
+TraceCapture Tracer::capture() {
+  auto &registry = getRegistry();
+  TraceCapture capture;
+
+  {
+    std::lock_guard lock(registry.mutex);
+
+    for (auto &buffer : registry.buffers) {
+      u64 head = buffer->head.load(std::memory_order_acquire);
+      u64 first = head > BufferSize ? head - BufferSize : 0;
+
+      usize start = capture.events.size();
+      for (u64 i = first; i < head; ++i) {
+        const auto &slot = buffer->slots.at(i % BufferSize);
+
+        TraceEvent event{};
+        event.name = slot.name.load(std::memory_order_relaxed);
+        event.start = slot.start.load(std::memory_order_relaxed);
+        event.end = slot.end.load(std::memory_order_relaxed);
+        event.frame = slot.frame.load(std::memory_order_relaxed);
+        event.threadIndex = buffer->index;
+        capture.events.push_back(event);
+      }
+
+      // Slots that owning thread started to
+      // overwrite while they were copied
+      // are dropped
+      std::atomic_thread_fence(std::memory_order_acquire);
+      u64 newHead = buffer->head.load(std::memory_order_relaxed);
+      u64 validFirst = newHead >= BufferSize ? newHead - BufferSize + 1 : 0;
+      if (validFirst > first) {
+        auto numInvalid = static_cast<usize>(
+            std::min(validFirst, head) - first);
+        capture.events.erase(capture.events.begin() + start,
+                             capture.events.begin() + start + numInvalid);
+      }
+
+      capture.threads.push_back({buffer->index, buffer->name});
+    }
+  }
+
+  std::sort(capture.events.begin(), capture.events.end(),
+            [](const auto &a, const auto &b) { return a.start < b.start; });
+
+#ifdef QUOLL_TRACER_TSC
+  f64 elapsedMicroseconds =
+      std::chrono::duration<f64, std::micro>(std::chrono::steady_clock::now() -
+                                             registry.startTime)
+          .count();
+  u64 elapsedTicks = now() - registry.startTicks;
+  if (elapsedMicroseconds > 0.0 && elapsedTicks > 0) {
+    capture.ticksPerMicrosecond =
+        static_cast<f64>(elapsedTicks) / elapsedMicroseconds;
+  }
+#else
+  capture.ticksPerMicrosecond = 1000.0;
+#endif
+
+  return capture;
+}
+
+TraceCapture Tracer::captureFrames(u32 numFrames) {
+  auto traceCapture = capture();
+
+  std::vector<u64> frames;
+  for (const auto &event : traceCapture.events) {
+    if (event.frame) {
+      frames.push_back(event.start);
+    }
+  }
+
+  // Last frame marker starts a frame
+  // that is not complete yet
+  if (frames.empty()) {
+    traceCapture.events.clear();
+    return traceCapture;
+  }
+
+  u64 end = frames.back();
+  u64 start = frames.size() > numFrames
+                  ? frames.at(frames.size() - 1 - numFrames)
+                  : frames.front();
+
+  std::erase_if(traceCapture.events, [start, end](const auto &event) {
+    return event.start < start || event.start >= end;
+  });
+
+  return traceCapture;
+}
+
+void TraceCapture::writeChromeTrace(std::ostream &stream) const {
+  u64 origin = events.empty() ? 0 : events.front().start;
+  auto toMicroseconds = [this](u64 ticks) {
+    return static_cast<f64>(ticks) / ticksPerMicrosecond;
+  };
+
+  stream << std::fixed << std::setprecision(3);
+  stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  bool first = true;
+  auto separate = [&stream, &first]() {
+    if (!first) {
+      stream << ",";
+    }
+    first = false;
+  };
+
+  for (const auto &thread : threads) {
+    separate();
+    stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+           << thread.index << ",\"args\":{\"name\":";
+    writeJsonString(stream, thread.name);
+    stream << "}}";
+  }
+
+  for (const auto &event : events) {
+    separate();
+    stream << "{\"name\":";
+    writeJsonString(stream, event.name ? event.name : "");
+
+    if (event.frame) {
+      stream << ",\"ph\":\"i\",\"s\":\"g\"";
+    } else {
+      stream << ",\"ph\":\"X\",\"dur\":"
+             << toMicroseconds(event.end - event.start);
+    }
+
+    stream << ",\"ts\":" << toMicroseconds(event.start - origin)
+           << ",\"pid\":0,\"tid\":" << event.threadIndex << "}";
+  }
+
+  stream << "]}";
+}
+
+} // namespace quoll
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "quoll/core/DataTypes.h"
+
+namespace quoll {
+
+/**
+ * @brief Trace event
+ */
+struct TraceEvent {
+  /**
+   * Event name
+   *
+   * Names must be string literals
+   * because only pointers are stored
+   */
+  const char *name = nullptr;
+
+  /**
+   * Start timestamp in ticks
+   */
+  u64 start = 0;
+
+  /**
+   * End timestamp in ticks
+   *
+   * Frame markers start and
+   * end at the same tick
+   */
+  u64 end = 0;
+
+  /**
+   * Trace thread index
+   */
+  u32 threadIndex = 0;
+
+  /**
+   * Event is a frame marker
+   */
+  bool frame = false;
+};
+
+/**
+ * @brief Trace thread
+ */
+struct TraceThread {
+  /**
+   * Trace thread index
+   */
+  u32 index = 0;
+
+  /**
+   * Thread name
+   */
+  String name;
+};
+
+/**
+ * @brief Captured trace
+ */
+struct TraceCapture {
+  /**
+   * Events sorted by start timestamp
+   */
+  std::vector<TraceEvent> events;
+
+  /**
+   * Threads that recorded events
+   */
+  std::vector<TraceThread> threads;
+
+  /**
+   * Timestamp ticks per microsecond
+   */
+  f64 ticksPerMicrosecond = 1.0;
+
+  /**
+   * @brief Write trace in Chrome trace format
+   *
+   * Chrome trace format is a JSON format that
+   * can be opened in chrome://tracing and in
+   * Perfetto UI
+   *
+   * @param stream Output stream
+   */
+  void writeChromeTrace(std::ostream &stream) const;
+};
+
+/**
+ * @brief Built-in tracing profiler
+ *
+ * Every thread records scoped events into its
+ * own ring buffer; so, recording does not lock
+ * and only costs two timestamps and a few
+ * stores. Ring buffers keep the latest events
+ * of every thread, which are copied into a
+ * capture when requested. Timestamps are read
+ * from the time stamp counter when it is
+ * available.
+ *
+ * Tracer is used when Optick is not enabled.
+ */
+class Tracer {
+public:
+  /**
+   * Number of events in ring buffer of a thread
+   */
+  static constexpr usize BufferSize = 16384;
+
+public:
+  /**
+   * @brief Get current timestamp
+   *
+   * @return Timestamp in ticks
+   */
+  static u64 now();
+
+  /**
+   * @brief Enable or disable recording
+   *
+   * Recording is enabled by default
+   *
+   * @param enabled Recording is enabled
+   */
+  static void setEnabled(bool enabled);
+
+  /**
+   * @brief Check if recording is enabled
+   *
+   * @retval true Recording is enabled
+   * @retval false Recording is disabled
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief Set name of current thread
+   *
+   * @param name Thread name
+   */
+  static void setThreadName(const String &name);
+
+  /**
+   * @brief Record event in current thread
+   *
+   * @param name Event name
+   * @param start Start timestamp
+   * @param end End timestamp
+   */
+  static void record(const char *name, u64 start, u64 end);
+
+  /**
+   * @brief Record frame marker in current thread
+   *
+   * @param name Frame name
+   */
+  static void markFrame(const char *name);
+
+  /**
+   * @brief Capture recorded events
+   *
+   * Copies latest events of all threads.
+   * Events that are overwritten while they
+   * are copied are dropped.
+   *
+   * @return Captured trace
+   */
+  static TraceCapture capture();
+
+  /**
+   * @brief Capture events of last frames
+   *
+   * Frames start at frame markers; so, events
+   * that start before the first captured frame
+   * marker are dropped
+   *
+   * @param numFrames Number of frames
+   * @return Captured trace
+   */
+  static TraceCapture captureFrames(u32 numFrames);
+};
+
+/**
+ * @brief Scoped trace event
+ *
+ * Records event from construction
+ * until destruction
+ */
+class TraceScope {
+public:
+  /**
+   * @brief Start trace event
+   *
+   * @param name Event name
+   */
+  TraceScope(const char *name)
+      : mName(Tracer::isEnabled() ? name : nullptr),
+        mStart(mName ? Tracer::now() : 0) {}
+
+  /**
+   * @brief End trace event
+   */
+  ~TraceScope() {
+    if (mName) {
+      Tracer::record(mName, mStart, Tracer::now());
+    }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+  TraceScope(TraceScope &&) = delete;
+  TraceScope &operator=(TraceScope &&) = delete;
+
+private:
+  const char *mName;
+  u64 mStart;
+};
+
+} // namespace quoll
@@ -0,0 +1,41 @@
+#include "quoll/core/Base.h"
+#include "DynamicResolutionController.h"
+
+namespace quoll {
+
+DynamicResolutionController::DynamicResolutionController(
+    const DynamicResolutionSettings &settings)
+    : mSettings(settings) {
+  mSettings.maxScale = std::clamp(mSettings.maxScale, 0.0f, 1.0f);
+  mSettings.minScale =
+      std::clamp(mSettings.minScale, 0.0f, mSettings.maxScale);
+  mScale = mSettings.maxScale;
+}
+
+f32 DynamicResolutionController::update(f32 gpuFrameTime) {
+  if (gpuFrameTime <= 0.0f || mSettings.targetFrameTime <= 0.0f) {
+    return mScale;
+  }
+
+  mAverageFrameTime = mAverageFrameTime > 0.0f
+                          ? glm::mix(mAverageFrameTime, gpuFrameTime, Smoothing)
+                          : gpuFrameTime;
+
+  // Frame time in the headroom band is stable
+  // and does not change the scale
+  f32 target = mSettings.targetFrameTime;
+  if (mAverageFrameTime <= target &&
+      mAverageFrameTime >= target * (1.0f - mSettings.headroom)) {
+    return mScale;
+  }
+
+  // Cost is proportional to number of pixels,
+  // which is proportional to square of scale
+  f32 desiredScale = mScale * std::sqrt(target / mAverageFrameTime);
+  f32 step = std::clamp(desiredScale - mScale, -MaxScaleStep, MaxScaleStep);
+
+  mScale = std::clamp(mScale + step, mSettings.minScale, mSettings.maxScale);
+  return mScale;
+}
+
+} // namespace quoll
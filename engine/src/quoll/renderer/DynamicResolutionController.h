@@ -0,0 +1,105 @@
+#pragma once
+
+namespace quoll {
+
+/**
+ * @brief Dynamic resolution settings
+ */
+struct DynamicResolutionSettings {
+  /**
+   * Target GPU frame time in milliseconds
+   */
+  f32 targetFrameTime = 16.0f;
+
+  /**
+   * Minimum resolution scale
+   */
+  f32 minScale = 0.5f;
+
+  /**
+   * Maximum resolution scale
+   *
+   * Render targets are sized for maximum
+   * resolution; so, scale cannot exceed one
+   */
+  f32 maxScale = 1.0f;
+
+  /**
+   * Fraction of target frame time that
+   * frame time must be below before
+   * resolution is increased
+   */
+  f32 headroom = 0.1f;
+};
+
+/**
+ * @brief Dynamic resolution controller
+ *
+ * Scales render resolution so that measured
+ * GPU frame time stays near the target frame
+ * time. Scale is applied to both dimensions;
+ * so, GPU cost is proportional to square of
+ * the scale.
+ */
+class DynamicResolutionController {
+  /**
+   * Smoothing factor of frame time average
+   */
+  static constexpr f32 Smoothing = 0.1f;
+
+  /**
+   * Maximum change of scale per update
+   */
+  static constexpr f32 MaxScaleStep = 0.05f;
+
+public:
+  /**
+   * @brief Create dynamic resolution controller
+   *
+   * Controller starts at maximum scale
+   *
+   * @param settings Dynamic resolution settings
+   */
+  DynamicResolutionController(const DynamicResolutionSettings &settings);
+
+  /**
+   * @brief Update scale from GPU frame time
+   *
+   * Frame times that are not positive are
+   * ignored because they are not measured
+   *
+   * @param gpuFrameTime GPU frame time in milliseconds
+   * @return Resolution scale
+   */
+  f32 update(f32 gpuFrameTime);
+
+  /**
+   * @brief Get resolution scale
+   *
+   * @return Resolution scale
+   */
+  inline f32 getScale() const { return mScale; }
+
+  /**
+   * @brief Get average GPU frame time
+   *
+   * @return Average GPU frame time in milliseconds
+   */
+  inline f32 getAverageFrameTime() const { return mAverageFrameTime; }
+
+  /**
+   * @brief Get settings
+   *
+   * @return Dynamic resolution settings
+   */
+  inline const DynamicResolutionSettings &getSettings() const {
+    return mSettings;
+  }
+
+private:
+  DynamicResolutionSettings mSettings;
+  f32 mScale = 1.0f;
+  f32 mAverageFrameTime = 0.0f;
+};
+
+} // namespace quoll
@@ -0,0 +1,34 @@
+#include "quoll/core/Base.h"
+#include "DynamicResolutionSettingsSerializer.h"
+
+namespace quoll {
+
+YAML::Node DynamicResolutionSettingsSerializer::serialize(
+    const std::optional<DynamicResolutionSettings> &settings) {
+  auto values = settings.value_or(DynamicResolutionSettings{});
+
+  YAML::Node node;
+  node["enabled"] = settings.has_value();
+  node["targetFrameTime"] = values.targetFrameTime;
+  node["minScale"] = values.minScale;
+  node["maxScale"] = values.maxScale;
+  node["headroom"] = values.headroom;
+  return node;
+}
+
+std::optional<DynamicResolutionSettings>
+DynamicResolutionSettingsSerializer::deserialize(const YAML::Node &node) {
+  if (!node || !node.IsMap() || !node["enabled"].as<bool>(false)) {
+    return std::nullopt;
+  }
+
+  DynamicResolutionSettings settings{};
+  settings.targetFrameTime =
+      node["targetFrameTime"].as<f32>(settings.targetFrameTime);
+  settings.minScale = node["minScale"].as<f32>(settings.minScale);
+  settings.maxScale = node["maxScale"].as<f32>(settings.maxScale);
+  settings.headroom = node["headroom"].as<f32>(settings.headroom);
+  return settings;
+}
+
+} // namespace quoll
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "quoll/yaml/Yaml.h"
+#include "DynamicResolutionController.h"
+
+namespace quoll {
+
+/**
+ * @brief Dynamic resolution settings serializer
+ *
+ * Stores dynamic resolution settings in
+ * project and launch files. Dynamic
+ * resolution is disabled unless the
+ * settings explicitly enable it
+ */
+class DynamicResolutionSettingsSerializer {
+public:
+  /**
+   * @brief Serialize dynamic resolution settings
+   *
+   * @param settings Dynamic resolution settings or
+   *                 empty if dynamic resolution is disabled
+   * @return YAML node
+   */
+  static YAML::Node
+  serialize(const std::optional<DynamicResolutionSettings> &settings);
+
+  /**
+   * @brief Deserialize dynamic resolution settings
+   *
+   * Missing or invalid options
+   * are set to default values
+   *
+   * @param node YAML node
+   * @return Dynamic resolution settings or
+   *         empty if dynamic resolution is disabled
+   */
+  static std::optional<DynamicResolutionSettings>
+  deserialize(const YAML::Node &node);
+};
+
+} // namespace quoll
@@ -4,6 +4,10 @@
 namespace quoll {
 
 static constexpr usize PositionsIndex = 0;
+static constexpr usize NormalsIndex = 1;
+static constexpr usize TangentsIndex = 2;
+static constexpr usize TexCoords0Index = 3;
+static constexpr usize TexCoords1Index = 4;
 static constexpr usize JointsIndex = 5;
 static constexpr usize WeightsIndex = 6;
 
@@ -32,4 +36,30 @@ MeshRenderUtils::getSkinnedGeometryBufferOffsets(const MeshAsset &mesh) {
                     mesh.vertexBufferOffsets.at(WeightsIndex)};
 }
 
+std::array<rhi::DeviceAddress, MeshRenderUtils::SkinningSources>
+MeshRenderUtils::getSkinningSourceAddresses(const MeshAsset &mesh) {
+  return std::array{mesh.vertexBufferAddresses.at(PositionsIndex),
+                    mesh.vertexBufferAddresses.at(NormalsIndex),
+                    mesh.vertexBufferAddresses.at(TangentsIndex),
+                    mesh.vertexBufferAddresses.at(JointsIndex),
+                    mesh.vertexBufferAddresses.at(WeightsIndex)};
+}
+
+std::array<rhi::BufferHandle, MeshRenderUtils::SkinnedVertexContributors>
+MeshRenderUtils::getSkinnedVertexBuffers(const MeshAsset &mesh,
+                                         rhi::BufferHandle skinnedVertices) {
+  return std::array{skinnedVertices, skinnedVertices, skinnedVertices,
+                    mesh.vertexBuffers.at(TexCoords0Index),
+                    mesh.vertexBuffers.at(TexCoords1Index)};
+}
+
+std::array<u64, MeshRenderUtils::SkinnedVertexContributors>
+MeshRenderUtils::getSkinnedVertexBufferOffsets(
+    const MeshAsset &mesh, const std::array<u64, 3> &skinnedOffsets) {
+  return std::array{skinnedOffsets.at(0), skinnedOffsets.at(1),
+                    skinnedOffsets.at(2),
+                    mesh.vertexBufferOffsets.at(TexCoords0Index),
+                    mesh.vertexBufferOffsets.at(TexCoords1Index)};
+}
+
 } // namespace quoll
@@ -9,6 +9,8 @@ namespace quoll {
  */
 class MeshRenderUtils {
   static constexpr usize SkinGeometryContributors = 3;
+  static constexpr usize SkinningSources = 5;
+  static constexpr usize SkinnedVertexContributors = 5;
 
 public:
   /**
@@ -51,6 +53,41 @@ public:
    */
   static std::array<u64, SkinGeometryContributors>
   getSkinnedGeometryBufferOffsets(const MeshAsset &mesh);
+
+  /**
+   * @brief Get buffer addresses required for skinning
+   *
+   * @param mesh Mesh asset data
+   * @return Position, normal, tangent, joint, and weight addresses
+   */
+  static std::array<rhi::DeviceAddress, SkinningSources>
+  getSkinningSourceAddresses(const MeshAsset &mesh);
+
+  /**
+   * @brief Get buffers required for skinned vertices
+   *
+   * Positions, normals, and tangents are read
+   * from skinned vertex cache while texture
+   * coordinates are read from the mesh
+   *
+   * @param mesh Mesh asset data
+   * @param skinnedVertices Skinned vertex cache
+   * @return Buffers
+   */
+  static std::array<rhi::BufferHandle, SkinnedVertexContributors>
+  getSkinnedVertexBuffers(const MeshAsset &mesh,
+                          rhi::BufferHandle skinnedVertices);
+
+  /**
+   * @brief Get buffer offsets required for skinned vertices
+   *
+   * @param mesh Mesh asset data
+   * @param skinnedOffsets Offsets in skinned vertex cache
+   * @return Offsets
+   */
+  static std::array<u64, SkinnedVertexContributors>
+  getSkinnedVertexBufferOffsets(const MeshAsset &mesh,
+                                const std::array<u64, 3> &skinnedOffsets);
 };
 
 } // namespace quoll
@@ -52,15 +52,26 @@ RenderGraph::RGTexture RenderGraph::import(rhi::TextureHandle handle) {
   return RGTexture(mRegistry, textureIndex);
 }
 
+void RenderGraph::markAsOutput(RGTexture texture) {
+  mOutputTextures.insert(texture.getIndex());
+}
+
+void RenderGraph::markAsPersistent(RGTexture texture) {
+  mPersistentTextures.insert(texture.getIndex());
+}
+
 /**
  * @brief Topologically sort a graph
  *
+ * @param inputs All passes
+ * @param passIndices Indices of compiled passes
  * @param index Index of current item
  * @param visited Visited nodes
  * @param adjacencyList Adjacency list
  * @param output Output array
  */
 static void topologicalSort(const std::vector<RenderGraphPass> &inputs,
+                            const std::vector<usize> &passIndices,
                             usize index, std::vector<bool> &visited,
                             const std::vector<std::set<usize>> &adjacencyList,
                             std::vector<RenderGraphPass> &output) {
@@ -68,14 +79,47 @@ static void topologicalSort(const std::vector<RenderGraphPass> &inputs,
 
   for (usize x : adjacencyList.at(index)) {
     if (!visited.at(x)) {
-      topologicalSort(inputs, x, visited, adjacencyList, output);
+      topologicalSort(inputs, passIndices, x, visited, adjacencyList, output);
     }
   }
 
-  output.push_back(inputs.at(index));
+  output.push_back(inputs.at(passIndices.at(index)));
 }
 
-void RenderGraph::buildResources(RenderStorage &storage) {
+/**
+ * @brief Check if a node is reachable from another node
+ *
+ * @param adjacencyList Adjacency list
+ * @param from Start node
+ * @param to Target node
+ * @retval true Target node is reachable
+ * @retval false Target node is not reachable
+ */
+static bool isReachable(const std::vector<std::set<usize>> &adjacencyList,
+                        usize from, usize to) {
+  std::vector<bool> visited(adjacencyList.size(), false);
+  std::vector<usize> stack{from};
+  visited.at(from) = true;
+
+  while (!stack.empty()) {
+    usize node = stack.back();
+    stack.pop_back();
+    if (node == to) {
+      return true;
+    }
+
+    for (usize next : adjacencyList.at(node)) {
+      if (!visited.at(next)) {
+        visited.at(next) = true;
+        stack.push_back(next);
+      }
+    }
+  }
+
+  return false;
+}
+
+void RenderGraph::buildResourceHandles(RenderStorage &storage) {
   // Create all real handles for render graph if they do not exist
   const auto &textures = mRegistry.getRealResources<rhi::TextureHandle>();
   for (usize i = 0; i < textures.size(); ++i) {
@@ -85,15 +129,47 @@ void RenderGraph::buildResources(RenderStorage &storage) {
 
     mRegistry.set(i, storage.getNewTextureHandle());
   }
+}
 
+void RenderGraph::buildResources(RenderStorage &storage) {
+  const auto &textures = mRegistry.getRealResources<rhi::TextureHandle>();
   auto *device = storage.getDevice();
 
+  // Textures that own heap memory must be
+  // created before textures that alias them
+  std::vector<usize> creationOrder;
+  creationOrder.reserve(textures.size());
+  for (const auto &heap : mTextureHeaps) {
+    creationOrder.push_back(heap.textures.front());
+  }
+
   for (usize i = 0; i < textures.size(); ++i) {
+    auto heapIndex = mTextureHeapIndices.at(i);
+    if (heapIndex == NoHeap ||
+        mTextureHeaps.at(heapIndex).textures.front() != i) {
+      creationOrder.push_back(i);
+    }
+  }
+
+  for (auto i : creationOrder) {
     auto handle = mRegistry.get<rhi::TextureHandle>(i);
     const auto &desc = mRegistry.getDescription<rhi::TextureHandle>(i);
 
     if (const auto *textureDesc = std::get_if<rhi::TextureDescription>(&desc)) {
-      device->createTexture(*textureDesc, handle);
+      auto description = *textureDesc;
+
+      auto heapIndex = mTextureHeapIndices.at(i);
+      if (heapIndex != NoHeap) {
+        const auto &heap = mTextureHeaps.at(heapIndex);
+        if (heap.textures.front() == i) {
+          description.aliasable = heap.textures.size() > 1;
+        } else {
+          description.aliasOf =
+              mRegistry.get<rhi::TextureHandle>(heap.textures.front());
+        }
+      }
+
+      device->createTexture(description, handle);
     } else if (const auto *viewDesc =
                    std::get_if<RGTextureViewDescription>(&desc)) {
       rhi::TextureViewDescription description{};
@@ -110,6 +186,147 @@ void RenderGraph::buildResources(RenderStorage &storage) {
   }
 }
 
+/**
+ * @brief Check if texture can reuse memory of another texture
+ *
+ * @param owner Description of texture that owns the memory
+ * @param texture Texture description
+ * @retval true Texture can alias owner memory
+ * @retval false Texture cannot alias owner memory
+ */
+static bool canAlias(const rhi::TextureDescription &owner,
+                     const rhi::TextureDescription &texture) {
+  return owner.type == texture.type && owner.format == texture.format &&
+         owner.usage == texture.usage && owner.samples == texture.samples &&
+         owner.layerCount == texture.layerCount &&
+         owner.mipLevelCount == texture.mipLevelCount &&
+         owner.depth == texture.depth && texture.width <= owner.width &&
+         texture.height <= owner.height;
+}
+
+usize RenderGraph::getRootTextureIndex(usize index) {
+  const auto *viewDescription = std::get_if<RGTextureViewDescription>(
+      &mRegistry.getDescription<rhi::TextureHandle>(index));
+
+  while (viewDescription) {
+    index = viewDescription->textureIndex;
+    viewDescription = std::get_if<RGTextureViewDescription>(
+        &mRegistry.getDescription<rhi::TextureHandle>(index));
+  }
+
+  return index;
+}
+
+void RenderGraph::buildAliases() {
+  QUOLL_PROFILE_EVENT("RenderGraph::buildAliases");
+  static constexpr usize Unused = std::numeric_limits<usize>::max();
+
+  const auto numTextures =
+      mRegistry.getRealResources<rhi::TextureHandle>().size();
+
+  mTextureHeaps.clear();
+  mTextureHeapIndices.assign(numTextures, NoHeap);
+  mAliasingReport = RenderGraphAliasingReport{};
+
+  std::vector<usize> firstUses(numTextures, Unused);
+  std::vector<usize> lastUses(numTextures, 0);
+  std::vector<bool> lastUseIsWrite(numTextures, false);
+
+  for (usize p = 0; p < mCompiledPasses.size(); ++p) {
+    auto &pass = mCompiledPasses.at(p);
+
+    for (auto &input : pass.getTextureInputs()) {
+      auto index = getRootTextureIndex(input.texture.getIndex());
+      firstUses.at(index) = std::min(firstUses.at(index), p);
+      lastUses.at(index) = p;
+      lastUseIsWrite.at(index) = false;
+    }
+
+    for (auto &output : pass.getTextureOutputs()) {
+      auto index = getRootTextureIndex(output.texture.getIndex());
+      firstUses.at(index) = std::min(firstUses.at(index), p);
+      lastUses.at(index) = p;
+      lastUseIsWrite.at(index) = true;
+    }
+  }
+
+  std::vector<usize> candidates;
+  for (usize i = 0; i < numTextures; ++i) {
+    const auto &description = mRegistry.getDescription<rhi::TextureHandle>(i);
+    const auto *textureDescription =
+        std::get_if<rhi::TextureDescription>(&description);
+
+    if (mRegistry.getResourceState<rhi::TextureHandle>(i) !=
+            RGResourceState::Transient ||
+        mPersistentTextures.contains(i) || !textureDescription ||
+        firstUses.at(i) == Unused ||
+        rhi::getTextureMemorySize(*textureDescription) == 0) {
+      continue;
+    }
+
+    // Textures that are not read after they are last
+    // written are outputs of the graph and their contents
+    // must be preserved after the graph is executed
+    if (lastUseIsWrite.at(i)) {
+      lastUses.at(i) = mCompiledPasses.size();
+    }
+
+    candidates.push_back(i);
+  }
+
+  auto getDescription =
+      [this](usize index) -> const rhi::TextureDescription & {
+    return std::get<rhi::TextureDescription>(
+        mRegistry.getDescription<rhi::TextureHandle>(index));
+  };
+
+  // Largest textures are placed first, which
+  // makes them owners of heap memory
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [&getDescription](usize a, usize b) {
+                     return rhi::getTextureMemorySize(getDescription(a)) >
+                            rhi::getTextureMemorySize(getDescription(b));
+                   });
+
+  for (auto index : candidates) {
+    const auto &description = getDescription(index);
+    auto size = rhi::getTextureMemorySize(description);
+
+    mAliasingReport.numTransientTextures++;
+    mAliasingReport.totalMemorySize += size;
+
+    auto heapIndex = NoHeap;
+    for (usize h = 0; h < mTextureHeaps.size() && heapIndex == NoHeap; ++h) {
+      const auto &heap = mTextureHeaps.at(h);
+      if (!canAlias(getDescription(heap.textures.front()), description)) {
+        continue;
+      }
+
+      bool overlaps = false;
+      for (usize i = 0; i < heap.textures.size() && !overlaps; ++i) {
+        auto other = heap.textures.at(i);
+        overlaps = firstUses.at(index) <= lastUses.at(other) &&
+                   firstUses.at(other) <= lastUses.at(index);
+      }
+
+      if (!overlaps) {
+        heapIndex = h;
+      }
+    }
+
+    if (heapIndex == NoHeap) {
+      heapIndex = mTextureHeaps.size();
+      mTextureHeaps.push_back({});
+    } else {
+      mAliasingReport.numAliasedTextures++;
+      mAliasingReport.savedMemorySize += size;
+    }
+
+    mTextureHeaps.at(heapIndex).textures.push_back(index);
+    mTextureHeapIndices.at(index) = heapIndex;
+  }
+}
+
 void RenderGraph::compile() {
   QUOLL_PROFILE_EVENT("RenderGraph::compile");
   std::vector<usize> passIndices;
@@ -146,18 +363,102 @@ void RenderGraph::compile() {
     }
   }
 
-  // Cache reads so we can easily access them
-  // for creating the adjacency lsit
-  std::unordered_map<rhi::TextureHandle, std::vector<usize>> passTextureReads;
-  std::unordered_map<rhi::BufferHandle, std::vector<usize>> passBufferReads;
+  // Passes that write to outputs, imported textures,
+  // or buffers are roots of the graph. Passes without
+  // outputs are also roots because the graph does not
+  // know about their side effects. Passes that none of
+  // the roots depend on are culled. Graphs without
+  // roots are not culled.
+  std::unordered_map<usize, std::vector<usize>> passTextureWrites;
+  std::unordered_map<rhi::BufferHandle, std::vector<usize>> passBufferWrites;
+  std::vector<usize> usedPasses;
+
+  std::set<usize> outputTextures;
+  for (auto index : mOutputTextures) {
+    outputTextures.insert(getRootTextureIndex(index));
+  }
+
   for (usize i = 0; i < passIndices.size(); ++i) {
     auto &pass = mPasses.at(passIndices.at(i));
-    for (auto &resourceId : pass.getTextureInputs()) {
-      passTextureReads[resourceId.texture].push_back(i);
+    bool isRoot = !pass.getBufferOutputs().empty() ||
+                  pass.getTextureOutputs().empty();
+
+    for (auto &output : pass.getTextureOutputs()) {
+      auto index = getRootTextureIndex(output.texture.getIndex());
+      passTextureWrites[index].push_back(i);
+
+      isRoot = isRoot || outputTextures.contains(index) ||
+               mRegistry.getResourceState<rhi::TextureHandle>(index) ==
+                   RGResourceState::Real;
     }
 
-    for (auto &resourceId : pass.getBufferInputs()) {
-      passBufferReads[resourceId.buffer].push_back(i);
+    for (auto &output : pass.getBufferOutputs()) {
+      passBufferWrites[output.buffer].push_back(i);
+    }
+
+    if (isRoot) {
+      usedPasses.push_back(i);
+    }
+  }
+
+  if (!usedPasses.empty()) {
+    std::vector<bool> used(passIndices.size(), false);
+    while (!usedPasses.empty()) {
+      auto i = usedPasses.back();
+      usedPasses.pop_back();
+
+      if (used.at(i)) {
+        continue;
+      }
+      used.at(i) = true;
+
+      auto &pass = mPasses.at(passIndices.at(i));
+      for (auto &input : pass.getTextureInputs()) {
+        auto it = passTextureWrites.find(
+            getRootTextureIndex(input.texture.getIndex()));
+        if (it != passTextureWrites.end()) {
+          usedPasses.insert(usedPasses.end(), it->second.begin(),
+                            it->second.end());
+        }
+      }
+
+      for (auto &input : pass.getBufferInputs()) {
+        auto it = passBufferWrites.find(input.buffer);
+        if (it != passBufferWrites.end()) {
+          usedPasses.insert(usedPasses.end(), it->second.begin(),
+                            it->second.end());
+        }
+      }
+    }
+
+    std::vector<usize> usedPassIndices;
+    usedPassIndices.reserve(passIndices.size());
+    for (usize i = 0; i < passIndices.size(); ++i) {
+      if (used.at(i)) {
+        usedPassIndices.push_back(passIndices.at(i));
+      } else {
+        LOG_DEBUG("Pass is culled during compilation because no output "
+                  "depends on it: "
+                  << mPasses.at(passIndices.at(i)).getName()
+                  << " (Graph: " << mName << ")");
+      }
+    }
+
+    passIndices = std::move(usedPassIndices);
+  }
+
+  // Cache writes so we can easily access them
+  // for creating the adjacency list
+  std::unordered_map<rhi::TextureHandle, std::vector<usize>> textureWriters;
+  std::unordered_map<rhi::BufferHandle, std::vector<usize>> bufferWriters;
+  for (usize i = 0; i < passIndices.size(); ++i) {
+    auto &pass = mPasses.at(passIndices.at(i));
+    for (auto &resourceId : pass.getTextureOutputs()) {
+      textureWriters[resourceId.texture].push_back(i);
+    }
+
+    for (auto &resourceId : pass.getBufferOutputs()) {
+      bufferWriters[resourceId.buffer].push_back(i);
     }
   }
 
@@ -166,25 +467,82 @@ void RenderGraph::compile() {
   std::vector<std::set<usize>> adjacencyList;
   adjacencyList.resize(passIndices.size());
 
+  // Passes read the writes of passes that are added
+  // before them. Writers of persistent resources that
+  // are added after the reader overwrite the contents
+  // of the previous execution that the reader reads;
+  // so, the reader runs before them (write after read)
+  std::vector<std::pair<usize, usize>> laterWrites;
+  auto addReadEdges = [&adjacencyList,
+                       &laterWrites](const std::vector<usize> &writers,
+                                     usize reader, bool persistent) {
+    auto end = std::lower_bound(writers.begin(), writers.end(), reader);
+    for (auto it = writers.begin(); it != end; ++it) {
+      adjacencyList.at(*it).insert(reader);
+    }
+
+    for (auto it = std::upper_bound(end, writers.end(), reader);
+         it != writers.end(); ++it) {
+      if (persistent) {
+        adjacencyList.at(reader).insert(*it);
+        break;
+      }
+
+      laterWrites.push_back({*it, reader});
+    }
+  };
+
+  // Writers of the same resource run in the
+  // order they are added (write after write)
+  auto addWriteEdges = [&adjacencyList](const std::vector<usize> &writers) {
+    for (usize i = 1; i < writers.size(); ++i) {
+      if (writers.at(i - 1) != writers.at(i)) {
+        adjacencyList.at(writers.at(i - 1)).insert(writers.at(i));
+      }
+    }
+  };
+
+  for (const auto &[_, writers] : textureWriters) {
+    addWriteEdges(writers);
+  }
+
+  for (const auto &[_, writers] : bufferWriters) {
+    addWriteEdges(writers);
+  }
+
   for (usize i = 0; i < passIndices.size(); ++i) {
     auto &pass = mPasses.at(passIndices.at(i));
-    for (auto resourceId : pass.getTextureOutputs()) {
-      if (passTextureReads.find(resourceId.texture) != passTextureReads.end()) {
-        for (auto read : passTextureReads.at(resourceId.texture)) {
-          adjacencyList.at(i).insert(read);
-        }
+    for (auto &resourceId : pass.getTextureInputs()) {
+      auto it = textureWriters.find(resourceId.texture);
+      if (it != textureWriters.end()) {
+        addReadEdges(
+            it->second, i,
+            mPersistentTextures.contains(resourceId.texture.getIndex()));
       }
     }
 
-    for (auto resourceId : pass.getBufferOutputs()) {
-      if (passBufferReads.find(resourceId.buffer) != passBufferReads.end()) {
-        for (auto read : passBufferReads.at(resourceId.buffer)) {
-          adjacencyList.at(i).insert(read);
-        }
+    for (auto &resourceId : pass.getBufferInputs()) {
+      auto it = bufferWriters.find(resourceId.buffer);
+      if (it != bufferWriters.end()) {
+        addReadEdges(it->second, i, false);
       }
     }
   }
 
+  // Writers of transient resources that are added after
+  // the reader still feed the reader (e.g. overlays that
+  // are attached after post processing), unless they
+  // depend on the reader, in which case the reader
+  // reads the writes that happen before it
+  std::sort(laterWrites.begin(), laterWrites.end());
+  for (auto [writer, reader] : laterWrites) {
+    if (isReachable(adjacencyList, reader, writer)) {
+      adjacencyList.at(reader).insert(writer);
+    } else {
+      adjacencyList.at(writer).insert(reader);
+    }
+  }
+
   // Topological sort based on DFS
   std::vector<RenderGraphPass> compiledPasses;
   compiledPasses.reserve(passIndices.size());
@@ -192,7 +550,8 @@ void RenderGraph::compile() {
 
   for (usize i = passIndices.size(); i-- > 0;) {
     if (!visited.at(i)) {
-      topologicalSort(mPasses, i, visited, adjacencyList, compiledPasses);
+      topologicalSort(mPasses, passIndices, i, visited, adjacencyList,
+                      compiledPasses);
     }
   }
 
@@ -200,8 +559,31 @@ void RenderGraph::compile() {
   mCompiledPasses = std::move(compiledPasses);
 }
 
+void RenderGraph::buildSubmissions() {
+  QUOLL_PROFILE_EVENT("RenderGraph::buildSubmissions");
+
+  bool asyncCompute = mStorage && mStorage->getDevice()->hasAsyncCompute();
+
+  mSubmissions.clear();
+  mPassSubmissions.resize(mCompiledPasses.size());
+
+  for (usize i = 0; i < mCompiledPasses.size(); ++i) {
+    auto queue = asyncCompute && mCompiledPasses.at(i).isAsyncCompute()
+                     ? rhi::QueueType::Compute
+                     : rhi::QueueType::Graphics;
+
+    if (mSubmissions.empty() || mSubmissions.back().queue != queue) {
+      mSubmissions.push_back({queue, i});
+    }
+
+    mSubmissions.back().numPasses++;
+    mPassSubmissions.at(i) = mSubmissions.size() - 1;
+  }
+}
+
 void RenderGraph::buildBarriers() {
   QUOLL_PROFILE_EVENT("RenderGraph::buildBarriers");
+  static constexpr usize NoSubmission = std::numeric_limits<usize>::max();
 
   std::unordered_map<rhi::TextureHandle, rhi::ImageLayout>
       textureAttachmentLayouts;
@@ -210,7 +592,118 @@ void RenderGraph::buildBarriers() {
   std::unordered_map<rhi::BufferHandle, RenderGraphBufferSyncDependency>
       bufferDependencies;
 
+  // Last access to memory of every texture heap
+  std::unordered_map<usize, RenderGraphTextureSyncDependency>
+      heapDependencies;
+
+  // Last submission of every queue that accessed
+  // the resource after the other queue did
+  using QueueAccesses = std::array<usize, 2>;
+  static constexpr QueueAccesses NoQueueAccesses{NoSubmission, NoSubmission};
+
+  std::unordered_map<usize, QueueAccesses> textureQueueAccesses;
+  std::unordered_map<rhi::BufferHandle, QueueAccesses> bufferQueueAccesses;
+
+  const auto numTextures =
+      mRegistry.getRealResources<rhi::TextureHandle>().size();
+
+  // Persistent textures start every execution in
+  // the state that their last access left them in
   for (auto &pass : mCompiledPasses) {
+    for (usize index = 0; index < pass.getTextureOutputs().size(); ++index) {
+      auto &output = pass.getTextureOutputs().at(index);
+      if (mPersistentTextures.contains(output.texture.getIndex())) {
+        textureDependencies.insert_or_assign(
+            output.texture.getHandle(),
+            RenderGraphSyncDependency::getTextureWrite(
+                pass.getType(), pass.getAttachments().at(index).type));
+      }
+    }
+
+    for (auto &input : pass.getTextureInputs()) {
+      if (mPersistentTextures.contains(input.texture.getIndex())) {
+        textureDependencies.insert_or_assign(
+            input.texture.getHandle(),
+            RenderGraphSyncDependency::getTextureRead(pass.getType()));
+      }
+    }
+  }
+
+  mPersistentTextureBarriers.clear();
+  for (auto index : mPersistentTextures) {
+    auto handle = mRegistry.get<rhi::TextureHandle>(index);
+    auto it = textureDependencies.find(handle);
+    if (it == textureDependencies.end()) {
+      continue;
+    }
+
+    const auto &dependency = it->second;
+    const auto &description =
+        mRegistry.getDescription<rhi::TextureHandle>(index);
+
+    rhi::ImageBarrier imageBarrier{};
+    imageBarrier.texture = handle;
+    if (const auto *textureDescription =
+            std::get_if<rhi::TextureDescription>(&description)) {
+      imageBarrier.levelCount = textureDescription->mipLevelCount;
+    }
+    imageBarrier.srcStage = rhi::PipelineStage::None;
+    imageBarrier.srcAccess = rhi::Access::None;
+    imageBarrier.srcLayout = rhi::ImageLayout::Undefined;
+    imageBarrier.dstStage = dependency.stage;
+    imageBarrier.dstAccess = dependency.access;
+    imageBarrier.dstLayout = dependency.layout;
+    mPersistentTextureBarriers.push_back(imageBarrier);
+  }
+
+  // Textures in the same heap share memory; so, they
+  // are synchronized between queues as one resource
+  auto getTextureQueueAccesses = [&](usize textureIndex) -> QueueAccesses & {
+    auto index = getRootTextureIndex(textureIndex);
+    auto heapIndex = mTextureHeapIndices.at(index);
+    auto key = heapIndex == NoHeap ? index : numTextures + heapIndex;
+
+    return textureQueueAccesses.try_emplace(key, NoQueueAccesses)
+        .first->second;
+  };
+
+  // Adds semaphore wait if the other queue
+  // accessed the resource since it was last
+  // waited for
+  auto waitForOtherQueue = [this](QueueAccesses &accesses, usize submission,
+                                  rhi::PipelineStage stage) {
+    auto &current = mSubmissions.at(submission);
+    auto queue = static_cast<usize>(current.queue);
+    auto otherQueue = 1 - queue;
+
+    auto waitFor = accesses.at(otherQueue);
+    accesses.at(queue) = submission;
+    if (waitFor == NoSubmission) {
+      return false;
+    }
+
+    accesses.at(otherQueue) = NoSubmission;
+
+    auto it = std::find_if(current.waits.begin(), current.waits.end(),
+                           [this, &waitFor](const auto &wait) {
+                             return mSubmissions.at(wait.submission).queue ==
+                                    mSubmissions.at(waitFor).queue;
+                           });
+
+    if (it == current.waits.end()) {
+      current.waits.push_back({waitFor, stage});
+    } else {
+      it->submission = std::max(it->submission, waitFor);
+      it->stage |= stage;
+    }
+
+    return true;
+  };
+
+  for (usize p = 0; p < mCompiledPasses.size(); ++p) {
+    auto &pass = mCompiledPasses.at(p);
+    auto submission = mPassSubmissions.at(p);
+
     std::vector<rhi::ImageBarrier> imageBarriers{};
     std::vector<rhi::BufferBarrier> bufferBarriers{};
 
@@ -244,8 +737,18 @@ void RenderGraph::buildBarriers() {
       imageBarrier.levelCount = mipLevelCount;
       imageBarrier.dstStage = newDependency.stage;
 
+      auto heapIndex = mTextureHeapIndices.at(
+          getRootTextureIndex(output.texture.getIndex()));
+      auto heapIt = heapDependencies.find(heapIndex);
+
       auto it = textureDependencies.find(handle);
-      if (it == textureDependencies.end()) {
+      if (it == textureDependencies.end() && heapIt != heapDependencies.end()) {
+        // Aliasing barrier waits for the last
+        // access of previous texture in the heap
+        imageBarrier.srcStage = heapIt->second.stage;
+        imageBarrier.srcAccess = heapIt->second.access;
+        imageBarrier.srcLayout = rhi::ImageLayout::Undefined;
+      } else if (it == textureDependencies.end()) {
         imageBarrier.srcStage = rhi::PipelineStage::None;
         imageBarrier.srcAccess = rhi::Access::None;
         imageBarrier.srcLayout = rhi::ImageLayout::Undefined;
@@ -257,8 +760,22 @@ void RenderGraph::buildBarriers() {
         imageBarrier.srcLayout = oldDependency.layout;
       }
 
+      // Semaphore wait makes previous access on the
+      // other queue available; so, barrier only needs
+      // to transition the layout after the wait
+      if (waitForOtherQueue(
+              getTextureQueueAccesses(output.texture.getIndex()), submission,
+              newDependency.stage)) {
+        imageBarrier.srcStage = newDependency.stage;
+        imageBarrier.srcAccess = rhi::Access::None;
+      }
+
       imageBarriers.push_back(imageBarrier);
       textureDependencies.insert_or_assign(handle, newDependency);
+
+      if (heapIndex != NoHeap) {
+        heapDependencies.insert_or_assign(heapIndex, newDependency);
+      }
     }
 
     for (usize index = 0; index < pass.getTextureInputs().size(); ++index) {
@@ -281,9 +798,22 @@ void RenderGraph::buildBarriers() {
       imageBarrier.dstLayout = newDependency.layout;
       imageBarrier.srcStage = oldDependency.stage;
       imageBarrier.dstStage = newDependency.stage;
+
+      if (waitForOtherQueue(getTextureQueueAccesses(input.texture.getIndex()),
+                            submission, newDependency.stage)) {
+        imageBarrier.srcStage = newDependency.stage;
+        imageBarrier.srcAccess = rhi::Access::None;
+      }
+
       imageBarriers.push_back(imageBarrier);
 
       textureDependencies.insert_or_assign(handle, newDependency);
+
+      auto heapIndex = mTextureHeapIndices.at(
+          getRootTextureIndex(input.texture.getIndex()));
+      if (heapIndex != NoHeap) {
+        heapDependencies.insert_or_assign(heapIndex, newDependency);
+      }
     }
 
     for (auto &output : pass.getBufferOutputs()) {
@@ -308,6 +838,14 @@ void RenderGraph::buildBarriers() {
         bufferBarrier.srcAccess = oldDependency.access;
       }
 
+      if (waitForOtherQueue(
+              bufferQueueAccesses.try_emplace(handle, NoQueueAccesses)
+                  .first->second,
+              submission, newDependency.stage)) {
+        bufferBarrier.srcStage = newDependency.stage;
+        bufferBarrier.srcAccess = rhi::Access::None;
+      }
+
       bufferBarriers.push_back(bufferBarrier);
       bufferDependencies.insert_or_assign(handle, newDependency);
     }
@@ -326,6 +864,15 @@ void RenderGraph::buildBarriers() {
       bufferBarrier.dstAccess = newDependency.access;
       bufferBarrier.srcStage = oldDependency.stage;
       bufferBarrier.dstStage = newDependency.stage;
+
+      if (waitForOtherQueue(
+              bufferQueueAccesses.try_emplace(handle, NoQueueAccesses)
+                  .first->second,
+              submission, newDependency.stage)) {
+        bufferBarrier.srcStage = newDependency.stage;
+        bufferBarrier.srcAccess = rhi::Access::None;
+      }
+
       bufferBarriers.push_back(bufferBarrier);
 
       bufferDependencies.insert_or_assign(handle, newDependency);
@@ -338,13 +885,20 @@ void RenderGraph::buildBarriers() {
     for (usize i = 0; i < pass.mTextureOutputs.size(); ++i) {
       auto &output = pass.mTextureOutputs.at(i);
       auto &attachment = pass.mAttachments.at(i);
-      if (textureAttachmentLayouts.find(output.texture) ==
+      if (textureAttachmentLayouts.find(output.texture) !=
           textureAttachmentLayouts.end()) {
-        output.srcLayout = rhi::ImageLayout::Undefined;
-        attachment.loadOp = rhi::AttachmentLoadOp::Clear;
-      } else {
         output.srcLayout = textureAttachmentLayouts.at(output.texture);
         attachment.loadOp = rhi::AttachmentLoadOp::Load;
+      } else if (mPersistentTextures.contains(output.texture.getIndex())) {
+        // Barrier of the pass already transitions
+        // persistent texture to attachment layout
+        output.srcLayout = RenderGraphSyncDependency::getTextureWrite(
+                               pass.getType(), attachment.type)
+                               .layout;
+        attachment.loadOp = rhi::AttachmentLoadOp::Load;
+      } else {
+        output.srcLayout = rhi::ImageLayout::Undefined;
+        attachment.loadOp = rhi::AttachmentLoadOp::Clear;
       }
 
       attachment.storeOp = rhi::AttachmentStoreOp::Store;
@@ -365,17 +919,19 @@ void RenderGraph::buildBarriers() {
 void RenderGraph::buildPasses(RenderStorage &storage) {
   QUOLL_PROFILE_EVENT("RenderGraph::buildPasses");
 
-  for (auto &pass : mCompiledPasses) {
-    if (pass.getType() == RenderGraphPassType::Compute) {
-      buildComputePass(pass, storage);
-    } else {
-      buildGraphicsPass(pass, storage);
+  std::vector<PipelineRenderTargets> renderTargets(mCompiledPasses.size());
+  for (usize i = 0; i < mCompiledPasses.size(); ++i) {
+    auto &pass = mCompiledPasses.at(i);
+    if (pass.getType() == RenderGraphPassType::Graphics) {
+      renderTargets.at(i) = buildGraphicsPass(pass, storage);
     }
   }
+
+  buildPipelines(storage, renderTargets);
 }
 
-void RenderGraph::buildGraphicsPass(RenderGraphPass &pass,
-                                    RenderStorage &storage) {
+PipelineRenderTargets RenderGraph::buildGraphicsPass(RenderGraphPass &pass,
+                                                     RenderStorage &storage) {
   QUOLL_PROFILE_EVENT("RenderGraph::buildGraphicsPass");
   auto *device = storage.getDevice();
 
@@ -385,6 +941,7 @@ void RenderGraph::buildGraphicsPass(RenderGraphPass &pass,
   u32 sampleCount = 0;
 
   std::vector<rhi::TextureHandle> framebufferAttachments;
+  PipelineRenderTargets renderTargets{};
 
   rhi::RenderPassDescription renderPassDesc{};
   renderPassDesc.bindPoint = rhi::PipelineBindPoint::Graphics;
@@ -416,10 +973,13 @@ void RenderGraph::buildGraphicsPass(RenderGraphPass &pass,
 
     if (attachment.type == AttachmentType::Resolve) {
       renderPassDesc.resolveAttachment.emplace(rpAttachmentDesc);
+      renderTargets.resolveFormat = desc.format;
     } else if (attachment.type == AttachmentType::Depth) {
       renderPassDesc.depthAttachment.emplace(rpAttachmentDesc);
+      renderTargets.depthFormat = desc.format;
     } else {
       renderPassDesc.colorAttachments.push_back(rpAttachmentDesc);
+      renderTargets.colorFormats.push_back(desc.format);
     }
 
     width = desc.width;
@@ -452,71 +1012,325 @@ void RenderGraph::buildGraphicsPass(RenderGraphPass &pass,
   pass.mDimensions.y = height;
   pass.mDimensions.z = layerCount;
 
-  for (auto handle : pass.mPipelines) {
-    auto &description = storage.getGraphicsPipelineDescription(handle);
-    description.renderPass = pass.mRenderPass;
-    description.multisample.sampleCount = sampleCount;
+  renderTargets.sampleCount = sampleCount;
+  return renderTargets;
+}
+
+void RenderGraph::buildPipelines(
+    RenderStorage &storage,
+    const std::vector<PipelineRenderTargets> &renderTargets) {
+  QUOLL_PROFILE_EVENT("RenderGraph::buildPipelines");
+  auto *device = storage.getDevice();
+
+  // Pipeline descriptions are copied into tasks because
+  // render pass of the pipeline belongs to the graph
+  std::vector<ThreadPool::Task> tasks;
+  std::set<rhi::PipelineHandle> scheduled;
+
+  for (usize i = 0; i < mCompiledPasses.size(); ++i) {
+    const auto &pass = mCompiledPasses.at(i);
+    const auto &passRenderTargets = renderTargets.at(i);
+
+    for (auto handle : pass.mPipelines) {
+      if (scheduled.contains(handle) ||
+          storage.isPipelineBuilt(handle, passRenderTargets)) {
+        continue;
+      }
+
+      if (device->hasPipeline(handle)) {
+        device->destroyPipeline(handle);
+      }
 
-    if (device->hasPipeline(handle)) {
-      device->destroyPipeline(handle);
+      scheduled.insert(handle);
+      storage.setPipelineBuilt(handle, passRenderTargets);
+
+      if (pass.getType() == RenderGraphPassType::Compute) {
+        tasks.push_back([device, handle,
+                         description = storage.getComputePipelineDescription(
+                             handle)](u32) {
+          device->createPipeline(description, handle);
+        });
+      } else {
+        auto description = storage.getGraphicsPipelineDescription(handle);
+        description.renderPass = pass.mRenderPass;
+        description.multisample.sampleCount = passRenderTargets.sampleCount;
+
+        tasks.push_back([device, handle, description](u32) {
+          device->createPipeline(description, handle);
+        });
+      }
     }
+  }
 
-    device->createPipeline(description, handle);
+  if (tasks.empty()) {
+    return;
+  }
+
+  auto &threadPool = storage.getRecordingThreadPool();
+  for (auto &task : tasks) {
+    threadPool.push(std::move(task));
   }
+  threadPool.wait();
+
+  LOG_DEBUG("Render graph pipelines built: " << tasks.size()
+                                             << " (Graph: " << mName << ")");
 }
 
-void RenderGraph::buildComputePass(RenderGraphPass &pass,
-                                   RenderStorage &storage) {
-  QUOLL_PROFILE_EVENT("buildComputePass");
-  auto *device = storage.getDevice();
+void RenderGraph::execute(rhi::RenderCommandList &commandList, u32 frameIndex) {
+  QUOLL_PROFILE_EVENT("RenderGraph::execute");
+
+  readTimestamps(frameIndex);
+  recordParallelPasses(frameIndex);
+
+  // Graph without async compute submissions
+  // is recorded into the frame command list
+  if (mSubmissions.size() <= 1) {
+    recordPasses(commandList, 0, mCompiledPasses.size(), frameIndex);
+    mTimestampsWritten.at(frameIndex) = true;
+    return;
+  }
+
+  auto *device = mStorage->getDevice();
+  std::vector<u64> values(mSubmissions.size(), 0);
 
-  for (auto handle : pass.mPipelines) {
-    auto &description = storage.getComputePipelineDescription(handle);
+  for (usize i = 0; i < mSubmissions.size(); ++i) {
+    const auto &submission = mSubmissions.at(i);
 
-    if (device->hasPipeline(handle)) {
-      device->destroyPipeline(handle);
+    std::vector<rhi::QueueWait> waits;
+    waits.reserve(submission.waits.size());
+    for (const auto &wait : submission.waits) {
+      waits.push_back({mSubmissions.at(wait.submission).queue,
+                       values.at(wait.submission), wait.stage});
     }
 
-    device->createPipeline(description, handle);
+    auto &queueCommandList = device->requestQueueCommandList(submission.queue);
+    recordPasses(queueCommandList, submission.firstPass, submission.numPasses,
+                 frameIndex);
+    values.at(i) = device->submitQueueCommandList(queueCommandList,
+                                                  submission.queue, waits);
   }
+
+  mTimestampsWritten.at(frameIndex) = true;
 }
 
-void RenderGraph::execute(rhi::RenderCommandList &commandList, u32 frameIndex) {
-  QUOLL_PROFILE_EVENT("RenderGraph::execute");
+void RenderGraph::recordPasses(rhi::RenderCommandList &commandList,
+                               usize firstPass, usize numPasses,
+                               u32 frameIndex) {
+  bool hasTimestamps = rhi::isHandleValid(mTimestampQueryPool);
+  if (hasTimestamps && numPasses > 0) {
+    commandList.resetQueryPool(mTimestampQueryPool,
+                               getTimestampQuery(frameIndex, firstPass),
+                               static_cast<u32>(numPasses * 2));
+  }
+
+  for (usize i = firstPass; i < firstPass + numPasses; ++i) {
+    auto &pass = mCompiledPasses.at(i);
+    auto &secondaryCommandLists = mSecondaryCommandLists.at(i);
+
+    if (hasTimestamps) {
+      commandList.writeTimestamp(mTimestampQueryPool,
+                                 getTimestampQuery(frameIndex, i),
+                                 rhi::PipelineStage::AllCommands);
+    }
 
-  for (auto &pass : mCompiledPasses) {
     commandList.pipelineBarrier(pass.mDependencies.memoryBarriers,
                                 pass.mDependencies.imageBarriers,
                                 pass.mDependencies.bufferBarriers);
 
     if (pass.getType() == RenderGraphPassType::Compute) {
       pass.execute(commandList, frameIndex);
+    } else if (!secondaryCommandLists.empty()) {
+      commandList.beginRenderPass(pass.mRenderPass, pass.getFramebuffer(),
+                                  {0, 0}, glm::uvec2(pass.getDimensions()),
+                                  rhi::SubpassContents::SecondaryCommandLists);
+      commandList.executeCommands(secondaryCommandLists);
+      commandList.endRenderPass();
     } else {
+      auto viewportSize = getViewportSize(pass);
       commandList.beginRenderPass(pass.mRenderPass, pass.getFramebuffer(),
                                   {0, 0}, glm::uvec2(pass.getDimensions()));
-      commandList.setViewport({0.0f, 0.0f}, glm::uvec2(pass.getDimensions()),
-                              {0.0f, 1.0f});
-      commandList.setScissor({0.0f, 0.0f}, glm::uvec2(pass.getDimensions()));
+      commandList.setViewport({0.0f, 0.0f}, viewportSize, {0.0f, 1.0f});
+      commandList.setScissor({0.0f, 0.0f}, viewportSize);
       pass.execute(commandList, frameIndex);
       commandList.endRenderPass();
     }
+
+    if (hasTimestamps) {
+      commandList.writeTimestamp(mTimestampQueryPool,
+                                 getTimestampQuery(frameIndex, i) + 1,
+                                 rhi::PipelineStage::AllCommands);
+    }
+  }
+}
+
+void RenderGraph::buildTimestamps(RenderStorage &storage) {
+  auto *device = storage.getDevice();
+  if (rhi::isHandleValid(mTimestampQueryPool)) {
+    device->destroyQueryPool(mTimestampQueryPool);
+    mTimestampQueryPool = rhi::QueryPoolHandle::Null;
+  }
+
+  mTimestampsWritten = {};
+  mPassTimings.clear();
+  mPassTimings.reserve(mCompiledPasses.size());
+  for (usize i = 0; i < mCompiledPasses.size(); ++i) {
+    mPassTimings.push_back({mCompiledPasses.at(i).getName(),
+                            mSubmissions.at(mPassSubmissions.at(i)).queue,
+                            0.0f});
+  }
+
+  if (mCompiledPasses.empty()) {
+    return;
+  }
+
+  // Every frame index has its own begin and end
+  // queries for each pass; so, queries of a frame
+  // are read back when the frame index is reused
+  rhi::QueryPoolDescription description{};
+  description.type = rhi::QueryType::Timestamp;
+  description.count = static_cast<u32>(mCompiledPasses.size() * 2 *
+                                       rhi::RenderDevice::NumFrames);
+  description.debugName = mName + " timestamps";
+  mTimestampQueryPool = device->createQueryPool(description);
+}
+
+void RenderGraph::readTimestamps(u32 frameIndex) {
+  static constexpr f64 NanosecondsInMillisecond = 1000000.0;
+
+  if (!rhi::isHandleValid(mTimestampQueryPool) ||
+      !mTimestampsWritten.at(frameIndex)) {
+    return;
+  }
+
+  std::vector<u64> timestamps(mCompiledPasses.size() * 2);
+  if (!mStorage->getDevice()->getQueryPoolResults(
+          mTimestampQueryPool, getTimestampQuery(frameIndex, 0), timestamps)) {
+    return;
+  }
+
+  for (usize i = 0; i < mPassTimings.size(); ++i) {
+    u64 begin = timestamps.at(i * 2);
+    u64 end = timestamps.at(i * 2 + 1);
+    mPassTimings.at(i).time =
+        end > begin ? static_cast<f32>(static_cast<f64>(end - begin) /
+                                       NanosecondsInMillisecond)
+                    : 0.0f;
   }
 }
 
+void RenderGraph::setResolutionScale(f32 scale) {
+  mResolutionScale = std::clamp(scale, 0.0f, 1.0f);
+}
+
+glm::uvec2 RenderGraph::getViewportSize(const RenderGraphPass &pass) const {
+  glm::uvec2 size(pass.getDimensions());
+  if (!pass.hasDynamicResolution()) {
+    return size;
+  }
+
+  glm::vec2 scaledSize = glm::round(glm::vec2(size) * mResolutionScale);
+  return glm::max(glm::uvec2(scaledSize), glm::uvec2(1, 1));
+}
+
+u32 RenderGraph::getTimestampQuery(u32 frameIndex, usize passIndex) const {
+  return static_cast<u32>((frameIndex * mCompiledPasses.size() + passIndex) *
+                          2);
+}
+
+void RenderGraph::recordParallelPasses(u32 frameIndex) {
+  QUOLL_PROFILE_EVENT("RenderGraph::recordParallelPasses");
+
+  mSecondaryCommandLists.resize(mCompiledPasses.size());
+  for (auto &commandLists : mSecondaryCommandLists) {
+    commandLists.clear();
+  }
+
+  // Passes are executed inline if graph
+  // is not built with render storage
+  if (!mStorage) {
+    return;
+  }
+
+  auto &threadPool = mStorage->getRecordingThreadPool();
+  auto *device = mStorage->getDevice();
+  u32 numChunks = threadPool.getNumThreads();
+
+  for (usize i = 0; i < mCompiledPasses.size(); ++i) {
+    auto &pass = mCompiledPasses.at(i);
+    if (pass.getType() != RenderGraphPassType::Graphics || !pass.isParallel()) {
+      continue;
+    }
+
+    auto &commandLists = mSecondaryCommandLists.at(i);
+    commandLists.resize(numChunks, nullptr);
+
+    auto viewportSize = getViewportSize(pass);
+    for (u32 chunk = 0; chunk < numChunks; ++chunk) {
+      threadPool.push([&pass, &commandLists, device, frameIndex, chunk,
+                       numChunks, viewportSize](u32 threadIndex) {
+        auto &commandList = device->requestSecondaryCommandList(
+            threadIndex, pass.getRenderPass(), pass.getFramebuffer());
+
+        commandList.setViewport({0.0f, 0.0f}, viewportSize, {0.0f, 1.0f});
+        commandList.setScissor({0.0f, 0.0f}, viewportSize);
+        pass.execute(commandList, frameIndex, chunk, numChunks);
+        commandList.end();
+
+        commandLists.at(chunk) = &commandList;
+      });
+    }
+  }
+
+  threadPool.wait();
+}
+
+void RenderGraph::buildPersistentTextures(RenderStorage &storage) {
+  if (mPersistentTextureBarriers.empty()) {
+    return;
+  }
+
+  // Newly created textures have undefined layout; so, they
+  // are transitioned to the layout that the first barrier
+  // of the graph expects from the previous execution
+  auto *device = storage.getDevice();
+  auto commandList = device->requestImmediateCommandList();
+  commandList.pipelineBarrier({}, mPersistentTextureBarriers, {});
+  device->submitImmediate(commandList);
+}
+
 void RenderGraph::build(RenderStorage &storage) {
-  buildResources(storage);
+  mStorage = &storage;
+  buildResourceHandles(storage);
 
   compile();
+  buildAliases();
+  buildResources(storage);
+  buildSubmissions();
   buildBarriers();
   buildPasses(storage);
-
-  LOG_DEBUG("Render graph built: " << mName);
+  buildTimestamps(storage);
+  buildPersistentTextures(storage);
+
+  LOG_DEBUG("Render graph built: " << mName << " (" << mCompiledPasses.size()
+                                   << " passes, " << mSubmissions.size()
+                                   << " submissions)");
+  LOG_DEBUG("Render graph memory aliasing: "
+            << mAliasingReport.numAliasedTextures << " of "
+            << mAliasingReport.numTransientTextures
+            << " transient textures aliased, "
+            << mAliasingReport.savedMemorySize << " of "
+            << mAliasingReport.totalMemorySize
+            << " bytes saved (Graph: " << mName << ")");
 }
 
-void RenderGraph::destroy(RenderStorage &storage) {
+void RenderGraph::destroy(RenderStorage &storage, bool retainPipelines) {
   for (auto &pass : mCompiledPasses) {
     for (auto pipeline : pass.getPipelines()) {
-      storage.getDevice()->destroyPipeline(pipeline);
+      if (retainPipelines) {
+        storage.retainPipeline(pipeline);
+      } else {
+        storage.getDevice()->destroyPipeline(pipeline);
+      }
     }
 
     if (rhi::isHandleValid(pass.getFramebuffer())) {
@@ -536,6 +1350,11 @@ void RenderGraph::destroy(RenderStorage &storage) {
       storage.destroyTexture(mRegistry.get<rhi::TextureHandle>(index));
     }
   }
+
+  if (rhi::isHandleValid(mTimestampQueryPool)) {
+    storage.getDevice()->destroyQueryPool(mTimestampQueryPool);
+    mTimestampQueryPool = rhi::QueryPoolHandle::Null;
+  }
 }
 
 } // namespace quoll
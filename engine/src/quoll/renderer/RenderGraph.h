@@ -11,6 +11,94 @@ namespace quoll {
 
 enum class GraphDirty { None, PassChanges, SizeUpdate };
 
+/**
+ * @brief Render graph memory aliasing report
+ */
+struct RenderGraphAliasingReport {
+  /**
+   * Number of transient textures
+   */
+  u32 numTransientTextures = 0;
+
+  /**
+   * Number of textures that reuse memory of another texture
+   */
+  u32 numAliasedTextures = 0;
+
+  /**
+   * Memory size of transient textures without aliasing
+   */
+  usize totalMemorySize = 0;
+
+  /**
+   * Memory size saved by aliasing
+   */
+  usize savedMemorySize = 0;
+};
+
+/**
+ * @brief Render graph submission wait
+ */
+struct RenderGraphSubmissionWait {
+  /**
+   * Index of submission to wait for
+   */
+  usize submission = 0;
+
+  /**
+   * Pipeline stages that wait for submission
+   */
+  rhi::PipelineStage stage = rhi::PipelineStage::None;
+};
+
+/**
+ * @brief Render graph queue submission
+ *
+ * Consecutive compiled passes that
+ * run on the same queue
+ */
+struct RenderGraphSubmission {
+  /**
+   * Queue type
+   */
+  rhi::QueueType queue = rhi::QueueType::Graphics;
+
+  /**
+   * Index of first compiled pass
+   */
+  usize firstPass = 0;
+
+  /**
+   * Number of passes
+   */
+  usize numPasses = 0;
+
+  /**
+   * Earlier submissions of other queue to wait for
+   */
+  std::vector<RenderGraphSubmissionWait> waits;
+};
+
+/**
+ * @brief GPU time of render graph pass
+ */
+struct RenderGraphPassTiming {
+  /**
+   * Pass name
+   */
+  String name;
+
+  /**
+   * Queue type
+   */
+  rhi::QueueType queue = rhi::QueueType::Graphics;
+
+  /**
+   * GPU time in milliseconds
+   */
+  f32 time = 0.0f;
+};
+
 /**
  * @brief Render graph
  */
@@ -78,9 +166,41 @@ public:
    */
   RGTexture import(rhi::TextureHandle handle);
 
+  /**
+   * @brief Mark texture as output of render graph
+   *
+   * Output textures are used outside of the graph.
+   * Passes that output textures and imported textures
+   * do not depend on are culled during compilation.
+   *
+   * @param texture Render graph texture
+   */
+  void markAsOutput(RGTexture texture);
+
+  /**
+   * @brief Mark texture as persistent
+   *
+   * Persistent textures keep their contents between
+   * executions of the graph. They are never aliased
+   * and their first write in the graph loads existing
+   * contents instead of clearing them. Passes can use
+   * them to cache results of previous frames.
+   *
+   * @param texture Render graph texture
+   */
+  void markAsPersistent(RGTexture texture);
+
   /**
    * @brief Execute render graph
    *
+   * Parallel passes are recorded into secondary
+   * command lists before any pass is recorded
+   * into the command list.
+   *
+   * If graph has async compute passes, every
+   * submission is recorded into a queue command
+   * list and submitted to its queue instead.
+   *
    * @param commandList Command list
    * @param frameIndex Frame index
    */
@@ -96,9 +216,14 @@ public:
   /**
    * @brief Clear render graph
    *
+   * Retained pipelines stay in the device and
+   * are reused by the next graph that adds
+   * pipelines with equal descriptions
+   *
    * @param storage Render storage
+   * @param retainPipelines Retain pipelines instead of destroying them
    */
-  void destroy(RenderStorage &storage);
+  void destroy(RenderStorage &storage, bool retainPipelines = false);
 
   /**
    * @brief Get passes
@@ -123,7 +248,70 @@ public:
    */
   inline const String &getName() const { return mName; }
 
+  /**
+   * @brief Get memory aliasing report
+   *
+   * @return Memory aliasing report of last build
+   */
+  inline const RenderGraphAliasingReport &getAliasingReport() const {
+    return mAliasingReport;
+  }
+
+  /**
+   * @brief Get queue submissions
+   *
+   * @return Queue submissions of last build
+   */
+  inline const std::vector<RenderGraphSubmission> &getSubmissions() const {
+    return mSubmissions;
+  }
+
+  /**
+   * @brief Get GPU times of compiled passes
+   *
+   * Timestamps are read back when the same
+   * frame index is executed again
+   *
+   * @return GPU times of compiled passes
+   */
+  inline const std::vector<RenderGraphPassTiming> &getPassTimings() const {
+    return mPassTimings;
+  }
+
+  /**
+   * @brief Set resolution scale
+   *
+   * Scales viewports of passes with
+   * dynamic resolution. Resources are
+   * not rebuilt when scale changes.
+   *
+   * @param scale Resolution scale
+   */
+  void setResolutionScale(f32 scale);
+
+  /**
+   * @brief Get resolution scale
+   *
+   * @return Resolution scale
+   */
+  inline f32 getResolutionScale() const { return mResolutionScale; }
+
+  /**
+   * @brief Get viewport size of pass
+   *
+   * @param pass Render graph pass
+   * @return Viewport size
+   */
+  glm::uvec2 getViewportSize(const RenderGraphPass &pass) const;
+
 private:
+  /**
+   * @brief Create handles for render graph resources
+   *
+   * @param storage Render storage
+   */
+  void buildResourceHandles(RenderStorage &storage);
+
   /**
    * @brief Build render graph resources
    *
@@ -131,16 +319,43 @@ private:
    */
   void buildResources(RenderStorage &storage);
 
+  /**
+   * @brief Build texture memory aliases
+   *
+   * Computes first and last use of every transient
+   * texture from compiled passes and places compatible
+   * textures whose lifetimes do not overlap into
+   * shared memory heaps
+   */
+  void buildAliases();
+
+  /**
+   * @brief Get index of texture that owns the resource
+   *
+   * @param index Texture or texture view index
+   * @return Texture index
+   */
+  usize getRootTextureIndex(usize index);
+
   /**
    * @brief Compile render graph
    *
-   * Topologically sorts and updates render
-   * passes in place
+   * Culls passes that graph outputs do not
+   * depend on, and topologically sorts and
+   * updates render passes in place
    */
   void compile();
 
+  /**
+   * @brief Split compiled passes into queue submissions
+   */
+  void buildSubmissions();
+
   /**
    * @brief Build barriers
+   *
+   * Also adds semaphore waits to submissions
+   * that access resources after another queue
    */
   void buildBarriers();
 
@@ -154,23 +369,78 @@ private:
   /**
    * @brief Build graphics pass resources
    *
-   * Creates framebuffers, render passes,
-   * and pipelines
+   * Creates framebuffers and render passes
    *
    * @param pass Render graph pass
    * @param storage Render storage
+   * @return Render targets of pass pipelines
    */
-  void buildGraphicsPass(RenderGraphPass &pass, RenderStorage &storage);
+  PipelineRenderTargets buildGraphicsPass(RenderGraphPass &pass,
+                                          RenderStorage &storage);
 
   /**
-   * @brief Build compute pass resources
+   * @brief Build pipelines of all passes
    *
-   * Creates compute pipelines
+   * Pipelines that are already built for render
+   * targets of their passes are kept. Other pipelines
+   * are created in recording threads.
    *
-   * @param pass Render graph pass
    * @param storage Render storage
+   * @param renderTargets Render targets of every pass
    */
-  void buildComputePass(RenderGraphPass &pass, RenderStorage &storage);
+  void buildPipelines(RenderStorage &storage,
+                      const std::vector<PipelineRenderTargets> &renderTargets);
+
+  /**
+   * @brief Record parallel passes
+   *
+   * Records chunks of all parallel passes in
+   * recording threads and waits for them to finish
+   *
+   * @param frameIndex Frame index
+   */
+  void recordParallelPasses(u32 frameIndex);
+
+  /**
+   * @brief Create timestamp queries for compiled passes
+   *
+   * @param storage Render storage
+   */
+  void buildTimestamps(RenderStorage &storage);
+
+  /**
+   * @brief Transition persistent textures to initial layouts
+   *
+   * @param storage Render storage
+   */
+  void buildPersistentTextures(RenderStorage &storage);
+
+  /**
+   * @brief Read pass timestamps of frame
+   *
+   * @param frameIndex Frame index
+   */
+  void readTimestamps(u32 frameIndex);
+
+  /**
+   * @brief Get first timestamp query of pass
+   *
+   * @param frameIndex Frame index
+   * @param passIndex Compiled pass index
+   * @return Query index
+   */
+  u32 getTimestampQuery(u32 frameIndex, usize passIndex) const;
+
+  /**
+   * @brief Record compiled passes
+   *
+   * @param commandList Command list
+   * @param firstPass Index of first compiled pass
+   * @param numPasses Number of passes
+   * @param frameIndex Frame index
+   */
+  void recordPasses(rhi::RenderCommandList &commandList, usize firstPass,
+                    usize numPasses, u32 frameIndex);
 
 private:
   RenderGraphRegistry mRegistry;
@@ -178,6 +448,35 @@ private:
 
   std::vector<RenderGraphPass> mPasses;
   std::vector<RenderGraphPass> mCompiledPasses;
+  std::set<usize> mOutputTextures;
+  std::set<usize> mPersistentTextures;
+  std::vector<rhi::ImageBarrier> mPersistentTextureBarriers;
+  std::vector<RenderGraphSubmission> mSubmissions;
+  std::vector<usize> mPassSubmissions;
+
+  /**
+   * @brief Textures that share the same memory
+   *
+   * First texture is the largest one and
+   * owns the memory
+   */
+  struct RGTextureHeap {
+    std::vector<usize> textures;
+  };
+
+  static constexpr usize NoHeap = std::numeric_limits<usize>::max();
+  std::vector<RGTextureHeap> mTextureHeaps;
+  std::vector<usize> mTextureHeapIndices;
+  RenderGraphAliasingReport mAliasingReport;
+
+  RenderStorage *mStorage = nullptr;
+  std::vector<std::vector<rhi::RenderCommandList *>> mSecondaryCommandLists;
+
+  rhi::QueryPoolHandle mTimestampQueryPool = rhi::QueryPoolHandle::Null;
+  std::array<bool, rhi::RenderDevice::NumFrames> mTimestampsWritten{};
+  std::vector<RenderGraphPassTiming> mPassTimings;
+
+  f32 mResolutionScale = 1.0f;
 };
 
 } // namespace quoll
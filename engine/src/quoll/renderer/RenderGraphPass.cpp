@@ -42,13 +42,41 @@ void RenderGraphPass::setExecutor(const ExecutorFn &executor) {
   mExecutor = executor;
 }
 
+void RenderGraphPass::setParallelExecutor(
+    const ParallelExecutorFn &executor) {
+  QuollAssert(mType == RenderGraphPassType::Graphics,
+              "Only graphics passes can be executed in parallel");
+  mParallelExecutor = executor;
+}
+
+void RenderGraphPass::setAsyncCompute() {
+  QuollAssert(mType == RenderGraphPassType::Compute,
+              "Only compute passes can run on async compute queue");
+  mAsyncCompute = true;
+}
+
+void RenderGraphPass::setDynamicResolution() {
+  QuollAssert(mType == RenderGraphPassType::Graphics,
+              "Only graphics passes can have dynamic resolution");
+  mDynamicResolution = true;
+}
+
 void RenderGraphPass::addPipeline(rhi::PipelineHandle handle) {
   mPipelines.push_back(handle);
 }
 
 void RenderGraphPass::execute(rhi::RenderCommandList &commandList,
                               u32 frameIndex) {
-  mExecutor(commandList, frameIndex);
+  if (mParallelExecutor) {
+    mParallelExecutor(commandList, frameIndex, 0, 1);
+  } else {
+    mExecutor(commandList, frameIndex);
+  }
+}
+
+void RenderGraphPass::execute(rhi::RenderCommandList &commandList,
+                              u32 frameIndex, u32 chunk, u32 numChunks) {
+  mParallelExecutor(commandList, frameIndex, chunk, numChunks);
 }
 
 } // namespace quoll
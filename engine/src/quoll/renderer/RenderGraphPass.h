@@ -103,6 +103,8 @@ enum class RenderGraphPassType { Graphics, Compute };
  */
 class RenderGraphPass {
   using ExecutorFn = std::function<void(rhi::RenderCommandList &, u32)>;
+  using ParallelExecutorFn =
+      std::function<void(rhi::RenderCommandList &, u32, u32, u32)>;
   friend RenderGraph;
 
 public:
@@ -157,6 +159,17 @@ public:
    */
   void execute(rhi::RenderCommandList &commandList, u32 frameIndex);
 
+  /**
+   * @brief Execute chunk of parallel pass
+   *
+   * @param commandList Command list
+   * @param frameIndex Frame index
+   * @param chunk Chunk index
+   * @param numChunks Number of chunks
+   */
+  void execute(rhi::RenderCommandList &commandList, u32 frameIndex, u32 chunk,
+               u32 numChunks);
+
   /**
    * @brief Set output texture
    *
@@ -197,6 +210,74 @@ public:
    */
   void setExecutor(const ExecutorFn &executor);
 
+  /**
+   * @brief Set parallel executor function
+   *
+   * Render graph splits the pass into chunks
+   * and records every chunk into its own secondary
+   * command list in a separate thread. Executor
+   * receives chunk index and number of chunks in
+   * addition to command list and frame index.
+   *
+   * Executor must only record commands that
+   * belong to its chunk and must not modify
+   * shared state.
+   *
+   * Only graphics passes can be executed in parallel
+   *
+   * @param executor Parallel executor function
+   */
+  void setParallelExecutor(const ParallelExecutorFn &executor);
+
+  /**
+   * @brief Check if pass is executed in parallel
+   *
+   * @retval true Pass has parallel executor
+   * @retval false Pass does not have parallel executor
+   */
+  inline bool isParallel() const { return mParallelExecutor != nullptr; }
+
+  /**
+   * @brief Run pass on async compute queue
+   *
+   * Render graph synchronizes the pass with
+   * graphics queue passes using semaphores. Pass
+   * runs on graphics queue if device does not
+   * have async compute queue.
+   *
+   * Only compute passes can run on async compute queue
+   */
+  void setAsyncCompute();
+
+  /**
+   * @brief Check if pass runs on async compute queue
+   *
+   * @retval true Pass runs on async compute queue
+   * @retval false Pass runs on graphics queue
+   */
+  inline bool isAsyncCompute() const { return mAsyncCompute; }
+
+  /**
+   * @brief Scale viewport with resolution scale
+   *
+   * Viewport and scissor of the pass are
+   * scaled with resolution scale of the graph.
+   * Attachments keep their size; so, passes
+   * that read them need to scale texture
+   * coordinates with the same scale.
+   *
+   * Only graphics passes can be scaled
+   */
+  void setDynamicResolution();
+
+  /**
+   * @brief Check if pass viewport is scaled
+   *
+   * @retval true Viewport is scaled with resolution scale
+   * @retval false Viewport covers attachments
+   */
+  inline bool hasDynamicResolution() const { return mDynamicResolution; }
+
   /**
    * @brief Add pipeline to pass
    *
@@ -314,6 +395,7 @@ private:
   RenderGraphPassBarrier mDependencies;
 
   ExecutorFn mExecutor;
+  ParallelExecutorFn mParallelExecutor;
 
   std::vector<rhi::PipelineHandle> mPipelines;
 
@@ -321,6 +403,8 @@ private:
   RenderGraphPassType mType;
 
   bool mCreated = false;
+  bool mAsyncCompute = false;
+  bool mDynamicResolution = false;
 
   // Graphics specific resources
   rhi::RenderPassHandle mRenderPass = rhi::RenderPassHandle::Null;
@@ -185,7 +185,8 @@ public:
    * @param index Index
    * @return Resource handle
    */
-  template <class THandle> inline auto getDescription(usize index) {
+  template <class THandle>
+  inline const auto &getDescription(usize index) const {
     return getCache<THandle>().getDescription(index);
   }
 
@@ -0,0 +1,54 @@
+#include "quoll/core/Base.h"
+#include "RenderInstanceSlots.h"
+
+namespace quoll {
+
+void RenderInstanceSlots::beginFrame() { mFrame++; }
+
+u32 RenderInstanceSlots::acquire(Entity entity) {
+  auto it = mSlots.find(entity);
+  if (it != mSlots.end()) {
+    mLastAcquiredFrames.at(it->second) = mFrame;
+    return it->second;
+  }
+
+  u32 slot = 0;
+  if (!mFreeSlots.empty()) {
+    slot = mFreeSlots.back();
+    mFreeSlots.pop_back();
+    mEntities.at(slot) = entity;
+    mLastAcquiredFrames.at(slot) = mFrame;
+  } else {
+    slot = static_cast<u32>(mEntities.size());
+    mEntities.push_back(entity);
+    mLastAcquiredFrames.push_back(mFrame);
+  }
+
+  mSlots.insert({entity, slot});
+  return slot;
+}
+
+bool RenderInstanceSlots::canAcquire(Entity entity, usize capacity) const {
+  return mSlots.contains(entity) || !mFreeSlots.empty() ||
+         mEntities.size() < capacity;
+}
+
+const std::vector<u32> &RenderInstanceSlots::releaseUnused() {
+  mReleasedSlots.clear();
+
+  for (u32 slot = 0; slot < static_cast<u32>(mEntities.size()); ++slot) {
+    auto entity = mEntities.at(slot);
+    if (entity == Entity::Null || mLastAcquiredFrames.at(slot) == mFrame) {
+      continue;
+    }
+
+    mSlots.erase(entity);
+    mEntities.at(slot) = Entity::Null;
+    mFreeSlots.push_back(slot);
+    mReleasedSlots.push_back(slot);
+  }
+
+  return mReleasedSlots;
+}
+
+} // namespace quoll
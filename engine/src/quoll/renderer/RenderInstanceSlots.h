@@ -0,0 +1,87 @@
+#pragma once
+
+#include "quoll/entity/Entity.h"
+
+namespace quoll {
+
+/**
+ * @brief Persistent render instance slots
+ *
+ * Assigns stable slots to entities that are
+ * rendered. Slot stays the same as long as
+ * the entity is acquired every frame, which
+ * allows storing per instance data in GPU
+ * buffers and only updating changed slots.
+ */
+class RenderInstanceSlots {
+public:
+  /**
+   * @brief Begin new frame
+   *
+   * Entities that are not acquired until
+   * the next release are released
+   */
+  void beginFrame();
+
+  /**
+   * @brief Acquire slot for entity
+   *
+   * Returns existing slot if entity already
+   * has one, otherwise allocates new slot
+   *
+   * @param entity Entity
+   * @return Slot index
+   */
+  u32 acquire(Entity entity);
+
+  /**
+   * @brief Check if entity can acquire slot
+   *
+   * @param entity Entity
+   * @param capacity Maximum number of slots
+   * @retval true Entity has slot or a slot is available
+   * @retval false All slots are used
+   */
+  bool canAcquire(Entity entity, usize capacity) const;
+
+  /**
+   * @brief Release slots that are not acquired in current frame
+   *
+   * @return Released slots
+   */
+  const std::vector<u32> &releaseUnused();
+
+  /**
+   * @brief Get entity in slot
+   *
+   * @param slot Slot index
+   * @return Entity or null if slot is free
+   */
+  inline Entity getEntity(u32 slot) const { return mEntities.at(slot); }
+
+  /**
+   * @brief Get number of slots
+   *
+   * Includes free slots
+   *
+   * @return Number of slots
+   */
+  inline usize size() const { return mEntities.size(); }
+
+  /**
+   * @brief Get number of used slots
+   *
+   * @return Number of used slots
+   */
+  inline usize getUsedCount() const { return mSlots.size(); }
+
+private:
+  std::unordered_map<Entity, u32> mSlots;
+  std::vector<Entity> mEntities;
+  std::vector<u64> mLastAcquiredFrames;
+  std::vector<u32> mFreeSlots;
+  std::vector<u32> mReleasedSlots;
+  u64 mFrame = 0;
+};
+
+} // namespace quoll
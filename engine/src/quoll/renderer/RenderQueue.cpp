@@ -0,0 +1,140 @@
+#include "quoll/core/Base.h"
+#include "RenderQueue.h"
+
+namespace quoll {
+
+static constexpr u64 PipelineShift = 57;
+static constexpr u64 DynamicShift = 56;
+static constexpr u64 MeshShift = 32;
+static constexpr u64 DepthShift = 16;
+static constexpr u64 MeshMask = (1ull << 24) - 1;
+static constexpr u64 BatchShift = MeshShift;
+
+u64 RenderQueue::createKey(Pipeline pipeline, MeshAssetHandle mesh,
+                           u16 material, f32 depth, bool dynamic) {
+  QuollAssert(static_cast<u64>(mesh) <= MeshMask,
+              "Mesh handle does not fit into sort key");
+
+  static constexpr f32 MaxDepth = static_cast<f32>(0xFFFF);
+  u64 quantizedDepth =
+      static_cast<u64>(std::clamp(depth, 0.0f, 1.0f) * MaxDepth);
+
+  return (static_cast<u64>(pipeline) << PipelineShift) |
+         (static_cast<u64>(dynamic) << DynamicShift) |
+         ((static_cast<u64>(mesh) & MeshMask) << MeshShift) |
+         (quantizedDepth << DepthShift) | static_cast<u64>(material);
+}
+
+u16 RenderQueue::createMaterialKey(
+    std::span<const rhi::DeviceAddress> materials) {
+  if (materials.empty()) {
+    return 0;
+  }
+
+  u64 address = static_cast<u64>(materials.front());
+  return static_cast<u16>(address ^ (address >> 16) ^ (address >> 32) ^
+                          (address >> 48));
+}
+
+void RenderQueue::reserve(usize size) {
+  mKeys.reserve(size);
+  mItemInstances.reserve(size);
+  mItemEntities.reserve(size);
+  mOrder.reserve(size);
+  mOrderScratch.reserve(size);
+}
+
+void RenderQueue::add(u64 key, u32 instance, Entity entity) {
+  mKeys.push_back(key);
+  mItemInstances.push_back(instance);
+  mItemEntities.push_back(entity);
+}
+
+void RenderQueue::sort() {
+  QUOLL_PROFILE_EVENT("RenderQueue::sort");
+
+  usize numItems = mKeys.size();
+  mOrder.resize(numItems);
+  mOrderScratch.resize(numItems);
+  for (usize i = 0; i < numItems; ++i) {
+    mOrder.at(i) = static_cast<u32>(i);
+  }
+
+  // LSD radix sort with 8-bit digits. Digits that
+  // are the same for all keys are skipped, which
+  // removes most passes because pipeline and mesh
+  // bits have few distinct values
+  u64 differentBits = 0;
+  for (auto key : mKeys) {
+    differentBits |= key ^ mKeys.at(0);
+  }
+
+  static constexpr usize NumBuckets = 256;
+  for (u64 shift = 0; shift < 64; shift += 8) {
+    if (((differentBits >> shift) & 0xFF) == 0) {
+      continue;
+    }
+
+    std::array<u32, NumBuckets> offsets{};
+    for (auto index : mOrder) {
+      offsets.at((mKeys.at(index) >> shift) & 0xFF)++;
+    }
+
+    u32 sum = 0;
+    for (auto &offset : offsets) {
+      u32 count = offset;
+      offset = sum;
+      sum += count;
+    }
+
+    for (auto index : mOrder) {
+      auto &offset = offsets.at((mKeys.at(index) >> shift) & 0xFF);
+      mOrderScratch.at(offset++) = index;
+    }
+
+    std::swap(mOrder, mOrderScratch);
+  }
+
+  for (usize p = 0; p < NumPipelines; ++p) {
+    mBatches.at(p).clear();
+    mInstances.at(p).clear();
+    mEntities.at(p).clear();
+  }
+
+  for (usize i = 0; i < numItems; ++i) {
+    auto index = mOrder.at(i);
+    u64 key = mKeys.at(index);
+    usize pipeline = static_cast<usize>(key >> PipelineShift);
+    QuollAssert(pipeline < NumPipelines, "Invalid pipeline in sort key");
+
+    auto &batches = mBatches.at(pipeline);
+    auto &instances = mInstances.at(pipeline);
+
+    bool newBatch = i == 0 || (mKeys.at(mOrder.at(i - 1)) >> BatchShift) !=
+                                  (key >> BatchShift);
+    if (newBatch) {
+      batches.push_back(
+          {static_cast<MeshAssetHandle>((key >> MeshShift) & MeshMask),
+           static_cast<u32>(instances.size()), 0,
+           ((key >> DynamicShift) & 1) != 0});
+    }
+
+    batches.back().numInstances++;
+    instances.push_back(mItemInstances.at(index));
+    mEntities.at(pipeline).push_back(mItemEntities.at(index));
+  }
+}
+
+void RenderQueue::clear() {
+  mKeys.clear();
+  mItemInstances.clear();
+  mItemEntities.clear();
+
+  for (usize p = 0; p < NumPipelines; ++p) {
+    mBatches.at(p).clear();
+    mInstances.at(p).clear();
+    mEntities.at(p).clear();
+  }
+}
+
+} // namespace quoll
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "quoll/asset/Asset.h"
+#include "quoll/entity/Entity.h"
+#include "quoll/rhi/DeviceAddress.h"
+
+namespace quoll {
+
+/**
+ * @brief Render queue
+ *
+ * Stores render items with 64-bit sort keys.
+ * Items are sorted with radix sort and
+ * consecutive items with the same pipeline
+ * and mesh are collapsed into instanced
+ * draw batches. Static items are sorted before
+ * dynamic items of the same pipeline; so,
+ * batches never mix them. Instances of a
+ * batch are sorted front to back and items
+ * at the same depth are grouped by material.
+ *
+ * Sort key layout from most significant bits:
+ *
+ * - Pipeline (7 bits)
+ * - Dynamic (1 bit)
+ * - Mesh (24 bits)
+ * - Quantized depth (16 bits)
+ * - Material (16 bits)
+ */
+class RenderQueue {
+public:
+  /**
+   * @brief Render queue pipeline
+   */
+  enum class Pipeline : u8 { Mesh = 0, SkinnedMesh = 1 };
+
+  /**
+   * Number of pipelines
+   */
+  static constexpr usize NumPipelines = 2;
+
+  /**
+   * @brief Draw batch
+   */
+  struct Batch {
+    /**
+     * Mesh handle
+     */
+    MeshAssetHandle mesh = MeshAssetHandle::Null;
+
+    /**
+     * First instance in pipeline instances
+     */
+    u32 instanceStart = 0;
+
+    /**
+     * Number of instances
+     */
+    u32 numInstances = 0;
+
+    /**
+     * Instances are dynamic shadow casters
+     */
+    bool dynamic = false;
+  };
+
+public:
+  /**
+   * @brief Create sort key
+   *
+   * @param pipeline Pipeline
+   * @param mesh Mesh handle
+   * @param material Material key
+   * @param depth Normalized depth
+   * @param dynamic Item is a dynamic shadow caster
+   * @return Sort key
+   */
+  static u64 createKey(Pipeline pipeline, MeshAssetHandle mesh, u16 material,
+                       f32 depth, bool dynamic = false);
+
+  /**
+   * @brief Create material key
+   *
+   * Folds material address into 16 bits
+   *
+   * @param materials Materials
+   * @return Material key
+   */
+  static u16 createMaterialKey(std::span<const rhi::DeviceAddress> materials);
+
+  /**
+   * @brief Reserve space for items
+   *
+   * @param size Number of items
+   */
+  void reserve(usize size);
+
+  /**
+   * @brief Add item
+   *
+   * @param key Sort key
+   * @param instance Instance slot
+   * @param entity Entity
+   */
+  void add(u64 key, u32 instance, Entity entity);
+
+  /**
+   * @brief Sort items and build batches
+   */
+  void sort();
+
+  /**
+   * @brief Clear items and batches
+   */
+  void clear();
+
+  /**
+   * @brief Get number of items
+   *
+   * @return Number of items
+   */
+  inline usize size() const { return mKeys.size(); }
+
+  /**
+   * @brief Get draw batches of pipeline
+   *
+   * @param pipeline Pipeline
+   * @return Draw batches
+   */
+  inline const std::vector<Batch> &getBatches(Pipeline pipeline) const {
+    return mBatches.at(static_cast<usize>(pipeline));
+  }
+
+  /**
+   * @brief Get sorted instance slots of pipeline
+   *
+   * @param pipeline Pipeline
+   * @return Instance slots
+   */
+  inline const std::vector<u32> &getInstances(Pipeline pipeline) const {
+    return mInstances.at(static_cast<usize>(pipeline));
+  }
+
+  /**
+   * @brief Get sorted entities of pipeline
+   *
+   * @param pipeline Pipeline
+   * @return Entities
+   */
+  inline const std::vector<Entity> &getEntities(Pipeline pipeline) const {
+    return mEntities.at(static_cast<usize>(pipeline));
+  }
+
+private:
+  std::vector<u64> mKeys;
+  std::vector<u32> mItemInstances;
+  std::vector<Entity> mItemEntities;
+
+  std::vector<u32> mOrder;
+  std::vector<u32> mOrderScratch;
+
+  std::array<std::vector<Batch>, NumPipelines> mBatches;
+  std::array<std::vector<u32>, NumPipelines> mInstances;
+  std::array<std::vector<Entity>, NumPipelines> mEntities;
+};
+
+} // namespace quoll
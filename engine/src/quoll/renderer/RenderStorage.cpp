@@ -144,13 +144,67 @@ rhi::FramebufferHandle RenderStorage::getNewFramebufferHandle() {
   return mFramebufferCounter.create();
 }
 
+ThreadPool &RenderStorage::getRecordingThreadPool() {
+  if (!mRecordingThreadPool) {
+    // Leave one hardware thread for the thread
+    // that submits recorded command lists
+    u32 numThreads = std::thread::hardware_concurrency();
+    numThreads = std::clamp(numThreads > 1 ? numThreads - 1 : 1, 1u,
+                            rhi::RenderDevice::MaxRecordingThreads);
+
+    mRecordingThreadPool = std::make_unique<ThreadPool>(numThreads);
+  }
+
+  return *mRecordingThreadPool;
+}
+
 rhi::Buffer
 RenderStorage::createBuffer(const rhi::BufferDescription &description) {
   return mDevice->createBuffer(description);
 }
 
+/**
+ * @brief Find retained pipeline with equal description
+ *
+ * @tparam TDescription Pipeline description type
+ * @param retainedPipelines Retained pipelines
+ * @param descriptions Pipeline descriptions
+ * @param description Pipeline description
+ * @return Retained pipeline handle or null handle
+ */
+template <class TDescription>
+static rhi::PipelineHandle findRetainedPipeline(
+    std::vector<rhi::PipelineHandle> &retainedPipelines,
+    const std::vector<std::variant<rhi::GraphicsPipelineDescription,
+                                   rhi::ComputePipelineDescription>>
+        &descriptions,
+    const TDescription &description) {
+  auto it = std::find_if(
+      retainedPipelines.begin(), retainedPipelines.end(),
+      [&](rhi::PipelineHandle handle) {
+        const auto *retained = std::get_if<TDescription>(
+            &descriptions.at(static_cast<usize>(handle) - 1));
+        return retained && *retained == description;
+      });
+
+  if (it == retainedPipelines.end()) {
+    return rhi::PipelineHandle::Null;
+  }
+
+  auto handle = *it;
+  retainedPipelines.erase(it);
+  return handle;
+}
+
 rhi::PipelineHandle RenderStorage::addPipeline(
     const rhi::GraphicsPipelineDescription &description) {
+  auto retained =
+      findRetainedPipeline(mRetainedPipelines, mPipelineDescriptions,
+                           description);
+  if (rhi::isHandleValid(retained)) {
+    return retained;
+  }
+
   mPipelineDescriptions.push_back(description);
   mGraphicsPipelineIndices.push_back(mPipelineDescriptions.size() - 1);
 
@@ -159,10 +213,42 @@ rhi::PipelineHandle RenderStorage::addPipeline(
 
 rhi::PipelineHandle
 RenderStorage::addPipeline(const rhi::ComputePipelineDescription &description) {
+  auto retained =
+      findRetainedPipeline(mRetainedPipelines, mPipelineDescriptions,
+                           description);
+  if (rhi::isHandleValid(retained)) {
+    return retained;
+  }
+
   mPipelineDescriptions.push_back(description);
   mComputePipelineIndices.push_back(mPipelineDescriptions.size() - 1);
 
   return static_cast<rhi::PipelineHandle>(mPipelineDescriptions.size());
 }
 
+void RenderStorage::retainPipeline(rhi::PipelineHandle handle) {
+  mRetainedPipelines.push_back(handle);
+}
+
+void RenderStorage::destroyRetainedPipelines() {
+  for (auto handle : mRetainedPipelines) {
+    mDevice->destroyPipeline(handle);
+    mPipelineRenderTargets.erase(handle);
+  }
+
+  mRetainedPipelines.clear();
+}
+
+bool RenderStorage::isPipelineBuilt(
+    rhi::PipelineHandle handle, const PipelineRenderTargets &renderTargets) {
+  auto it = mPipelineRenderTargets.find(handle);
+  return it != mPipelineRenderTargets.end() && it->second == renderTargets &&
+         mDevice->hasPipeline(handle);
+}
+
+void RenderStorage::setPipelineBuilt(
+    rhi::PipelineHandle handle, const PipelineRenderTargets &renderTargets) {
+  mPipelineRenderTargets.insert_or_assign(handle, renderTargets);
+}
+
 } // namespace quoll
@@ -2,10 +2,50 @@
 
 #include "quoll/rhi/TextureDescription.h"
 #include "quoll/rhi/RenderDevice.h"
+#include "quoll/core/ThreadPool.h"
 #include "HandleCounter.h"
 
 namespace quoll {
 
+/**
+ * @brief Render targets of pipeline
+ *
+ * Graphics pipeline can be used with every render
+ * pass that has the same attachment formats and
+ * sample count, regardless of attachment sizes.
+ * Compute pipelines do not have render targets.
+ */
+struct PipelineRenderTargets {
+  /**
+   * Color attachment formats
+   */
+  std::vector<rhi::Format> colorFormats;
+
+  /**
+   * Depth attachment format
+   */
+  rhi::Format depthFormat = rhi::Format::Undefined;
+
+  /**
+   * Resolve attachment format
+   */
+  rhi::Format resolveFormat = rhi::Format::Undefined;
+
+  /**
+   * Sample count
+   */
+  u32 sampleCount = 0;
+
+  /**
+   * @brief Check if render targets are equal to other ones
+   *
+   * @param rhs Other render targets
+   * @retval true Render targets are equal
+   * @retval false Render targets are not equal
+   */
+  bool operator==(const PipelineRenderTargets &rhs) const = default;
+};
+
 /**
  * @brief Render storage
  *
@@ -155,10 +195,24 @@ public:
    */
   inline rhi::RenderDevice *getDevice() { return mDevice; }
 
+  /**
+   * @brief Get command recording thread pool
+   *
+   * Thread pool is created on first use and
+   * never has more threads than the device
+   * can record secondary command lists with
+   *
+   * @return Command recording thread pool
+   */
+  ThreadPool &getRecordingThreadPool();
+
 public:
   /**
    * @brief Add graphics pipeline
    *
+   * Returns handle of a retained pipeline
+   * if its description is equal
+   *
    * @param description Graphics pipeline description
    * @return Virtual pipeline handle
    */
@@ -168,12 +222,55 @@ public:
   /**
    * @brief Add compute pipeline
    *
+   * Returns handle of a retained pipeline
+   * if its description is equal
+   *
    * @param description Compute pipeline description
    * @return Virtual pipeline handle
    */
   rhi::PipelineHandle
   addPipeline(const rhi::ComputePipelineDescription &description);
 
+  /**
+   * @brief Retain pipeline for reuse
+   *
+   * Retained pipeline is kept in the device
+   * and is handed out by the next pipeline
+   * add with an equal description
+   *
+   * @param handle Pipeline handle
+   */
+  void retainPipeline(rhi::PipelineHandle handle);
+
+  /**
+   * @brief Destroy retained pipelines
+   *
+   * Destroys retained pipelines that are
+   * not added again since they were retained
+   */
+  void destroyRetainedPipelines();
+
+  /**
+   * @brief Check if pipeline is built for render targets
+   *
+   * @param handle Pipeline handle
+   * @param renderTargets Render targets
+   * @retval true Device pipeline is built for render targets
+   * @retval false Device pipeline does not exist or is built
+   * for different render targets
+   */
+  bool isPipelineBuilt(rhi::PipelineHandle handle,
+                       const PipelineRenderTargets &renderTargets);
+
+  /**
+   * @brief Set render targets that pipeline is built for
+   *
+   * @param handle Pipeline handle
+   * @param renderTargets Render targets
+   */
+  void setPipelineBuilt(rhi::PipelineHandle handle,
+                        const PipelineRenderTargets &renderTargets);
+
   /**
    * @brief Get graphics pipeline description
    *
@@ -208,6 +305,9 @@ private:
       mPipelineDescriptions;
   std::vector<usize> mGraphicsPipelineIndices;
   std::vector<usize> mComputePipelineIndices;
+  std::vector<rhi::PipelineHandle> mRetainedPipelines;
+  std::unordered_map<rhi::PipelineHandle, PipelineRenderTargets>
+      mPipelineRenderTargets;
 
   static constexpr u32 TextureStart = 10;
   HandleCounter<rhi::ShaderHandle> mShaderCounter;
@@ -219,6 +319,8 @@ private:
   rhi::SamplerHandle mDefaultSampler = rhi::SamplerHandle::Null;
 
   std::unordered_map<String, rhi::ShaderHandle> mShaderMap;
+
+  std::unique_ptr<ThreadPool> mRecordingThreadPool;
 };
 
 } // namespace quoll
@@ -23,21 +23,51 @@ void Renderer::setFramebufferSize(glm::uvec2 size) {
   mOptionsChanged = true;
 }
 
-void Renderer::rebuildIfSettingsChanged() {
+bool Renderer::rebuildIfSettingsChanged() {
   if (!mOptionsChanged) {
-    return;
+    return false;
   }
 
-  mGraph.destroy(mRenderStorage);
+  // Pipelines do not depend on render target sizes
+  // and are reused by the new graph
+  mGraph.destroy(mRenderStorage, true);
   mGraph = RenderGraph("Main");
   auto res = mBuilderFn(mGraph, mOptions);
+  mGraph.markAsOutput(res.finalTexture);
+  mGraph.markAsOutput(res.sceneTexture);
   mGraph.build(mRenderStorage);
+  mRenderStorage.destroyRetainedPipelines();
   mSceneTexture = res.sceneTexture;
   mFinalTexture = res.finalTexture;
   mOptionsChanged = false;
+  return true;
+}
+
+void Renderer::enableDynamicResolution(
+    const DynamicResolutionSettings &settings) {
+  mDynamicResolution.emplace(settings);
+  mGraph.setResolutionScale(mDynamicResolution->getScale());
+}
+
+void Renderer::disableDynamicResolution() {
+  mDynamicResolution.reset();
+  mGraph.setResolutionScale(1.0f);
 }
 
 void Renderer::execute(rhi::RenderCommandList &commandList, u32 frameIndex) {
+  if (mDynamicResolution) {
+    // Async compute passes overlap with
+    // graphics passes and are not added
+    // to frame time
+    f32 gpuFrameTime = 0.0f;
+    for (const auto &timing : mGraph.getPassTimings()) {
+      if (timing.queue == rhi::QueueType::Graphics) {
+        gpuFrameTime += timing.time;
+      }
+    }
+
+    mGraph.setResolutionScale(mDynamicResolution->update(gpuFrameTime));
+  }
 
   mGraph.execute(commandList, frameIndex);
 }
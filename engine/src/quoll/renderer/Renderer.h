@@ -4,6 +4,7 @@
 #include "quoll/entity/EntityDatabase.h"
 #include "RendererOptions.h"
 #include "RenderGraph.h"
+#include "DynamicResolutionController.h"
 
 namespace quoll {
 
@@ -93,12 +94,48 @@ public:
 
   /**
    * @brief Rebuild render graph if settings have changed
+   *
+   * @retval true Render graph is rebuilt
+   * @retval false Settings have not changed
+   */
+  bool rebuildIfSettingsChanged();
+
+  /**
+   * @brief Enable dynamic resolution
+   *
+   * Render targets keep framebuffer size
+   * and passes with dynamic resolution are
+   * rendered at a scale that is updated
+   * every frame from GPU pass timings.
+   * Graph is not rebuilt when scale changes.
+   *
+   * @param settings Dynamic resolution settings
+   */
+  void enableDynamicResolution(const DynamicResolutionSettings &settings);
+
+  /**
+   * @brief Disable dynamic resolution
+   *
+   * Passes are rendered at framebuffer size
    */
-  void rebuildIfSettingsChanged();
+  void disableDynamicResolution();
+
+  /**
+   * @brief Get resolution scale
+   *
+   * @return Resolution scale of main graph
+   */
+  inline f32 getResolutionScale() const {
+    return mGraph.getResolutionScale();
+  }
 
   /**
    * @brief Execute main graph
    *
+   * Updates resolution scale before
+   * executing the graph if dynamic
+   * resolution is enabled
+   *
    * @param commandList Render command list
    * @param frameIndex Frame index
    */
@@ -118,6 +155,13 @@ public:
    */
   inline rhi::TextureHandle getSceneTexture() const { return mSceneTexture; }
 
+  /**
+   * @brief Get main graph
+   *
+   * @return Main render graph
+   */
+  inline const RenderGraph &getGraph() const { return mGraph; }
+
 private:
   RenderStorage &mRenderStorage;
 
@@ -127,6 +171,8 @@ private:
   RenderGraph mGraph;
   GraphBuilderFn mBuilderFn{};
 
+  std::optional<DynamicResolutionController> mDynamicResolution;
+
   rhi::TextureHandle mFinalTexture{0};
   rhi::TextureHandle mSceneTexture{0};
 };
@@ -1,5 +1,6 @@
 #include "quoll/core/Base.h"
 #include "quoll/core/Engine.h"
+#include "quoll/core/FrameAllocator.h"
 #include "quoll/scene/EnvironmentSkybox.h"
 #include "quoll/scene/Mesh.h"
 #include "quoll/scene/SkinnedMesh.h"
@@ -7,15 +8,35 @@
 #include "quoll/scene/Sprite.h"
 #include "quoll/text/Text.h"
 #include "quoll/scene/Skeleton.h"
+#include "quoll/scene/PreviousWorldTransform.h"
+#include "quoll/physics/RigidBody.h"
+#include "quoll/animation/Animator.h"
 
 #include "SceneRenderer.h"
 #include "StandardPushConstants.h"
 #include "BindlessDrawParameters.h"
 #include "MeshVertexLayout.h"
 #include "MeshRenderUtils.h"
+#include "TransformInterpolation.h"
 
 namespace quoll {
 
+/**
+ * @brief Get range of items that belong to chunk
+ *
+ * @param size Number of items
+ * @param chunk Chunk index
+ * @param numChunks Number of chunks
+ * @return Start and end of the range
+ */
+static std::pair<usize, usize> getChunkRange(usize size, u32 chunk,
+                                             u32 numChunks) {
+  usize chunkSize = (size + numChunks - 1) / numChunks;
+  usize start = std::min(size, chunkSize * chunk);
+
+  return {start, std::min(size, start + chunkSize)};
+}
+
 SceneRenderer::SceneRenderer(AssetRegistry &assetRegistry,
                              RenderStorage &renderStorage)
     : mAssetRegistry(assetRegistry), mRenderStorage(renderStorage),
@@ -61,6 +82,10 @@ SceneRenderer::SceneRenderer(AssetRegistry &assetRegistry,
 
   mRenderStorage.createShader("__engine.shadowmap.default.fragment",
                               {shadersPath / "shadowmap.frag.spv"});
+  mRenderStorage.createShader("__engine.shadowmap.layer.vertex",
+                              {shadersPath / "shadowmap-layer.vert.spv"});
+  mRenderStorage.createShader("__engine.shadowmap.copy.fragment",
+                              {shadersPath / "shadowmap-copy.frag.spv"});
 
   mRenderStorage.createShader("__engine.text.default.vertex",
                               {shadersPath / "text.vert.spv"});
@@ -68,6 +93,18 @@ SceneRenderer::SceneRenderer(AssetRegistry &assetRegistry,
   mRenderStorage.createShader("__engine.text.default.fragment",
                               {shadersPath / "text.frag.spv"});
 
+  mRenderStorage.createShader("__engine.lights.cluster.compute",
+                              {shadersPath / "cluster-lights.comp.spv"});
+
+  mRenderStorage.createShader("__engine.skinning.default.compute",
+                              {shadersPath / "skin-meshes.comp.spv"});
+
+  mRenderStorage.createShader("__engine.culling.meshes.compute",
+                              {shadersPath / "cull-meshes.comp.spv"});
+
+  mRenderStorage.createShader("__engine.depth-pyramid.compute",
+                              {shadersPath / "build-depth-pyramid.comp.spv"});
+
   mRenderStorage.createShader("__engine.pbr.brdfLut.compute",
                               {shadersPath / "generate-brdf-lut.comp.spv"});
 
@@ -105,12 +142,10 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
     frameData.getBindlessParams().destroy(mRenderStorage.getDevice());
   }
 
-  static constexpr u32 ShadowMapDimensions = 4096;
-
   rhi::TextureDescription shadowMapDesc{};
   shadowMapDesc.usage = rhi::TextureUsage::Depth | rhi::TextureUsage::Sampled;
-  shadowMapDesc.width = ShadowMapDimensions;
-  shadowMapDesc.height = ShadowMapDimensions;
+  shadowMapDesc.width = SceneRendererFrameData::ShadowMapDimensions;
+  shadowMapDesc.height = SceneRendererFrameData::ShadowMapDimensions;
   shadowMapDesc.layerCount = SceneRendererFrameData::MaxShadowMaps;
   shadowMapDesc.format = rhi::Format::Depth16Unorm;
   shadowMapDesc.debugName = "Shadow maps";
@@ -122,6 +157,18 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
                          storage.addToDescriptor(handle);
                        });
 
+  // Static shadow casters are cached between frames
+  // and are only rendered again when they change
+  auto staticShadowMapDesc = shadowMapDesc;
+  staticShadowMapDesc.debugName = "Static shadow maps";
+  auto staticShadowmap =
+      graph.create(staticShadowMapDesc)
+          .onReady([](auto handle, RenderStorage &storage) {
+            storage.addToDescriptor(handle);
+          });
+  graph.markAsPersistent(staticShadowmap);
+  mStaticShadowCastersHash.reset();
+
   rhi::TextureDescription sceneColorDesc{};
   sceneColorDesc.usage = rhi::TextureUsage::Color | rhi::TextureUsage::Sampled;
   sceneColorDesc.width = options.size.x;
@@ -165,13 +212,120 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
   depthBufferDesc.format = rhi::Format::Depth32Float;
   depthBufferDesc.debugName = "Depth buffer";
 
-  auto depthBuffer = graph.create(depthBufferDesc);
+  auto depthBuffer =
+      graph.create(depthBufferDesc)
+          .onReady([](rhi::TextureHandle handle, RenderStorage &storage) {
+            storage.addToDescriptor(handle);
+          });
+
+  // Depth pyramid stores farthest depth of
+  // every texel and is used by occlusion
+  // culling of the next frame. Its size is
+  // the largest power of two that fits in
+  // the framebuffer
+  rhi::TextureDescription depthPyramidDesc{};
+  depthPyramidDesc.usage =
+      rhi::TextureUsage::Storage | rhi::TextureUsage::Sampled;
+  depthPyramidDesc.width = 1;
+  depthPyramidDesc.height = 1;
+  while (depthPyramidDesc.width * 2 <= options.size.x) {
+    depthPyramidDesc.width *= 2;
+  }
+  while (depthPyramidDesc.height * 2 <= options.size.y) {
+    depthPyramidDesc.height *= 2;
+  }
+  depthPyramidDesc.mipLevelCount = 1;
+  while ((std::max(depthPyramidDesc.width, depthPyramidDesc.height) >>
+          depthPyramidDesc.mipLevelCount) > 0) {
+    depthPyramidDesc.mipLevelCount++;
+  }
+  depthPyramidDesc.layerCount = 1;
+  depthPyramidDesc.format = rhi::Format::R32Float;
+  depthPyramidDesc.debugName = "Depth pyramid";
+
+  auto depthPyramid =
+      graph.create(depthPyramidDesc)
+          .onReady([](rhi::TextureHandle handle, RenderStorage &storage) {
+            storage.addToDescriptor(handle);
+          });
+  graph.markAsPersistent(depthPyramid);
+  mDepthPyramidReady = false;
+
+  std::vector<RenderGraphResource<rhi::TextureHandle>> depthPyramidLevels;
+  depthPyramidLevels.reserve(depthPyramidDesc.mipLevelCount);
+  for (u32 i = 0; i < depthPyramidDesc.mipLevelCount; ++i) {
+    depthPyramidLevels.push_back(
+        graph.createView(depthPyramid, i)
+            .onReady([](rhi::TextureHandle handle, RenderStorage &storage) {
+              storage.addToDescriptor(handle);
+            }));
+  }
+
+  {
+    static constexpr u32 SkinningGroupSize = 64;
+
+    struct SkinningDrawParams {
+      rhi::DeviceAddress skinningJobs;
+      rhi::DeviceAddress joints;
+      rhi::DeviceAddress positions;
+      rhi::DeviceAddress normals;
+      rhi::DeviceAddress tangents;
+    };
+
+    usize skinningOffset = 0;
+    for (auto &frameData : mFrameData) {
+      auto vertices = static_cast<u64>(frameData.getSkinnedVerticesBuffer());
+
+      skinningOffset =
+          frameData.getBindlessParams().addRange(SkinningDrawParams{
+              frameData.getSkinningJobsBuffer(), frameData.getJointsBuffer(),
+              rhi::DeviceAddress{vertices},
+              rhi::DeviceAddress{
+                  vertices + SceneRendererFrameData::SkinnedNormalsOffset},
+              rhi::DeviceAddress{
+                  vertices + SceneRendererFrameData::SkinnedTangentsOffset}});
+    }
+
+    auto &pass = graph.addComputePass("skinningPass");
+    for (auto &frameData : mFrameData) {
+      pass.write(frameData.getSkinnedVerticesBufferHandle(),
+                 rhi::BufferUsage::Storage);
+    }
+
+    auto pipeline = mRenderStorage.addPipeline(rhi::ComputePipelineDescription{
+        mRenderStorage.getShader("__engine.skinning.default.compute"),
+        "skinning"});
+    pass.addPipeline(pipeline);
+
+    pass.setExecutor([pipeline, skinningOffset, this](
+                         rhi::RenderCommandList &commandList, u32 frameIndex) {
+      auto &frameData = mFrameData.at(frameIndex);
+      const auto &jobs = frameData.getSkinningJobs();
+      if (jobs.empty()) {
+        return;
+      }
+
+      std::array<u32, 1> offsets{static_cast<u32>(skinningOffset)};
+      commandList.bindPipeline(pipeline);
+      commandList.bindDescriptor(
+          pipeline, 0, frameData.getBindlessParams().getDescriptor(), offsets);
+
+      // Every row of workgroups skins one instance
+      u32 groupCountX =
+          (frameData.getMaxSkinningJobVertices() + SkinningGroupSize - 1) /
+          SkinningGroupSize;
+      commandList.dispatch(groupCountX, static_cast<u32>(jobs.size()), 1);
+    });
+  } // skinning pass
 
   {
     struct ShadowDrawParams {
       rhi::DeviceAddress meshTransforms;
       rhi::DeviceAddress skinnedMeshTransforms;
-      rhi::DeviceAddress skeletonTransforms;
+      rhi::DeviceAddress meshInstances;
+      rhi::DeviceAddress skinnedMeshInstances;
+      rhi::DeviceAddress meshShadowCasterMasks;
+      rhi::DeviceAddress skinnedMeshShadowCasterMasks;
       rhi::DeviceAddress shadows;
     };
 
@@ -181,30 +335,109 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
           frameData.getBindlessParams().addRange(ShadowDrawParams{
               frameData.getMeshTransformsBuffer(),
               frameData.getSkinnedMeshTransformsBuffer(),
-              frameData.getSkeletonsBuffer(), frameData.getShadowMapsBuffer()});
+              frameData.getMeshInstancesBuffer(),
+              frameData.getSkinnedMeshInstancesBuffer(),
+              frameData.getMeshShadowCasterMasksBuffer(),
+              frameData.getSkinnedMeshShadowCasterMasksBuffer(),
+              frameData.getShadowMapsBuffer()});
+    }
+
+    auto createCopyPipeline = [this](StringView debugName) {
+      return mRenderStorage.addPipeline(rhi::GraphicsPipelineDescription{
+          mRenderStorage.getShader("__engine.shadowmap.layer.vertex"),
+          mRenderStorage.getShader("__engine.shadowmap.copy.fragment"),
+          {},
+          rhi::PipelineInputAssembly{rhi::PrimitiveTopology::TriangleList},
+          rhi::PipelineRasterizer{rhi::PolygonMode::Fill, rhi::CullMode::None,
+                                  rhi::FrontFace::Clockwise},
+          {},
+          {},
+          {},
+          String(debugName)});
+    };
+
+    auto createMeshPipeline = [this](StringView debugName) {
+      return mRenderStorage.addPipeline(rhi::GraphicsPipelineDescription{
+          mRenderStorage.getShader("__engine.shadowmap.default.vertex"),
+          mRenderStorage.getShader("__engine.shadowmap.default.fragment"),
+          createMeshPositionLayout(),
+          rhi::PipelineInputAssembly{rhi::PrimitiveTopology::TriangleList},
+          rhi::PipelineRasterizer{rhi::PolygonMode::Fill, rhi::CullMode::Front,
+                                  rhi::FrontFace::Clockwise},
+          {},
+          {},
+          {},
+          String(debugName)});
+    };
+
+    {
+      auto &pass = graph.addGraphicsPass("staticShadowPass");
+      pass.write(staticShadowmap, AttachmentType::Depth,
+                 rhi::DepthStencilClear{1.0f, 0});
+
+      auto clearPipeline = createCopyPipeline("shadowmap static clear");
+      auto pipeline = createMeshPipeline("shadowmap static mesh");
+      pass.addPipeline(clearPipeline);
+      pass.addPipeline(pipeline);
+
+      pass.setExecutor([clearPipeline, pipeline, shadowDrawOffset,
+                        this](rhi::RenderCommandList &commandList,
+                              u32 frameIndex) {
+        auto &frameData = mFrameData.at(frameIndex);
+
+        // Cache keeps its contents until shadow maps
+        // or static shadow casters change
+        auto hash = frameData.getStaticShadowCastersHash();
+        if (mStaticShadowCastersHash == hash) {
+          return;
+        }
+        mStaticShadowCastersHash = hash;
+
+        auto numShadowMaps = static_cast<u32>(frameData.getNumShadowMaps());
+        if (numShadowMaps == 0) {
+          return;
+        }
+
+        QUOLL_PROFILE_EVENT("staticShadowPass::meshes");
+
+        // Null source clears cached shadow maps
+        std::array<u32, 2> clearData{0, 0};
+        commandList.bindPipeline(clearPipeline);
+        commandList.bindDescriptor(
+            clearPipeline, 0, mRenderStorage.getGlobalTexturesDescriptor());
+        commandList.pushConstants(clearPipeline, rhi::ShaderStage::Fragment, 0,
+                                  sizeof(clearData), clearData.data());
+        commandList.draw(3, 0, numShadowMaps);
+
+        std::array<u32, 1> offsets{static_cast<u32>(shadowDrawOffset)};
+        commandList.bindPipeline(pipeline);
+        commandList.bindDescriptor(
+            pipeline, 0, frameData.getBindlessParams().getDescriptor(),
+            offsets);
+        commandList.pushConstants(pipeline, rhi::ShaderStage::Vertex, 0,
+                                  sizeof(u32), &numShadowMaps);
+
+        renderShadowsMesh(commandList, pipeline, frameIndex, false, 0, 1);
+      });
     }
 
     auto &pass = graph.addGraphicsPass("shadowPass");
+    pass.read(staticShadowmap);
     pass.write(shadowmap, AttachmentType::Depth,
                rhi::DepthStencilClear{1.0f, 0});
+    for (auto &frameData : mFrameData) {
+      pass.read(frameData.getSkinnedVerticesBufferHandle(),
+                rhi::BufferUsage::Vertex);
+    }
 
-    auto pipeline = mRenderStorage.addPipeline(rhi::GraphicsPipelineDescription{
-        mRenderStorage.getShader("__engine.shadowmap.default.vertex"),
-        mRenderStorage.getShader("__engine.shadowmap.default.fragment"),
-        createMeshPositionLayout(),
-        rhi::PipelineInputAssembly{rhi::PrimitiveTopology::TriangleList},
-        rhi::PipelineRasterizer{rhi::PolygonMode::Fill, rhi::CullMode::Front,
-                                rhi::FrontFace::Clockwise},
-        {},
-        {},
-        {},
-        "shadowmap mesh"});
+    auto copyPipeline = createCopyPipeline("shadowmap copy");
+    auto pipeline = createMeshPipeline("shadowmap mesh");
 
     auto skinnedPipeline =
         mRenderStorage.addPipeline(rhi::GraphicsPipelineDescription{
             mRenderStorage.getShader("__engine.shadowmap.skinned.vertex"),
             mRenderStorage.getShader("__engine.shadowmap.default.fragment"),
-            createSkinnedMeshPositionLayout(),
+            createMeshPositionLayout(),
             rhi::PipelineInputAssembly{rhi::PrimitiveTopology::TriangleList},
             rhi::PipelineRasterizer{rhi::PolygonMode::Fill,
                                     rhi::CullMode::Front,
@@ -214,14 +447,42 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
             {},
             "shadowmap skinned mesh"});
 
+    pass.addPipeline(copyPipeline);
     pass.addPipeline(pipeline);
     pass.addPipeline(skinnedPipeline);
 
-    pass.setExecutor([pipeline, skinnedPipeline, shadowmap, shadowDrawOffset,
-                      this](rhi::RenderCommandList &commandList,
-                            u32 frameIndex) {
+    pass.setParallelExecutor([copyPipeline, pipeline, skinnedPipeline,
+                              staticShadowmap, shadowDrawOffset,
+                              this](rhi::RenderCommandList &commandList,
+                                    u32 frameIndex, u32 chunk, u32 numChunks) {
       auto &frameData = mFrameData.at(frameIndex);
 
+      // Every instance is drawn once per shadow map and
+      // vertex shader selects the layer from instance index;
+      // so, all shadow maps are rendered with one set of draws
+      auto numShadowMaps = static_cast<u32>(frameData.getNumShadowMaps());
+      if (numShadowMaps == 0) {
+        return;
+      }
+
+      // Cached static shadow maps are copied before dynamic
+      // shadow casters are drawn. First chunk is recorded
+      // into the first secondary command list; so, the copy
+      // is executed before draws of other chunks
+      if (chunk == 0) {
+        QUOLL_PROFILE_EVENT("shadowPass::copy");
+
+        std::array<u32, 2> copyData{
+            rhi::castHandleToUint(staticShadowmap.getHandle()),
+            rhi::castHandleToUint(mRenderStorage.getDefaultSampler())};
+        commandList.bindPipeline(copyPipeline);
+        commandList.bindDescriptor(
+            copyPipeline, 0, mRenderStorage.getGlobalTexturesDescriptor());
+        commandList.pushConstants(copyPipeline, rhi::ShaderStage::Fragment, 0,
+                                  sizeof(copyData), copyData.data());
+        commandList.draw(3, 0, numShadowMaps);
+      }
+
       std::array<u32, 1> offsets{static_cast<u32>(shadowDrawOffset)};
       {
         QUOLL_PROFILE_EVENT("shadowPass::meshes");
@@ -230,51 +491,182 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
         commandList.bindDescriptor(
             pipeline, 0, frameData.getBindlessParams().getDescriptor(),
             offsets);
+        commandList.pushConstants(pipeline, rhi::ShaderStage::Vertex, 0,
+                                  sizeof(u32), &numShadowMaps);
 
-        for (i32 index = 0;
-             index < static_cast<i32>(frameData.getNumShadowMaps()); ++index) {
-          commandList.pushConstants(pipeline, rhi::ShaderStage::Vertex, 0,
-                                    sizeof(u32), &index);
-
-          renderShadowsMesh(commandList, pipeline, frameIndex);
-        }
+        renderShadowsMesh(commandList, pipeline, frameIndex, true, chunk,
+                          numChunks);
       }
 
       {
         QUOLL_PROFILE_EVENT("shadowPass::skinnedMeshes");
         commandList.bindPipeline(skinnedPipeline);
         commandList.bindDescriptor(
-            pipeline, 0, frameData.getBindlessParams().getDescriptor(),
+            skinnedPipeline, 0, frameData.getBindlessParams().getDescriptor(),
             offsets);
+        commandList.pushConstants(skinnedPipeline, rhi::ShaderStage::Vertex, 0,
+                                  sizeof(u32), &numShadowMaps);
 
-        for (i32 index = 0;
-             index < static_cast<i32>(frameData.getNumShadowMaps()); ++index) {
-
-          commandList.pushConstants(pipeline, rhi::ShaderStage::Vertex, 0,
-                                    sizeof(u32), &index);
-
-          renderShadowsSkinnedMesh(commandList, skinnedPipeline, frameIndex);
-        }
+        renderShadowsSkinnedMesh(commandList, skinnedPipeline, frameIndex,
+                                 chunk, numChunks);
       }
     });
   } // shadow pass
 
   {
-    struct MeshDrawParams {
-      rhi::DeviceAddress materials;
-      rhi::DeviceAddress meshTransforms;
-      rhi::DeviceAddress meshMaterials;
-      rhi::DeviceAddress skinnedMeshTransforms;
-      rhi::DeviceAddress skinnedMeshMaterials;
-      rhi::DeviceAddress skeletonTransforms;
+    struct LightClusterDrawParams {
       rhi::DeviceAddress camera;
       rhi::DeviceAddress scene;
-      rhi::DeviceAddress directionalLights;
       rhi::DeviceAddress pointLights;
-      rhi::DeviceAddress shadows;
-      rhi::SamplerHandle sampler;
+      rhi::DeviceAddress lightClusterData;
+      rhi::DeviceAddress lightClusters;
     };
 
+    usize lightClusterOffset = 0;
+    for (auto &frameData : mFrameData) {
+      lightClusterOffset =
+          frameData.getBindlessParams().addRange(LightClusterDrawParams{
+              frameData.getCameraBuffer(), frameData.getSceneBuffer(),
+              frameData.getPointLightsBuffer(),
+              frameData.getLightClusterDataBuffer(),
+              frameData.getLightClustersBuffer()});
+    }
+
+    auto &pass = graph.addComputePass("lightClusterPass");
+    for (auto &frameData : mFrameData) {
+      pass.write(frameData.getLightClustersBufferHandle(),
+                 rhi::BufferUsage::Storage);
+    }
+
+    auto pipeline = mRenderStorage.addPipeline(rhi::ComputePipelineDescription{
+        mRenderStorage.getShader("__engine.lights.cluster.compute"),
+        "light clusters"});
+    pass.addPipeline(pipeline);
+
+    pass.setExecutor([pipeline, lightClusterOffset, this](
+                         rhi::RenderCommandList &commandList, u32 frameIndex) {
+      auto &frameData = mFrameData.at(frameIndex);
+
+      std::array<u32, 1> offsets{static_cast<u32>(lightClusterOffset)};
+      commandList.bindPipeline(pipeline);
+      commandList.bindDescriptor(
+          pipeline, 0, frameData.getBindlessParams().getDescriptor(), offsets);
+
+      // Every cluster is culled by its own workgroup
+      commandList.dispatch(SceneRendererFrameData::NumLightClustersX,
+                           SceneRendererFrameData::NumLightClustersY,
+                           SceneRendererFrameData::NumLightClustersZ);
+    });
+  } // light cluster pass
+
+  struct CullDrawParams {
+    rhi::DeviceAddress camera;
+    rhi::DeviceAddress instances;
+    rhi::DeviceAddress batches;
+    rhi::DeviceAddress meshInstances;
+    rhi::DeviceAddress visibility;
+    rhi::DeviceAddress stats;
+    rhi::DeviceAddress commands;
+    rhi::DeviceAddress visibleMeshInstances;
+  };
+
+  // Early pass tests instances against depth
+  // pyramid of the previous frame. Late pass
+  // tests instances that early pass culled
+  // against depth pyramid of the current
+  // frame and draws the ones that are visible
+  auto addCullPass = [this, &graph, depthPyramid](StringView name,
+                                                  bool late) {
+    static constexpr u32 CullGroupSize = 64;
+
+    usize cullOffset = 0;
+    for (auto &frameData : mFrameData) {
+      cullOffset = frameData.getBindlessParams().addRange(CullDrawParams{
+          frameData.getCameraBuffer(), frameData.getCullInstancesBuffer(),
+          frameData.getCullBatchesBuffer(), frameData.getMeshInstancesBuffer(),
+          frameData.getCullVisibilityBuffer(), frameData.getCullStatsBuffer(),
+          frameData.getMeshDrawCommandsBuffer(late),
+          frameData.getVisibleMeshInstancesBuffer(late)});
+    }
+
+    auto &pass = graph.addComputePass(String(name));
+    pass.read(depthPyramid);
+    for (auto &frameData : mFrameData) {
+      if (late) {
+        pass.read(frameData.getCullVisibilityBufferHandle(),
+                  rhi::BufferUsage::Storage);
+      } else {
+        pass.write(frameData.getCullVisibilityBufferHandle(),
+                   rhi::BufferUsage::Storage);
+      }
+
+      pass.write(frameData.getCullStatsBufferHandle(),
+                 rhi::BufferUsage::Storage);
+      pass.write(frameData.getMeshDrawCommandsBufferHandle(late),
+                 rhi::BufferUsage::Storage);
+      pass.write(frameData.getVisibleMeshInstancesBufferHandle(late),
+                 rhi::BufferUsage::Storage);
+    }
+
+    auto pipeline = mRenderStorage.addPipeline(rhi::ComputePipelineDescription{
+        mRenderStorage.getShader("__engine.culling.meshes.compute"),
+        String(name)});
+    pass.addPipeline(pipeline);
+
+    pass.setExecutor([this, pipeline, cullOffset, late, depthPyramid](
+                         rhi::RenderCommandList &commandList, u32 frameIndex) {
+      auto &frameData = mFrameData.at(frameIndex);
+      u32 numInstances = frameData.getNumCullInstances();
+      if (numInstances == 0) {
+        return;
+      }
+
+      // Depth pyramid has no contents until
+      // the first frame after attach builds it
+      bool occlusion = late || mDepthPyramidReady;
+
+      std::array<u32, 4> params{
+          late ? 1u : 0u, numInstances,
+          occlusion ? rhi::castHandleToUint(depthPyramid.getHandle()) : 0u,
+          rhi::castHandleToUint(mRenderStorage.getDefaultSampler())};
+
+      std::array<u32, 1> offsets{static_cast<u32>(cullOffset)};
+      commandList.bindPipeline(pipeline);
+      commandList.bindDescriptor(pipeline, 0,
+                                 mRenderStorage.getGlobalTexturesDescriptor());
+      commandList.bindDescriptor(
+          pipeline, 1, frameData.getBindlessParams().getDescriptor(), offsets);
+      commandList.pushConstants(pipeline, rhi::ShaderStage::Compute, 0,
+                                sizeof(params), params.data());
+
+      commandList.dispatch((numInstances + CullGroupSize - 1) / CullGroupSize,
+                           1, 1);
+    });
+  };
+
+  addCullPass("meshCullPass", false);
+
+  struct MeshDrawParams {
+    rhi::DeviceAddress materials;
+    rhi::DeviceAddress meshTransforms;
+    rhi::DeviceAddress meshMaterials;
+    rhi::DeviceAddress skinnedMeshTransforms;
+    rhi::DeviceAddress skinnedMeshMaterials;
+    rhi::DeviceAddress meshInstances;
+    rhi::DeviceAddress skinnedMeshInstances;
+    rhi::DeviceAddress camera;
+    rhi::DeviceAddress scene;
+    rhi::DeviceAddress directionalLights;
+    rhi::DeviceAddress pointLights;
+    rhi::DeviceAddress shadows;
+    rhi::DeviceAddress lightClusterData;
+    rhi::DeviceAddress lightClusters;
+    rhi::SamplerHandle sampler;
+  };
+
+  // Mesh instances of mesh passes are
+  // instances that survive culling
+  auto addMeshDrawParams = [this](bool late) {
     usize pbrOffset = 0;
     for (auto &frameData : mFrameData) {
       pbrOffset = frameData.getBindlessParams().addRange(MeshDrawParams{
@@ -283,14 +675,35 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
           frameData.getMeshMaterialsBuffer(),
           frameData.getSkinnedMeshTransformsBuffer(),
           frameData.getSkinnedMeshMaterialsBuffer(),
-          frameData.getSkeletonsBuffer(), frameData.getCameraBuffer(),
-          frameData.getSceneBuffer(), frameData.getDirectionalLightsBuffer(),
+          frameData.getVisibleMeshInstancesBuffer(late),
+          frameData.getSkinnedMeshInstancesBuffer(),
+          frameData.getCameraBuffer(), frameData.getSceneBuffer(),
+          frameData.getDirectionalLightsBuffer(),
           frameData.getPointLightsBuffer(), frameData.getShadowMapsBuffer(),
+          frameData.getLightClusterDataBuffer(),
+          frameData.getLightClustersBuffer(),
           mRenderStorage.getDefaultSampler()});
     }
 
+    return pbrOffset;
+  };
+
+  {
+    usize pbrOffset = addMeshDrawParams(false);
+
     auto &pass = graph.addGraphicsPass("meshPass");
+    pass.setDynamicResolution();
     pass.read(shadowmap);
+    for (auto &frameData : mFrameData) {
+      pass.read(frameData.getMeshDrawCommandsBufferHandle(false),
+                rhi::BufferUsage::Indirect);
+      pass.read(frameData.getVisibleMeshInstancesBufferHandle(false),
+                rhi::BufferUsage::Storage);
+      pass.read(frameData.getLightClustersBufferHandle(),
+                rhi::BufferUsage::Storage);
+      pass.read(frameData.getSkinnedVerticesBufferHandle(),
+                rhi::BufferUsage::Vertex);
+    }
     pass.write(sceneColor, AttachmentType::Color, mClearColor);
     pass.write(depthBuffer, AttachmentType::Depth,
                rhi::DepthStencilClear{1.0, 0});
@@ -312,7 +725,7 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
         mRenderStorage.addPipeline(rhi::GraphicsPipelineDescription{
             mRenderStorage.getShader("__engine.geometry.skinned.vertex"),
             mRenderStorage.getShader("__engine.pbr.default.fragment"),
-            createSkinnedMeshVertexLayout(),
+            createMeshVertexLayout(),
             rhi::PipelineInputAssembly{rhi::PrimitiveTopology::TriangleList},
             rhi::PipelineRasterizer{rhi::PolygonMode::Fill, rhi::CullMode::None,
                                     rhi::FrontFace::Clockwise},
@@ -324,8 +737,10 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
     pass.addPipeline(pipeline);
     pass.addPipeline(skinnedPipeline);
 
-    pass.setExecutor([this, pipeline, skinnedPipeline, pbrOffset, shadowmap](
-                         rhi::RenderCommandList &commandList, u32 frameIndex) {
+    pass.setParallelExecutor([this, pipeline, skinnedPipeline, pbrOffset,
+                              shadowmap](rhi::RenderCommandList &commandList,
+                                         u32 frameIndex, u32 chunk,
+                                         u32 numChunks) {
       auto &frameData = mFrameData.at(frameIndex);
 
       commandList.bindPipeline(pipeline);
@@ -341,7 +756,7 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
             pipeline, 1, frameData.getBindlessParams().getDescriptor(),
             offsets);
 
-        render(commandList, pipeline, frameIndex);
+        render(commandList, pipeline, frameIndex, false, chunk, numChunks);
       }
 
       {
@@ -354,11 +769,139 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
             skinnedPipeline, 1, frameData.getBindlessParams().getDescriptor(),
             offsets);
 
-        renderSkinned(commandList, skinnedPipeline, frameIndex);
+        renderSkinned(commandList, skinnedPipeline, frameIndex, chunk,
+                      numChunks);
       }
     });
   } // mesh pass
 
+  {
+    auto &pass = graph.addComputePass("depthPyramidPass");
+    pass.read(depthBuffer);
+    pass.write(depthPyramid, AttachmentType::Color, mClearColor);
+
+    auto pipeline = mRenderStorage.addPipeline(rhi::ComputePipelineDescription{
+        mRenderStorage.getShader("__engine.depth-pyramid.compute"),
+        "depth pyramid"});
+    pass.addPipeline(pipeline);
+
+    static constexpr u32 WorkGroupSize = 8;
+    glm::uvec2 size{depthPyramidDesc.width, depthPyramidDesc.height};
+
+    // Pyramid covers the part of depth buffer
+    // that is rendered with dynamic resolution
+    pass.setExecutor([this, pipeline, depthBuffer, depthPyramid,
+                      depthPyramidLevels, size,
+                      &graph](rhi::RenderCommandList &commandList, u32) {
+      commandList.bindPipeline(pipeline);
+      commandList.bindDescriptor(pipeline, 0,
+                                 mRenderStorage.getGlobalTexturesDescriptor());
+
+      for (u32 level = 0; level < static_cast<u32>(depthPyramidLevels.size());
+           ++level) {
+        if (level > 0) {
+          rhi::ImageBarrier imageBarrier{};
+          imageBarrier.baseLevel = level - 1;
+          imageBarrier.levelCount = 1;
+          imageBarrier.srcAccess = rhi::Access::ShaderWrite;
+          imageBarrier.srcLayout = rhi::ImageLayout::General;
+          imageBarrier.dstAccess = rhi::Access::ShaderRead;
+          imageBarrier.dstLayout = rhi::ImageLayout::General;
+          imageBarrier.texture = depthPyramid.getHandle();
+          imageBarrier.srcStage = rhi::PipelineStage::ComputeShader;
+          imageBarrier.dstStage = rhi::PipelineStage::ComputeShader;
+
+          std::array<rhi::ImageBarrier, 1> imageBarriers{imageBarrier};
+          commandList.pipelineBarrier({}, imageBarriers, {});
+        }
+
+        // First level is reduced from depth buffer
+        // samples; other levels are reduced from
+        // the previous level
+        auto source = level == 0 ? depthBuffer.getHandle()
+                                 : depthPyramidLevels.at(level - 1).getHandle();
+        glm::uvec2 levelSize{std::max(size.x >> level, 1u),
+                             std::max(size.y >> level, 1u)};
+
+        struct Data {
+          rhi::TextureHandle source;
+
+          rhi::TextureHandle target;
+
+          rhi::SamplerHandle defaultSampler;
+
+          u32 numSamples;
+
+          f32 resolutionScale;
+        };
+
+        Data data{source, depthPyramidLevels.at(level).getHandle(),
+                  mRenderStorage.getDefaultSampler(),
+                  level == 0 ? mMaxSampleCounts : 0,
+                  graph.getResolutionScale()};
+        commandList.pushConstants(pipeline, rhi::ShaderStage::Compute, 0,
+                                  sizeof(Data), &data);
+        commandList.dispatch((levelSize.x + WorkGroupSize - 1) / WorkGroupSize,
+                             (levelSize.y + WorkGroupSize - 1) / WorkGroupSize,
+                             1);
+      }
+
+      mDepthPyramidReady = true;
+    });
+  } // depth pyramid pass
+
+  addCullPass("meshLateCullPass", true);
+
+  {
+    usize pbrOffset = addMeshDrawParams(true);
+
+    auto &pass = graph.addGraphicsPass("meshLatePass");
+    pass.setDynamicResolution();
+    pass.read(shadowmap);
+    for (auto &frameData : mFrameData) {
+      pass.read(frameData.getMeshDrawCommandsBufferHandle(true),
+                rhi::BufferUsage::Indirect);
+      pass.read(frameData.getVisibleMeshInstancesBufferHandle(true),
+                rhi::BufferUsage::Storage);
+      pass.read(frameData.getLightClustersBufferHandle(),
+                rhi::BufferUsage::Storage);
+    }
+    pass.write(sceneColor, AttachmentType::Color, mClearColor);
+    pass.write(depthBuffer, AttachmentType::Depth,
+               rhi::DepthStencilClear{1.0f, 0});
+    pass.write(sceneColorResolved, AttachmentType::Resolve, mClearColor);
+
+    auto pipeline = mRenderStorage.addPipeline(rhi::GraphicsPipelineDescription{
+        mRenderStorage.getShader("__engine.geometry.default.vertex"),
+        mRenderStorage.getShader("__engine.pbr.default.fragment"),
+        createMeshVertexLayout(),
+        rhi::PipelineInputAssembly{rhi::PrimitiveTopology::TriangleList},
+        rhi::PipelineRasterizer{rhi::PolygonMode::Fill, rhi::CullMode::None,
+                                rhi::FrontFace::Clockwise},
+        rhi::PipelineColorBlend{{rhi::PipelineColorBlendAttachment{}}},
+        {},
+        rhi::PipelineMultisample{0},
+        "mesh late"});
+    pass.addPipeline(pipeline);
+
+    // Skinned meshes are not culled and
+    // are fully drawn in mesh pass
+    pass.setParallelExecutor([this, pipeline, pbrOffset](
+                                 rhi::RenderCommandList &commandList,
+                                 u32 frameIndex, u32 chunk, u32 numChunks) {
+      auto &frameData = mFrameData.at(frameIndex);
+
+      std::array<u32, 1> offsets{static_cast<u32>(pbrOffset)};
+      commandList.bindPipeline(pipeline);
+      commandList.bindDescriptor(pipeline, 0,
+                                 mRenderStorage.getGlobalTexturesDescriptor());
+      commandList.bindDescriptor(
+          pipeline, 1, frameData.getBindlessParams().getDescriptor(), offsets);
+
+      render(commandList, pipeline, frameIndex, true, chunk, numChunks);
+    });
+  } // mesh late pass
+
   {
     struct SpriteDrawParams {
       rhi::DeviceAddress camera;
@@ -368,6 +911,7 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
     };
 
     auto &pass = graph.addGraphicsPass("spritePass");
+    pass.setDynamicResolution();
     pass.write(sceneColor, AttachmentType::Color, mClearColor);
     pass.write(depthBuffer, AttachmentType::Depth,
                rhi::DepthStencilClear{1.0f, 0});
@@ -427,6 +971,7 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
     }
 
     auto &pass = graph.addGraphicsPass("skyboxPass");
+    pass.setDynamicResolution();
     pass.write(sceneColor, AttachmentType::Color, mClearColor);
     pass.write(depthBuffer, AttachmentType::Depth,
                rhi::DepthStencilClear{1.0f, 0});
@@ -491,6 +1036,7 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
 
   {
     auto &pass = graph.addComputePass("bloom");
+    pass.setAsyncCompute();
     pass.read(sceneColorResolved);
     pass.write(bloomTexture, AttachmentType::Color, mClearColor);
 
@@ -664,7 +1210,10 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
     auto pipeline = mRenderStorage.addPipeline(pipelineDescription);
     pass.addPipeline(pipeline);
 
-    pass.setExecutor([pipeline, sceneColorResolved, bloomTexture, this](
+    // Scene is rendered into a part of the scene
+    // color with dynamic resolution; so, it is
+    // upscaled to the size of HDR color
+    pass.setExecutor([pipeline, sceneColorResolved, bloomTexture, &graph, this](
                          rhi::RenderCommandList &commandList, u32 frameIndex) {
       commandList.bindPipeline(pipeline);
       commandList.bindDescriptor(pipeline, 0,
@@ -678,6 +1227,8 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
         rhi::TextureHandle bloomTexture;
 
         rhi::SamplerHandle defaultSampler;
+
+        f32 resolutionScale;
       };
 
       Data data{
@@ -685,6 +1236,7 @@ SceneRenderPassData SceneRenderer::attach(RenderGraph &graph,
           sceneColorResolved.getHandle(),
           bloomTexture.getHandle(),
           mRenderStorage.getDefaultSampler(),
+          graph.getResolutionScale(),
       };
 
       commandList.pushConstants(pipeline, rhi::ShaderStage::Fragment, 0,
@@ -721,6 +1273,7 @@ void SceneRenderer::attachText(RenderGraph &graph,
   }
 
   auto &pass = graph.addGraphicsPass("textPass");
+  pass.setDynamicResolution();
   pass.write(passData.sceneColor, AttachmentType::Color, mClearColor);
   pass.write(passData.depthBuffer, AttachmentType::Depth,
              rhi::DepthStencilClear{1.0f, 0});
@@ -763,16 +1316,49 @@ void SceneRenderer::attachText(RenderGraph &graph,
 }
 
 void SceneRenderer::updateFrameData(EntityDatabase &entityDatabase,
-                                    Entity camera, u32 frameIndex) {
+                                    Entity camera, u32 frameIndex, f32 alpha) {
+  extractFrameData(entityDatabase, camera, frameIndex, alpha);
+  uploadFrameData(frameIndex);
+}
+
+void SceneRenderer::uploadFrameData(u32 frameIndex) {
+  QUOLL_PROFILE_EVENT("SceneRenderer::uploadFrameData");
+  mFrameData.at(frameIndex).updateBuffers();
+}
+
+void SceneRenderer::extractFrameData(EntityDatabase &entityDatabase,
+                                     Entity camera, u32 frameIndex,
+                                     f32 alpha) {
   QuollAssert(entityDatabase.has<Camera>(camera),
               "Entity does not have a camera");
 
   auto &frameData = mFrameData.at(frameIndex);
 
-  QUOLL_PROFILE_EVENT("SceneRenderer::updateFrameData");
+  QUOLL_PROFILE_EVENT("SceneRenderer::extractFrameData");
   frameData.clear();
 
-  frameData.setCameraData(entityDatabase.get<Camera>(camera),
+  alpha = std::clamp(alpha, 0.0f, 1.0f);
+  auto getWorldTransform = [&entityDatabase, alpha](Entity entity,
+                                                    const glm::mat4 &current) {
+    if (alpha >= 1.0f || !entityDatabase.has<PreviousWorldTransform>(entity)) {
+      return current;
+    }
+
+    return TransformInterpolation::interpolate(
+        entityDatabase.get<PreviousWorldTransform>(entity).worldTransform,
+        current, alpha);
+  };
+
+  auto cameraData = entityDatabase.get<Camera>(camera);
+  if (alpha < 1.0f && entityDatabase.has<WorldTransform>(camera) &&
+      entityDatabase.has<PreviousWorldTransform>(camera)) {
+    cameraData = TransformInterpolation::interpolateCamera(
+        cameraData,
+        entityDatabase.get<PreviousWorldTransform>(camera).worldTransform,
+        entityDatabase.get<WorldTransform>(camera).worldTransform, alpha);
+  }
+
+  frameData.setCameraData(cameraData,
                           entityDatabase.get<PerspectiveLens>(camera));
 
   frameData.setDefaultMaterial(
@@ -781,50 +1367,62 @@ void SceneRenderer::updateFrameData(EntityDatabase &entityDatabase,
           .data.deviceHandle->getAddress());
 
   for (auto [entity, sprite, world] :
-       entityDatabase.view<Sprite, WorldTransform>()) {
+       entityDatabase.view<const Sprite, const WorldTransform>()) {
     auto handle =
         mAssetRegistry.getTextures().getAsset(sprite.handle).data.deviceHandle;
-    frameData.addSprite(entity, handle, world.worldTransform);
+    frameData.addSprite(entity, handle,
+                        getWorldTransform(entity, world.worldTransform));
   }
 
   // Meshes
-  for (auto [entity, world, mesh, renderer] :
-       entityDatabase.view<WorldTransform, Mesh, MeshRenderer>()) {
+  for (auto [entity, mesh, renderer, world] :
+       entityDatabase.group<const Mesh, const MeshRenderer>(
+           include<const WorldTransform>)) {
     const auto &asset = mAssetRegistry.getMeshes().getAsset(mesh.handle);
 
-    std::vector<rhi::DeviceAddress> materials;
+    FrameVector<rhi::DeviceAddress> materials;
+    materials.reserve(renderer.materials.size());
     for (auto material : renderer.materials) {
       materials.push_back(mAssetRegistry.getMaterials()
                               .getAsset(material)
                               .data.deviceHandle->getAddress());
     }
 
-    frameData.addMesh(mesh.handle, entity, world.worldTransform, materials);
+    // Rigid bodies and animated entities move every frame;
+    // so, they are not cached in static shadow maps
+    bool dynamic = entityDatabase.has<RigidBody>(entity) ||
+                   entityDatabase.has<Animator>(entity);
+
+    frameData.addMesh(mesh.handle, asset.data, entity,
+                      getWorldTransform(entity, world.worldTransform),
+                      materials, dynamic);
   }
 
   // Skinned Meshes
   for (auto [entity, skeleton, world, mesh, renderer] :
-       entityDatabase.view<Skeleton, WorldTransform, SkinnedMesh,
-                           SkinnedMeshRenderer>()) {
+       entityDatabase.view<const Skeleton, const WorldTransform,
+                           const SkinnedMesh, const SkinnedMeshRenderer>()) {
     const auto &asset = mAssetRegistry.getMeshes().getAsset(mesh.handle);
 
-    std::vector<rhi::DeviceAddress> materials;
+    FrameVector<rhi::DeviceAddress> materials;
+    materials.reserve(renderer.materials.size());
     for (auto material : renderer.materials) {
       materials.push_back(mAssetRegistry.getMaterials()
                               .getAsset(material)
                               .data.deviceHandle->getAddress());
     }
 
-    frameData.addSkinnedMesh(mesh.handle, entity, world.worldTransform,
+    frameData.addSkinnedMesh(mesh.handle, asset.data, entity,
+                             getWorldTransform(entity, world.worldTransform),
                              skeleton.jointFinalTransforms, materials);
   }
 
   // Texts
   for (auto [entity, text, world] :
-       entityDatabase.view<Text, WorldTransform>()) {
+       entityDatabase.view<const Text, const WorldTransform>()) {
     const auto &font = mAssetRegistry.getFonts().getAsset(text.font).data;
 
-    std::vector<SceneRendererFrameData::GlyphData> glyphs(text.text.length());
+    FrameVector<SceneRendererFrameData::GlyphData> glyphs(text.text.length());
     f32 advanceX = 0;
     f32 advanceY = 0;
     for (usize i = 0; i < text.text.length(); ++i) {
@@ -848,7 +1446,8 @@ void SceneRenderer::updateFrameData(EntityDatabase &entityDatabase,
       advanceX += fontGlyph.advanceX;
     }
 
-    frameData.addText(entity, font.deviceHandle, glyphs, world.worldTransform);
+    frameData.addText(entity, font.deviceHandle, glyphs,
+                      getWorldTransform(entity, world.worldTransform));
   }
 
   // Directional lights
@@ -862,7 +1461,7 @@ void SceneRenderer::updateFrameData(EntityDatabase &entityDatabase,
 
   // Point lights
   for (auto [entity, light, world] :
-       entityDatabase.view<PointLight, WorldTransform>()) {
+       entityDatabase.view<const PointLight, const WorldTransform>()) {
     frameData.addLight(light, world);
   };
 
@@ -894,42 +1493,68 @@ void SceneRenderer::updateFrameData(EntityDatabase &entityDatabase,
       }
     }
   }
-
-  frameData.updateBuffers();
 }
 
 void SceneRenderer::render(rhi::RenderCommandList &commandList,
-                           rhi::PipelineHandle pipeline, u32 frameIndex) {
+                           rhi::PipelineHandle pipeline, u32 frameIndex,
+                           bool late, u32 chunk, u32 numChunks) {
+  static constexpr u32 CommandSize =
+      sizeof(SceneRendererFrameData::IndexedDrawCommand);
+
   auto &frameData = mFrameData.at(frameIndex);
 
-  u32 instanceStart = 0;
-  for (auto &[handle, meshData] : frameData.getMeshGroups()) {
-    const auto &mesh = mAssetRegistry.getMeshes().getAsset(handle).data;
-    u32 numInstances = static_cast<u32>(meshData.transforms.size());
+  const auto &batches = frameData.getMeshBatches();
+  const auto &cullBatches = frameData.getCullBatches();
+  auto commands = frameData.getMeshDrawCommandsBufferHandle(late);
+  // Cull batches are a prefix of mesh batches
+  // when draw commands exceed reserved space
+  auto [start, end] = getChunkRange(cullBatches.size(), chunk, numChunks);
+
+  for (usize i = start; i < end; ++i) {
+    const auto &batch = batches.at(i);
+    const auto &cullBatch = cullBatches.at(i);
+    const auto &mesh = mAssetRegistry.getMeshes().getAsset(batch.mesh).data;
 
     commandList.bindVertexBuffers(mesh.vertexBuffers, mesh.vertexBufferOffsets);
     commandList.bindIndexBuffer(mesh.indexBuffer, rhi::IndexType::Uint32);
-    renderGeometries(commandList, pipeline, mesh, instanceStart, numInstances);
-    instanceStart += numInstances;
+
+    for (u32 g = 0; g < cullBatch.numCommands; ++g) {
+      commandList.pushConstants(pipeline, rhi::ShaderStage::Vertex, 0,
+                                sizeof(u32), &g);
+
+      u64 offset = static_cast<u64>(cullBatch.firstCommand + g) * CommandSize;
+      commandList.drawIndexedIndirect(commands, offset, 1, CommandSize);
+    }
   }
 }
 
 void SceneRenderer::renderSkinned(rhi::RenderCommandList &commandList,
-                                  rhi::PipelineHandle pipeline,
-                                  u32 frameIndex) {
+                                  rhi::PipelineHandle pipeline, u32 frameIndex,
+                                  u32 chunk, u32 numChunks) {
   auto &frameData = mFrameData.at(frameIndex);
 
-  u32 instanceStart = 0;
+  const auto &batches = frameData.getSkinnedMeshBatches();
+  const auto &jobs = frameData.getSkinningJobs();
+  auto [start, end] = getChunkRange(batches.size(), chunk, numChunks);
 
-  for (auto &[handle, meshData] : frameData.getSkinnedMeshGroups()) {
-    const auto &mesh = mAssetRegistry.getMeshes().getAsset(handle).data;
-    u32 numInstances = static_cast<u32>(meshData.transforms.size());
+  for (usize i = start; i < end; ++i) {
+    const auto &batch = batches.at(i);
+    const auto &mesh = mAssetRegistry.getMeshes().getAsset(batch.mesh).data;
 
-    commandList.bindVertexBuffers(mesh.vertexBuffers, mesh.vertexBufferOffsets);
     commandList.bindIndexBuffer(mesh.indexBuffer, rhi::IndexType::Uint32);
 
-    renderGeometries(commandList, pipeline, mesh, instanceStart, numInstances);
-    instanceStart += numInstances;
+    // Every instance has its own vertices in skinned vertex cache
+    for (u32 instance = batch.instanceStart;
+         instance < batch.instanceStart + batch.numInstances; ++instance) {
+      auto offsets = SceneRendererFrameData::getSkinnedVertexOffsets(
+          jobs.at(instance).vertexOffset);
+
+      commandList.bindVertexBuffers(
+          MeshRenderUtils::getSkinnedVertexBuffers(
+              mesh, frameData.getSkinnedVerticesBufferHandle()),
+          MeshRenderUtils::getSkinnedVertexBufferOffsets(mesh, offsets));
+      renderGeometries(commandList, pipeline, mesh, instance, 1);
+    }
   }
 }
 
@@ -959,41 +1584,65 @@ void SceneRenderer::renderGeometries(rhi::RenderCommandList &commandList,
 
 void SceneRenderer::renderShadowsMesh(rhi::RenderCommandList &commandList,
                                       rhi::PipelineHandle pipeline,
-                                      u32 frameIndex) {
+                                      u32 frameIndex, bool dynamic, u32 chunk,
+                                      u32 numChunks) {
   auto &frameData = mFrameData.at(frameIndex);
 
-  u32 instanceStart = 0;
-  for (auto &[handle, meshData] : frameData.getMeshGroups()) {
-    const auto &mesh = mAssetRegistry.getMeshes().getAsset(handle).data;
-    u32 numInstances = static_cast<u32>(meshData.transforms.size());
+  const auto &batches = frameData.getMeshBatches();
+  auto numShadowMaps = static_cast<u32>(frameData.getNumShadowMaps());
+
+  // Static batches are sorted before dynamic batches
+  usize numStaticBatches = static_cast<usize>(
+      std::partition_point(batches.begin(), batches.end(),
+                           [](const auto &batch) { return !batch.dynamic; }) -
+      batches.begin());
+  usize first = dynamic ? numStaticBatches : 0;
+  usize last = dynamic ? batches.size() : numStaticBatches;
+
+  auto [start, end] = getChunkRange(last - first, chunk, numChunks);
+
+  for (usize i = first + start; i < first + end; ++i) {
+    const auto &batch = batches.at(i);
+    const auto &mesh = mAssetRegistry.getMeshes().getAsset(batch.mesh).data;
 
     commandList.bindVertexBuffers(
         MeshRenderUtils::getGeometryBuffers(mesh),
         MeshRenderUtils::getGeometryBufferOffsets(mesh));
     commandList.bindIndexBuffer(mesh.indexBuffer, rhi::IndexType::Uint32);
-    renderShadowsGeometries(commandList, pipeline, mesh, instanceStart,
-                            numInstances);
-    instanceStart += numInstances;
+    renderShadowsGeometries(commandList, pipeline, mesh,
+                            batch.instanceStart * numShadowMaps,
+                            batch.numInstances * numShadowMaps);
   }
 }
 
 void SceneRenderer::renderShadowsSkinnedMesh(
     rhi::RenderCommandList &commandList, rhi::PipelineHandle pipeline,
-    u32 frameIndex) {
+    u32 frameIndex, u32 chunk, u32 numChunks) {
   auto &frameData = mFrameData.at(frameIndex);
 
-  u32 instanceStart = 0;
-  for (auto &[handle, meshData] : frameData.getSkinnedMeshGroups()) {
-    const auto &mesh = mAssetRegistry.getMeshes().getAsset(handle).data;
-    u32 numInstances = static_cast<u32>(meshData.transforms.size());
+  const auto &batches = frameData.getSkinnedMeshBatches();
+  const auto &jobs = frameData.getSkinningJobs();
+  auto numShadowMaps = static_cast<u32>(frameData.getNumShadowMaps());
+  auto [start, end] = getChunkRange(batches.size(), chunk, numChunks);
+
+  std::array<rhi::BufferHandle, 1> buffers{
+      frameData.getSkinnedVerticesBufferHandle()};
+
+  for (usize i = start; i < end; ++i) {
+    const auto &batch = batches.at(i);
+    const auto &mesh = mAssetRegistry.getMeshes().getAsset(batch.mesh).data;
 
-    commandList.bindVertexBuffers(
-        MeshRenderUtils::getSkinnedGeometryBuffers(mesh),
-        MeshRenderUtils::getSkinnedGeometryBufferOffsets(mesh));
     commandList.bindIndexBuffer(mesh.indexBuffer, rhi::IndexType::Uint32);
-    renderShadowsGeometries(commandList, pipeline, mesh, instanceStart,
-                            numInstances);
-    instanceStart += numInstances;
+
+    for (u32 instance = batch.instanceStart;
+         instance < batch.instanceStart + batch.numInstances; ++instance) {
+      auto offsets = SceneRendererFrameData::getSkinnedVertexOffsets(
+          jobs.at(instance).vertexOffset);
+
+      commandList.bindVertexBuffers(buffers, std::array{offsets.at(0)});
+      renderShadowsGeometries(commandList, pipeline, mesh,
+                              instance * numShadowMaps, numShadowMaps);
+    }
   }
 }
 
@@ -81,12 +81,46 @@ public:
   /**
    * @brief Update frame data
    *
+   * Extracts and uploads frame data
+   *
    * @param entityDatabase Entity database
    * @param camera Camera entity
    * @param frameIndex Frame index
+   * @param alpha Interpolation factor
    */
   void updateFrameData(EntityDatabase &entityDatabase, Entity camera,
-                       u32 frameIndex);
+                       u32 frameIndex, f32 alpha = 1.0f);
+
+  /**
+   * @brief Extract frame data from entity database
+   *
+   * Only writes CPU side of frame data. Frame
+   * data is a snapshot of the scene that render
+   * thread reads while the next frame is
+   * extracted into the other frame data.
+   *
+   * Entities with previous world transforms are
+   * rendered at transforms that are blended from
+   * previous and current world transforms using
+   * the interpolation factor.
+   *
+   * @param entityDatabase Entity database
+   * @param camera Camera entity
+   * @param frameIndex Frame index
+   * @param alpha Interpolation factor
+   */
+  void extractFrameData(EntityDatabase &entityDatabase, Entity camera,
+                        u32 frameIndex, f32 alpha = 1.0f);
+
+  /**
+   * @brief Upload extracted frame data to device
+   *
+   * Device must not be using buffers of
+   * the frame data
+   *
+   * @param frameIndex Frame index
+   */
+  void uploadFrameData(u32 frameIndex);
 
   /**
    * @brief Get frame data
@@ -101,12 +135,18 @@ private:
   /**
    * @brief Render meshes
    *
+   * Instance counts are read from draw
+   * commands that are written by culling
+   *
    * @param commandList Command list
    * @param pipeline Pipeline handle
    * @param frameIndex Frame index
+   * @param late Render instances of second culling pass
+   * @param chunk Chunk index
+   * @param numChunks Number of chunks
    */
   void render(rhi::RenderCommandList &commandList, rhi::PipelineHandle pipeline,
-              u32 frameIndex);
+              u32 frameIndex, bool late, u32 chunk, u32 numChunks);
 
   /**
    * @brief Render skinned meshes
@@ -114,9 +154,12 @@ private:
    * @param commandList Command list
    * @param pipeline Pipeline handle
    * @param frameIndex Frame index
+   * @param chunk Chunk index
+   * @param numChunks Number of chunks
    */
   void renderSkinned(rhi::RenderCommandList &commandList,
-                     rhi::PipelineHandle pipeline, u32 frameIndex);
+                     rhi::PipelineHandle pipeline, u32 frameIndex, u32 chunk,
+                     u32 numChunks);
 
   /**
    * @brief Render geometries
@@ -137,9 +180,13 @@ private:
    * @param commandList Command list
    * @param pipeline Pipeline handle
    * @param frameIndex Frame index
+   * @param dynamic Render dynamic or static shadow casters
+   * @param chunk Chunk index
+   * @param numChunks Number of chunks
    */
   void renderShadowsMesh(rhi::RenderCommandList &commandList,
-                         rhi::PipelineHandle pipeline, u32 frameIndex);
+                         rhi::PipelineHandle pipeline, u32 frameIndex,
+                         bool dynamic, u32 chunk, u32 numChunks);
 
   /**
    * @brief Render skinned meshes for shadows
@@ -147,13 +194,18 @@ private:
    * @param commandList Command list
    * @param pipeline Pipeline handle
    * @param frameIndex Frame index
+   * @param chunk Chunk index
+   * @param numChunks Number of chunks
    */
   void renderShadowsSkinnedMesh(rhi::RenderCommandList &commandList,
-                                rhi::PipelineHandle pipeline, u32 frameIndex);
+                                rhi::PipelineHandle pipeline, u32 frameIndex,
+                                u32 chunk, u32 numChunks);
 
   /**
    * @brief Render geometries for shadows
    *
+   * Instances are amplified per shadow map
+   *
    * @param commandList Command list
    * @param pipeline Pipeline handle
    * @param mesh Mesh asset
@@ -194,6 +246,8 @@ private:
   std::array<SceneRendererFrameData, rhi::RenderDevice::NumFrames> mFrameData;
 
   rhi::SamplerHandle mBloomSampler;
+  std::optional<u64> mStaticShadowCastersHash;
+  bool mDepthPyramidReady = false;
 
   u32 mMaxSampleCounts = 1;
 };
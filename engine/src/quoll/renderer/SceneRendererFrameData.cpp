@@ -1,27 +1,65 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/Engine.h"
 #include "quoll/rhi/RenderHandle.h"
 #include "quoll/scene/PointLight.h"
 #include "quoll/scene/DirectionalLight.h"
 
+#include "MeshRenderUtils.h"
 #include "SceneRendererFrameData.h"
 
 namespace quoll {
 
+/**
+ * Light intensity below which lights
+ * are ignored during shading
+ */
+static constexpr f32 LightIntensityThreshold = 0.001f;
+
+/**
+ * @brief Combine value into hash
+ *
+ * @param seed Hash
+ * @param value Value
+ */
+static void hashCombine(u64 &seed, u64 value) {
+  static constexpr u64 GoldenRatio = 0x9e3779b97f4a7c15ull;
+  seed ^= value + GoldenRatio + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * @brief Combine matrix into hash
+ *
+ * @param seed Hash
+ * @param matrix Matrix
+ */
+static void hashCombine(u64 &seed, const glm::mat4 &matrix) {
+  std::array<u32, 16> words{};
+  memcpy(words.data(), &matrix, sizeof(glm::mat4));
+  for (auto word : words) {
+    hashCombine(seed, word);
+  }
+}
+
 SceneRendererFrameData::SceneRendererFrameData(RenderStorage &renderStorage,
                                                usize reservedSpace)
     : mReservedSpace(reservedSpace),
       mBindlessParams(renderStorage.getDevice()
                           ->getDeviceInformation()
                           .getLimits()
-                          .minUniformBufferOffsetAlignment) {
-  mDirectionalLights.reserve(MaxNumLights);
-  mPointLights.reserve(MaxNumLights);
+                          .minUniformBufferOffsetAlignment),
+      mDevice(renderStorage.getDevice()) {
+  mDirectionalLights.reserve(MaxNumDirectionalLights);
+  mPointLights.reserve(MaxNumPointLights);
   mShadowMaps.reserve(MaxShadowMaps);
 
   mTextTransforms.reserve(mReservedSpace);
   mTextGlyphs.reserve(mReservedSpace);
   mSpriteTransforms.reserve(mReservedSpace);
   mSpriteTextures.reserve(mReservedSpace);
+  mFlatMaterials.reserve(mReservedSpace);
+  mFlatMaterials.resize(1);
+  mRenderQueue.reserve(mReservedSpace);
+  mSkinningJobs.reserve(mReservedSpace);
 
   rhi::BufferDescription defaultDesc{};
   defaultDesc.usage = rhi::BufferUsage::Storage;
@@ -48,6 +86,20 @@ SceneRendererFrameData::SceneRendererFrameData(RenderStorage &renderStorage,
     mMeshMaterialsBuffer = renderStorage.createBuffer(desc);
   }
 
+  {
+    auto desc = defaultDesc;
+    desc.debugName = "Mesh instances";
+    desc.size = mReservedSpace * sizeof(u32);
+    mMeshInstancesBuffer = renderStorage.createBuffer(desc);
+  }
+
+  {
+    auto desc = defaultDesc;
+    desc.debugName = "Mesh shadow caster masks";
+    desc.size = mReservedSpace * sizeof(u32);
+    mMeshShadowCasterMasksBuffer = renderStorage.createBuffer(desc);
+  }
+
   {
     auto desc = defaultDesc;
     desc.debugName = "Skinned mesh transforms";
@@ -63,10 +115,44 @@ SceneRendererFrameData::SceneRendererFrameData(RenderStorage &renderStorage,
 
   {
     auto desc = defaultDesc;
-    desc.size = mReservedSpace * MaxNumJoints * sizeof(glm::mat4);
-    desc.debugName = "Skeletons";
+    desc.debugName = "Skinned mesh instances";
+    desc.size = mReservedSpace * sizeof(u32);
+    mSkinnedMeshInstancesBuffer = renderStorage.createBuffer(desc);
+  }
+
+  {
+    auto desc = defaultDesc;
+    desc.debugName = "Skinned mesh shadow caster masks";
+    desc.size = mReservedSpace * sizeof(u32);
+    mSkinnedMeshShadowCasterMasksBuffer = renderStorage.createBuffer(desc);
+  }
+
+  {
+    auto desc = defaultDesc;
+    desc.size = mReservedSpace * ReservedJointsPerSkeleton * sizeof(glm::mat4);
+    desc.debugName = "Joints";
+
+    mJointsBuffer = renderStorage.createBuffer(desc);
+  }
+
+  {
+    auto desc = defaultDesc;
+    desc.size = mReservedSpace * sizeof(SkinningJob);
+    desc.debugName = "Skinning jobs";
 
-    mSkeletonsBuffer = renderStorage.createBuffer(desc);
+    mSkinningJobsBuffer = renderStorage.createBuffer(desc);
+  }
+
+  {
+    // Skinned vertices are written by
+    // skinning compute shader
+    rhi::BufferDescription desc{};
+    desc.usage = rhi::BufferUsage::Vertex | rhi::BufferUsage::Storage;
+    desc.size = SkinnedVerticesSize;
+    desc.allocationUsage = rhi::BufferAllocationUsage::None;
+    desc.debugName = "Skinned vertices";
+
+    mSkinnedVerticesBuffer = renderStorage.createBuffer(desc);
   }
 
   {
@@ -112,6 +198,28 @@ SceneRendererFrameData::SceneRendererFrameData(RenderStorage &renderStorage,
     mPointLightsBuffer = renderStorage.createBuffer(desc);
   }
 
+  {
+    auto desc = defaultDesc;
+    desc.size = sizeof(LightClusterData);
+    desc.usage = rhi::BufferUsage::Uniform;
+    desc.debugName = "Light cluster data";
+
+    mLightClusterDataBuffer = renderStorage.createBuffer(desc);
+  }
+
+  {
+    // Light clusters are written by
+    // light culling compute shader
+    rhi::BufferDescription desc{};
+    desc.usage = rhi::BufferUsage::Storage;
+    desc.size = static_cast<usize>(NumLightClusters) *
+                (MaxLightsPerCluster + 1) * sizeof(u32);
+    desc.allocationUsage = rhi::BufferAllocationUsage::None;
+    desc.debugName = "Light clusters";
+
+    mLightClustersBuffer = renderStorage.createBuffer(desc);
+  }
+
   {
     auto desc = defaultDesc;
     desc.size = sizeof(Camera);
@@ -146,62 +254,141 @@ SceneRendererFrameData::SceneRendererFrameData(RenderStorage &renderStorage,
 
     mShadowMapsBuffer = renderStorage.createBuffer(desc);
   }
-}
 
-void SceneRendererFrameData::updateBuffers() {
-  QUOLL_PROFILE_EVENT("SceneRendererFrameData::updateBuffer");
-  mFlatMaterialsBuffer.update(mFlatMaterials.data(),
-                              mFlatMaterials.size() *
-                                  sizeof(rhi::DeviceAddress));
+  mMeshDrawCommands.reserve(mReservedSpace);
+  mCullBatches.reserve(mReservedSpace);
+  mCullInstances.reserve(mReservedSpace);
+
   {
-    usize offset = 0;
-    auto *bufferData = static_cast<glm::mat4 *>(mMeshTransformsBuffer.map());
-    for (auto &[_, data] : mMeshGroups) {
-      memcpy(bufferData + offset, data.transforms.data(),
-             data.transforms.size() * sizeof(glm::mat4));
-      offset += data.transforms.size();
-    }
+    auto desc = defaultDesc;
+    desc.size = mReservedSpace * sizeof(CullInstanceData);
+    desc.debugName = "Mesh cull instances";
+
+    mCullInstancesBuffer = renderStorage.createBuffer(desc);
   }
 
   {
-    usize offset = 0;
-    auto *bufferData = static_cast<MaterialRange *>(mMeshMaterialsBuffer.map());
-    for (auto &[_, data] : mMeshGroups) {
-      memcpy(bufferData + offset, data.materialRanges.data(),
-             data.materialRanges.size() * sizeof(MaterialRange));
-      offset += data.materialRanges.size();
-    }
+    auto desc = defaultDesc;
+    desc.size = mReservedSpace * sizeof(CullBatchData);
+    desc.debugName = "Mesh cull batches";
+
+    mCullBatchesBuffer = renderStorage.createBuffer(desc);
   }
 
   {
-    usize transformsOffset = 0;
-    auto *transformsBuffer =
-        static_cast<glm::mat4 *>(mSkinnedMeshTransformsBuffer.map());
-
-    usize skeletonsOffset = 0;
-    auto *skeletonsBuffer = static_cast<glm::mat4 *>(mSkeletonsBuffer.map());
-    for (auto &[_, data] : mSkinnedMeshGroups) {
-      memcpy(transformsBuffer + transformsOffset, data.transforms.data(),
-             data.transforms.size() * sizeof(glm::mat4));
-      transformsOffset += data.transforms.size();
-
-      memcpy(skeletonsBuffer + skeletonsOffset, data.skeletons.get(),
-             data.lastSkeleton * MaxNumJoints * sizeof(glm::mat4));
-      skeletonsOffset += data.lastSkeleton * MaxNumJoints;
-    }
+    auto desc = defaultDesc;
+    desc.size = sizeof(CullStatsData);
+    desc.debugName = "Mesh cull stats";
+
+    mCullStatsBuffer = renderStorage.createBuffer(desc);
+
+    CullStatsData stats{};
+    mCullStatsBuffer.update(&stats, sizeof(CullStatsData));
   }
 
   {
-    usize offset = 0;
+    // Visibility is written by
+    // first culling pass
+    rhi::BufferDescription desc{};
+    desc.usage = rhi::BufferUsage::Storage;
+    desc.size = mReservedSpace * sizeof(u32);
+    desc.allocationUsage = rhi::BufferAllocationUsage::None;
+    desc.debugName = "Mesh cull visibility";
+
+    mCullVisibilityBuffer = renderStorage.createBuffer(desc);
+  }
+
+  for (usize i = 0; i < mMeshDrawCommandsBuffers.size(); ++i) {
+    // Instance counts of draw commands
+    // are written by culling passes
+    auto desc = defaultDesc;
+    desc.usage = rhi::BufferUsage::Storage | rhi::BufferUsage::Indirect;
+    desc.size = mReservedSpace * sizeof(IndexedDrawCommand);
+    desc.debugName = i == 0 ? "Mesh draw commands" : "Late mesh draw commands";
+
+    mMeshDrawCommandsBuffers.at(i) = renderStorage.createBuffer(desc);
+  }
+
+  for (usize i = 0; i < mVisibleMeshInstancesBuffers.size(); ++i) {
+    // Visible instances are written
+    // by culling passes
+    rhi::BufferDescription desc{};
+    desc.usage = rhi::BufferUsage::Storage;
+    desc.size = mReservedSpace * sizeof(u32);
+    desc.allocationUsage = rhi::BufferAllocationUsage::None;
+    desc.debugName =
+        i == 0 ? "Visible mesh instances" : "Late visible mesh instances";
+
+    mVisibleMeshInstancesBuffers.at(i) = renderStorage.createBuffer(desc);
+  }
+}
+
+void SceneRendererFrameData::updateBuffers() {
+  QUOLL_PROFILE_EVENT("SceneRendererFrameData::updateBuffer");
+
+  mRenderQueue.sort();
+
+  releaseUnusedInstances(mMeshInstances);
+  releaseUnusedInstances(mSkinnedMeshInstances);
+
+  usize uploadedBytes = 0;
+
+  if (mDirtyMaterialsStart < mDirtyMaterialsEnd) {
     auto *bufferData =
-        static_cast<MaterialRange *>(mSkinnedMeshMaterialsBuffer.map());
-    for (auto &[_, data] : mSkinnedMeshGroups) {
-      memcpy(bufferData + offset, data.materialRanges.data(),
-             data.materialRanges.size() * sizeof(MaterialRange));
-      offset += data.materialRanges.size();
-    }
+        static_cast<rhi::DeviceAddress *>(mFlatMaterialsBuffer.map());
+    usize size = (mDirtyMaterialsEnd - mDirtyMaterialsStart) *
+                 sizeof(rhi::DeviceAddress);
+    memcpy(bufferData + mDirtyMaterialsStart,
+           mFlatMaterials.data() + mDirtyMaterialsStart, size);
+    uploadedBytes += size;
+
+    mDirtyMaterialsStart = 0;
+    mDirtyMaterialsEnd = 0;
   }
 
+  uploadedBytes += uploadInstances(mMeshInstances, mMeshTransformsBuffer,
+                                   mMeshMaterialsBuffer);
+  uploadedBytes +=
+      uploadInstances(mSkinnedMeshInstances, mSkinnedMeshTransformsBuffer,
+                      mSkinnedMeshMaterialsBuffer);
+
+  if (mDirtyJointsStart < mDirtyJointsEnd) {
+    auto *bufferData = static_cast<glm::mat4 *>(mJointsBuffer.map());
+    usize size = (mDirtyJointsEnd - mDirtyJointsStart) * sizeof(glm::mat4);
+    memcpy(bufferData + mDirtyJointsStart, mJoints.data() + mDirtyJointsStart,
+           size);
+    uploadedBytes += size;
+
+    mDirtyJointsStart = 0;
+    mDirtyJointsEnd = 0;
+  }
+
+  // Only dirty ranges of persistent buffers are counted;
+  // per frame data below is rebuilt every frame
+  mDevice->getDeviceStats().addUploadedBytes(uploadedBytes);
+
+  uploadSkinningJobs();
+
+  uploadInstanceSlots(mRenderQueue.getInstances(RenderQueue::Pipeline::Mesh),
+                      mMeshInstancesBuffer);
+  uploadInstanceSlots(
+      mRenderQueue.getInstances(RenderQueue::Pipeline::SkinnedMesh),
+      mSkinnedMeshInstancesBuffer);
+
+  // Skinned meshes are not culled because
+  // animated vertices can leave mesh bounds
+  uploadShadowCasterMasks(
+      mMeshInstances, mRenderQueue.getInstances(RenderQueue::Pipeline::Mesh),
+      mMeshShadowCasterMasksBuffer, true);
+  uploadShadowCasterMasks(
+      mSkinnedMeshInstances,
+      mRenderQueue.getInstances(RenderQueue::Pipeline::SkinnedMesh),
+      mSkinnedMeshShadowCasterMasksBuffer, false);
+
+  mStaticShadowCastersHash = hashStaticShadowCasters();
+
+  uploadCullingData();
+
   mTextTransformsBuffer.update(mTextTransforms.data(),
                                mTextTransforms.size() * sizeof(glm::mat4));
   mTextGlyphsBuffer.update(mTextGlyphs.data(),
@@ -215,6 +402,7 @@ void SceneRendererFrameData::updateBuffers() {
                            mShadowMaps.size() * sizeof(ShadowMapData));
   mCameraBuffer.update(&mCameraData, sizeof(Camera));
   mSceneBuffer.update(&mSceneData, sizeof(SceneData));
+  mLightClusterDataBuffer.update(&mLightClusterData, sizeof(LightClusterData));
   mSkyboxBuffer.update(&mSkyboxData, sizeof(SkyboxData));
 
   mSpriteTexturesBuffer.update(mSpriteTextures.data(),
@@ -224,66 +412,501 @@ void SceneRendererFrameData::updateBuffers() {
 }
 
 void SceneRendererFrameData::setDefaultMaterial(rhi::DeviceAddress material) {
+  if (mFlatMaterials.at(0) == material) {
+    return;
+  }
+
   mFlatMaterials.at(0) = material;
+  mDirtyMaterialsEnd = std::max(mDirtyMaterialsEnd, usize{1});
 }
 
 void SceneRendererFrameData::addMesh(
-    MeshAssetHandle handle, quoll::Entity entity, const glm::mat4 &transform,
-    const std::vector<rhi::DeviceAddress> &materials) {
-  u32 start = static_cast<u32>(mFlatMaterials.size());
-  for (const auto &material : materials) {
-    mFlatMaterials.push_back(material);
+    MeshAssetHandle handle, const MeshAsset &mesh, quoll::Entity entity,
+    const glm::mat4 &transform, std::span<const rhi::DeviceAddress> materials,
+    bool dynamic) {
+  // Instance buffers are referenced by address
+  // from draw parameters; so, they cannot grow
+  if (!mMeshInstances.slots.canAcquire(entity, mReservedSpace)) {
+    Engine::getLogger().warning()
+        << "Mesh is not rendered because mesh instances buffer is full "
+           "(Entity: "
+        << static_cast<u32>(entity) << ")";
+    return;
   }
-  auto newMaterialSize = static_cast<u32>(mFlatMaterials.size());
-  u32 end = newMaterialSize == start ? 0 : newMaterialSize - 1;
 
-  if (mMeshGroups.find(handle) == mMeshGroups.end()) {
-    MeshData data{};
-    mMeshGroups.insert_or_assign(handle, data);
+  bool isNew = false;
+  u32 slot =
+      updateInstance(mMeshInstances, entity, transform, materials, isNew);
+
+  f32 scale = std::max({glm::length(glm::vec3(transform[0])),
+                        glm::length(glm::vec3(transform[1])),
+                        glm::length(glm::vec3(transform[2]))});
+  auto center = transform * glm::vec4(glm::vec3(mesh.boundingSphere), 1.0f);
+  mMeshInstances.boundingSpheres.at(slot) =
+      glm::vec4(glm::vec3(center), mesh.boundingSphere.w * scale);
+
+  enqueue(RenderQueue::Pipeline::Mesh, handle, slot, entity, transform,
+          materials, dynamic);
+
+  auto [it, inserted] = mMeshGeometries.try_emplace(handle);
+  if (inserted) {
+    i32 vertexOffset = 0;
+    u32 indexOffset = 0;
+    for (const auto &geometry : mesh.geometries) {
+      IndexedDrawCommand command{};
+      command.indexCount = static_cast<u32>(geometry.indices.size());
+      command.firstIndex = indexOffset;
+      command.vertexOffset = vertexOffset;
+      it->second.push_back(command);
+
+      vertexOffset += static_cast<i32>(geometry.positions.size());
+      indexOffset += command.indexCount;
+    }
   }
-
-  mMeshGroups.at(handle).entities.push_back(entity);
-  mMeshGroups.at(handle).transforms.push_back(transform);
-  mMeshGroups.at(handle).materialRanges.push_back({start, end});
 }
 
 void SceneRendererFrameData::addSkinnedMesh(
-    MeshAssetHandle handle, Entity entity, const glm::mat4 &transform,
-    const std::vector<glm::mat4> &skeleton,
-    const std::vector<rhi::DeviceAddress> &materials) {
-  u32 start = static_cast<u32>(mFlatMaterials.size());
-  for (const auto &material : materials) {
-    mFlatMaterials.push_back(material);
+    MeshAssetHandle handle, const MeshAsset &mesh, Entity entity,
+    const glm::mat4 &transform, const std::vector<glm::mat4> &skeleton,
+    std::span<const rhi::DeviceAddress> materials) {
+  u32 numVertices = 0;
+  for (const auto &geometry : mesh.geometries) {
+    numVertices += static_cast<u32>(geometry.positions.size());
+  }
+
+  if (mNumSkinnedVertices + numVertices > MaxNumSkinnedVertices) {
+    Engine::getLogger().warning()
+        << "Skinned mesh is not rendered because skinned vertex cache is "
+           "full (Entity: "
+        << static_cast<u32>(entity) << ")";
+    return;
+  }
+
+  if (!mSkinnedMeshInstances.slots.canAcquire(entity, mReservedSpace)) {
+    Engine::getLogger().warning()
+        << "Skinned mesh is not rendered because skinned mesh instances "
+           "buffer is full (Entity: "
+        << static_cast<u32>(entity) << ")";
+    return;
+  }
+
+  bool isNew = false;
+  u32 slot = updateInstance(mSkinnedMeshInstances, entity, transform,
+                            materials, isNew);
+
+  if (slot >= mSkinnedMeshSources.size()) {
+    mSkinnedMeshSources.resize(slot + 1);
+    mJointCapacities.resize(slot + 1, 0);
+  }
+
+  auto [positions, normals, tangents, joints, weights] =
+      MeshRenderUtils::getSkinningSourceAddresses(mesh);
+
+  auto &source = mSkinnedMeshSources.at(slot);
+  source.positions = positions;
+  source.normals = normals;
+  source.tangents = tangents;
+  source.joints = joints;
+  source.weights = weights;
+  source.numVertices = numVertices;
+
+  if (!writeJoints(slot, skeleton, isNew)) {
+    Engine::getLogger().warning()
+        << "Skinned mesh is not rendered because joints buffer is full "
+           "(Entity: "
+        << static_cast<u32>(entity) << ")";
+    return;
+  }
+
+  mNumSkinnedVertices += numVertices;
+  enqueue(RenderQueue::Pipeline::SkinnedMesh, handle, slot, entity, transform,
+          materials, true);
+}
+
+bool SceneRendererFrameData::writeJoints(u32 slot,
+                                         const std::vector<glm::mat4> &skeleton,
+                                         bool isNew) {
+  auto &source = mSkinnedMeshSources.at(slot);
+  usize capacity = isNew ? 0 : mJointCapacities.at(slot);
+
+  usize start = source.jointOffset;
+  if (skeleton.size() > capacity) {
+    usize maxJoints = mReservedSpace * ReservedJointsPerSkeleton;
+    if (mJoints.size() + skeleton.size() > maxJoints) {
+      // Current slot is written again below
+      mJointCapacities.at(slot) = 0;
+      compactJoints();
+    }
+
+    if (mJoints.size() + skeleton.size() > maxJoints) {
+      return false;
+    }
+
+    start = mJoints.size();
+    mJoints.resize(start + skeleton.size());
+    mJointCapacities.at(slot) = static_cast<u32>(skeleton.size());
+    source.jointOffset = static_cast<u32>(start);
+  } else if (std::equal(skeleton.begin(), skeleton.end(),
+                        mJoints.data() + start)) {
+    return true;
+  }
+
+  std::copy(skeleton.begin(), skeleton.end(), mJoints.data() + start);
+
+  if (mDirtyJointsStart == mDirtyJointsEnd) {
+    mDirtyJointsStart = start;
+    mDirtyJointsEnd = start + skeleton.size();
+  } else {
+    mDirtyJointsStart = std::min(mDirtyJointsStart, start);
+    mDirtyJointsEnd = std::max(mDirtyJointsEnd, start + skeleton.size());
+  }
+
+  return true;
+}
+
+void SceneRendererFrameData::compactJoints() {
+  std::vector<glm::mat4> joints;
+  joints.reserve(mJoints.capacity());
+
+  const auto &written = mSkinnedMeshInstances.written;
+  for (u32 slot = 0; slot < static_cast<u32>(mJointCapacities.size());
+       ++slot) {
+    usize capacity = mJointCapacities.at(slot);
+    if (!written.at(slot) || capacity == 0) {
+      mJointCapacities.at(slot) = 0;
+      continue;
+    }
+
+    auto &source = mSkinnedMeshSources.at(slot);
+    const auto *first = mJoints.data() + source.jointOffset;
+    source.jointOffset = static_cast<u32>(joints.size());
+    joints.insert(joints.end(), first, first + capacity);
+  }
+
+  mJoints = std::move(joints);
+  mDirtyJointsStart = 0;
+  mDirtyJointsEnd = mJoints.size();
+}
+
+void SceneRendererFrameData::uploadSkinningJobs() {
+  mSkinningJobs.clear();
+  mMaxSkinningJobVertices = 0;
+
+  u32 vertexOffset = 0;
+  for (auto slot :
+       mRenderQueue.getInstances(RenderQueue::Pipeline::SkinnedMesh)) {
+    auto job = mSkinnedMeshSources.at(slot);
+    job.vertexOffset = vertexOffset;
+    vertexOffset += job.numVertices;
+
+    // Skinned meshes that do not fit into
+    // vertex cache are not added to the queue
+    QuollAssert(vertexOffset <= MaxNumSkinnedVertices,
+                "Number of skinned vertices exceeds reserved space");
+
+    mMaxSkinningJobVertices =
+        std::max(mMaxSkinningJobVertices, job.numVertices);
+    mSkinningJobs.push_back(job);
+  }
+
+  mSkinningJobsBuffer.update(mSkinningJobs.data(),
+                             mSkinningJobs.size() * sizeof(SkinningJob));
+}
+
+void SceneRendererFrameData::enqueue(
+    RenderQueue::Pipeline pipeline, MeshAssetHandle handle, u32 slot,
+    Entity entity, const glm::mat4 &transform,
+    std::span<const rhi::DeviceAddress> materials, bool dynamic) {
+  // Instances of each mesh batch are sorted front
+  // to back using view space depth of mesh origin
+  f32 viewDepth = -(mCameraData.viewMatrix * transform[3]).z;
+  f32 depth = viewDepth / mCameraLens.far;
+
+  mRenderQueue.add(
+      RenderQueue::createKey(pipeline, handle,
+                             RenderQueue::createMaterialKey(materials), depth,
+                             dynamic),
+      slot, entity);
+}
+
+u32 SceneRendererFrameData::updateInstance(
+    InstanceData &data, Entity entity, const glm::mat4 &transform,
+    std::span<const rhi::DeviceAddress> materials, bool &isNew) {
+  u32 slot = data.slots.acquire(entity);
+  QuollAssert(slot < mReservedSpace,
+              "Number of instances exceeds reserved space");
+
+  if (slot >= data.written.size()) {
+    data.transforms.resize(slot + 1);
+    data.materials.resize(slot + 1);
+    data.materialRanges.resize(slot + 1);
+    data.written.resize(slot + 1, false);
+    data.boundingSpheres.resize(slot + 1);
+  }
+
+  isNew = !data.written.at(slot);
+
+  if (isNew || data.transforms.at(slot) != transform) {
+    data.transforms.at(slot) = transform;
+    data.dirtyTransforms.push_back(slot);
+  }
+
+  auto &slotMaterials = data.materials.at(slot);
+  if (isNew || !std::equal(slotMaterials.begin(), slotMaterials.end(),
+                           materials.begin(), materials.end())) {
+    data.materialRanges.at(slot) =
+        writeMaterials(materials, data.materialRanges.at(slot),
+                       isNew ? 0 : slotMaterials.size());
+    slotMaterials.assign(materials.begin(), materials.end());
+    data.dirtyMaterialRanges.push_back(slot);
+  }
+
+  data.written.at(slot) = true;
+  return slot;
+}
+
+SceneRendererFrameData::MaterialRange SceneRendererFrameData::writeMaterials(
+    std::span<const rhi::DeviceAddress> materials, MaterialRange range,
+    usize capacity) {
+  if (materials.empty()) {
+    return {0, 0};
   }
-  auto newMaterialSize = static_cast<u32>(mFlatMaterials.size());
-  u32 end = newMaterialSize == start ? 0 : newMaterialSize - 1;
 
-  if (mSkinnedMeshGroups.find(handle) == mSkinnedMeshGroups.end()) {
-    mSkinnedMeshGroups.insert({handle, SkinnedMeshData{}});
+  usize start = range.start;
+  if (materials.size() > capacity) {
+    if (mFlatMaterials.size() + materials.size() > mReservedSpace) {
+      compactMaterials();
+    }
+
+    QuollAssert(mFlatMaterials.size() + materials.size() <= mReservedSpace,
+                "Number of materials exceeds reserved space");
+
+    start = mFlatMaterials.size();
+    mFlatMaterials.resize(start + materials.size());
   }
 
-  auto &group = mSkinnedMeshGroups.at(handle);
+  std::copy(materials.begin(), materials.end(), mFlatMaterials.data() + start);
 
-  group.entities.push_back(entity);
-  group.transforms.push_back(transform);
-  group.materialRanges.push_back({start, end});
+  if (mDirtyMaterialsStart == mDirtyMaterialsEnd) {
+    mDirtyMaterialsStart = start;
+    mDirtyMaterialsEnd = start + materials.size();
+  } else {
+    mDirtyMaterialsStart = std::min(mDirtyMaterialsStart, start);
+    mDirtyMaterialsEnd =
+        std::max(mDirtyMaterialsEnd, start + materials.size());
+  }
 
-  usize currentOffset = group.lastSkeleton * MaxNumJoints;
-  usize newSize = currentOffset + MaxNumJoints;
+  return {static_cast<u32>(start),
+          static_cast<u32>(start + materials.size() - 1)};
+}
 
-  // Resize skeletons if new skeleton does not fit
-  if (group.skeletonCapacity < newSize) {
-    group.skeletonCapacity = newSize * 2;
-    auto *newVector = new glm::mat4[group.skeletonCapacity];
+void SceneRendererFrameData::compactMaterials() {
+  mFlatMaterials.resize(1);
 
-    memcpy(newVector, group.skeletons.get(), currentOffset * sizeof(glm::mat4));
-    group.skeletons.reset(newVector);
+  for (auto *data : {&mMeshInstances, &mSkinnedMeshInstances}) {
+    for (u32 slot = 0; slot < static_cast<u32>(data->written.size()); ++slot) {
+      const auto &materials = data->materials.at(slot);
+      if (!data->written.at(slot) || materials.empty()) {
+        continue;
+      }
+
+      auto start = static_cast<u32>(mFlatMaterials.size());
+      mFlatMaterials.insert(mFlatMaterials.end(), materials.begin(),
+                            materials.end());
+      data->materialRanges.at(slot) = {
+          start, static_cast<u32>(mFlatMaterials.size() - 1)};
+      data->dirtyMaterialRanges.push_back(slot);
+    }
   }
 
-  auto *currentSkeleton = group.skeletons.get() + currentOffset;
-  usize dataSize = std::min(skeleton.size(), MaxNumJoints);
-  memcpy(currentSkeleton, skeleton.data(), dataSize * sizeof(glm::mat4));
-  group.lastSkeleton++;
+  mDirtyMaterialsStart = 0;
+  mDirtyMaterialsEnd = mFlatMaterials.size();
+}
+
+void SceneRendererFrameData::releaseUnusedInstances(InstanceData &data) {
+  for (auto slot : data.slots.releaseUnused()) {
+    data.written.at(slot) = false;
+    data.materials.at(slot).clear();
+    data.materialRanges.at(slot) = {};
+  }
+}
+
+usize SceneRendererFrameData::uploadInstances(
+    InstanceData &data, rhi::Buffer &transformsBuffer,
+    rhi::Buffer &materialRangesBuffer) {
+  {
+    auto *bufferData = static_cast<glm::mat4 *>(transformsBuffer.map());
+    for (auto slot : data.dirtyTransforms) {
+      bufferData[slot] = data.transforms.at(slot);
+    }
+  }
+
+  {
+    auto *bufferData =
+        static_cast<MaterialRange *>(materialRangesBuffer.map());
+    for (auto slot : data.dirtyMaterialRanges) {
+      bufferData[slot] = data.materialRanges.at(slot);
+    }
+  }
+
+  usize size = data.dirtyTransforms.size() * sizeof(glm::mat4) +
+               data.dirtyMaterialRanges.size() * sizeof(MaterialRange);
+
+  data.dirtyTransforms.clear();
+  data.dirtyMaterialRanges.clear();
+
+  return size;
+}
+
+u32 SceneRendererFrameData::getShadowCasterMask(
+    const glm::vec4 &sphere) const {
+  u32 mask = 0;
+  for (usize i = 0; i < mShadowMaps.size(); ++i) {
+    const auto &matrix = mShadowMaps.at(i).shadowMatrix;
+    auto center = matrix * glm::vec4(glm::vec3(sphere), 1.0f);
+
+    // Shadow matrices are orthographic; so, radius
+    // in each axis is scaled by length of matrix row
+    glm::vec3 radius =
+        sphere.w *
+        glm::vec3(glm::length(glm::vec3(matrix[0][0], matrix[1][0],
+                                        matrix[2][0])),
+                  glm::length(glm::vec3(matrix[0][1], matrix[1][1],
+                                        matrix[2][1])),
+                  glm::length(glm::vec3(matrix[0][2], matrix[1][2],
+                                        matrix[2][2])));
+
+    // Casters in front of near plane are
+    // kept because they still cast shadows
+    bool visible = std::abs(center.x) <= 1.0f + radius.x &&
+                   std::abs(center.y) <= 1.0f + radius.y &&
+                   center.z <= 1.0f + radius.z;
+
+    if (visible) {
+      mask |= 1u << i;
+    }
+  }
+
+  return mask;
+}
+
+u64 SceneRendererFrameData::hashStaticShadowCasters() const {
+  u64 hash = 0;
+  u64 instancesHash = 0;
+  for (const auto &shadowMap : mShadowMaps) {
+    hashCombine(hash, shadowMap.shadowMatrix);
+  }
+
+  const auto &instances =
+      mRenderQueue.getInstances(RenderQueue::Pipeline::Mesh);
+  for (const auto &batch : getMeshBatches()) {
+    // Static batches are sorted before dynamic batches
+    if (batch.dynamic) {
+      break;
+    }
+
+    // Instances are sorted by depth within batches; so,
+    // instance hashes are summed to not depend on camera
+    for (u32 i = batch.instanceStart;
+         i < batch.instanceStart + batch.numInstances; ++i) {
+      u64 instanceHash = static_cast<u64>(batch.mesh);
+      hashCombine(instanceHash,
+                  mMeshInstances.transforms.at(instances.at(i)));
+      instancesHash += instanceHash;
+    }
+  }
+
+  hashCombine(hash, instancesHash);
+  return hash;
+}
+
+void SceneRendererFrameData::uploadShadowCasterMasks(
+    const InstanceData &data, const std::vector<u32> &instances,
+    rhi::Buffer &buffer, bool cull) {
+  u32 allShadowMaps = (1u << mShadowMaps.size()) - 1;
+
+  mShadowCasterMasks.resize(instances.size());
+  for (usize i = 0; i < instances.size(); ++i) {
+    mShadowCasterMasks.at(i) =
+        cull ? getShadowCasterMask(data.boundingSpheres.at(instances.at(i)))
+             : allShadowMaps;
+  }
+
+  buffer.update(mShadowCasterMasks.data(),
+                mShadowCasterMasks.size() * sizeof(u32));
+}
+
+void SceneRendererFrameData::uploadCullingData() {
+  // Frame data is only reused after its
+  // previous frame is complete; so, culling
+  // statistics of that frame are available
+  const auto *stats =
+      static_cast<const CullStatsData *>(mCullStatsBuffer.map());
+  u32 numVisible = std::min(stats->numVisibleEarly + stats->numVisibleLate,
+                            stats->numInstances);
+  mDevice->getDeviceStats().setCullingResults(
+      numVisible, stats->numInstances - numVisible);
+
+  mMeshDrawCommands.clear();
+  mCullBatches.clear();
+  mCullInstances.clear();
+
+  const auto &batches = mRenderQueue.getBatches(RenderQueue::Pipeline::Mesh);
+  const auto &instances =
+      mRenderQueue.getInstances(RenderQueue::Pipeline::Mesh);
+
+  for (u32 b = 0; b < static_cast<u32>(batches.size()); ++b) {
+    const auto &batch = batches.at(b);
+    const auto &geometries = mMeshGeometries.at(batch.mesh);
+
+    // Draw command buffers are referenced by address
+    // from culling parameters; so, they cannot grow
+    // and batches that do not fit are not rendered
+    if (mMeshDrawCommands.size() + geometries.size() > mReservedSpace) {
+      Engine::getLogger().warning()
+          << "Mesh draw commands exceed reserved space; "
+          << (batches.size() - b) << " mesh batches are not rendered";
+      break;
+    }
+
+    CullBatchData cullBatch{};
+    cullBatch.firstCommand = static_cast<u32>(mMeshDrawCommands.size());
+    cullBatch.numCommands = static_cast<u32>(geometries.size());
+    cullBatch.instanceStart = batch.instanceStart;
+    mCullBatches.push_back(cullBatch);
+
+    for (auto command : geometries) {
+      command.firstInstance = batch.instanceStart;
+      mMeshDrawCommands.push_back(command);
+    }
+
+    for (u32 i = batch.instanceStart;
+         i < batch.instanceStart + batch.numInstances; ++i) {
+      mCullInstances.push_back(
+          {mMeshInstances.boundingSpheres.at(instances.at(i)),
+           glm::uvec4(b, 0, 0, 0)});
+    }
+  }
+
+  CullStatsData newStats{};
+  newStats.numInstances = static_cast<u32>(mCullInstances.size());
+  mCullStatsBuffer.update(&newStats, sizeof(CullStatsData));
+
+  for (auto &buffer : mMeshDrawCommandsBuffers) {
+    buffer.update(mMeshDrawCommands.data(),
+                  mMeshDrawCommands.size() * sizeof(IndexedDrawCommand));
+  }
+
+  mCullBatchesBuffer.update(mCullBatches.data(),
+                            mCullBatches.size() * sizeof(CullBatchData));
+  mCullInstancesBuffer.update(mCullInstances.data(),
+                              mCullInstances.size() *
+                                  sizeof(CullInstanceData));
+}
+
+void SceneRendererFrameData::uploadInstanceSlots(
+    const std::vector<u32> &instances, rhi::Buffer &buffer) {
+  buffer.update(instances.data(), instances.size() * sizeof(u32));
 }
 
 void SceneRendererFrameData::setBrdfLookupTable(rhi::TextureHandle brdfLut) {
@@ -367,6 +990,20 @@ void SceneRendererFrameData::addCascadedShadowMaps(
     glm::vec3 maxBounds = glm::vec3(radius);
     glm::vec3 minBounds = -maxBounds;
 
+    // Snap frustum center to shadow map texels in light
+    // space; so, cascade bounds only change when camera
+    // moves by a whole texel. This removes shimmering
+    // and keeps cached static shadow maps valid
+    auto lightRotation = glm::lookAt(glm::vec3(0.0f), light.direction,
+                                     glm::vec3(0.0f, 1.0f, 0.0f));
+    f32 texelSize = (2.0f * radius) / static_cast<f32>(ShadowMapDimensions);
+    auto lightSpaceCenter =
+        glm::floor(glm::vec3(lightRotation * glm::vec4(frustumCenter, 1.0f)) /
+                   texelSize) *
+        texelSize;
+    frustumCenter = glm::vec3(glm::inverse(lightRotation) *
+                              glm::vec4(lightSpaceCenter, 1.0f));
+
     f32 cascadeZ = maxBounds.z - minBounds.z;
     auto lightViewMatrix =
         glm::lookAt(frustumCenter - light.direction * radius, frustumCenter,
@@ -422,8 +1059,21 @@ void SceneRendererFrameData::addLight(const PointLight &light,
   glm::decompose(transform.worldTransform, scale, orientation, position, skew,
                  perspective);
 
+  if (mPointLights.size() >= MaxNumPointLights) {
+    return;
+  }
+
+  // Attenuated intensity drops below
+  // threshold after the culling radius
+  f32 radius =
+      std::sqrt(std::max(light.intensity, 0.0f) / LightIntensityThreshold);
+  if (light.range > 0.0f) {
+    radius = std::min(radius, light.range);
+  }
+
   PointLightData data{glm::vec4(position, light.intensity),
-                      glm::vec4(light.range), glm::vec4(light.color)};
+                      glm::vec4(light.range, radius, 0.0f, 0.0f),
+                      glm::vec4(light.color)};
   mPointLights.push_back(data);
   mSceneData.data.y = static_cast<i32>(mPointLights.size());
 }
@@ -438,7 +1088,7 @@ void SceneRendererFrameData::addSprite(Entity entity,
 
 void SceneRendererFrameData::addText(Entity entity,
                                      rhi::TextureHandle fontTexture,
-                                     const std::vector<GlyphData> &glyphs,
+                                     std::span<const GlyphData> glyphs,
                                      const glm::mat4 &transform) {
   mTextTransforms.push_back(transform);
   mTextEntities.push_back(entity);
@@ -479,6 +1129,22 @@ void SceneRendererFrameData::setCameraData(const Camera &data,
                                            const PerspectiveLens &lens) {
   mCameraData = data;
   mCameraLens = lens;
+
+  f32 near = std::max(lens.near, 0.001f);
+  f32 far = std::max(lens.far, near * 2.0f);
+  f32 logRatio = std::log(far / near);
+
+  mLightClusterData.inverseProjectionMatrix =
+      glm::inverse(data.projectionMatrix);
+  mLightClusterData.gridSize =
+      glm::uvec4(NumLightClustersX, NumLightClustersY, NumLightClustersZ,
+                 MaxLightsPerCluster);
+
+  // Slice index of view depth is
+  // log(depth) * scale + bias
+  f32 scale = static_cast<f32>(NumLightClustersZ) / logRatio;
+  mLightClusterData.depthSlices =
+      glm::vec4(near, far, scale, -scale * std::log(near));
 }
 
 void SceneRendererFrameData::setShadowMapTexture(rhi::TextureHandle shadowmap) {
@@ -486,6 +1152,8 @@ void SceneRendererFrameData::setShadowMapTexture(rhi::TextureHandle shadowmap) {
 }
 
 void SceneRendererFrameData::clear() {
+  mMeshInstances.slots.beginFrame();
+  mSkinnedMeshInstances.slots.beginFrame();
 
   mSpriteEntities.clear();
   mSpriteTransforms.clear();
@@ -508,11 +1176,9 @@ void SceneRendererFrameData::clear() {
   mSkyboxData.color = {};
   mSkyboxData.data.x = 0;
 
-  mLastSkeleton = 0;
-  mFlatMaterials.clear();
-  mFlatMaterials.resize(1);
-  mMeshGroups.clear();
-  mSkinnedMeshGroups.clear();
+  mRenderQueue.clear();
+  mMeshGeometries.clear();
+  mNumSkinnedVertices = 0;
 }
 
 } // namespace quoll
@@ -6,6 +6,8 @@
 #include "quoll/renderer/Material.h"
 #include "quoll/entity/EntityDatabase.h"
 #include "quoll/renderer/BindlessDrawParameters.h"
+#include "quoll/renderer/RenderInstanceSlots.h"
+#include "quoll/renderer/RenderQueue.h"
 #include "quoll/scene/CascadedShadowMap.h"
 #include "quoll/scene/WorldTransform.h"
 #include "quoll/scene/Camera.h"
@@ -19,7 +21,10 @@ namespace quoll {
  * @brief Scene renderer frame data
  *
  * Stores everything necessary to
- * render a frame
+ * render a frame. Mesh instance data
+ * is stored in persistent slots and
+ * only changed slots are uploaded. Mesh
+ * draws are sorted through a render queue.
  */
 class SceneRendererFrameData {
 public:
@@ -29,20 +34,86 @@ public:
   static constexpr usize DefaultReservedSpace = 10000;
 
   /**
-   * Maximum number of joints
+   * Number of joints reserved per skeleton
+   *
+   * Skeletons can have any number of joints
+   * as long as all joints fit into joints
+   * buffer, which is sized using this value
+   */
+  static constexpr usize ReservedJointsPerSkeleton = 32;
+
+  /**
+   * Maximum number of skinned vertices
+   *
+   * Skinned vertex cache stores vertices
+   * of every skinned mesh instance
+   */
+  static constexpr usize MaxNumSkinnedVertices = 512ull * 1024;
+
+  /**
+   * Offset of skinned normals in skinned vertex cache
+   */
+  static constexpr usize SkinnedNormalsOffset =
+      MaxNumSkinnedVertices * sizeof(glm::vec3);
+
+  /**
+   * Offset of skinned tangents in skinned vertex cache
+   */
+  static constexpr usize SkinnedTangentsOffset =
+      SkinnedNormalsOffset + MaxNumSkinnedVertices * sizeof(glm::vec3);
+
+  /**
+   * Skinned vertex cache size
+   */
+  static constexpr usize SkinnedVerticesSize =
+      SkinnedTangentsOffset + MaxNumSkinnedVertices * sizeof(glm::vec4);
+
+  /**
+   * Maximum number of directional lights
+   */
+  static constexpr usize MaxNumDirectionalLights = 256;
+
+  /**
+   * Maximum number of point lights
+   */
+  static constexpr usize MaxNumPointLights = 4096;
+
+  /**
+   * Number of light clusters in X axis
    */
-  static constexpr usize MaxNumJoints = 32;
+  static constexpr u32 NumLightClustersX = 16;
 
   /**
-   * Maximum number of lights
+   * Number of light clusters in Y axis
    */
-  static constexpr usize MaxNumLights = 256;
+  static constexpr u32 NumLightClustersY = 9;
+
+  /**
+   * Number of light clusters in Z axis
+   */
+  static constexpr u32 NumLightClustersZ = 24;
+
+  /**
+   * Number of light clusters
+   */
+  static constexpr u32 NumLightClusters =
+      NumLightClustersX * NumLightClustersY * NumLightClustersZ;
+
+  /**
+   * Maximum number of lights in a light cluster
+   */
+  static constexpr u32 MaxLightsPerCluster = 128;
 
   /**
    * Maximum number of shadow maps
    */
   static constexpr usize MaxShadowMaps = 16;
 
+  /**
+   * Width and height of shadow maps
+   */
+  static constexpr u32 ShadowMapDimensions = 4096;
+
   /**
    * @brief Directional light data
    */
@@ -86,7 +157,9 @@ public:
     /**
      * Light range
      *
-     * vec4 is used for padding purposes
+     * First parameter is range cutoff
+     * Second parameter is culling radius
+     *  after which light has no contribution
      */
     glm::vec4 range;
 
@@ -115,6 +188,38 @@ public:
     glm::vec4 data;
   };
 
+  /**
+   * @brief Light cluster data
+   *
+   * View frustum is divided into clusters
+   * using screen tiles and exponential
+   * depth slices
+   */
+  struct LightClusterData {
+    /**
+     * Inverse camera projection matrix
+     */
+    glm::mat4 inverseProjectionMatrix{1.0};
+
+    /**
+     * Cluster grid size
+     *
+     * First three values are number of clusters in each axis
+     * Fourth value is maximum number of lights in a cluster
+     */
+    glm::uvec4 gridSize{0};
+
+    /**
+     * Depth slice data
+     *
+     * First parameter is camera near plane
+     * Second parameter is camera far plane
+     * Third parameter is depth slice scale
+     * Fourth parameter is depth slice bias
+     */
+    glm::vec4 depthSlices{0.0f};
+  };
+
   /**
    * @brief Scene data
    */
@@ -184,44 +289,162 @@ public:
   };
 
   /**
-   * @brief Mesh data
+   * @brief Skinning job
+   *
+   * Skins vertices of single skinned mesh
+   * instance into skinned vertex cache
    */
-  struct MeshData {
+  struct SkinningJob {
+    /**
+     * Source positions
+     */
+    rhi::DeviceAddress positions = rhi::DeviceAddress::Null;
 
     /**
-     * @brief Transforms of mesh entities
+     * Source normals
      */
-    std::vector<glm::mat4> transforms;
+    rhi::DeviceAddress normals = rhi::DeviceAddress::Null;
 
     /**
-     * @brief Mateiral ranges
+     * Source tangents
      */
-    std::vector<MaterialRange> materialRanges;
+    rhi::DeviceAddress tangents = rhi::DeviceAddress::Null;
+
+    /**
+     * Source joints
+     */
+    rhi::DeviceAddress joints = rhi::DeviceAddress::Null;
+
+    /**
+     * Source weights
+     */
+    rhi::DeviceAddress weights = rhi::DeviceAddress::Null;
+
+    /**
+     * Number of vertices
+     */
+    u32 numVertices = 0;
+
+    /**
+     * First vertex in skinned vertex cache
+     */
+    u32 vertexOffset = 0;
+
+    /**
+     * First joint in joints buffer
+     */
+    u32 jointOffset = 0;
+
+    /**
+     * Padding
+     */
+    u32 padding = 0;
+  };
+
+  /**
+   * @brief Indexed draw command
+   *
+   * Matches layout of indexed draw
+   * commands that are read by device
+   */
+  struct IndexedDrawCommand {
+    /**
+     * Index count
+     */
+    u32 indexCount = 0;
+
+    /**
+     * Instance count
+     */
+    u32 instanceCount = 0;
+
+    /**
+     * First index
+     */
+    u32 firstIndex = 0;
+
+    /**
+     * Vertex offset
+     */
+    i32 vertexOffset = 0;
+
+    /**
+     * First instance
+     */
+    u32 firstInstance = 0;
+  };
+
+  /**
+   * @brief Mesh batch data for culling
+   *
+   * Every geometry of the batch
+   * has its own draw command
+   */
+  struct CullBatchData {
+    /**
+     * First draw command
+     */
+    u32 firstCommand = 0;
+
+    /**
+     * Number of draw commands
+     */
+    u32 numCommands = 0;
+
+    /**
+     * First instance in mesh instances
+     */
+    u32 instanceStart = 0;
+
+    /**
+     * Padding
+     */
+    u32 padding = 0;
+  };
+
+  /**
+   * @brief Mesh instance data for culling
+   */
+  struct CullInstanceData {
+    /**
+     * World bounding sphere
+     */
+    glm::vec4 boundingSphere;
 
     /**
-     * @brief Ids of mesh entities
+     * Batch index
      */
-    std::vector<Entity> entities;
+    glm::uvec4 batch;
   };
 
   /**
-   * @brief Skinned mesh data
+   * @brief Culling statistics
+   *
+   * Visible instances are counted
+   * by culling compute shader
    */
-  struct SkinnedMeshData : public MeshData {
+  struct CullStatsData {
+    /**
+     * Number of instances
+     */
+    u32 numInstances = 0;
+
     /**
-     * @brief Skeleton bone transforms
+     * Number of instances that are
+     * visible in first culling pass
      */
-    std::unique_ptr<glm::mat4> skeletons;
+    u32 numVisibleEarly = 0;
 
     /**
-     * Last skeleton index
+     * Number of instances that become
+     * visible in second culling pass
      */
-    usize lastSkeleton = 0;
+    u32 numVisibleLate = 0;
 
     /**
-     * Skeleton capacity
+     * Padding
      */
-    usize skeletonCapacity = 0;
+    u32 padding = 0;
   };
 
   /**
@@ -274,6 +497,9 @@ public:
 
   /**
    * @brief Update storage buffers
+   *
+   * Sorts render queue and uploads
+   * changed data
    */
   void updateBuffers();
 
@@ -287,23 +513,84 @@ public:
   }
 
   /**
-   * @brief Get mesh groups
+   * @brief Get mesh draw batches
+   *
+   * @return Mesh draw batches
+   */
+  inline const std::vector<RenderQueue::Batch> &getMeshBatches() const {
+    return mRenderQueue.getBatches(RenderQueue::Pipeline::Mesh);
+  }
+
+  /**
+   * @brief Get skinned mesh draw batches
+   *
+   * @return Skinned mesh draw batches
+   */
+  inline const std::vector<RenderQueue::Batch> &getSkinnedMeshBatches() const {
+    return mRenderQueue.getBatches(RenderQueue::Pipeline::SkinnedMesh);
+  }
+
+  /**
+   * @brief Get mesh batches for culling
+   *
+   * Indexed by mesh batch index
+   *
+   * @return Mesh batches for culling
+   */
+  inline const std::vector<CullBatchData> &getCullBatches() const {
+    return mCullBatches;
+  }
+
+  /**
+   * @brief Get number of mesh instances for culling
+   *
+   * @return Number of mesh instances for culling
+   */
+  inline u32 getNumCullInstances() const {
+    return static_cast<u32>(mCullInstances.size());
+  }
+
+  /**
+   * @brief Get skinning jobs
+   *
+   * Jobs are indexed by skinned
+   * mesh draw instance index
+   *
+   * @return Skinning jobs
+   */
+  inline const std::vector<SkinningJob> &getSkinningJobs() const {
+    return mSkinningJobs;
+  }
+
+  /**
+   * @brief Get largest number of vertices in skinning jobs
+   *
+   * @return Largest number of vertices in skinning jobs
+   */
+  inline u32 getMaxSkinningJobVertices() const {
+    return mMaxSkinningJobVertices;
+  }
+
+  /**
+   * @brief Get mesh entities
+   *
+   * Entities are in draw instance order
    *
-   * @return Mesh groups
+   * @return Mesh entities
    */
-  inline const std::unordered_map<MeshAssetHandle, MeshData> &
-  getMeshGroups() const {
-    return mMeshGroups;
+  inline const std::vector<Entity> &getMeshEntities() const {
+    return mRenderQueue.getEntities(RenderQueue::Pipeline::Mesh);
   }
 
   /**
-   * @brief Get skinned mesh groups
+   * @brief Get skinned mesh entities
+   *
+   * Entities are in draw instance order
    *
-   * @return Skinned mesh groups
+   * @return Skinned mesh entities
    */
-  inline const std::unordered_map<MeshAssetHandle, SkinnedMeshData> &
-  getSkinnedMeshGroups() const {
-    return mSkinnedMeshGroups;
+  inline const std::vector<Entity> &getSkinnedMeshEntities() const {
+    return mRenderQueue.getEntities(RenderQueue::Pipeline::SkinnedMesh);
   }
 
   /**
@@ -345,6 +632,18 @@ public:
    */
   inline const usize getNumShadowMaps() const { return mShadowMaps.size(); }
 
+  /**
+   * @brief Get static shadow casters hash
+   *
+   * Cached static shadow maps are valid
+   * as long as the hash does not change
+   *
+   * @return Static shadow casters hash
+   */
+  inline u64 getStaticShadowCastersHash() const {
+    return mStaticShadowCastersHash;
+  }
+
   /**
    * @brief Set default material
    *
@@ -356,27 +655,37 @@ public:
    * @brief Add mesh data
    *
    * @param handle Mesh handle
+   * @param mesh Mesh
    * @param entity Entity
    * @param transform Mesh world transform
    * @param materials Materials
+   * @param dynamic Mesh is a dynamic shadow caster
    */
-  void addMesh(MeshAssetHandle handle, quoll::Entity entity,
-               const glm::mat4 &transform,
-               const std::vector<rhi::DeviceAddress> &materials);
+  void addMesh(MeshAssetHandle handle, const MeshAsset &mesh,
+               quoll::Entity entity, const glm::mat4 &transform,
+               std::span<const rhi::DeviceAddress> materials, bool dynamic);
 
   /**
    * @brief Add skinned mesh data
    *
+   * Skinned meshes are dynamic shadow casters.
+   * Joints are stored in a shared joints
+   * buffer with an offset per skeleton.
+   * Skinned meshes that do not fit into
+   * skinned vertex cache or joints buffer
+   * are not rendered and a warning is logged
+   *
    * @param handle Skinned mesh handle
+   * @param mesh Skinned mesh
    * @param entity Entity
    * @param transform Skinned mesh world transform
    * @param skeleton Skeleton joint transforms
    * @param materials Materials
    */
-  void addSkinnedMesh(MeshAssetHandle handle, Entity entity,
-                      const glm::mat4 &transform,
+  void addSkinnedMesh(MeshAssetHandle handle, const MeshAsset &mesh,
+                      Entity entity, const glm::mat4 &transform,
                       const std::vector<glm::mat4> &skeleton,
-                      const std::vector<rhi::DeviceAddress> &materials);
+                      std::span<const rhi::DeviceAddress> materials);
 
   /**
    * @brief Set BRDF lookup table
@@ -428,7 +737,7 @@ public:
    * @param transform Text world transform
    */
   void addText(Entity entity, rhi::TextureHandle fontTexture,
-               const std::vector<GlyphData> &glyphs,
+               std::span<const GlyphData> glyphs,
                const glm::mat4 &transform);
 
   /**
@@ -464,6 +773,9 @@ public:
   /**
    * @brief Set camera data
    *
+   * Updates light cluster grid
+   * from camera projection
+   *
    * @param camera Camera data
    * @param lens Camera lens data
    */
@@ -549,6 +861,17 @@ public:
     return mMeshMaterialsBuffer.getAddress();
   }
 
+  /**
+   * @brief Get mesh instances buffer
+   *
+   * Maps draw instance index to mesh slot
+   *
+   * @return Mesh instances buffer
+   */
+  inline rhi::DeviceAddress getMeshInstancesBuffer() const {
+    return mMeshInstancesBuffer.getAddress();
+  }
+
   /**
    * @brief Get skinned mesh transforms buffer
    *
@@ -567,6 +890,41 @@ public:
     return mSkinnedMeshMaterialsBuffer.getAddress();
   }
 
+  /**
+   * @brief Get skinned mesh instances buffer
+   *
+   * Maps draw instance index to skinned mesh slot
+   *
+   * @return Skinned mesh instances buffer
+   */
+  inline rhi::DeviceAddress getSkinnedMeshInstancesBuffer() const {
+    return mSkinnedMeshInstancesBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get mesh shadow caster masks buffer
+   *
+   * Maps draw instance index to shadow maps
+   * that the mesh is visible in
+   *
+   * @return Mesh shadow caster masks buffer
+   */
+  inline rhi::DeviceAddress getMeshShadowCasterMasksBuffer() const {
+    return mMeshShadowCasterMasksBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get skinned mesh shadow caster masks buffer
+   *
+   * Maps draw instance index to shadow maps
+   * that the skinned mesh is visible in
+   *
+   * @return Skinned mesh shadow caster masks buffer
+   */
+  inline rhi::DeviceAddress getSkinnedMeshShadowCasterMasksBuffer() const {
+    return mSkinnedMeshShadowCasterMasksBuffer.getAddress();
+  }
+
   /**
    * @brief Get text transforms buffer
    *
@@ -577,12 +935,52 @@ public:
   }
 
   /**
-   * @brief Get skeletons buffer
+   * @brief Get joints buffer
    *
-   * @return Skeletons buffer
+   * @return Joints buffer
    */
-  inline rhi::DeviceAddress getSkeletonsBuffer() const {
-    return mSkeletonsBuffer.getAddress();
+  inline rhi::DeviceAddress getJointsBuffer() const {
+    return mJointsBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get skinning jobs buffer
+   *
+   * @return Skinning jobs buffer
+   */
+  inline rhi::DeviceAddress getSkinningJobsBuffer() const {
+    return mSkinningJobsBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get skinned vertex cache
+   *
+   * @return Skinned vertex cache
+   */
+  inline rhi::DeviceAddress getSkinnedVerticesBuffer() const {
+    return mSkinnedVerticesBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get skinned vertex cache handle
+   *
+   * @return Skinned vertex cache handle
+   */
+  inline rhi::BufferHandle getSkinnedVerticesBufferHandle() const {
+    return mSkinnedVerticesBuffer.getHandle();
+  }
+
+  /**
+   * @brief Get skinned vertex binding offsets
+   *
+   * @param vertexOffset First vertex in skinned vertex cache
+   * @return Position, normal, and tangent binding offsets
+   */
+  static constexpr std::array<u64, 3>
+  getSkinnedVertexOffsets(u32 vertexOffset) {
+    return {vertexOffset * sizeof(glm::vec3),
+            SkinnedNormalsOffset + vertexOffset * sizeof(glm::vec3),
+            SkinnedTangentsOffset + vertexOffset * sizeof(glm::vec4)};
   }
 
   /**
@@ -621,6 +1019,138 @@ public:
     return mPointLightsBuffer.getAddress();
   }
 
+  /**
+   * @brief Get light cluster data buffer
+   *
+   * @return Light cluster data buffer
+   */
+  inline rhi::DeviceAddress getLightClusterDataBuffer() const {
+    return mLightClusterDataBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get light clusters buffer
+   *
+   * Every cluster stores number of lights
+   * followed by indices of point lights
+   *
+   * @return Light clusters buffer
+   */
+  inline rhi::DeviceAddress getLightClustersBuffer() const {
+    return mLightClustersBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get light clusters buffer handle
+   *
+   * @return Light clusters buffer handle
+   */
+  inline rhi::BufferHandle getLightClustersBufferHandle() const {
+    return mLightClustersBuffer.getHandle();
+  }
+
+  /**
+   * @brief Get mesh instances for culling buffer
+   *
+   * @return Mesh instances for culling buffer
+   */
+  inline rhi::DeviceAddress getCullInstancesBuffer() const {
+    return mCullInstancesBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get mesh batches for culling buffer
+   *
+   * @return Mesh batches for culling buffer
+   */
+  inline rhi::DeviceAddress getCullBatchesBuffer() const {
+    return mCullBatchesBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get culling visibility buffer
+   *
+   * Stores whether mesh instance is
+   * drawn after first culling pass
+   *
+   * @return Culling visibility buffer
+   */
+  inline rhi::DeviceAddress getCullVisibilityBuffer() const {
+    return mCullVisibilityBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get culling visibility buffer handle
+   *
+   * @return Culling visibility buffer handle
+   */
+  inline rhi::BufferHandle getCullVisibilityBufferHandle() const {
+    return mCullVisibilityBuffer.getHandle();
+  }
+
+  /**
+   * @brief Get culling statistics buffer
+   *
+   * @return Culling statistics buffer
+   */
+  inline rhi::DeviceAddress getCullStatsBuffer() const {
+    return mCullStatsBuffer.getAddress();
+  }
+
+  /**
+   * @brief Get culling statistics buffer handle
+   *
+   * @return Culling statistics buffer handle
+   */
+  inline rhi::BufferHandle getCullStatsBufferHandle() const {
+    return mCullStatsBuffer.getHandle();
+  }
+
+  /**
+   * @brief Get mesh draw commands buffer
+   *
+   * @param late Draw commands of second culling pass
+   * @return Mesh draw commands buffer
+   */
+  inline rhi::DeviceAddress getMeshDrawCommandsBuffer(bool late) const {
+    return mMeshDrawCommandsBuffers.at(late ? 1 : 0).getAddress();
+  }
+
+  /**
+   * @brief Get mesh draw commands buffer handle
+   *
+   * @param late Draw commands of second culling pass
+   * @return Mesh draw commands buffer handle
+   */
+  inline rhi::BufferHandle getMeshDrawCommandsBufferHandle(bool late) const {
+    return mMeshDrawCommandsBuffers.at(late ? 1 : 0).getHandle();
+  }
+
+  /**
+   * @brief Get visible mesh instances buffer
+   *
+   * Maps draw instance index of
+   * visible mesh instances to
+   * persistent instance slot
+   *
+   * @param late Visible instances of second culling pass
+   * @return Visible mesh instances buffer
+   */
+  inline rhi::DeviceAddress getVisibleMeshInstancesBuffer(bool late) const {
+    return mVisibleMeshInstancesBuffers.at(late ? 1 : 0).getAddress();
+  }
+
+  /**
+   * @brief Get visible mesh instances buffer handle
+   *
+   * @param late Visible instances of second culling pass
+   * @return Visible mesh instances buffer handle
+   */
+  inline rhi::BufferHandle
+  getVisibleMeshInstancesBufferHandle(bool late) const {
+    return mVisibleMeshInstancesBuffers.at(late ? 1 : 0).getHandle();
+  }
+
   /**
    * @brief Get shadow maps buffer
    *
@@ -649,6 +1179,209 @@ public:
   }
 
 private:
+  /**
+   * @brief Persistent instance data
+   *
+   * Stores copies of data that is written
+   * to instance slots in device buffers
+   */
+  struct InstanceData {
+    /**
+     * Instance slots
+     */
+    RenderInstanceSlots slots;
+
+    /**
+     * Slot transforms
+     */
+    std::vector<glm::mat4> transforms;
+
+    /**
+     * Slot materials
+     */
+    std::vector<std::vector<rhi::DeviceAddress>> materials;
+
+    /**
+     * Slot material ranges
+     */
+    std::vector<MaterialRange> materialRanges;
+
+    /**
+     * Slot is written to device buffers
+     */
+    std::vector<bool> written;
+
+    /**
+     * Slots with changed transforms
+     */
+    std::vector<u32> dirtyTransforms;
+
+    /**
+     * Slots with changed material ranges
+     */
+    std::vector<u32> dirtyMaterialRanges;
+
+    /**
+     * Slot world bounding spheres
+     */
+    std::vector<glm::vec4> boundingSpheres;
+  };
+
+private:
+  /**
+   * @brief Update instance data
+   *
+   * @param data Instance data
+   * @param entity Entity
+   * @param transform World transform
+   * @param materials Materials
+   * @param[out] isNew Slot is newly allocated
+   * @return Instance slot
+   */
+  u32 updateInstance(InstanceData &data, Entity entity,
+                     const glm::mat4 &transform,
+                     std::span<const rhi::DeviceAddress> materials,
+                     bool &isNew);
+
+  /**
+   * @brief Write materials to flat materials
+   *
+   * Reuses existing range if new
+   * materials fit into it
+   *
+   * @param materials Materials
+   * @param range Existing range
+   * @param capacity Number of materials in existing range
+   * @return Material range
+   */
+  MaterialRange writeMaterials(std::span<const rhi::DeviceAddress> materials,
+                               MaterialRange range, usize capacity);
+
+  /**
+   * @brief Compact flat materials
+   *
+   * Rewrites materials of all used
+   * slots without gaps
+   */
+  void compactMaterials();
+
+  /**
+   * @brief Write skeleton to joints
+   *
+   * Reuses existing joints of the slot
+   * if new skeleton fits into them
+   *
+   * @param slot Skinned mesh slot
+   * @param skeleton Skeleton joint transforms
+   * @param isNew Slot is newly allocated
+   * @retval true Joints are written
+   * @retval false Joints do not fit into joints buffer
+   */
+  bool writeJoints(u32 slot, const std::vector<glm::mat4> &skeleton,
+                   bool isNew);
+
+  /**
+   * @brief Compact joints
+   *
+   * Rewrites joints of all used
+   * skinned mesh slots without gaps
+   */
+  void compactJoints();
+
+  /**
+   * @brief Create skinning jobs
+   *
+   * Creates a job for every skinned mesh
+   * draw instance and allocates its
+   * vertices in skinned vertex cache
+   */
+  void uploadSkinningJobs();
+
+  /**
+   * @brief Release slots of removed instances
+   *
+   * @param data Instance data
+   */
+  void releaseUnusedInstances(InstanceData &data);
+
+  /**
+   * @brief Upload changed instance data
+   *
+   * @param data Instance data
+   * @param transformsBuffer Transforms buffer
+   * @param materialRangesBuffer Material ranges buffer
+   * @return Number of uploaded bytes
+   */
+  usize uploadInstances(InstanceData &data, rhi::Buffer &transformsBuffer,
+                        rhi::Buffer &materialRangesBuffer);
+
+  /**
+   * @brief Add mesh to render queue
+   *
+   * @param pipeline Render queue pipeline
+   * @param handle Mesh handle
+   * @param slot Instance slot
+   * @param entity Entity
+   * @param transform World transform
+   * @param materials Materials
+   * @param dynamic Mesh is a dynamic shadow caster
+   */
+  void enqueue(RenderQueue::Pipeline pipeline, MeshAssetHandle handle,
+               u32 slot, Entity entity, const glm::mat4 &transform,
+               std::span<const rhi::DeviceAddress> materials, bool dynamic);
+
+  /**
+   * @brief Upload sorted instance slots
+   *
+   * @param instances Sorted instance slots
+   * @param buffer Instances buffer
+   */
+  void uploadInstanceSlots(const std::vector<u32> &instances,
+                           rhi::Buffer &buffer);
+
+  /**
+   * @brief Upload mesh culling data
+   *
+   * Reads back culling statistics of the
+   * previous use of frame data and creates
+   * a draw command for every geometry of
+   * mesh batches. Instance counts of draw
+   * commands are written by culling passes
+   */
+  void uploadCullingData();
+
+  /**
+   * @brief Hash static shadow casters
+   *
+   * Hash changes when shadow maps or any
+   * static shadow caster changes
+   *
+   * @return Static shadow casters hash
+   */
+  u64 hashStaticShadowCasters() const;
+
+  /**
+   * @brief Get shadow maps that sphere is visible in
+   *
+   * @param sphere World bounding sphere
+   * @return Shadow map bit mask
+   */
+  u32 getShadowCasterMask(const glm::vec4 &sphere) const;
+
+  /**
+   * @brief Upload shadow caster masks
+   *
+   * Masks are stored in draw order
+   *
+   * @param data Instance data
+   * @param instances Sorted instance slots
+   * @param buffer Shadow caster masks buffer
+   * @param cull Cull instances using bounding spheres
+   */
+  void uploadShadowCasterMasks(const InstanceData &data,
+                               const std::vector<u32> &instances,
+                               rhi::Buffer &buffer, bool cull);
+
   /**
    * @brief Add cascaded shadow maps
    *
@@ -663,26 +1396,59 @@ private:
   std::vector<PointLightData> mPointLights;
   std::vector<ShadowMapData> mShadowMaps;
   SceneData mSceneData{};
+  LightClusterData mLightClusterData{};
   SkyboxData mSkyboxData{};
   Camera mCameraData;
   PerspectiveLens mCameraLens;
 
-  usize mLastSkeleton = 0;
-
   std::vector<rhi::DeviceAddress> mFlatMaterials;
+  usize mDirtyMaterialsStart = 0;
+  usize mDirtyMaterialsEnd = 0;
   rhi::Buffer mFlatMaterialsBuffer;
 
+  InstanceData mMeshInstances;
+  InstanceData mSkinnedMeshInstances;
+  std::vector<glm::mat4> mJoints;
+  usize mDirtyJointsStart = 0;
+  usize mDirtyJointsEnd = 0;
+  std::vector<u32> mJointCapacities;
+  std::vector<SkinningJob> mSkinnedMeshSources;
+  std::vector<SkinningJob> mSkinningJobs;
+  u32 mMaxSkinningJobVertices = 0;
+  u32 mNumSkinnedVertices = 0;
+
   rhi::Buffer mMeshTransformsBuffer;
   rhi::Buffer mSkinnedMeshTransformsBuffer;
-  rhi::Buffer mSkeletonsBuffer;
+  rhi::Buffer mJointsBuffer;
+  rhi::Buffer mSkinningJobsBuffer;
+  rhi::Buffer mSkinnedVerticesBuffer;
   rhi::Buffer mMeshMaterialsBuffer;
   rhi::Buffer mSkinnedMeshMaterialsBuffer;
-  std::unordered_map<MeshAssetHandle, MeshData> mMeshGroups;
-  std::unordered_map<MeshAssetHandle, SkinnedMeshData> mSkinnedMeshGroups;
+  rhi::Buffer mMeshInstancesBuffer;
+  rhi::Buffer mSkinnedMeshInstancesBuffer;
+  rhi::Buffer mMeshShadowCasterMasksBuffer;
+  rhi::Buffer mSkinnedMeshShadowCasterMasksBuffer;
+  std::vector<u32> mShadowCasterMasks;
+  u64 mStaticShadowCastersHash = 0;
+  RenderQueue mRenderQueue;
+
+  std::unordered_map<MeshAssetHandle, std::vector<IndexedDrawCommand>>
+      mMeshGeometries;
+  std::vector<IndexedDrawCommand> mMeshDrawCommands;
+  std::vector<CullBatchData> mCullBatches;
+  std::vector<CullInstanceData> mCullInstances;
+  rhi::Buffer mCullInstancesBuffer;
+  rhi::Buffer mCullBatchesBuffer;
+  rhi::Buffer mCullVisibilityBuffer;
+  rhi::Buffer mCullStatsBuffer;
+  std::array<rhi::Buffer, 2> mMeshDrawCommandsBuffers;
+  std::array<rhi::Buffer, 2> mVisibleMeshInstancesBuffers;
 
   rhi::Buffer mSceneBuffer;
   rhi::Buffer mDirectionalLightsBuffer;
   rhi::Buffer mPointLightsBuffer;
+  rhi::Buffer mLightClusterDataBuffer;
+  rhi::Buffer mLightClustersBuffer;
   rhi::Buffer mShadowMapsBuffer;
   rhi::Buffer mCameraBuffer;
   rhi::Buffer mSkyboxBuffer;
@@ -704,6 +1470,7 @@ private:
   usize mReservedSpace = 0;
 
   BindlessDrawParameters mBindlessParams;
+  rhi::RenderDevice *mDevice = nullptr;
 };
 
 } // namespace quoll
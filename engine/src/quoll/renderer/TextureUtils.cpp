@@ -3,37 +3,20 @@
 
 namespace quoll {
 
-void TextureUtils::copyDataToTexture(
+u64 TextureUtils::copyDataToTexture(
     rhi::RenderDevice *device, void *source, rhi::TextureHandle destination,
     rhi::ImageLayout destinationLayout, u32 destinationLayers,
     const std::vector<TextureAssetLevel> &destinationLevels) {
-
-  rhi::BufferDescription stagingBufferDesc{};
-  stagingBufferDesc.size = getBufferSizeFromLevels(destinationLevels);
-  stagingBufferDesc.data = source;
-  stagingBufferDesc.usage = rhi::BufferUsage::TransferSource;
-
-  auto stagingBuffer = device->createBuffer(stagingBufferDesc);
-
-  auto commandList = device->requestImmediateCommandList();
-
-  rhi::ImageBarrier barrier{};
-  barrier.baseLevel = 0;
-  barrier.levelCount = static_cast<u32>(destinationLevels.size());
-  barrier.srcAccess = rhi::Access::None;
-  barrier.dstAccess = rhi::Access::TransferWrite;
-  barrier.srcLayout = rhi::ImageLayout::Undefined;
-  barrier.dstLayout = rhi::ImageLayout::TransferDestinationOptimal;
-  barrier.srcStage = rhi::PipelineStage::None;
-  barrier.dstStage = rhi::PipelineStage::Transfer;
-  barrier.texture = destination;
-
-  std::array<rhi::ImageBarrier, 1> preBarriers{barrier};
-  commandList.pipelineBarrier({}, preBarriers, {});
-
-  std::vector<rhi::CopyRegion> copies(destinationLevels.size());
-  for (usize i = 0; i < copies.size(); ++i) {
-    auto &copy = copies.at(i);
+  rhi::TextureUploadDescription upload{};
+  upload.texture = destination;
+  upload.data = source;
+  upload.size = getBufferSizeFromLevels(destinationLevels);
+  upload.levelCount = static_cast<u32>(destinationLevels.size());
+  upload.layout = destinationLayout;
+
+  upload.regions.resize(destinationLevels.size());
+  for (usize i = 0; i < upload.regions.size(); ++i) {
+    auto &copy = upload.regions.at(i);
     auto &dstLevel = destinationLevels.at(i);
 
     copy.bufferOffset = static_cast<u32>(dstLevel.offset);
@@ -44,21 +27,7 @@ void TextureUtils::copyDataToTexture(
     copy.imageLevel = static_cast<u32>(i);
   }
 
-  commandList.copyBufferToTexture(stagingBuffer.getHandle(), destination,
-                                  copies);
-
-  barrier.srcLayout = rhi::ImageLayout::TransferDestinationOptimal;
-  barrier.dstLayout = destinationLayout;
-  barrier.srcAccess = rhi::Access::TransferWrite;
-  barrier.dstAccess = rhi::Access::None;
-  barrier.srcStage = rhi::PipelineStage::Transfer;
-  barrier.dstStage = rhi::PipelineStage::AllCommands;
-  std::array<rhi::ImageBarrier, 1> postBarriers{barrier};
-  commandList.pipelineBarrier({}, postBarriers, {});
-
-  device->submitImmediate(commandList);
-
-  device->destroyBuffer(stagingBuffer.getHandle());
+  return device->uploadTexture(upload);
 }
 
 void TextureUtils::copyTextureToData(
@@ -16,14 +16,19 @@ public:
   /**
    * @brief Copy data to texture
    *
+   * Copy is added to the device upload batch
+   * and is not waited for. Returned value can
+   * be polled with `isUploadComplete`.
+   *
    * @param device Render device
    * @param source Source data
    * @param destination Destination texture
    * @param destinationLayout Destination texture layout
    * @param destinationLayers Destination texture layers
    * @param destinationLevels Destination texture levels
+   * @return Upload value
    */
-  static void
+  static u64
   copyDataToTexture(rhi::RenderDevice *device, void *source,
                     rhi::TextureHandle destination,
                     rhi::ImageLayout destinationLayout, u32 destinationLayers,
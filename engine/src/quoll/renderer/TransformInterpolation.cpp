@@ -0,0 +1,47 @@
+#include "quoll/core/Base.h"
+#include "TransformInterpolation.h"
+
+namespace quoll {
+
+glm::mat4 TransformInterpolation::interpolate(const glm::mat4 &previous,
+                                              const glm::mat4 &current,
+                                              f32 alpha) {
+  if (alpha >= 1.0f) {
+    return current;
+  }
+
+  glm::vec3 previousScale;
+  glm::quat previousRotation;
+  glm::vec3 previousPosition;
+  glm::vec3 currentScale;
+  glm::quat currentRotation;
+  glm::vec3 currentPosition;
+  glm::vec3 skew;
+  glm::vec4 perspective;
+
+  if (!glm::decompose(previous, previousScale, previousRotation,
+                      previousPosition, skew, perspective) ||
+      !glm::decompose(current, currentScale, currentRotation, currentPosition,
+                      skew, perspective)) {
+    return current;
+  }
+
+  glm::mat4 identity{1.0f};
+  return glm::translate(identity,
+                        glm::mix(previousPosition, currentPosition, alpha)) *
+         glm::toMat4(glm::slerp(previousRotation, currentRotation, alpha)) *
+         glm::scale(identity, glm::mix(previousScale, currentScale, alpha));
+}
+
+Camera TransformInterpolation::interpolateCamera(const Camera &camera,
+                                                 const glm::mat4 &previous,
+                                                 const glm::mat4 &current,
+                                                 f32 alpha) {
+  Camera blended = camera;
+  blended.viewMatrix = glm::inverse(interpolate(previous, current, alpha));
+  blended.projectionViewMatrix =
+      blended.projectionMatrix * blended.viewMatrix;
+  return blended;
+}
+
+} // namespace quoll
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "quoll/scene/Camera.h"
+
+namespace quoll {
+
+/**
+ * @brief Transform interpolation
+ *
+ * Blends states of the last two updates
+ * to render frames between updates
+ */
+class TransformInterpolation {
+public:
+  /**
+   * @brief Blend two world transforms
+   *
+   * Translation and scale are blended linearly
+   * and rotation is blended spherically; so,
+   * blended transform does not shear
+   *
+   * @param previous Previous world transform
+   * @param current Current world transform
+   * @param alpha Interpolation factor
+   * @return Blended world transform
+   */
+  static glm::mat4 interpolate(const glm::mat4 &previous,
+                               const glm::mat4 &current, f32 alpha);
+
+  /**
+   * @brief Blend camera between two world transforms
+   *
+   * View matrix is created from blended world
+   * transform. Projection matrix is not blended
+   *
+   * @param camera Camera
+   * @param previous Previous camera world transform
+   * @param current Current camera world transform
+   * @param alpha Interpolation factor
+   * @return Blended camera
+   */
+  static Camera interpolateCamera(const Camera &camera,
+                                  const glm::mat4 &previous,
+                                  const glm::mat4 &current, f32 alpha);
+};
+
+} // namespace quoll
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace quoll {
+
+/**
+ * @brief Previous world transform component
+ *
+ * World transform of the previous simulation
+ * step. Renderer blends previous and current
+ * world transforms to render frames that fall
+ * between simulation steps.
+ */
+struct PreviousWorldTransform {
+  /**
+   * World transform matrix
+   */
+  glm::mat4 worldTransform{1.0f};
+};
+
+} // namespace quoll
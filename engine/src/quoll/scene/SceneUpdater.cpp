@@ -1,6 +1,12 @@
 #include "quoll/core/Base.h"
+#include "quoll/core/FrameAllocator.h"
 #include "quoll/scene/LocalTransform.h"
 #include "quoll/scene/WorldTransform.h"
+#include "quoll/scene/PreviousWorldTransform.h"
+#include "quoll/scene/Mesh.h"
+#include "quoll/scene/SkinnedMesh.h"
+#include "quoll/scene/Sprite.h"
+#include "quoll/text/Text.h"
 #include "quoll/scene/Parent.h"
 #include "quoll/scene/Skeleton.h"
 #include "quoll/scene/JointAttachment.h"
@@ -15,30 +21,88 @@ namespace quoll {
 void SceneUpdater::update(EntityDatabase &entityDatabase) {
   QUOLL_PROFILE_EVENT("SceneUpdater::update");
   updateTransforms(entityDatabase);
+  addPreviousTransforms(entityDatabase);
   updateCameras(entityDatabase);
   updateLights(entityDatabase);
 }
 
+void SceneUpdater::enableTransformInterpolation() {
+  mTransformInterpolationEnabled = true;
+}
+
+void SceneUpdater::storePreviousTransforms(EntityDatabase &entityDatabase) {
+  QUOLL_PROFILE_EVENT("SceneUpdater::storePreviousTransforms");
+
+  for (auto [entity, world, previous] :
+       entityDatabase.view<const WorldTransform, PreviousWorldTransform>()) {
+    previous.worldTransform = world.worldTransform;
+  }
+}
+
+void SceneUpdater::addPreviousTransforms(EntityDatabase &entityDatabase) {
+  QUOLL_PROFILE_EVENT("SceneUpdater::addPreviousTransforms");
+
+  if (!mTransformInterpolationEnabled) {
+    return;
+  }
+
+  // Components are added after iteration
+  // because adding them modifies the views
+  FrameVector<Entity> entities;
+  auto collect = [&entities](auto &&view) {
+    for (auto [entity, world, component] : view) {
+      entities.push_back(entity);
+    }
+  };
+
+  collect(entityDatabase.view<const WorldTransform, const Mesh>(
+      exclude<PreviousWorldTransform>));
+  collect(entityDatabase.view<const WorldTransform, const SkinnedMesh>(
+      exclude<PreviousWorldTransform>));
+  collect(entityDatabase.view<const WorldTransform, const Sprite>(
+      exclude<PreviousWorldTransform>));
+  collect(entityDatabase.view<const WorldTransform, const Text>(
+      exclude<PreviousWorldTransform>));
+  collect(entityDatabase.view<const WorldTransform, const Camera>(
+      exclude<PreviousWorldTransform>));
+
+  for (auto entity : entities) {
+    if (!entityDatabase.has<PreviousWorldTransform>(entity)) {
+      entityDatabase.set<PreviousWorldTransform>(
+          entity, {entityDatabase.get<WorldTransform>(entity).worldTransform});
+    }
+  }
+}
+
 void SceneUpdater::updateTransforms(EntityDatabase &entityDatabase) {
   QUOLL_PROFILE_EVENT("SceneUpdater::updateTransforms");
 
-  for (auto [entity, local, world] :
-       entityDatabase.view<LocalTransform, WorldTransform>()) {
-    // TODO: Add exclusive loop
-    if (entityDatabase.has<Parent>(entity))
-      continue;
+  // World transforms are only written when they change
+  // so that unchanged entities are not marked as updated
+  const auto &database = entityDatabase;
+  auto setWorldTransform = [&entityDatabase](Entity entity,
+                                             const WorldTransform &world,
+                                             const glm::mat4 &transform) {
+    if (world.worldTransform != transform) {
+      entityDatabase.get<WorldTransform>(entity).worldTransform = transform;
+    }
+  };
 
+  for (auto [entity, local, world] :
+       entityDatabase.group<const LocalTransform, const WorldTransform>(
+           exclude<Parent>)) {
     glm::mat4 identity{1.0f};
     glm::mat4 localTransform = glm::translate(identity, local.localPosition) *
                                glm::toMat4(local.localRotation) *
                                glm::scale(identity, local.localScale);
 
-    world.worldTransform = localTransform;
+    setWorldTransform(entity, world, localTransform);
   }
 
   for (auto [entity, local, world, parent] :
-       entityDatabase.view<LocalTransform, WorldTransform, Parent>()) {
-    auto &parentTransform = entityDatabase.get<WorldTransform>(parent.parent);
+       entityDatabase
+           .view<const LocalTransform, const WorldTransform, const Parent>()) {
+    const auto &parentTransform = database.get<WorldTransform>(parent.parent);
 
     glm::mat4 identity{1.0f};
     glm::mat4 localTransform = glm::translate(identity, local.localPosition) *
@@ -46,20 +110,22 @@ void SceneUpdater::updateTransforms(EntityDatabase &entityDatabase) {
                                glm::scale(identity, local.localScale);
 
     i16 jointId = -1;
-    if (entityDatabase.has<JointAttachment>(entity) &&
-        entityDatabase.has<Skeleton>(parent.parent)) {
-      jointId = entityDatabase.get<JointAttachment>(entity).joint;
+    if (database.has<JointAttachment>(entity) &&
+        database.has<Skeleton>(parent.parent)) {
+      jointId = database.get<JointAttachment>(entity).joint;
     }
 
-    if (jointId >= 0 && static_cast<usize>(jointId) <
-                            entityDatabase.get<Skeleton>(parent.parent)
-                                .jointWorldTransforms.size()) {
-      const auto &jointTransform = entityDatabase.get<Skeleton>(parent.parent)
+    if (jointId >= 0 &&
+        static_cast<usize>(jointId) <
+            database.get<Skeleton>(parent.parent).jointWorldTransforms.size()) {
+      const auto &jointTransform = database.get<Skeleton>(parent.parent)
                                        .jointWorldTransforms.at(jointId);
-      world.worldTransform =
-          parentTransform.worldTransform * jointTransform * localTransform;
+      setWorldTransform(entity, world,
+                        parentTransform.worldTransform * jointTransform *
+                            localTransform);
     } else {
-      world.worldTransform = parentTransform.worldTransform * localTransform;
+      setWorldTransform(entity, world,
+                        parentTransform.worldTransform * localTransform);
     }
   }
 }
@@ -68,7 +134,8 @@ void SceneUpdater::updateCameras(EntityDatabase &entityDatabase) {
   QUOLL_PROFILE_EVENT("SceneUpdater::updateCameras");
 
   for (auto [entity, lens, world, camera] :
-       entityDatabase.view<PerspectiveLens, WorldTransform, Camera>()) {
+       entityDatabase
+           .view<const PerspectiveLens, const WorldTransform, Camera>()) {
 
     const f32 fovY =
         2.0f * atanf(lens.sensorSize.y / (2.0f * lens.focalLength));
@@ -89,7 +156,7 @@ void SceneUpdater::updateLights(EntityDatabase &entityDatabase) {
   QUOLL_PROFILE_EVENT("SceneUpdater::updateLights");
 
   for (auto [entity, world, light] :
-       entityDatabase.view<WorldTransform, DirectionalLight>()) {
+       entityDatabase.view<const WorldTransform, DirectionalLight>()) {
     glm::quat rotation;
     glm::vec3 empty3;
     glm::vec4 empty4;
@@ -17,7 +17,39 @@ public:
    */
   void update(EntityDatabase &entityDatabase);
 
+  /**
+   * @brief Store world transforms of previous update
+   *
+   * Must be called at the start of an update
+   * before any system changes world transforms
+   * (e.g. physics writes simulated poses)
+   *
+   * @param entityDatabase Entity database
+   */
+  void storePreviousTransforms(EntityDatabase &entityDatabase);
+
+  /**
+   * @brief Keep previous world transforms of renderables
+   *
+   * Meshes, skinned meshes, sprites, texts, and
+   * cameras get previous world transforms, which
+   * renderer uses to interpolate between updates
+   */
+  void enableTransformInterpolation();
+
 private:
+  /**
+   * @brief Add previous world transforms to renderables
+   *
+   * Previous world transform is set to the
+   * computed world transform; so, new
+   * renderables are not interpolated from
+   * their initial world transform
+   *
+   * @param entityDatabase Entity database
+   */
+  void addPreviousTransforms(EntityDatabase &entityDatabase);
+
   /**
    * @brief Update all transforms
    *
@@ -38,6 +70,9 @@ private:
    * @param entityDatabase Entity database
    */
   void updateLights(EntityDatabase &entityDatabase);
+
+private:
+  bool mTransformInterpolationEnabled = false;
 };
 
 } // namespace quoll
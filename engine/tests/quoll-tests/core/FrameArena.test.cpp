@@ -0,0 +1,101 @@
+#include "quoll/core/Base.h"
+#include "quoll/core/FrameAllocator.h"
+
+#include "quoll-tests/Testing.h"
+
+class FrameArenaTest : public ::testing::Test {
+public:
+  quoll::FrameArena arena{256};
+};
+
+using FrameArenaDeathTest = FrameArenaTest;
+
+TEST_F(FrameArenaTest, AllocatesAlignedMemory) {
+  arena.allocate(1, 1);
+  auto *data = arena.allocate(sizeof(u64), alignof(u64));
+
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data) % alignof(u64), 0);
+}
+
+TEST_F(FrameArenaDeathTest, AllocationFailsIfAlignmentIsNotPowerOfTwo) {
+  EXPECT_DEATH(arena.allocate(4, 3), ".*");
+}
+
+TEST_F(FrameArenaTest, AllocatesConsecutiveMemoryInOneBlock) {
+  auto *first = static_cast<std::byte *>(arena.allocate(16, 16));
+  auto *second = static_cast<std::byte *>(arena.allocate(16, 16));
+
+  EXPECT_EQ(second, first + 16);
+  EXPECT_EQ(arena.getBlocksCount(), 1);
+}
+
+TEST_F(FrameArenaTest, CountsAllocationsOfFrame) {
+  arena.allocate(16, 4);
+  arena.allocate(32, 4);
+
+  EXPECT_EQ(arena.getStats().allocationsCount, 2);
+  EXPECT_EQ(arena.getStats().allocatedSize, 48);
+}
+
+TEST_F(FrameArenaTest, AddsBlockIfCurrentBlockIsFull) {
+  arena.allocate(200, 4);
+  arena.allocate(200, 4);
+
+  EXPECT_EQ(arena.getBlocksCount(), 2);
+  EXPECT_EQ(arena.getCapacity(), 512);
+}
+
+TEST_F(FrameArenaTest, AddsBlockThatFitsAllocationsLargerThanBlockSize) {
+  arena.allocate(1024, 8);
+
+  EXPECT_EQ(arena.getBlocksCount(), 2);
+  EXPECT_GE(arena.getCapacity(), 256 + 1024);
+}
+
+TEST_F(FrameArenaTest, ResetReusesMemoryAndStoresLastFrameStats) {
+  auto *first = arena.allocate(16, 4);
+  arena.allocate(16, 4);
+  arena.reset();
+
+  EXPECT_EQ(arena.getStats().allocationsCount, 0);
+  EXPECT_EQ(arena.getLastFrameStats().allocationsCount, 2);
+  EXPECT_EQ(arena.getLastFrameStats().allocatedSize, 32);
+  EXPECT_EQ(arena.allocate(16, 4), first);
+}
+
+TEST_F(FrameArenaTest, ResetMergesBlocksIntoOneBlock) {
+  arena.allocate(200, 4);
+  arena.allocate(200, 4);
+  arena.reset();
+
+  EXPECT_EQ(arena.getBlocksCount(), 1);
+  EXPECT_EQ(arena.getCapacity(), 512);
+
+  arena.allocate(200, 4);
+  arena.allocate(200, 4);
+  EXPECT_EQ(arena.getBlocksCount(), 1);
+}
+
+TEST_F(FrameArenaTest, FrameVectorAllocatesFromArena) {
+  quoll::FrameVector<u32> values{quoll::FrameAllocator<u32>(arena)};
+  values.reserve(8);
+  for (u32 i = 0; i < 8; ++i) {
+    values.push_back(i);
+  }
+
+  EXPECT_EQ(values.size(), 8);
+  EXPECT_EQ(values.at(7), 7);
+  EXPECT_EQ(arena.getStats().allocationsCount, 1);
+  EXPECT_EQ(arena.getStats().allocatedSize, 8 * sizeof(u32));
+}
+
+TEST_F(FrameArenaTest, DefaultFrameAllocatorUsesArenaOfCurrentThread) {
+  quoll::FrameAllocator<u32> allocator;
+  EXPECT_EQ(allocator.getArena(), &quoll::FrameArena::get());
+
+  quoll::FrameArena *otherArena = nullptr;
+  std::thread thread([&otherArena] { otherArena = &quoll::FrameArena::get(); });
+  thread.join();
+
+  EXPECT_NE(otherArena, &quoll::FrameArena::get());
+}
@@ -0,0 +1,46 @@
+#include "quoll/core/Base.h"
+#include "quoll/core/ThreadPool.h"
+
+#include "quoll-tests/Testing.h"
+
+class ThreadPoolTest : public ::testing::Test {
+public:
+  quoll::ThreadPool threadPool{4};
+};
+
+TEST_F(ThreadPoolTest, CreatesRequestedNumberOfThreads) {
+  EXPECT_EQ(threadPool.getNumThreads(), 4);
+}
+
+TEST_F(ThreadPoolTest, WaitBlocksUntilAllTasksAreFinished) {
+  static constexpr u32 NumTasks = 100;
+  std::atomic<u32> counter = 0;
+
+  for (u32 i = 0; i < NumTasks; ++i) {
+    threadPool.push([&counter](u32) { counter++; });
+  }
+
+  threadPool.wait();
+  EXPECT_EQ(counter.load(), NumTasks);
+}
+
+TEST_F(ThreadPoolTest, PassesWorkerThreadIndexToTasks) {
+  static constexpr u32 NumTasks = 32;
+  std::array<u32, NumTasks> threadIndices{};
+
+  for (u32 i = 0; i < NumTasks; ++i) {
+    threadPool.push([&threadIndices, i](u32 threadIndex) {
+      threadIndices.at(i) = threadIndex;
+    });
+  }
+
+  threadPool.wait();
+  for (auto threadIndex : threadIndices) {
+    EXPECT_LT(threadIndex, threadPool.getNumThreads());
+  }
+}
+
+TEST_F(ThreadPoolTest, WaitReturnsImmediatelyIfThereAreNoTasks) {
+  threadPool.wait();
+  SUCCEED();
+}
@@ -242,7 +242,10 @@ TEST(EntityStorageSparseSetTest, UseRecyclesEntity) {
   auto recycledEntity = storage.create();
   EXPECT_EQ(storage.getEntityCount(), 3);
   EXPECT_TRUE(storage.exists(recycledEntity));
-  EXPECT_EQ(recycledEntity, e2);
+  EXPECT_NE(recycledEntity, e2);
+  EXPECT_EQ(quoll::getEntityIndex(recycledEntity), quoll::getEntityIndex(e2));
+  EXPECT_EQ(quoll::getEntityGeneration(recycledEntity),
+            quoll::getEntityGeneration(e2) + 1);
   EXPECT_FALSE(storage.has<IntComponent>(recycledEntity));
   EXPECT_FALSE(storage.has<FloatComponent>(recycledEntity));
 
@@ -253,6 +256,89 @@ TEST(EntityStorageSparseSetTest, UseRecyclesEntity) {
   EXPECT_EQ(storage.get<IntComponent>(recycledEntity).value, 6);
 }
 
+TEST(EntityStorageSparseSetTest, StaleEntityDoesNotAliasRecycledEntity) {
+  TestEntityStorage<IntComponent> storage;
+  auto e1 = storage.create();
+  storage.set<IntComponent>(e1, {5});
+  storage.deleteEntity(e1);
+
+  auto e2 = storage.create();
+  storage.set<IntComponent>(e2, {10});
+
+  EXPECT_EQ(quoll::getEntityIndex(e1), quoll::getEntityIndex(e2));
+  EXPECT_FALSE(storage.exists(e1));
+  EXPECT_FALSE(storage.has<IntComponent>(e1));
+  EXPECT_TRUE(storage.exists(e2));
+  EXPECT_TRUE(storage.has<IntComponent>(e2));
+
+  // Deleting stale entity does not affect recycled entity
+  storage.deleteEntity(e1);
+  EXPECT_TRUE(storage.exists(e2));
+  EXPECT_EQ(storage.getEntityCount(), 1);
+  EXPECT_EQ(storage.get<IntComponent>(e2).value, 10);
+}
+
+TEST(EntityStorageSparseSetTest, RetiresSlotWhenGenerationIsExhausted) {
+  TestEntityStorage<IntComponent> storage;
+  auto first = storage.create();
+
+  auto entity = first;
+  for (u32 i = 0; i < quoll::EntityGenerationMask; ++i) {
+    storage.deleteEntity(entity);
+    entity = storage.create();
+    EXPECT_EQ(quoll::getEntityIndex(entity), quoll::getEntityIndex(first));
+  }
+
+  EXPECT_EQ(quoll::getEntityGeneration(entity), quoll::EntityGenerationMask);
+  storage.deleteEntity(entity);
+  EXPECT_FALSE(storage.exists(entity));
+
+  auto next = storage.create();
+  EXPECT_NE(quoll::getEntityIndex(next), quoll::getEntityIndex(first));
+  EXPECT_FALSE(storage.exists(first));
+  EXPECT_FALSE(storage.has<IntComponent>(first));
+  EXPECT_EQ(storage.getEntityCount(), 1);
+
+  // Deleting retired entity again does nothing
+  storage.deleteEntity(entity);
+  EXPECT_EQ(storage.getEntityCount(), 1);
+}
+
+TEST(EntityStorageSparseSetTest,
+     ReturnsNullEntityWhenMaximumNumberOfEntitiesIsReached) {
+  TestEntityStorage<IntComponent> storage;
+
+  // Index zero is reserved for null entity
+  quoll::Entity last = quoll::Entity::Null;
+  for (u32 i = 0; i < quoll::EntityIndexMask; ++i) {
+    last = storage.create();
+  }
+  EXPECT_EQ(quoll::getEntityIndex(last), quoll::EntityIndexMask);
+
+  EXPECT_EQ(storage.create(), quoll::Entity::Null);
+  EXPECT_EQ(storage.getEntityCount(), quoll::EntityIndexMask);
+  EXPECT_TRUE(storage.exists(last));
+
+  // Deleted slots can still be reused
+  storage.deleteEntity(last);
+  auto entity = storage.create();
+  EXPECT_EQ(quoll::getEntityIndex(entity), quoll::EntityIndexMask);
+  EXPECT_EQ(storage.getEntityCount(), quoll::EntityIndexMask);
+}
+
+TEST(EntityStorageSparseSetTest, DeletingEntityTwiceDoesNotRecycleItTwice) {
+  TestEntityStorage<IntComponent> storage;
+  auto e1 = storage.create();
+  storage.deleteEntity(e1);
+  storage.deleteEntity(e1);
+  EXPECT_EQ(storage.getEntityCount(), 0);
+
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  EXPECT_NE(quoll::getEntityIndex(e2), quoll::getEntityIndex(e3));
+  EXPECT_EQ(storage.getEntityCount(), 2);
+}
+
 TEST(EntityStorageSparseSetTest, DoesNotDeleteNonExistentEntity) {
   TestEntityStorage<IntComponent, FloatComponent> storage;
   storage.deleteEntity(quoll::Entity::Null);
@@ -362,6 +448,256 @@ TEST(EntityStorageSparseSetTest, IterateEntities) {
   }
 }
 
+TEST(EntityStorageSparseSetTest, ViewSkipsEntitiesWithExcludedComponents) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<IntComponent>(e2, {20});
+  storage.set<FloatComponent>(e2, {20.0f});
+  storage.set<IntComponent>(e3, {30});
+  storage.set<StringComponent>(e3, {"Entity 3"});
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, val] : storage.view<IntComponent>(
+           quoll::exclude<FloatComponent, StringComponent>)) {
+    EXPECT_EQ(storage.get<IntComponent>(entity).value, val.value);
+    entities.push_back(entity);
+  }
+
+  EXPECT_EQ(entities, std::vector<quoll::Entity>{e1});
+
+  entities.clear();
+  for (auto [entity, val] :
+       storage.view<IntComponent>(quoll::exclude<StringComponent>)) {
+    entities.push_back(entity);
+  }
+
+  EXPECT_EQ(entities, std::vector({e1, e2}));
+}
+
+TEST(EntityStorageSparseSetTest, GroupPacksExistingEntitiesOnCreation) {
+  TestEntityStorage<IntComponent, FloatComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<IntComponent>(e2, {20});
+  storage.set<FloatComponent>(e3, {30.0f});
+  storage.set<IntComponent>(e3, {30});
+  storage.set<FloatComponent>(e2, {20.0f});
+
+  auto group = storage.group<IntComponent, FloatComponent>();
+  EXPECT_EQ(group.size(), 2);
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, intVal, floatVal] : group) {
+    EXPECT_EQ(storage.get<IntComponent>(entity).value, intVal.value);
+    EXPECT_EQ(storage.get<FloatComponent>(entity).value, floatVal.value);
+    entities.push_back(entity);
+  }
+
+  std::sort(entities.begin(), entities.end());
+  EXPECT_EQ(entities, std::vector({e2, e3}));
+}
+
+TEST(EntityStorageSparseSetTest,
+     GroupsWithSameComponentsInDifferentOrderShareGroup) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  auto e1 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<FloatComponent>(e1, {10.0f});
+  storage.set<StringComponent>(e1, {"e1"});
+
+  storage.group<IntComponent, FloatComponent>();
+  storage.group<StringComponent>(
+      quoll::include<IntComponent, FloatComponent>);
+
+  auto group = storage.group<FloatComponent, IntComponent>();
+  EXPECT_EQ(group.size(), 1);
+  for (auto [entity, floatVal, intVal] : group) {
+    EXPECT_EQ(entity, e1);
+    EXPECT_EQ(floatVal.value, 10.0f);
+    EXPECT_EQ(intVal.value, 10);
+  }
+
+  auto included = storage.group<StringComponent>(
+      quoll::include<FloatComponent, IntComponent>);
+  EXPECT_EQ(included.size(), 1);
+}
+
+TEST(EntityStorageSparseSetTest, GroupTracksAddedAndRemovedComponents) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  storage.group<IntComponent, FloatComponent>();
+
+  std::vector<quoll::Entity> entities;
+  for (usize i = 0; i < 10; ++i) {
+    auto entity = storage.create();
+    storage.set<IntComponent>(entity, {static_cast<int>(i)});
+    if (i % 2 == 0) {
+      storage.set<FloatComponent>(entity, {static_cast<f32>(i)});
+    }
+    entities.push_back(entity);
+  }
+
+  auto group = storage.group<IntComponent, FloatComponent>();
+  EXPECT_EQ(group.size(), 5);
+
+  storage.remove<FloatComponent>(entities.at(0));
+  storage.remove<IntComponent>(entities.at(2));
+  storage.deleteEntity(entities.at(4));
+  storage.set<FloatComponent>(entities.at(1), {1.0f});
+
+  // Updating existing component does not change the group
+  storage.set<IntComponent>(entities.at(6), {60});
+
+  std::vector<quoll::Entity> expected{entities.at(1), entities.at(6),
+                                      entities.at(8)};
+  std::vector<quoll::Entity> actual;
+  for (auto [entity, intVal, floatVal] :
+       storage.group<IntComponent, FloatComponent>()) {
+    EXPECT_EQ(storage.get<IntComponent>(entity).value, intVal.value);
+    EXPECT_EQ(storage.get<FloatComponent>(entity).value, floatVal.value);
+    actual.push_back(entity);
+  }
+
+  std::sort(actual.begin(), actual.end());
+  EXPECT_EQ(actual, expected);
+
+  storage.destroyComponents<FloatComponent>();
+  group = storage.group<IntComponent, FloatComponent>();
+  EXPECT_EQ(group.size(), 0);
+}
+
+TEST(EntityStorageSparseSetTest,
+     GroupAllowsSettingComponentsThatDoNotChangeGroupDuringIteration) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  std::vector<quoll::Entity> entities;
+  for (usize i = 0; i < 4; ++i) {
+    auto entity = storage.create();
+    storage.set<IntComponent>(entity, {static_cast<int>(i)});
+    storage.set<FloatComponent>(entity, {static_cast<f32>(i)});
+    entities.push_back(entity);
+  }
+
+  auto outside = storage.create();
+
+  std::vector<quoll::Entity> visited;
+  for (auto [entity, intVal, floatVal] :
+       storage.group<IntComponent, FloatComponent>()) {
+    // Updating existing and unrelated components
+    storage.set<IntComponent>(entity, {intVal.value + 10});
+    storage.set<StringComponent>(entity, {"visited"});
+
+    // Entity does not enter the group
+    storage.set<IntComponent>(outside, {100});
+
+    visited.push_back(entity);
+  }
+
+  std::sort(visited.begin(), visited.end());
+  EXPECT_EQ(visited, entities);
+
+  for (usize i = 0; i < entities.size(); ++i) {
+    EXPECT_EQ(storage.get<IntComponent>(entities.at(i)).value,
+              static_cast<int>(i) + 10);
+  }
+}
+
+TEST(EntityStorageSparseSetDeathTest,
+     GroupAssertsIfEntityEntersGroupDuringIteration) {
+  TestEntityStorage<IntComponent, FloatComponent> storage;
+  auto e1 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<FloatComponent>(e1, {10.0f});
+
+  auto e2 = storage.create();
+  storage.set<IntComponent>(e2, {20});
+
+  EXPECT_DEATH(
+      {
+        for (auto [entity, intVal, floatVal] :
+             storage.group<IntComponent, FloatComponent>()) {
+          storage.set<FloatComponent>(e2, {20.0f});
+        }
+      },
+      ".*");
+}
+
+TEST(EntityStorageSparseSetDeathTest,
+     GroupAssertsIfEntityLeavesGroupDuringIteration) {
+  TestEntityStorage<IntComponent, FloatComponent> storage;
+  for (usize i = 0; i < 2; ++i) {
+    auto entity = storage.create();
+    storage.set<IntComponent>(entity, {static_cast<int>(i)});
+    storage.set<FloatComponent>(entity, {static_cast<f32>(i)});
+  }
+
+  EXPECT_DEATH(
+      {
+        for (auto [entity, intVal, floatVal] :
+             storage.group<IntComponent, FloatComponent>()) {
+          storage.deleteEntity(entity);
+        }
+      },
+      ".*");
+}
+
+TEST(EntityStorageSparseSetTest, GroupWithIncludedComponents) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  storage.group<IntComponent>(quoll::include<FloatComponent>);
+
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<IntComponent>(e2, {20});
+  storage.set<FloatComponent>(e2, {20.0f});
+  storage.set<FloatComponent>(e3, {30.0f});
+  storage.set<IntComponent>(e3, {30});
+
+  storage.remove<FloatComponent>(e3);
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, intVal, floatVal] :
+       storage.group<IntComponent>(quoll::include<FloatComponent>)) {
+    EXPECT_EQ(intVal.value, 20);
+    EXPECT_EQ(floatVal.value, 20.0f);
+    entities.push_back(entity);
+  }
+
+  EXPECT_EQ(entities, std::vector({e2}));
+}
+
+TEST(EntityStorageSparseSetTest, GroupSkipsEntitiesWithExcludedComponents) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<FloatComponent>(e1, {10.0f});
+  storage.set<IntComponent>(e2, {20});
+  storage.set<FloatComponent>(e2, {20.0f});
+  storage.set<StringComponent>(e1, {"Entity 1"});
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, intVal, floatVal] :
+       storage.group<IntComponent, FloatComponent>(
+           quoll::exclude<StringComponent>)) {
+    entities.push_back(entity);
+  }
+
+  EXPECT_EQ(entities, std::vector({e2}));
+}
+
+TEST(EntityStorageSparseSetDeathTest,
+     GroupThrowsErrorIfComponentIsOwnedByAnotherGroup) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  storage.group<IntComponent, FloatComponent>();
+
+  EXPECT_DEATH({ (storage.group<StringComponent, FloatComponent>()); }, ".*");
+}
+
 TEST(EntityStorageSparseSetTest, DestroysOneComponent) {
   TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
   auto e1 = storage.create(); // 0
@@ -437,7 +773,7 @@ TEST(EntityStorageSparseSetTest, DeletesOnlyNeededComponents) {
 
   // This entity is going to fill up the space of old one
   auto newE1 = storage.create();
-  EXPECT_EQ(e1, newE1);
+  EXPECT_EQ(quoll::getEntityIndex(e1), quoll::getEntityIndex(newE1));
 
   // Set component for the entity
   storage.set<StringComponent>(newE1, {"Hello World"});
@@ -681,3 +1017,186 @@ TEST(EntityStorageSparseSetTest, ClearingObserverClearsAllExistingData) {
     }
   }
 }
+
+TEST(EntityStorageSparseSetTest, AddObserverIteratesOverAddedComponents) {
+  TestEntityStorage<IntComponent, StringComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+
+  auto observer = storage.observeAdd<IntComponent>();
+  EXPECT_TRUE(observer.empty());
+
+  storage.set<IntComponent>(e2, {20});
+  storage.set<IntComponent>(e3, {30});
+  storage.set<IntComponent>(e1, {15});
+  storage.set<StringComponent>(e1, {"e1"});
+  storage.remove<IntComponent>(e2);
+
+  EXPECT_FALSE(observer.empty());
+  EXPECT_EQ(observer.size(), 1);
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, component] : observer) {
+    EXPECT_EQ(component.value, 30);
+    entities.push_back(entity);
+  }
+  EXPECT_EQ(entities, std::vector({e3}));
+
+  observer.clear();
+  EXPECT_TRUE(observer.empty());
+  EXPECT_EQ(observer.size(), 0);
+}
+
+TEST(EntityStorageSparseSetTest, UpdateObserverIteratesOverUpdatedComponents) {
+  TestEntityStorage<IntComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  auto e4 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<IntComponent>(e2, {20});
+  storage.set<IntComponent>(e3, {30});
+
+  auto observer = storage.observeUpdate<IntComponent>();
+  EXPECT_TRUE(observer.empty());
+
+  storage.set<IntComponent>(e1, {15});
+  storage.patch<IntComponent>(e3, [](auto &component) { component.value = 35; });
+  storage.set<IntComponent>(e4, {40});
+
+  // Reading components through const reference
+  // does not mark them as updated
+  const auto &constStorage = storage;
+  EXPECT_EQ(constStorage.get<IntComponent>(e2).value, 20);
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, component] : observer) {
+    EXPECT_EQ(component.value, storage.get<IntComponent>(entity).value);
+    entities.push_back(entity);
+  }
+
+  std::sort(entities.begin(), entities.end());
+  EXPECT_EQ(entities, std::vector({e1, e3, e4}));
+
+  observer.clear();
+  EXPECT_TRUE(observer.empty());
+
+  storage.get<IntComponent>(e2).value = 25;
+  EXPECT_EQ(observer.size(), 1);
+  for (auto [entity, component] : observer) {
+    EXPECT_EQ(entity, e2);
+    EXPECT_EQ(component.value, 25);
+  }
+}
+
+TEST(EntityStorageSparseSetTest, ChangeObserversFollowComponentsWhenPoolIsReordered) {
+  TestEntityStorage<IntComponent, FloatComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  auto e3 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<IntComponent>(e2, {20});
+  storage.set<IntComponent>(e3, {30});
+
+  auto observer = storage.observeUpdate<IntComponent>();
+  storage.patch<IntComponent>(e3, [](auto &component) { component.value = 35; });
+
+  // Moves last component into the place of removed one
+  storage.remove<IntComponent>(e1);
+
+  // Packs group components at the start of the pool
+  storage.set<FloatComponent>(e2, {20.0f});
+  storage.group<IntComponent, FloatComponent>();
+
+  std::vector<quoll::Entity> entities;
+  for (auto [entity, component] : observer) {
+    EXPECT_EQ(component.value, 35);
+    entities.push_back(entity);
+  }
+
+  EXPECT_EQ(entities, std::vector({e3}));
+}
+
+TEST(EntityStorageSparseSetTest,
+     UpdateObserverVisitsComponentsAccessedThroughViewsAndGroups) {
+  TestEntityStorage<IntComponent, FloatComponent, StringComponent> storage;
+  auto e1 = storage.create();
+  auto e2 = storage.create();
+  storage.set<IntComponent>(e1, {10});
+  storage.set<FloatComponent>(e1, {10.0f});
+  storage.set<StringComponent>(e1, {"e1"});
+  storage.set<IntComponent>(e2, {20});
+
+  auto intObserver = storage.observeUpdate<IntComponent>();
+  auto floatObserver = storage.observeUpdate<FloatComponent>();
+  auto stringObserver = storage.observeUpdate<StringComponent>();
+
+  // Constant components are only read
+  for (auto [entity, value] : storage.view<const IntComponent>()) {
+    EXPECT_GT(value.value, 0);
+  }
+  for (auto [entity, value, string] :
+       storage.group<const FloatComponent>(
+           quoll::EntityStorageSparseSetInclude<const StringComponent>{})) {
+    EXPECT_EQ(string.value, "e1");
+  }
+
+  EXPECT_TRUE(intObserver.empty());
+  EXPECT_TRUE(floatObserver.empty());
+  EXPECT_TRUE(stringObserver.empty());
+
+  for (auto [entity, value, floatValue] :
+       storage.view<IntComponent, const FloatComponent>()) {
+    value.value = static_cast<i32>(floatValue.value) + 1;
+  }
+  for (auto [entity, value, string] :
+       storage.group<FloatComponent>(
+           quoll::EntityStorageSparseSetInclude<StringComponent>{})) {
+    value.value = 15.0f;
+  }
+
+  EXPECT_EQ(intObserver.size(), 1);
+  for (auto [entity, component] : intObserver) {
+    EXPECT_EQ(entity, e1);
+    EXPECT_EQ(component.value, 11);
+  }
+
+  EXPECT_EQ(floatObserver.size(), 1);
+  EXPECT_EQ(stringObserver.size(), 1);
+}
+
+TEST(EntityStorageSparseSetTest, UpdateObserverSkipsUnchangedChunks) {
+  TestEntityStorage<IntComponent> storage;
+
+  std::vector<quoll::Entity> entities(1000);
+  for (usize i = 0; i < entities.size(); ++i) {
+    entities.at(i) = storage.create();
+    storage.set<IntComponent>(entities.at(i), {static_cast<i32>(i)});
+  }
+
+  auto observer = storage.observeUpdate<IntComponent>();
+  storage.get<IntComponent>(entities.at(3)).value = -3;
+  storage.get<IntComponent>(entities.at(700)).value = -700;
+
+  // Moves last component into the first chunk
+  storage.get<IntComponent>(entities.at(999)).value = -999;
+  storage.remove<IntComponent>(entities.at(1));
+
+  std::vector<quoll::Entity> visited;
+  for (auto [entity, component] : observer) {
+    auto index = std::find(entities.begin(), entities.end(), entity) -
+                 entities.begin();
+    EXPECT_EQ(component.value, -static_cast<i32>(index));
+    visited.push_back(entity);
+  }
+
+  EXPECT_EQ(observer.size(), 3);
+  EXPECT_EQ(visited, std::vector({entities.at(999), entities.at(3),
+                                  entities.at(700)}));
+
+  observer.clear();
+  EXPECT_TRUE(observer.empty());
+  EXPECT_EQ(observer.size(), 0);
+}
@@ -0,0 +1,69 @@
+#include "quoll/core/Base.h"
+#include "quoll/loop/FramePipeline.h"
+
+#include "quoll-tests/Testing.h"
+
+class FramePipelineTest : public ::testing::TestWithParam<bool> {
+public:
+  FramePipelineTest() {
+    pipeline.setPrepareFn([this](f32, u32 slot) {
+      preparedSlots.push_back(slot);
+      preparedSlot = slot;
+    });
+
+    pipeline.setRenderFn([this](u32 slot) {
+      renderedSlots.push_back(slot);
+      renderedWithPreparedSlot =
+          renderedWithPreparedSlot && slot == preparedSlot;
+
+      // Second frame is skipped; e.g swapchain is recreated
+      return renderedSlots.size() != 2;
+    });
+
+    pipeline.setSubmitFn(
+        [this](u32 slot) { submittedSlots.push_back(slot); });
+
+    if (GetParam()) {
+      pipeline.enableRenderThread();
+    }
+  }
+
+  void runFrames(u32 numFrames) {
+    pipeline.start();
+    for (u32 i = 0; i < numFrames; ++i) {
+      pipeline.frame(0.0f);
+    }
+    pipeline.stop();
+  }
+
+public:
+  quoll::FramePipeline pipeline{2};
+
+  std::vector<u32> preparedSlots;
+  std::vector<u32> renderedSlots;
+  std::vector<u32> submittedSlots;
+  u32 preparedSlot = 0;
+  bool renderedWithPreparedSlot = true;
+};
+
+TEST_P(FramePipelineTest, RendersEveryPreparedFrame) {
+  runFrames(5);
+
+  EXPECT_EQ(preparedSlots.size(), 5);
+  EXPECT_EQ(renderedSlots.size(), 5);
+  EXPECT_TRUE(renderedWithPreparedSlot);
+}
+
+TEST_P(FramePipelineTest, DoesNotAdvanceSlotWhenFrameIsSkipped) {
+  runFrames(5);
+
+  EXPECT_EQ(preparedSlots, (std::vector<u32>{0, 1, 1, 0, 1}));
+  EXPECT_EQ(submittedSlots, (std::vector<u32>{0, 1, 0, 1}));
+  EXPECT_EQ(pipeline.getSlot(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(FramePipeline, FramePipelineTest,
+                         ::testing::Values(false, true),
+                         [](const auto &info) {
+                           return info.param ? "RenderThread" : "SingleThread";
+                         });
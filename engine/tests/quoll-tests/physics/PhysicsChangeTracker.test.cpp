@@ -0,0 +1,143 @@
+#include "quoll/core/Base.h"
+#include "quoll/physics/PhysicsChangeTracker.h"
+
+#include "quoll-tests/Testing.h"
+
+class PhysicsChangeTrackerTest : public ::testing::Test {
+public:
+  quoll::Entity createCollidable() {
+    auto entity = entityDatabase.create();
+    entityDatabase.set<quoll::Collidable>(entity, {});
+    entityDatabase.set<quoll::WorldTransform>(entity, {});
+    return entity;
+  }
+
+  quoll::Entity createRigidBody() {
+    auto entity = createCollidable();
+    entityDatabase.set<quoll::RigidBody>(entity, {});
+    return entity;
+  }
+
+  quoll::EntityDatabase entityDatabase;
+  quoll::PhysicsChangeTracker tracker;
+};
+
+TEST_F(PhysicsChangeTrackerTest, CollectsAllEntitiesIfChangesAreNotObserved) {
+  auto e1 = createCollidable();
+  auto e2 = createRigidBody();
+
+  tracker.collect(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  EXPECT_EQ(tracker.getCollidables(), std::vector<quoll::Entity>({e1, e2}));
+  EXPECT_EQ(tracker.getRigidBodies(), std::vector<quoll::Entity>({e2}));
+}
+
+TEST_F(PhysicsChangeTrackerTest,
+       CollectsAllEntitiesOnFirstCollectionAfterObservingChanges) {
+  auto e1 = createCollidable();
+  auto e2 = createRigidBody();
+
+  tracker.observeChanges(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  EXPECT_EQ(tracker.getCollidables(), std::vector<quoll::Entity>({e1, e2}));
+  EXPECT_EQ(tracker.getRigidBodies(), std::vector<quoll::Entity>({e2}));
+}
+
+TEST_F(PhysicsChangeTrackerTest, CollectsNothingIfNothingChanged) {
+  createCollidable();
+  createRigidBody();
+
+  tracker.observeChanges(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  // Reading components does not mark them as changed
+  for (auto [entity, rigidBody, world] :
+       entityDatabase
+           .view<const quoll::RigidBody, const quoll::WorldTransform>()) {
+    EXPECT_EQ(rigidBody.dynamicDesc.mass, 1.0f);
+  }
+
+  tracker.collect(entityDatabase);
+
+  EXPECT_TRUE(tracker.getCollidables().empty());
+  EXPECT_TRUE(tracker.getRigidBodies().empty());
+}
+
+TEST_F(PhysicsChangeTrackerTest, CollectsOnlyEntitiesWhoseComponentsChanged) {
+  std::vector<quoll::Entity> entities;
+  for (usize i = 0; i < 10; ++i) {
+    entities.push_back(createRigidBody());
+  }
+
+  tracker.observeChanges(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  entityDatabase.get<quoll::WorldTransform>(entities.at(2)).worldTransform =
+      glm::mat4{2.0f};
+  entityDatabase.get<quoll::Collidable>(entities.at(5)).useInQueries = false;
+  entityDatabase.get<quoll::RigidBody>(entities.at(7)).dynamicDesc.mass = 5.0f;
+
+  tracker.collect(entityDatabase);
+
+  std::vector<quoll::Entity> expected{entities.at(2), entities.at(5),
+                                      entities.at(7)};
+  EXPECT_EQ(tracker.getCollidables(), expected);
+  EXPECT_EQ(tracker.getRigidBodies(), expected);
+
+  tracker.collect(entityDatabase);
+  EXPECT_TRUE(tracker.getCollidables().empty());
+  EXPECT_TRUE(tracker.getRigidBodies().empty());
+}
+
+TEST_F(PhysicsChangeTrackerTest,
+       CollectsEntityOnceIfMultipleComponentsChanged) {
+  auto entity = createRigidBody();
+
+  tracker.observeChanges(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  entityDatabase.get<quoll::WorldTransform>(entity).worldTransform =
+      glm::mat4{2.0f};
+  entityDatabase.get<quoll::Collidable>(entity).useInQueries = false;
+  entityDatabase.get<quoll::RigidBody>(entity).dynamicDesc.mass = 5.0f;
+
+  tracker.collect(entityDatabase);
+
+  EXPECT_EQ(tracker.getCollidables(), std::vector<quoll::Entity>({entity}));
+  EXPECT_EQ(tracker.getRigidBodies(), std::vector<quoll::Entity>({entity}));
+}
+
+TEST_F(PhysicsChangeTrackerTest,
+       DoesNotCollectChangedEntitiesWithoutWorldTransform) {
+  auto entity = createRigidBody();
+
+  tracker.observeChanges(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  entityDatabase.remove<quoll::WorldTransform>(entity);
+  entityDatabase.get<quoll::RigidBody>(entity).dynamicDesc.mass = 5.0f;
+
+  tracker.collect(entityDatabase);
+
+  EXPECT_TRUE(tracker.getCollidables().empty());
+  EXPECT_TRUE(tracker.getRigidBodies().empty());
+}
+
+TEST_F(PhysicsChangeTrackerTest, CollectsAllEntitiesIfFullSyncIsRequested) {
+  auto e1 = createCollidable();
+  auto e2 = createRigidBody();
+
+  tracker.observeChanges(entityDatabase);
+  tracker.collect(entityDatabase);
+
+  tracker.requestFullSync();
+  tracker.collect(entityDatabase);
+
+  EXPECT_EQ(tracker.getCollidables(), std::vector<quoll::Entity>({e1, e2}));
+  EXPECT_EQ(tracker.getRigidBodies(), std::vector<quoll::Entity>({e2}));
+
+  tracker.collect(entityDatabase);
+  EXPECT_TRUE(tracker.getCollidables().empty());
+}
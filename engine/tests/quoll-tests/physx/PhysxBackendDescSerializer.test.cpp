@@ -0,0 +1,65 @@
+#include "quoll/core/Base.h"
+#include "quoll/physx/PhysxBackendDescSerializer.h"
+
+#include "quoll-tests/Testing.h"
+
+using PhysxBackendDescSerializerTest = ::testing::Test;
+
+TEST_F(PhysxBackendDescSerializerTest, SerializesPhysxBackendDesc) {
+  quoll::PhysxBackendDesc desc{};
+  desc.numThreads = 3;
+  desc.enableVisualDebugger = true;
+  desc.visualDebuggerHost = "10.0.0.1";
+  desc.visualDebuggerPort = 1234;
+
+  auto node = quoll::PhysxBackendDescSerializer::serialize(desc);
+
+  EXPECT_EQ(node["threads"].as<u32>(), 3);
+  EXPECT_TRUE(node["visualDebugger"]["enabled"].as<bool>());
+  EXPECT_EQ(node["visualDebugger"]["host"].as<quoll::String>(), "10.0.0.1");
+  EXPECT_EQ(node["visualDebugger"]["port"].as<u32>(), 1234);
+}
+
+TEST_F(PhysxBackendDescSerializerTest, DeserializesSerializedPhysxBackendDesc) {
+  quoll::PhysxBackendDesc desc{};
+  desc.numThreads = 3;
+  desc.enableVisualDebugger = true;
+  desc.visualDebuggerHost = "10.0.0.1";
+  desc.visualDebuggerPort = 1234;
+
+  auto actual = quoll::PhysxBackendDescSerializer::deserialize(
+      quoll::PhysxBackendDescSerializer::serialize(desc));
+
+  EXPECT_EQ(actual.numThreads, 3);
+  EXPECT_TRUE(actual.enableVisualDebugger);
+  EXPECT_EQ(actual.visualDebuggerHost, "10.0.0.1");
+  EXPECT_EQ(actual.visualDebuggerPort, 1234);
+}
+
+TEST_F(PhysxBackendDescSerializerTest,
+       UsesDefaultsIfPhysxBackendDescIsMissing) {
+  quoll::PhysxBackendDesc defaults{};
+
+  auto actual = quoll::PhysxBackendDescSerializer::deserialize(YAML::Node{});
+
+  EXPECT_EQ(actual.numThreads, defaults.numThreads);
+  EXPECT_EQ(actual.enableVisualDebugger, defaults.enableVisualDebugger);
+  EXPECT_EQ(actual.visualDebuggerHost, defaults.visualDebuggerHost);
+  EXPECT_EQ(actual.visualDebuggerPort, defaults.visualDebuggerPort);
+}
+
+TEST_F(PhysxBackendDescSerializerTest, UsesDefaultsForInvalidOptions) {
+  quoll::PhysxBackendDesc defaults{};
+
+  YAML::Node node;
+  node["threads"] = "many";
+  node["visualDebugger"]["enabled"] = true;
+  node["visualDebugger"]["port"] = YAML::Node(YAML::NodeType::Sequence);
+
+  auto actual = quoll::PhysxBackendDescSerializer::deserialize(node);
+
+  EXPECT_EQ(actual.numThreads, defaults.numThreads);
+  EXPECT_TRUE(actual.enableVisualDebugger);
+  EXPECT_EQ(actual.visualDebuggerHost, defaults.visualDebuggerHost);
+  EXPECT_EQ(actual.visualDebuggerPort, defaults.visualDebuggerPort);
+}
@@ -0,0 +1,118 @@
+#include "quoll/core/Base.h"
+#include "quoll/profiler/Tracer.h"
+
+#include "quoll-tests/Testing.h"
+
+class TracerTest : public ::testing::Test {
+public:
+  void TearDown() override { quoll::Tracer::setEnabled(true); }
+
+  std::vector<quoll::TraceEvent>
+  findEvents(const quoll::TraceCapture &capture, quoll::StringView name) {
+    std::vector<quoll::TraceEvent> events;
+    for (const auto &event : capture.events) {
+      if (event.name && name == event.name) {
+        events.push_back(event);
+      }
+    }
+    return events;
+  }
+};
+
+TEST_F(TracerTest, RecordsScopedEvents) {
+  {
+    quoll::TraceScope scope("TracerTest.Scoped");
+  }
+
+  auto events = findEvents(quoll::Tracer::capture(), "TracerTest.Scoped");
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_GE(events.at(0).end, events.at(0).start);
+  EXPECT_FALSE(events.at(0).frame);
+}
+
+TEST_F(TracerTest, DoesNotRecordEventsIfDisabled) {
+  quoll::Tracer::setEnabled(false);
+  {
+    quoll::TraceScope scope("TracerTest.Disabled");
+  }
+  quoll::Tracer::markFrame("TracerTest.DisabledFrame");
+  quoll::Tracer::setEnabled(true);
+
+  auto capture = quoll::Tracer::capture();
+  EXPECT_TRUE(findEvents(capture, "TracerTest.Disabled").empty());
+  EXPECT_TRUE(findEvents(capture, "TracerTest.DisabledFrame").empty());
+}
+
+TEST_F(TracerTest, CapturesEventsOfAllThreadsWithThreadNames) {
+  std::thread thread([] {
+    quoll::Tracer::setThreadName("TracerTest thread");
+    quoll::TraceScope scope("TracerTest.Thread");
+  });
+  thread.join();
+
+  auto capture = quoll::Tracer::capture();
+  auto events = findEvents(capture, "TracerTest.Thread");
+  ASSERT_EQ(events.size(), 1);
+
+  auto it = std::find_if(
+      capture.threads.begin(), capture.threads.end(),
+      [&events](const auto &t) { return t.index == events.at(0).threadIndex; });
+  ASSERT_NE(it, capture.threads.end());
+  EXPECT_EQ(it->name, "TracerTest thread");
+}
+
+TEST_F(TracerTest, KeepsLatestEventsIfRingBufferIsFull) {
+  std::thread thread([] {
+    for (usize i = 0; i < quoll::Tracer::BufferSize + 10; ++i) {
+      quoll::Tracer::record("TracerTest.Overflow", i, i);
+    }
+    quoll::Tracer::record("TracerTest.OverflowLast", 0, 0);
+  });
+  thread.join();
+
+  auto capture = quoll::Tracer::capture();
+  auto events = findEvents(capture, "TracerTest.Overflow");
+  // Oldest slot can be dropped because
+  // it is the next slot to be overwritten
+  EXPECT_LT(events.size(), quoll::Tracer::BufferSize);
+  EXPECT_GE(events.size(), quoll::Tracer::BufferSize - 2);
+  EXPECT_EQ(findEvents(capture, "TracerTest.OverflowLast").size(), 1);
+}
+
+TEST_F(TracerTest, CapturesEventsOfLastCompleteFrames) {
+  std::thread thread([] {
+    quoll::Tracer::markFrame("TracerTest.Frame");
+    { quoll::TraceScope scope("TracerTest.FirstFrame"); }
+    quoll::Tracer::markFrame("TracerTest.Frame");
+    { quoll::TraceScope scope("TracerTest.SecondFrame"); }
+    quoll::Tracer::markFrame("TracerTest.Frame");
+    { quoll::TraceScope scope("TracerTest.IncompleteFrame"); }
+  });
+  thread.join();
+
+  auto capture = quoll::Tracer::captureFrames(1);
+  EXPECT_TRUE(findEvents(capture, "TracerTest.FirstFrame").empty());
+  EXPECT_EQ(findEvents(capture, "TracerTest.SecondFrame").size(), 1);
+  EXPECT_TRUE(findEvents(capture, "TracerTest.IncompleteFrame").empty());
+  EXPECT_EQ(findEvents(capture, "TracerTest.Frame").size(), 1);
+}
+
+TEST_F(TracerTest, WritesChromeTrace) {
+  quoll::TraceCapture capture;
+  capture.ticksPerMicrosecond = 2.0;
+  capture.threads.push_back({1, "Main \"thread\""});
+  capture.events.push_back({"Frame", 10, 10, 1, true});
+  capture.events.push_back({"Update", 12, 16, 1, false});
+
+  std::stringstream stream;
+  capture.writeChromeTrace(stream);
+
+  EXPECT_EQ(stream.str(),
+            "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["
+            "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,"
+            "\"args\":{\"name\":\"Main \\\"thread\\\"\"}},"
+            "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":0.000,"
+            "\"pid\":0,\"tid\":1},"
+            "{\"name\":\"Update\",\"ph\":\"X\",\"dur\":2.000,\"ts\":1.000,"
+            "\"pid\":0,\"tid\":1}]}");
+}
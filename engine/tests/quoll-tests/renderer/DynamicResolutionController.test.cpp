@@ -0,0 +1,71 @@
+#include "quoll/core/Base.h"
+#include "quoll/renderer/DynamicResolutionController.h"
+
+#include "quoll-tests/Testing.h"
+
+class DynamicResolutionControllerTest : public ::testing::Test {
+public:
+  quoll::DynamicResolutionController controller{{16.0f, 0.5f, 1.0f, 0.1f}};
+};
+
+TEST_F(DynamicResolutionControllerTest, StartsAtMaximumScale) {
+  EXPECT_EQ(controller.getScale(), 1.0f);
+}
+
+TEST_F(DynamicResolutionControllerTest, ClampsMaximumScaleToOne) {
+  quoll::DynamicResolutionController controller{{16.0f, 0.5f, 2.0f, 0.1f}};
+  EXPECT_EQ(controller.getScale(), 1.0f);
+  EXPECT_EQ(controller.getSettings().maxScale, 1.0f);
+}
+
+TEST_F(DynamicResolutionControllerTest, IgnoresFrameTimesThatAreNotMeasured) {
+  EXPECT_EQ(controller.update(0.0f), 1.0f);
+  EXPECT_EQ(controller.update(-1.0f), 1.0f);
+  EXPECT_EQ(controller.getAverageFrameTime(), 0.0f);
+}
+
+TEST_F(DynamicResolutionControllerTest,
+       DecreasesScaleGraduallyIfFrameTimeIsAboveTarget) {
+  f32 scale = controller.update(32.0f);
+  EXPECT_LT(scale, 1.0f);
+  EXPECT_GE(scale, 0.95f);
+
+  f32 nextScale = controller.update(32.0f);
+  EXPECT_LT(nextScale, scale);
+}
+
+TEST_F(DynamicResolutionControllerTest, DoesNotDecreaseScaleBelowMinimum) {
+  for (u32 i = 0; i < 100; ++i) {
+    controller.update(100.0f);
+  }
+
+  EXPECT_EQ(controller.getScale(), 0.5f);
+}
+
+TEST_F(DynamicResolutionControllerTest,
+       IncreasesScaleIfFrameTimeIsBelowHeadroom) {
+  for (u32 i = 0; i < 100; ++i) {
+    controller.update(100.0f);
+  }
+  EXPECT_EQ(controller.getScale(), 0.5f);
+
+  for (u32 i = 0; i < 200; ++i) {
+    controller.update(2.0f);
+  }
+
+  EXPECT_EQ(controller.getScale(), 1.0f);
+}
+
+TEST_F(DynamicResolutionControllerTest,
+       KeepsScaleIfFrameTimeIsWithinHeadroom) {
+  for (u32 i = 0; i < 100; ++i) {
+    controller.update(100.0f);
+  }
+  EXPECT_EQ(controller.getScale(), 0.5f);
+
+  for (u32 i = 0; i < 200; ++i) {
+    controller.update(15.0f);
+  }
+
+  EXPECT_EQ(controller.getScale(), 0.5f);
+}
@@ -0,0 +1,67 @@
+#include "quoll/core/Base.h"
+#include "quoll/renderer/DynamicResolutionSettingsSerializer.h"
+
+#include "quoll-tests/Testing.h"
+
+using DynamicResolutionSettingsSerializerTest = ::testing::Test;
+
+TEST_F(DynamicResolutionSettingsSerializerTest,
+       SerializesDisabledDynamicResolution) {
+  auto node =
+      quoll::DynamicResolutionSettingsSerializer::serialize(std::nullopt);
+
+  EXPECT_FALSE(node["enabled"].as<bool>());
+}
+
+TEST_F(DynamicResolutionSettingsSerializerTest,
+       DeserializesSerializedDynamicResolutionSettings) {
+  quoll::DynamicResolutionSettings settings{};
+  settings.targetFrameTime = 8.0f;
+  settings.minScale = 0.25f;
+  settings.maxScale = 0.75f;
+  settings.headroom = 0.2f;
+
+  auto actual = quoll::DynamicResolutionSettingsSerializer::deserialize(
+      quoll::DynamicResolutionSettingsSerializer::serialize(settings));
+
+  ASSERT_TRUE(actual.has_value());
+  EXPECT_EQ(actual->targetFrameTime, 8.0f);
+  EXPECT_EQ(actual->minScale, 0.25f);
+  EXPECT_EQ(actual->maxScale, 0.75f);
+  EXPECT_EQ(actual->headroom, 0.2f);
+}
+
+TEST_F(DynamicResolutionSettingsSerializerTest,
+       DisablesDynamicResolutionIfSettingsAreMissing) {
+  EXPECT_FALSE(quoll::DynamicResolutionSettingsSerializer::deserialize(
+                   YAML::Node{})
+                   .has_value());
+}
+
+TEST_F(DynamicResolutionSettingsSerializerTest,
+       DisablesDynamicResolutionIfNotExplicitlyEnabled) {
+  YAML::Node node;
+  node["targetFrameTime"] = 8.0f;
+
+  EXPECT_FALSE(
+      quoll::DynamicResolutionSettingsSerializer::deserialize(node)
+          .has_value());
+}
+
+TEST_F(DynamicResolutionSettingsSerializerTest,
+       UsesDefaultsForInvalidOptions) {
+  quoll::DynamicResolutionSettings defaults{};
+
+  YAML::Node node;
+  node["enabled"] = true;
+  node["targetFrameTime"] = "fast";
+  node["minScale"] = YAML::Node(YAML::NodeType::Sequence);
+
+  auto actual = quoll::DynamicResolutionSettingsSerializer::deserialize(node);
+
+  ASSERT_TRUE(actual.has_value());
+  EXPECT_EQ(actual->targetFrameTime, defaults.targetFrameTime);
+  EXPECT_EQ(actual->minScale, defaults.minScale);
+  EXPECT_EQ(actual->maxScale, defaults.maxScale);
+  EXPECT_EQ(actual->headroom, defaults.headroom);
+}
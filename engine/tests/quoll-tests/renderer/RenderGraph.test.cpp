@@ -2,6 +2,7 @@
 #include "quoll/rhi-mock/MockRenderDevice.h"
 
 #include "quoll/renderer/RenderGraph.h"
+#include "quoll/renderer/RenderGraphSyncDependency.h"
 
 #include "quoll-tests/Testing.h"
 
@@ -756,6 +757,7 @@ TEST_F(RenderGraphTest, SetsBufferAndTextureBarriersBetweenPasses) {
     pass.write(colorTexture, quoll::AttachmentType::Color, {});
   }
 
+  graph.markAsOutput(colorTexture);
   graph.build(storage);
 
   auto dependencies = graph.getCompiledPasses().at(1).getSyncDependencies();
@@ -1041,7 +1043,9 @@ TEST_F(RenderGraphTest, CompilationRemovesLonelyNodes) {
 
   graph.build(storage);
 
-  EXPECT_EQ(graph.getCompiledPasses().size(), 2);
+  ASSERT_EQ(graph.getCompiledPasses().size(), 2);
+  EXPECT_EQ(graph.getCompiledPasses().at(0).getName(), "A");
+  EXPECT_EQ(graph.getCompiledPasses().at(1).getName(), "E");
   EXPECT_EQ(graph.getPasses().size(), 4);
 }
 
@@ -1059,6 +1063,64 @@ TEST_F(RenderGraphTest, RecompilationRecreatesCompiledPassesList) {
   EXPECT_EQ(graph.getCompiledPasses().size(), 2);
 }
 
+TEST_F(RenderGraphTest, CompilationCullsPassesThatOutputsDoNotDependOn) {
+  auto a = createTexture({});
+  auto b = createTexture({});
+  auto output = graph.import(storage.createTexture({}));
+
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+  graph.addGraphicsPass("B").write(b, quoll::AttachmentType::Color, {});
+
+  auto &passC = graph.addGraphicsPass("C");
+  passC.read(a);
+  passC.write(output, quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  ASSERT_EQ(graph.getCompiledPasses().size(), 2);
+  EXPECT_EQ(graph.getCompiledPasses().at(0).getName(), "A");
+  EXPECT_EQ(graph.getCompiledPasses().at(1).getName(), "C");
+}
+
+TEST_F(RenderGraphTest, CompilationKeepsPassesThatWriteToMarkedOutputs) {
+  auto a = createTexture({});
+  auto b = createTexture({});
+  auto c = createTexture({});
+
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addGraphicsPass("B");
+  passB.read(a);
+  passB.write(b, quoll::AttachmentType::Color, {});
+
+  graph.addGraphicsPass("C").write(c, quoll::AttachmentType::Color, {});
+
+  graph.markAsOutput(b);
+  graph.build(storage);
+
+  ASSERT_EQ(graph.getCompiledPasses().size(), 2);
+  EXPECT_EQ(graph.getCompiledPasses().at(0).getName(), "A");
+  EXPECT_EQ(graph.getCompiledPasses().at(1).getName(), "B");
+}
+
+TEST_F(RenderGraphTest, CompilationKeepsPassesThatWriteToBuffers) {
+  auto a = createTexture({});
+  auto buffer = device.createBuffer({}).getHandle();
+
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+  graph.addComputePass("B").write(buffer, BufferUsage::Storage);
+
+  auto output = createTexture({});
+  graph.addGraphicsPass("C").write(output, quoll::AttachmentType::Color, {});
+  graph.markAsOutput(output);
+
+  graph.build(storage);
+
+  ASSERT_EQ(graph.getCompiledPasses().size(), 2);
+  EXPECT_EQ(graph.getCompiledPasses().at(0).getName(), "B");
+  EXPECT_EQ(graph.getCompiledPasses().at(1).getName(), "C");
+}
+
 TEST_F(RenderGraphDeathTest, CompilationFailsIfMultipleNodesHaveTheSameName) {
   auto handle = createTexture({});
 
@@ -1118,3 +1180,771 @@ TEST_F(RenderGraphTest, DoesNotDestroyImportedResourcesOnDestroy) {
 
   EXPECT_TRUE(device.hasTexture(texture));
 }
+
+class RenderGraphPipelineRetentionTest : public RenderGraphTest {
+public:
+  RenderGraphPipelineRetentionTest() {
+    graphicsDescription.vertexShader = ShaderHandle{25};
+    computeDescription.computeShader = ShaderHandle{26};
+  }
+
+  std::pair<PipelineHandle, PipelineHandle> buildGraph(u32 width,
+                                                       Format format) {
+    TextureDescription description{};
+    description.width = width;
+    description.height = width;
+    description.format = format;
+
+    auto graphicsPipeline = storage.addPipeline(graphicsDescription);
+    auto computePipeline = storage.addPipeline(computeDescription);
+
+    auto texture = graph.create(description);
+    auto &graphicsPass = graph.addGraphicsPass("A");
+    graphicsPass.write(texture, quoll::AttachmentType::Color, {});
+    graphicsPass.addPipeline(graphicsPipeline);
+
+    auto &computePass = graph.addComputePass("B");
+    computePass.read(texture);
+    computePass.addPipeline(computePipeline);
+
+    graph.build(storage);
+    storage.destroyRetainedPipelines();
+
+    return {graphicsPipeline, computePipeline};
+  }
+
+  GraphicsPipelineDescription graphicsDescription{};
+  ComputePipelineDescription computeDescription{};
+};
+
+TEST_F(RenderGraphPipelineRetentionTest,
+       RebuildReusesPipelinesIfRenderTargetFormatsDoNotChange) {
+  auto [graphics, compute] = buildGraph(1024, Format::Rgba8Srgb);
+  EXPECT_EQ(device.getNumCreatedPipelines(), 2);
+
+  graph.destroy(storage, true);
+  graph = quoll::RenderGraph("TestGraph");
+  auto [newGraphics, newCompute] = buildGraph(512, Format::Rgba8Srgb);
+
+  EXPECT_EQ(newGraphics, graphics);
+  EXPECT_EQ(newCompute, compute);
+  EXPECT_EQ(device.getNumCreatedPipelines(), 2);
+  EXPECT_TRUE(device.hasPipeline(graphics));
+  EXPECT_TRUE(device.hasPipeline(compute));
+}
+
+TEST_F(RenderGraphPipelineRetentionTest,
+       RebuildRecreatesGraphicsPipelinesIfRenderTargetFormatsChange) {
+  auto [graphics, compute] = buildGraph(1024, Format::Rgba8Srgb);
+
+  graph.destroy(storage, true);
+  graph = quoll::RenderGraph("TestGraph");
+  auto [newGraphics, newCompute] = buildGraph(1024, Format::Rgba16Float);
+
+  EXPECT_EQ(newGraphics, graphics);
+  EXPECT_EQ(newCompute, compute);
+  EXPECT_EQ(device.getNumCreatedPipelines(), 3);
+
+  const auto &pass = graph.getCompiledPasses().at(0);
+  EXPECT_EQ(device.getPipeline(graphics).getGraphicsDescription().renderPass,
+            pass.getRenderPass());
+}
+
+TEST_F(RenderGraphPipelineRetentionTest,
+       RebuildDestroysRetainedPipelinesThatAreNotAddedAgain) {
+  auto [graphics, compute] = buildGraph(1024, Format::Rgba8Srgb);
+
+  graph.destroy(storage, true);
+  graph = quoll::RenderGraph("TestGraph");
+  graphicsDescription.fragmentShader = ShaderHandle{27};
+  auto [newGraphics, newCompute] = buildGraph(1024, Format::Rgba8Srgb);
+
+  EXPECT_NE(newGraphics, graphics);
+  EXPECT_EQ(newCompute, compute);
+  EXPECT_FALSE(device.hasPipeline(graphics));
+  EXPECT_TRUE(device.hasPipeline(newGraphics));
+  EXPECT_EQ(device.getNumCreatedPipelines(), 3);
+}
+
+TEST_F(RenderGraphTest, AliasesTexturesWithNonOverlappingLifetimes) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 64;
+
+  auto a = createTexture(description);
+  auto b = createTexture(description);
+  auto c = createTexture(description);
+  auto output = storage.createTexture(description);
+
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addGraphicsPass("B");
+  passB.read(a);
+  passB.write(b, quoll::AttachmentType::Color, {});
+
+  auto &passC = graph.addGraphicsPass("C");
+  passC.read(b);
+  passC.write(c, quoll::AttachmentType::Color, {});
+
+  auto &passD = graph.addGraphicsPass("D");
+  passD.read(c);
+  passD.write(graph.import(output), quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  EXPECT_TRUE(device.getTextureDescription(a.getHandle()).aliasable);
+  EXPECT_EQ(device.getTextureDescription(a.getHandle()).aliasOf,
+            TextureHandle::Null);
+  EXPECT_EQ(device.getTextureDescription(b.getHandle()).aliasOf,
+            TextureHandle::Null);
+  EXPECT_EQ(device.getTextureDescription(c.getHandle()).aliasOf,
+            a.getHandle());
+
+  auto textureSize = getTextureMemorySize(description);
+
+  const auto &report = graph.getAliasingReport();
+  EXPECT_EQ(report.numTransientTextures, 3);
+  EXPECT_EQ(report.numAliasedTextures, 1);
+  EXPECT_EQ(report.totalMemorySize, textureSize * 3);
+  EXPECT_EQ(report.savedMemorySize, textureSize);
+  EXPECT_EQ(device.getAliasedTextureMemorySize(), textureSize);
+
+  // First write to aliased texture waits
+  // for the last read of previous texture
+  auto readDependency = quoll::RenderGraphSyncDependency::getTextureRead(
+      quoll::RenderGraphPassType::Graphics);
+  const auto &barrier =
+      graph.getCompiledPasses().at(2).getSyncDependencies().imageBarriers.at(
+          0);
+  EXPECT_EQ(barrier.texture, c.getHandle());
+  EXPECT_EQ(barrier.srcLayout, ImageLayout::Undefined);
+  EXPECT_EQ(barrier.srcStage, readDependency.stage);
+  EXPECT_EQ(barrier.srcAccess, readDependency.access);
+}
+
+TEST_F(RenderGraphTest, DoesNotAliasIncompatibleTextures) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 64;
+
+  auto differentFormatDescription = description;
+  differentFormatDescription.format = Format::Rgba16Float;
+
+  auto a = createTexture(description);
+  auto b = createTexture(description);
+  auto c = createTexture(differentFormatDescription);
+  auto output = storage.createTexture(description);
+
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addGraphicsPass("B");
+  passB.read(a);
+  passB.write(b, quoll::AttachmentType::Color, {});
+
+  auto &passC = graph.addGraphicsPass("C");
+  passC.read(b);
+  passC.write(c, quoll::AttachmentType::Color, {});
+
+  auto &passD = graph.addGraphicsPass("D");
+  passD.read(c);
+  passD.write(graph.import(output), quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  EXPECT_FALSE(device.getTextureDescription(a.getHandle()).aliasable);
+  EXPECT_EQ(device.getTextureDescription(c.getHandle()).aliasOf,
+            TextureHandle::Null);
+
+  const auto &report = graph.getAliasingReport();
+  EXPECT_EQ(report.numTransientTextures, 3);
+  EXPECT_EQ(report.numAliasedTextures, 0);
+  EXPECT_EQ(report.savedMemorySize, 0);
+  EXPECT_EQ(device.getAliasedTextureMemorySize(), 0);
+}
+
+TEST_F(RenderGraphTest, DoesNotAliasTexturesThatAreNotReadAfterLastWrite) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 64;
+
+  auto a = createTexture(description);
+  auto b = createTexture(description);
+
+  // Both textures are outputs of the graph; so,
+  // their contents must outlive the graph
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+  graph.addGraphicsPass("B").write(b, quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  EXPECT_EQ(device.getTextureDescription(a.getHandle()).aliasOf,
+            TextureHandle::Null);
+  EXPECT_EQ(device.getTextureDescription(b.getHandle()).aliasOf,
+            TextureHandle::Null);
+  EXPECT_EQ(graph.getAliasingReport().numTransientTextures, 2);
+  EXPECT_EQ(graph.getAliasingReport().numAliasedTextures, 0);
+}
+
+TEST_F(RenderGraphTest, LoadsPersistentTextureFromLayoutOfItsLastAccess) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Depth | TextureUsage::Sampled;
+  description.format = Format::Depth16Unorm;
+  description.width = 64;
+  description.height = 64;
+
+  auto cache = createTexture(description);
+  graph.markAsPersistent(cache);
+
+  graph.addGraphicsPass("A").write(cache, quoll::AttachmentType::Depth,
+                                   DepthStencilClear{1.0f, 0});
+  graph.addGraphicsPass("B").read(cache);
+
+  graph.build(storage);
+
+  const auto &pass = graph.getCompiledPasses().at(0);
+  EXPECT_EQ(pass.getAttachments().at(0).loadOp, AttachmentLoadOp::Load);
+  EXPECT_EQ(pass.getTextureOutputs().at(0).srcLayout,
+            ImageLayout::DepthStencilAttachmentOptimal);
+
+  auto readDependency = quoll::RenderGraphSyncDependency::getTextureRead(
+      quoll::RenderGraphPassType::Graphics);
+  const auto &barrier = pass.getSyncDependencies().imageBarriers.at(0);
+  EXPECT_EQ(barrier.texture, cache.getHandle());
+  EXPECT_EQ(barrier.srcLayout, readDependency.layout);
+  EXPECT_EQ(barrier.srcStage, readDependency.stage);
+  EXPECT_EQ(barrier.srcAccess, readDependency.access);
+  EXPECT_EQ(barrier.dstLayout, ImageLayout::DepthStencilAttachmentOptimal);
+}
+
+TEST_F(RenderGraphTest, DoesNotAliasPersistentTextures) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 64;
+
+  auto a = createTexture(description);
+  auto b = createTexture(description);
+  auto output = storage.createTexture(description);
+  graph.markAsPersistent(a);
+
+  graph.addGraphicsPass("A").write(a, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addGraphicsPass("B");
+  passB.read(a);
+  passB.write(b, quoll::AttachmentType::Color, {});
+
+  auto &passC = graph.addGraphicsPass("C");
+  passC.read(b);
+  passC.write(graph.import(output), quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  EXPECT_FALSE(device.getTextureDescription(a.getHandle()).aliasable);
+  EXPECT_EQ(device.getTextureDescription(b.getHandle()).aliasOf,
+            TextureHandle::Null);
+  EXPECT_EQ(graph.getAliasingReport().numTransientTextures, 1);
+}
+
+TEST_F(RenderGraphTest, OrdersPassThatReadsTextureBeforeItsNextWriter) {
+  auto texture = createTexture({});
+  auto output = storage.createTexture({});
+  auto buffer = device.createBuffer({}).getHandle();
+
+  graph.addGraphicsPass("A").write(texture, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addComputePass("B");
+  passB.read(texture);
+  passB.write(buffer, quoll::rhi::BufferUsage::Storage);
+
+  // C overwrites the texture using results of B
+  auto &passC = graph.addGraphicsPass("C");
+  passC.read(buffer, quoll::rhi::BufferUsage::Storage);
+  passC.write(texture, quoll::AttachmentType::Color, {});
+
+  auto &passD = graph.addGraphicsPass("D");
+  passD.read(texture);
+  passD.write(graph.import(output), quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  const auto &passes = graph.getCompiledPasses();
+  ASSERT_EQ(passes.size(), 4);
+  EXPECT_EQ(passes.at(0).getName(), "A");
+  EXPECT_EQ(passes.at(1).getName(), "B");
+  EXPECT_EQ(passes.at(2).getName(), "C");
+  EXPECT_EQ(passes.at(3).getName(), "D");
+}
+
+TEST_F(RenderGraphTest, WriterAddedAfterReaderFeedsReader) {
+  auto texture = createTexture({});
+  auto output = createTexture({});
+
+  graph.addGraphicsPass("A").write(texture, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addGraphicsPass("B");
+  passB.read(texture);
+  passB.write(output, quoll::AttachmentType::Color, {});
+
+  // C draws on top of A and its result must reach B
+  graph.addGraphicsPass("C").write(texture, quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  const auto &passes = graph.getCompiledPasses();
+  ASSERT_EQ(passes.size(), 3);
+  EXPECT_EQ(passes.at(0).getName(), "A");
+  EXPECT_EQ(passes.at(1).getName(), "C");
+  EXPECT_EQ(passes.at(2).getName(), "B");
+}
+
+TEST_F(RenderGraphTest,
+       OrdersReaderBeforeLaterWriterThatDependsOnReader) {
+  auto texture = createTexture({});
+  auto input = device.createBuffer({}).getHandle();
+  auto readerOutput = device.createBuffer({}).getHandle();
+  auto writerOutput = device.createBuffer({}).getHandle();
+
+  graph.addGraphicsPass("A").write(texture, quoll::AttachmentType::Color, {});
+
+  auto &passB = graph.addComputePass("B");
+  passB.read(texture);
+  passB.read(input, quoll::rhi::BufferUsage::Storage);
+  passB.write(readerOutput, quoll::rhi::BufferUsage::Storage);
+
+  // C overwrites the texture using results of B
+  auto &passC = graph.addGraphicsPass("C");
+  passC.read(readerOutput, quoll::rhi::BufferUsage::Storage);
+  passC.write(texture, quoll::AttachmentType::Color, {});
+  passC.write(writerOutput, quoll::rhi::BufferUsage::Storage);
+
+  // B reads input that is written after it
+  graph.addComputePass("D").write(input, quoll::rhi::BufferUsage::Storage);
+
+  graph.build(storage);
+
+  std::vector<quoll::String> names;
+  for (const auto &pass : graph.getCompiledPasses()) {
+    names.push_back(pass.getName());
+  }
+
+  ASSERT_EQ(names.size(), 4);
+  auto indexOf = [&names](const quoll::String &name) {
+    return std::find(names.begin(), names.end(), name) - names.begin();
+  };
+
+  EXPECT_LT(indexOf("A"), indexOf("B"));
+  EXPECT_LT(indexOf("D"), indexOf("B"));
+  EXPECT_LT(indexOf("B"), indexOf("C"));
+}
+
+TEST_F(RenderGraphTest, OrdersWritersOfSameResourceInOrderTheyAreAdded) {
+  auto buffer = device.createBuffer({}).getHandle();
+  auto input = device.createBuffer({}).getHandle();
+
+  auto &passA = graph.addComputePass("A");
+  passA.read(input, quoll::rhi::BufferUsage::Storage);
+  passA.write(buffer, quoll::rhi::BufferUsage::Storage);
+
+  graph.addComputePass("B").write(buffer, quoll::rhi::BufferUsage::Storage);
+
+  // A reads input that is written after it
+  graph.addComputePass("C").write(input, quoll::rhi::BufferUsage::Storage);
+
+  graph.build(storage);
+
+  const auto &passes = graph.getCompiledPasses();
+  ASSERT_EQ(passes.size(), 3);
+  EXPECT_EQ(passes.at(0).getName(), "C");
+  EXPECT_EQ(passes.at(1).getName(), "A");
+  EXPECT_EQ(passes.at(2).getName(), "B");
+}
+
+TEST_F(RenderGraphTest, PassThatReadsPersistentTextureBeforeItsWriterIsFirst) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 64;
+
+  auto history = createTexture(description);
+  graph.markAsPersistent(history);
+
+  auto buffer = device.createBuffer({}).getHandle();
+
+  auto &passA = graph.addComputePass("A");
+  passA.read(history);
+  passA.write(buffer, quoll::rhi::BufferUsage::Storage);
+
+  auto &passB = graph.addComputePass("B");
+  passB.read(buffer, quoll::rhi::BufferUsage::Storage);
+  passB.write(history, quoll::AttachmentType::Color, {});
+
+  graph.build(storage);
+
+  const auto &passes = graph.getCompiledPasses();
+  ASSERT_EQ(passes.size(), 2);
+  EXPECT_EQ(passes.at(0).getName(), "A");
+  EXPECT_EQ(passes.at(1).getName(), "B");
+}
+
+TEST_F(RenderGraphTest, RecordsParallelPassChunksInSecondaryCommandLists) {
+  auto handle = createTexture({});
+
+  auto &pass = graph.addGraphicsPass("test");
+  pass.write(handle, quoll::AttachmentType::Color, {});
+  pass.setParallelExecutor([](RenderCommandList &commandList, u32 frameIndex,
+                              u32 chunk, u32 numChunks) {
+    commandList.draw(numChunks, chunk);
+  });
+
+  graph.build(storage);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+
+  auto numChunks = storage.getRecordingThreadPool().getNumThreads();
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  const auto &commands = mockCommandList->getCommands();
+
+  // Query reset, timestamp, barrier, begin render pass,
+  // execute commands, three commands per chunk,
+  // end render pass, and timestamp
+  ASSERT_EQ(commands.size(), 7 + numChunks * 3);
+
+  auto *beginRenderPass =
+      static_cast<MockCommandBeginRenderPass *>(commands.at(3).get());
+  EXPECT_EQ(beginRenderPass->type, MockCommandType::BeginRenderPass);
+  EXPECT_EQ(beginRenderPass->contents, SubpassContents::SecondaryCommandLists);
+
+  auto *executeCommands =
+      static_cast<MockCommandExecuteCommands *>(commands.at(4).get());
+  EXPECT_EQ(executeCommands->type, MockCommandType::ExecuteCommands);
+  EXPECT_EQ(executeCommands->numCommandLists, numChunks);
+
+  const auto &drawCalls = mockCommandList->getDrawCalls();
+  ASSERT_EQ(drawCalls.size(), numChunks);
+  for (u32 chunk = 0; chunk < numChunks; ++chunk) {
+    auto *draw = static_cast<MockCommandDraw *>(drawCalls.at(chunk).command);
+    EXPECT_EQ(draw->vertexCount, numChunks);
+    EXPECT_EQ(draw->firstVertex, chunk);
+  }
+}
+
+TEST_F(RenderGraphTest, RecordsNonParallelPassInline) {
+  auto handle = createTexture({});
+
+  auto &pass = graph.addGraphicsPass("test");
+  pass.write(handle, quoll::AttachmentType::Color, {});
+  pass.setExecutor([](RenderCommandList &commandList, u32 frameIndex) {
+    commandList.draw(3, 0);
+  });
+
+  graph.build(storage);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  const auto &commands = mockCommandList->getCommands();
+
+  // Query reset, timestamp, barrier, begin render pass,
+  // viewport, scissor, draw, end render pass, and timestamp
+  ASSERT_EQ(commands.size(), 9);
+
+  auto *beginRenderPass =
+      static_cast<MockCommandBeginRenderPass *>(commands.at(3).get());
+  EXPECT_EQ(beginRenderPass->contents, SubpassContents::Inline);
+  EXPECT_EQ(mockCommandList->getDrawCalls().size(), 1);
+}
+
+TEST_F(RenderGraphTest, ScalesViewportOfPassesWithDynamicResolution) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 32;
+
+  auto &pass = graph.addGraphicsPass("test");
+  pass.write(createTexture(description), quoll::AttachmentType::Color, {});
+  pass.setDynamicResolution();
+  pass.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+
+  graph.build(storage);
+  graph.setResolutionScale(0.5f);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  const auto &commands = mockCommandList->getCommands();
+  ASSERT_EQ(commands.size(), 9);
+
+  auto *beginRenderPass =
+      static_cast<MockCommandBeginRenderPass *>(commands.at(3).get());
+  EXPECT_EQ(beginRenderPass->renderAreaSize, glm::uvec2(64, 32));
+
+  auto *viewport = static_cast<MockCommandSetViewport *>(commands.at(4).get());
+  EXPECT_EQ(viewport->type, MockCommandType::SetViewport);
+  EXPECT_EQ(viewport->size, glm::vec2(32.0f, 16.0f));
+
+  auto *scissor = static_cast<MockCommandSetScissor *>(commands.at(5).get());
+  EXPECT_EQ(scissor->type, MockCommandType::SetScissor);
+  EXPECT_EQ(scissor->size, glm::uvec2(32, 16));
+}
+
+TEST_F(RenderGraphTest, DoesNotScaleViewportOfPassesWithoutDynamicResolution) {
+  TextureDescription description{};
+  description.usage = TextureUsage::Color | TextureUsage::Sampled;
+  description.format = Format::Rgba8Unorm;
+  description.width = 64;
+  description.height = 32;
+
+  auto &pass = graph.addGraphicsPass("test");
+  pass.write(createTexture(description), quoll::AttachmentType::Color, {});
+  pass.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+
+  graph.build(storage);
+  graph.setResolutionScale(0.5f);
+
+  EXPECT_EQ(graph.getViewportSize(graph.getCompiledPasses().at(0)),
+            glm::uvec2(64, 32));
+}
+
+TEST_F(RenderGraphTest, WrapsEveryPassInTimestamps) {
+  auto &passA = graph.addGraphicsPass("A");
+  passA.write(createTexture({}), quoll::AttachmentType::Color, {});
+  passA.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+
+  auto &passB = graph.addComputePass("B");
+  passB.write(createTexture({}), quoll::AttachmentType::Color, {});
+  passB.setExecutor(
+      [](auto &commandList, u32) { commandList.dispatch(1, 1, 1); });
+
+  graph.build(storage);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 1);
+
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  const auto &commands = mockCommandList->getCommands();
+
+  std::vector<MockCommandWriteTimestamp *> timestamps;
+  MockCommandResetQueryPool *reset = nullptr;
+  for (const auto &command : commands) {
+    auto *timestamp = static_cast<MockCommandWriteTimestamp *>(command.get());
+    if (timestamp->type == MockCommandType::WriteTimestamp) {
+      timestamps.push_back(timestamp);
+    } else if (timestamp->type == MockCommandType::ResetQueryPool) {
+      reset = static_cast<MockCommandResetQueryPool *>(command.get());
+    }
+  }
+
+  // Queries of frame index 1 start after
+  // the queries of frame index 0
+  ASSERT_NE(reset, nullptr);
+  EXPECT_TRUE(device.hasQueryPool(reset->queryPool));
+  EXPECT_EQ(reset->firstQuery, 4);
+  EXPECT_EQ(reset->queryCount, 4);
+
+  ASSERT_EQ(timestamps.size(), 4);
+  for (u32 i = 0; i < 4; ++i) {
+    EXPECT_EQ(timestamps.at(i)->queryPool, reset->queryPool);
+    EXPECT_EQ(timestamps.at(i)->query, 4 + i);
+  }
+}
+
+TEST_F(RenderGraphTest, ReadsPassTimingsWhenFrameIndexIsReused) {
+  auto &passA = graph.addGraphicsPass("A");
+  passA.write(createTexture({}), quoll::AttachmentType::Color, {});
+  passA.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+
+  auto &passB = graph.addComputePass("B");
+  passB.write(createTexture({}), quoll::AttachmentType::Color, {});
+  passB.setExecutor(
+      [](auto &commandList, u32) { commandList.dispatch(1, 1, 1); });
+
+  graph.build(storage);
+
+  const auto &timings = graph.getPassTimings();
+  ASSERT_EQ(timings.size(), 2);
+  EXPECT_EQ(timings.at(0).name, "A");
+  EXPECT_EQ(timings.at(1).name, "B");
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+  EXPECT_EQ(timings.at(0).time, 0.0f);
+  EXPECT_EQ(timings.at(1).time, 0.0f);
+
+  graph.execute(commandList, 1);
+  EXPECT_EQ(timings.at(0).time, 0.0f);
+
+  graph.execute(commandList, 0);
+
+  auto expected = static_cast<f32>(MockRenderDevice::TimestampInterval) /
+                  1000000.0f;
+  EXPECT_FLOAT_EQ(timings.at(0).time, expected);
+  EXPECT_FLOAT_EQ(timings.at(1).time, expected);
+}
+
+TEST_F(RenderGraphTest, DestroysTimestampQueryPoolOnDestroy) {
+  auto &pass = graph.addGraphicsPass("A");
+  pass.write(createTexture({}), quoll::AttachmentType::Color, {});
+  pass.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+  graph.build(storage);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  auto *reset = static_cast<MockCommandResetQueryPool *>(
+      mockCommandList->getCommands().at(0).get());
+  ASSERT_EQ(reset->type, MockCommandType::ResetQueryPool);
+  EXPECT_TRUE(device.hasQueryPool(reset->queryPool));
+
+  graph.destroy(storage);
+  EXPECT_FALSE(device.hasQueryPool(reset->queryPool));
+}
+
+class RenderGraphAsyncComputeTest : public RenderGraphTest {
+public:
+  RenderGraphAsyncComputeTest()
+      : a(createTexture({})), b(createTexture({})),
+        output(graph.import(storage.createTexture({}))) {
+    auto &passA = graph.addGraphicsPass("A");
+    passA.write(a, quoll::AttachmentType::Color, {});
+    passA.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+
+    auto &passB = graph.addComputePass("B");
+    passB.setAsyncCompute();
+    passB.read(a);
+    passB.write(b, quoll::AttachmentType::Color, {});
+    passB.setExecutor(
+        [](auto &commandList, u32) { commandList.dispatch(1, 1, 1); });
+
+    auto &passC = graph.addGraphicsPass("C");
+    passC.read(b);
+    passC.write(output, quoll::AttachmentType::Color, {});
+    passC.setExecutor([](auto &commandList, u32) { commandList.draw(3, 0); });
+  }
+
+  quoll::RenderGraphResource<TextureHandle> a;
+  quoll::RenderGraphResource<TextureHandle> b;
+  quoll::RenderGraphResource<TextureHandle> output;
+};
+
+TEST_F(RenderGraphAsyncComputeTest,
+       SplitsAsyncComputePassesIntoSeparateSubmissions) {
+  graph.build(storage);
+
+  const auto &submissions = graph.getSubmissions();
+  ASSERT_EQ(submissions.size(), 3);
+
+  EXPECT_EQ(submissions.at(0).queue, QueueType::Graphics);
+  EXPECT_EQ(submissions.at(0).firstPass, 0);
+  EXPECT_EQ(submissions.at(0).numPasses, 1);
+  EXPECT_TRUE(submissions.at(0).waits.empty());
+
+  EXPECT_EQ(submissions.at(1).queue, QueueType::Compute);
+  EXPECT_EQ(submissions.at(1).firstPass, 1);
+  EXPECT_EQ(submissions.at(1).numPasses, 1);
+  ASSERT_EQ(submissions.at(1).waits.size(), 1);
+  EXPECT_EQ(submissions.at(1).waits.at(0).submission, 0);
+  EXPECT_EQ(submissions.at(1).waits.at(0).stage,
+            quoll::RenderGraphSyncDependency::getTextureRead(
+                quoll::RenderGraphPassType::Compute)
+                .stage);
+
+  EXPECT_EQ(submissions.at(2).queue, QueueType::Graphics);
+  EXPECT_EQ(submissions.at(2).firstPass, 2);
+  EXPECT_EQ(submissions.at(2).numPasses, 1);
+  ASSERT_EQ(submissions.at(2).waits.size(), 1);
+  EXPECT_EQ(submissions.at(2).waits.at(0).submission, 1);
+  EXPECT_EQ(submissions.at(2).waits.at(0).stage,
+            quoll::RenderGraphSyncDependency::getTextureRead(
+                quoll::RenderGraphPassType::Graphics)
+                .stage);
+}
+
+TEST_F(RenderGraphAsyncComputeTest,
+       SetsBarrierAfterSemaphoreWaitForCrossQueueAccess) {
+  graph.build(storage);
+
+  auto readDependency = quoll::RenderGraphSyncDependency::getTextureRead(
+      quoll::RenderGraphPassType::Compute);
+
+  const auto &barriers =
+      graph.getCompiledPasses().at(1).getSyncDependencies().imageBarriers;
+  auto it = std::find_if(barriers.begin(), barriers.end(),
+                         [this](auto &barrier) {
+                           return barrier.texture == a.getHandle();
+                         });
+  ASSERT_NE(it, barriers.end());
+  EXPECT_EQ(it->srcStage, readDependency.stage);
+  EXPECT_EQ(it->srcAccess, Access::None);
+  EXPECT_EQ(it->srcLayout, ImageLayout::ColorAttachmentOptimal);
+  EXPECT_EQ(it->dstLayout, readDependency.layout);
+}
+
+TEST_F(RenderGraphAsyncComputeTest, ExecutesSubmissionsOnTheirQueues) {
+  graph.build(storage);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  EXPECT_TRUE(mockCommandList->getCommands().empty());
+
+  const auto &submissions = device.getQueueSubmissions();
+  ASSERT_EQ(submissions.size(), 3);
+
+  EXPECT_EQ(submissions.at(0).queue, QueueType::Graphics);
+  EXPECT_EQ(submissions.at(0).value, 1);
+  EXPECT_TRUE(submissions.at(0).waits.empty());
+  EXPECT_EQ(submissions.at(0).commandList.getDrawCalls().size(), 1);
+
+  EXPECT_EQ(submissions.at(1).queue, QueueType::Compute);
+  EXPECT_EQ(submissions.at(1).value, 1);
+  ASSERT_EQ(submissions.at(1).waits.size(), 1);
+  EXPECT_EQ(submissions.at(1).waits.at(0).queue, QueueType::Graphics);
+  EXPECT_EQ(submissions.at(1).waits.at(0).value, 1);
+  EXPECT_EQ(submissions.at(1).commandList.getDispatchCalls().size(), 1);
+
+  EXPECT_EQ(submissions.at(2).queue, QueueType::Graphics);
+  EXPECT_EQ(submissions.at(2).value, 2);
+  ASSERT_EQ(submissions.at(2).waits.size(), 1);
+  EXPECT_EQ(submissions.at(2).waits.at(0).queue, QueueType::Compute);
+  EXPECT_EQ(submissions.at(2).waits.at(0).value, 1);
+  EXPECT_EQ(submissions.at(2).commandList.getDrawCalls().size(), 1);
+}
+
+TEST_F(RenderGraphAsyncComputeTest,
+       RunsAsyncComputePassesOnGraphicsQueueIfDeviceHasNoAsyncCompute) {
+  device.setAsyncCompute(false);
+  graph.build(storage);
+
+  ASSERT_EQ(graph.getSubmissions().size(), 1);
+  EXPECT_EQ(graph.getSubmissions().at(0).queue, QueueType::Graphics);
+  EXPECT_EQ(graph.getSubmissions().at(0).numPasses, 3);
+
+  RenderCommandList commandList(new MockCommandList);
+  graph.execute(commandList, 0);
+
+  auto *mockCommandList = static_cast<MockCommandList *>(
+      commandList.getNativeRenderCommandList().get());
+  EXPECT_EQ(mockCommandList->getDrawCalls().size(), 2);
+  EXPECT_EQ(mockCommandList->getDispatchCalls().size(), 1);
+  EXPECT_TRUE(device.getQueueSubmissions().empty());
+}
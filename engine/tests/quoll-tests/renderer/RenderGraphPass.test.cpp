@@ -56,6 +56,17 @@ TEST_F(RenderGraphPassTest, AddsTextureHandleToInputOnRead) {
   EXPECT_EQ(graphicsPass.getTextureInputs().at(0).texture, handle);
 }
 
+TEST_F(RenderGraphPassTest, SetsDynamicResolutionOnGraphicsPass) {
+  EXPECT_FALSE(graphicsPass.hasDynamicResolution());
+
+  graphicsPass.setDynamicResolution();
+  EXPECT_TRUE(graphicsPass.hasDynamicResolution());
+}
+
+TEST_F(RenderGraphPassTest, FailsSettingDynamicResolutionOnComputePass) {
+  EXPECT_DEATH(computePass.setDynamicResolution(), ".*");
+}
+
 TEST_F(RenderGraphPassTest, FailsWritingBufferWithVertexOnGraphicsPass) {
   quoll::rhi::BufferHandle handle{2};
 
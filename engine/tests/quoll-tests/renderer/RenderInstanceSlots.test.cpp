@@ -0,0 +1,88 @@
+#include "quoll/core/Base.h"
+#include "quoll/renderer/RenderInstanceSlots.h"
+
+#include "quoll-tests/Testing.h"
+
+class RenderInstanceSlotsTest : public ::testing::Test {
+public:
+  quoll::RenderInstanceSlots slots;
+};
+
+TEST_F(RenderInstanceSlotsTest, AcquireReturnsSameSlotForSameEntity) {
+  auto entity1 = static_cast<quoll::Entity>(1);
+  auto entity2 = static_cast<quoll::Entity>(2);
+
+  slots.beginFrame();
+  auto slot1 = slots.acquire(entity1);
+  auto slot2 = slots.acquire(entity2);
+  EXPECT_NE(slot1, slot2);
+
+  slots.beginFrame();
+  EXPECT_EQ(slots.acquire(entity2), slot2);
+  EXPECT_EQ(slots.acquire(entity1), slot1);
+
+  EXPECT_EQ(slots.getEntity(slot1), entity1);
+  EXPECT_EQ(slots.getEntity(slot2), entity2);
+  EXPECT_EQ(slots.size(), 2);
+  EXPECT_EQ(slots.getUsedCount(), 2);
+}
+
+TEST_F(RenderInstanceSlotsTest, ReleasesSlotsThatAreNotAcquiredInCurrentFrame) {
+  auto entity1 = static_cast<quoll::Entity>(1);
+  auto entity2 = static_cast<quoll::Entity>(2);
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+  auto slot2 = slots.acquire(entity2);
+  EXPECT_TRUE(slots.releaseUnused().empty());
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+
+  const auto &released = slots.releaseUnused();
+  EXPECT_EQ(released.size(), 1);
+  EXPECT_EQ(released.at(0), slot2);
+  EXPECT_EQ(slots.getEntity(slot2), quoll::Entity::Null);
+  EXPECT_EQ(slots.size(), 2);
+  EXPECT_EQ(slots.getUsedCount(), 1);
+}
+
+TEST_F(RenderInstanceSlotsTest, ReusesReleasedSlots) {
+  auto entity1 = static_cast<quoll::Entity>(1);
+  auto entity2 = static_cast<quoll::Entity>(2);
+  auto entity3 = static_cast<quoll::Entity>(3);
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+  auto slot2 = slots.acquire(entity2);
+  slots.releaseUnused();
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+  slots.releaseUnused();
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+  EXPECT_EQ(slots.acquire(entity3), slot2);
+  EXPECT_EQ(slots.getEntity(slot2), entity3);
+  EXPECT_EQ(slots.size(), 2);
+}
+
+TEST_F(RenderInstanceSlotsTest,
+       CanAcquireOnlyIfEntityHasSlotOrSlotIsAvailable) {
+  auto entity1 = static_cast<quoll::Entity>(1);
+  auto entity2 = static_cast<quoll::Entity>(2);
+  auto entity3 = static_cast<quoll::Entity>(3);
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+  slots.acquire(entity2);
+  EXPECT_TRUE(slots.canAcquire(entity1, 2));
+  EXPECT_FALSE(slots.canAcquire(entity3, 2));
+  EXPECT_TRUE(slots.canAcquire(entity3, 3));
+
+  slots.beginFrame();
+  slots.acquire(entity1);
+  slots.releaseUnused();
+  EXPECT_TRUE(slots.canAcquire(entity3, 2));
+}
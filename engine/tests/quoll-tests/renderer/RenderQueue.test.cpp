@@ -0,0 +1,133 @@
+#include "quoll/core/Base.h"
+#include "quoll/renderer/RenderQueue.h"
+
+#include "quoll-tests/Testing.h"
+
+class RenderQueueTest : public ::testing::Test {
+public:
+  quoll::RenderQueue queue;
+};
+
+using Pipeline = quoll::RenderQueue::Pipeline;
+
+TEST_F(RenderQueueTest, CreatesKeysThatSortByPipelineMeshDepthAndMaterial) {
+  auto mesh1 = static_cast<quoll::MeshAssetHandle>(1);
+  auto mesh2 = static_cast<quoll::MeshAssetHandle>(2);
+
+  auto key = quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 5, 0.5f);
+
+  EXPECT_LT(key, quoll::RenderQueue::createKey(Pipeline::SkinnedMesh, mesh1,
+                                               0, 0.0f));
+  EXPECT_LT(key, quoll::RenderQueue::createKey(Pipeline::Mesh, mesh2, 0, 0.0f));
+  EXPECT_LT(key, quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 0, 0.6f));
+  EXPECT_LT(key, quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 6, 0.5f));
+  EXPECT_EQ(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 5, 2.0f),
+            quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 5, 1.0f));
+}
+
+TEST_F(RenderQueueTest, SortsItemsFrontToBackWithinMesh) {
+  auto mesh = static_cast<quoll::MeshAssetHandle>(1);
+
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 0, 0.75f), 0,
+            static_cast<quoll::Entity>(1));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 0, 0.25f), 1,
+            static_cast<quoll::Entity>(2));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 0, 0.5f), 2,
+            static_cast<quoll::Entity>(3));
+  queue.sort();
+
+  EXPECT_EQ(queue.getInstances(Pipeline::Mesh), std::vector<u32>({1, 2, 0}));
+  EXPECT_EQ(queue.getEntities(Pipeline::Mesh),
+            std::vector<quoll::Entity>({static_cast<quoll::Entity>(2),
+                                        static_cast<quoll::Entity>(3),
+                                        static_cast<quoll::Entity>(1)}));
+}
+
+TEST_F(RenderQueueTest,
+       SortsItemsFrontToBackWithinMeshRegardlessOfMaterial) {
+  auto mesh = static_cast<quoll::MeshAssetHandle>(1);
+
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 1, 0.25f), 0,
+            static_cast<quoll::Entity>(1));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 9, 0.5f), 1,
+            static_cast<quoll::Entity>(2));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 5, 0.1f), 2,
+            static_cast<quoll::Entity>(3));
+  queue.sort();
+
+  ASSERT_EQ(queue.getBatches(Pipeline::Mesh).size(), 1);
+  EXPECT_EQ(queue.getInstances(Pipeline::Mesh), std::vector<u32>({2, 0, 1}));
+}
+
+TEST_F(RenderQueueTest, CollapsesConsecutiveItemsWithSameMeshIntoBatches) {
+  auto mesh1 = static_cast<quoll::MeshAssetHandle>(1);
+  auto mesh2 = static_cast<quoll::MeshAssetHandle>(300);
+
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh2, 4, 0.1f), 0,
+            static_cast<quoll::Entity>(1));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 7, 0.3f), 1,
+            static_cast<quoll::Entity>(2));
+  queue.add(
+      quoll::RenderQueue::createKey(Pipeline::SkinnedMesh, mesh1, 0, 0.0f), 0,
+      static_cast<quoll::Entity>(3));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 2, 0.9f), 2,
+            static_cast<quoll::Entity>(4));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh2, 4, 0.2f), 3,
+            static_cast<quoll::Entity>(5));
+  queue.sort();
+
+  const auto &batches = queue.getBatches(Pipeline::Mesh);
+  ASSERT_EQ(batches.size(), 2);
+  EXPECT_EQ(batches.at(0).mesh, mesh1);
+  EXPECT_EQ(batches.at(0).instanceStart, 0);
+  EXPECT_EQ(batches.at(0).numInstances, 2);
+  EXPECT_EQ(batches.at(1).mesh, mesh2);
+  EXPECT_EQ(batches.at(1).instanceStart, 2);
+  EXPECT_EQ(batches.at(1).numInstances, 2);
+  EXPECT_EQ(queue.getInstances(Pipeline::Mesh),
+            std::vector<u32>({1, 2, 0, 3}));
+
+  const auto &skinnedBatches = queue.getBatches(Pipeline::SkinnedMesh);
+  ASSERT_EQ(skinnedBatches.size(), 1);
+  EXPECT_EQ(skinnedBatches.at(0).mesh, mesh1);
+  EXPECT_EQ(skinnedBatches.at(0).instanceStart, 0);
+  EXPECT_EQ(skinnedBatches.at(0).numInstances, 1);
+}
+
+TEST_F(RenderQueueTest, SortsDynamicItemsAfterStaticItems) {
+  auto mesh1 = static_cast<quoll::MeshAssetHandle>(1);
+  auto mesh2 = static_cast<quoll::MeshAssetHandle>(2);
+
+  queue.add(
+      quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 0, 0.1f, true), 0,
+      static_cast<quoll::Entity>(1));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh2, 0, 0.2f), 1,
+            static_cast<quoll::Entity>(2));
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh1, 0, 0.3f), 2,
+            static_cast<quoll::Entity>(3));
+  queue.sort();
+
+  const auto &batches = queue.getBatches(Pipeline::Mesh);
+  ASSERT_EQ(batches.size(), 3);
+  EXPECT_EQ(batches.at(0).mesh, mesh1);
+  EXPECT_FALSE(batches.at(0).dynamic);
+  EXPECT_EQ(batches.at(1).mesh, mesh2);
+  EXPECT_FALSE(batches.at(1).dynamic);
+  EXPECT_EQ(batches.at(2).mesh, mesh1);
+  EXPECT_TRUE(batches.at(2).dynamic);
+  EXPECT_EQ(queue.getInstances(Pipeline::Mesh), std::vector<u32>({2, 1, 0}));
+}
+
+TEST_F(RenderQueueTest, ClearRemovesItemsAndBatches) {
+  auto mesh = static_cast<quoll::MeshAssetHandle>(1);
+
+  queue.add(quoll::RenderQueue::createKey(Pipeline::Mesh, mesh, 0, 0.0f), 0,
+            static_cast<quoll::Entity>(1));
+  queue.sort();
+  queue.clear();
+
+  EXPECT_EQ(queue.size(), 0);
+  EXPECT_TRUE(queue.getBatches(Pipeline::Mesh).empty());
+  EXPECT_TRUE(queue.getInstances(Pipeline::Mesh).empty());
+  EXPECT_TRUE(queue.getEntities(Pipeline::Mesh).empty());
+}
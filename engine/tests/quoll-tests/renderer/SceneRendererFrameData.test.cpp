@@ -0,0 +1,185 @@
+#include "quoll/core/Base.h"
+#include "quoll/rhi-mock/MockRenderDevice.h"
+#include "quoll/renderer/RenderStorage.h"
+#include "quoll/renderer/SceneRendererFrameData.h"
+
+#include "quoll-tests/Testing.h"
+
+class SceneRendererFrameDataTest : public ::testing::Test {
+public:
+  static constexpr usize ReservedSpace = 4;
+
+  SceneRendererFrameDataTest()
+      : storage(&device), frameData(storage, ReservedSpace) {
+    frameData.setCameraData(quoll::Camera{}, quoll::PerspectiveLens{});
+  }
+
+  quoll::MeshAsset createSkinnedMesh(usize numVertices) {
+    static constexpr usize NumVertexBuffers = 7;
+
+    quoll::BaseGeometryAsset geometry{};
+    geometry.positions.resize(numVertices);
+    geometry.indices = {0, 1, 2};
+
+    quoll::MeshAsset mesh{};
+    mesh.geometries.push_back(geometry);
+    mesh.vertexBuffers.resize(NumVertexBuffers);
+    mesh.vertexBufferOffsets.resize(NumVertexBuffers);
+    mesh.vertexBufferAddresses.resize(NumVertexBuffers);
+    return mesh;
+  }
+
+  void addSkinnedMesh(const quoll::MeshAsset &mesh, u32 entity,
+                      usize numJoints) {
+    std::vector<glm::mat4> skeleton(numJoints, glm::mat4{1.0f});
+    frameData.addSkinnedMesh(quoll::MeshAssetHandle{1}, mesh,
+                             quoll::Entity{entity}, glm::mat4{1.0f}, skeleton,
+                             {});
+  }
+
+  quoll::rhi::MockRenderDevice device;
+  quoll::RenderStorage storage;
+  quoll::SceneRendererFrameData frameData;
+};
+
+TEST_F(SceneRendererFrameDataTest,
+       SkipsSkinnedMeshesThatDoNotFitIntoSkinnedVertexCache) {
+  auto mesh = createSkinnedMesh(
+      quoll::SceneRendererFrameData::MaxNumSkinnedVertices / 2);
+  auto small = createSkinnedMesh(3);
+
+  addSkinnedMesh(mesh, 1, 1);
+  addSkinnedMesh(mesh, 2, 1);
+  addSkinnedMesh(mesh, 3, 1);
+  addSkinnedMesh(small, 4, 1);
+  frameData.updateBuffers();
+
+  const auto &entities = frameData.getSkinnedMeshEntities();
+  EXPECT_EQ(entities.size(), 2);
+  EXPECT_EQ(std::count(entities.begin(), entities.end(), quoll::Entity{3}), 0);
+  EXPECT_EQ(std::count(entities.begin(), entities.end(), quoll::Entity{4}), 0);
+
+  u32 numVertices = 0;
+  for (const auto &job : frameData.getSkinningJobs()) {
+    EXPECT_EQ(job.vertexOffset, numVertices);
+    numVertices += job.numVertices;
+  }
+  EXPECT_EQ(numVertices,
+            quoll::SceneRendererFrameData::MaxNumSkinnedVertices);
+}
+
+TEST_F(SceneRendererFrameDataTest,
+       RendersSkippedSkinnedMeshesWhenSkinnedVertexCacheIsFreed) {
+  auto mesh = createSkinnedMesh(
+      quoll::SceneRendererFrameData::MaxNumSkinnedVertices / 2);
+
+  addSkinnedMesh(mesh, 1, 1);
+  addSkinnedMesh(mesh, 2, 1);
+  addSkinnedMesh(mesh, 3, 1);
+  frameData.updateBuffers();
+
+  frameData.clear();
+  addSkinnedMesh(mesh, 2, 1);
+  addSkinnedMesh(mesh, 3, 1);
+  frameData.updateBuffers();
+
+  const auto &entities = frameData.getSkinnedMeshEntities();
+  EXPECT_EQ(entities.size(), 2);
+  EXPECT_EQ(std::count(entities.begin(), entities.end(), quoll::Entity{3}), 1);
+}
+
+TEST_F(SceneRendererFrameDataTest,
+       SkipsSkinnedMeshesThatDoNotFitIntoJointsBuffer) {
+  static constexpr usize MaxJoints =
+      ReservedSpace * quoll::SceneRendererFrameData::ReservedJointsPerSkeleton;
+
+  auto mesh = createSkinnedMesh(3);
+
+  addSkinnedMesh(mesh, 1, MaxJoints / 2);
+  addSkinnedMesh(mesh, 2, MaxJoints / 2 + 1);
+  addSkinnedMesh(mesh, 3, MaxJoints / 2);
+  frameData.updateBuffers();
+
+  const auto &entities = frameData.getSkinnedMeshEntities();
+  EXPECT_EQ(entities.size(), 2);
+  EXPECT_EQ(std::count(entities.begin(), entities.end(), quoll::Entity{2}), 0);
+
+  const auto &jobs = frameData.getSkinningJobs();
+  ASSERT_EQ(jobs.size(), 2);
+  EXPECT_NE(jobs.at(0).jointOffset, jobs.at(1).jointOffset);
+}
+
+TEST_F(SceneRendererFrameDataTest,
+       SkipsSkinnedMeshesWithMoreJointsThanJointsBuffer) {
+  static constexpr usize MaxJoints =
+      ReservedSpace * quoll::SceneRendererFrameData::ReservedJointsPerSkeleton;
+
+  auto mesh = createSkinnedMesh(3);
+
+  addSkinnedMesh(mesh, 1, MaxJoints + 1);
+  addSkinnedMesh(mesh, 2, MaxJoints);
+  frameData.updateBuffers();
+
+  const auto &entities = frameData.getSkinnedMeshEntities();
+  ASSERT_EQ(entities.size(), 1);
+  EXPECT_EQ(entities.at(0), quoll::Entity{2});
+}
+
+TEST_F(SceneRendererFrameDataTest,
+       SkipsMeshBatchesThatDoNotFitIntoDrawCommandsBuffer) {
+  quoll::BaseGeometryAsset geometry{};
+  geometry.positions.resize(3);
+  geometry.indices = {0, 1, 2};
+
+  quoll::MeshAsset mesh{};
+  mesh.geometries = {geometry, geometry};
+
+  for (u32 i = 1; i <= 3; ++i) {
+    frameData.addMesh(quoll::MeshAssetHandle{i}, mesh, quoll::Entity{i},
+                      glm::mat4{1.0f}, {}, false);
+  }
+  frameData.updateBuffers();
+
+  EXPECT_EQ(frameData.getMeshBatches().size(), 3);
+
+  const auto &cullBatches = frameData.getCullBatches();
+  ASSERT_EQ(cullBatches.size(), 2);
+  EXPECT_EQ(cullBatches.at(1).firstCommand, 2);
+  EXPECT_EQ(frameData.getNumCullInstances(), 2);
+}
+
+TEST_F(SceneRendererFrameDataTest,
+       SkipsMeshesThatDoNotFitIntoMeshInstancesBuffer) {
+  quoll::MeshAsset mesh{};
+  mesh.geometries.resize(1);
+
+  for (u32 i = 1; i <= ReservedSpace + 1; ++i) {
+    frameData.addMesh(quoll::MeshAssetHandle{1}, mesh, quoll::Entity{i},
+                      glm::mat4{1.0f}, {}, false);
+  }
+  frameData.updateBuffers();
+
+  const auto &batches = frameData.getMeshBatches();
+  ASSERT_EQ(batches.size(), 1);
+  EXPECT_EQ(batches.at(0).numInstances, ReservedSpace);
+}
+
+TEST_F(SceneRendererFrameDataTest,
+       CountsOnlyChangedInstanceDataAsUploadedBytes) {
+  quoll::MeshAsset mesh{};
+  mesh.geometries.resize(1);
+
+  frameData.addMesh(quoll::MeshAssetHandle{1}, mesh, quoll::Entity{1},
+                    glm::mat4{1.0f}, {}, false);
+  frameData.updateBuffers();
+  EXPECT_EQ(device.getDeviceStats().getUploadedBytes(),
+            sizeof(glm::mat4) +
+                sizeof(quoll::SceneRendererFrameData::MaterialRange));
+
+  device.getDeviceStats().resetCalls();
+  frameData.clear();
+  frameData.addMesh(quoll::MeshAssetHandle{1}, mesh, quoll::Entity{1},
+                    glm::mat4{1.0f}, {}, false);
+  frameData.updateBuffers();
+  EXPECT_EQ(device.getDeviceStats().getUploadedBytes(), 0);
+}
@@ -0,0 +1,50 @@
+#include "quoll/core/Base.h"
+#include "quoll/renderer/TextureUtils.h"
+#include "quoll/rhi-mock/MockRenderDevice.h"
+
+#include "quoll-tests/Testing.h"
+
+class TextureUtilsTest : public ::testing::Test {
+public:
+  quoll::rhi::MockRenderDevice device;
+};
+
+TEST_F(TextureUtilsTest, CopyDataToTextureAddsUploadWithRegionPerLevel) {
+  auto texture = quoll::rhi::TextureHandle{2};
+  std::vector<u8> data(20);
+  for (usize i = 0; i < data.size(); ++i) {
+    data.at(i) = static_cast<u8>(i);
+  }
+
+  std::vector<quoll::TextureAssetLevel> levels{{0, 16, 2, 2}, {16, 4, 1, 1}};
+
+  auto value = quoll::TextureUtils::copyDataToTexture(
+      &device, data.data(), texture,
+      quoll::rhi::ImageLayout::ShaderReadOnlyOptimal, 1, levels);
+
+  ASSERT_EQ(device.getTextureUploads().size(), 1);
+  const auto &upload = device.getTextureUploads().at(0);
+  EXPECT_EQ(upload.value, value);
+  EXPECT_EQ(upload.data, data);
+  EXPECT_EQ(upload.description.texture, texture);
+  EXPECT_EQ(upload.description.levelCount, 2);
+  EXPECT_EQ(upload.description.layout,
+            quoll::rhi::ImageLayout::ShaderReadOnlyOptimal);
+
+  ASSERT_EQ(upload.description.regions.size(), 2);
+  EXPECT_EQ(upload.description.regions.at(1).bufferOffset, 16);
+  EXPECT_EQ(upload.description.regions.at(1).imageLevel, 1);
+  EXPECT_EQ(upload.description.regions.at(1).imageExtent, glm::uvec3(1, 1, 1));
+}
+
+TEST_F(TextureUtilsTest, CopyDataToTextureDoesNotWaitForUpload) {
+  std::vector<u8> data(4);
+  auto value = quoll::TextureUtils::copyDataToTexture(
+      &device, data.data(), quoll::rhi::TextureHandle{2},
+      quoll::rhi::ImageLayout::ShaderReadOnlyOptimal, 1, {{0, 4, 1, 1}});
+
+  EXPECT_FALSE(device.isUploadComplete(value));
+
+  device.flushUploads();
+  EXPECT_TRUE(device.isUploadComplete(value));
+}
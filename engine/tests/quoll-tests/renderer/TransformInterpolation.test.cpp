@@ -0,0 +1,73 @@
+#include "quoll/core/Base.h"
+#include "quoll/renderer/TransformInterpolation.h"
+
+#include "quoll-tests/Testing.h"
+
+using TransformInterpolationTest = ::testing::Test;
+
+static constexpr f32 Epsilon = 0.0001f;
+
+static void expectNear(const glm::mat4 &actual, const glm::mat4 &expected) {
+  for (glm::length_t i = 0; i < 4; ++i) {
+    for (glm::length_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(actual[i][j], expected[i][j], Epsilon);
+    }
+  }
+}
+
+TEST_F(TransformInterpolationTest, ReturnsPreviousTransformIfAlphaIsZero) {
+  auto previous = glm::translate(glm::mat4{1.0f}, glm::vec3(1.0f, 2.0f, 3.0f));
+  auto current = glm::translate(glm::mat4{1.0f}, glm::vec3(5.0f, 2.0f, 3.0f));
+
+  expectNear(
+      quoll::TransformInterpolation::interpolate(previous, current, 0.0f),
+      previous);
+}
+
+TEST_F(TransformInterpolationTest, ReturnsCurrentTransformIfAlphaIsOne) {
+  auto previous = glm::translate(glm::mat4{1.0f}, glm::vec3(1.0f, 2.0f, 3.0f));
+  auto current = glm::translate(glm::mat4{1.0f}, glm::vec3(5.0f, 2.0f, 3.0f));
+
+  EXPECT_EQ(quoll::TransformInterpolation::interpolate(previous, current, 1.0f),
+            current);
+}
+
+TEST_F(TransformInterpolationTest, BlendsTranslationScaleAndRotation) {
+  glm::mat4 identity{1.0f};
+  auto previous = glm::translate(identity, glm::vec3(0.0f, 0.0f, 0.0f)) *
+                  glm::scale(identity, glm::vec3(1.0f));
+  auto current = glm::translate(identity, glm::vec3(4.0f, 2.0f, 0.0f)) *
+                 glm::toMat4(glm::angleAxis(glm::radians(90.0f),
+                                            glm::vec3(0.0f, 1.0f, 0.0f))) *
+                 glm::scale(identity, glm::vec3(3.0f));
+
+  auto expected = glm::translate(identity, glm::vec3(2.0f, 1.0f, 0.0f)) *
+                  glm::toMat4(glm::angleAxis(glm::radians(45.0f),
+                                             glm::vec3(0.0f, 1.0f, 0.0f))) *
+                  glm::scale(identity, glm::vec3(2.0f));
+
+  expectNear(
+      quoll::TransformInterpolation::interpolate(previous, current, 0.5f),
+      expected);
+}
+
+TEST_F(TransformInterpolationTest,
+       BlendsCameraViewFromPreviousAndCurrentWorldTransforms) {
+  glm::mat4 identity{1.0f};
+  auto previous = glm::translate(identity, glm::vec3(0.0f, 0.0f, 2.0f));
+  auto current = glm::translate(identity, glm::vec3(0.0f, 0.0f, 6.0f));
+
+  quoll::Camera camera{};
+  camera.projectionMatrix = glm::perspective(1.0f, 1.0f, 0.1f, 100.0f);
+  camera.viewMatrix = glm::inverse(current);
+
+  auto blended = quoll::TransformInterpolation::interpolateCamera(
+      camera, previous, current, 0.25f);
+
+  auto expectedView =
+      glm::inverse(glm::translate(identity, glm::vec3(0.0f, 0.0f, 3.0f)));
+  expectNear(blended.viewMatrix, expectedView);
+  expectNear(blended.projectionViewMatrix,
+             camera.projectionMatrix * expectedView);
+  EXPECT_EQ(blended.projectionMatrix, camera.projectionMatrix);
+}
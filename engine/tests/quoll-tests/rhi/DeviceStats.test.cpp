@@ -28,13 +28,32 @@ TEST_F(DeviceStatsTest, AddCommandCalls) {
   EXPECT_EQ(stats.getCommandCallsCount(), 2);
 }
 
+TEST_F(DeviceStatsTest, AddsUploadedBytes) {
+  stats.addUploadedBytes(256);
+  stats.addUploadedBytes(1024);
+
+  EXPECT_EQ(stats.getUploadedBytes(), 1280);
+  EXPECT_EQ(stats.getCommandCallsCount(), 0);
+}
+
 TEST_F(DeviceStatsTest, ResetsCalls) {
   stats.addDrawCall(80);
   stats.addDrawCall(125);
   stats.addCommandCall();
+  stats.addUploadedBytes(256);
 
   stats.resetCalls();
   EXPECT_EQ(stats.getDrawCallsCount(), 0);
   EXPECT_EQ(stats.getDrawnPrimitivesCount(), 0);
   EXPECT_EQ(stats.getCommandCallsCount(), 0);
+  EXPECT_EQ(stats.getUploadedBytes(), 0);
+}
+
+TEST_F(DeviceStatsTest, SetsCullingResultsThatAreNotResetWithCalls) {
+  stats.setCullingResults(20, 5);
+  stats.setCullingResults(30, 10);
+
+  stats.resetCalls();
+  EXPECT_EQ(stats.getVisibleInstancesCount(), 30);
+  EXPECT_EQ(stats.getCulledInstancesCount(), 10);
 }
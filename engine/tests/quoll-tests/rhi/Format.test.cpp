@@ -0,0 +1,26 @@
+#include "quoll/core/Base.h"
+#include "quoll/rhi/Format.h"
+
+#include "quoll-tests/Testing.h"
+
+using FormatTest = ::testing::Test;
+
+TEST_F(FormatTest, ReturnsTexelSizeOfFormat) {
+  EXPECT_EQ(quoll::rhi::getFormatSize(quoll::rhi::Format::Undefined), 0);
+  EXPECT_EQ(quoll::rhi::getFormatSize(quoll::rhi::Format::Depth16Unorm), 2);
+  EXPECT_EQ(quoll::rhi::getFormatSize(quoll::rhi::Format::Rgba8Srgb), 4);
+  EXPECT_EQ(quoll::rhi::getFormatSize(quoll::rhi::Format::Rgba16Float), 8);
+  EXPECT_EQ(quoll::rhi::getFormatSize(quoll::rhi::Format::Rgb32Float), 12);
+  EXPECT_EQ(quoll::rhi::getFormatSize(quoll::rhi::Format::Rgba32Uint), 16);
+}
+
+TEST_F(FormatTest, PadsCombinedDepthStencilTexelsTo64Bits) {
+  EXPECT_EQ(quoll::rhi::getFormatSize(
+                quoll::rhi::Format::Depth32FloatStencil8Uint),
+            8);
+}
+
+TEST_F(FormatTest, FailsIfFormatHasNoTexelSize) {
+  EXPECT_DEATH(
+      quoll::rhi::getFormatSize(static_cast<quoll::rhi::Format>(255)), ".*");
+}
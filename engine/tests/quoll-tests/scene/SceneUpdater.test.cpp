@@ -1,6 +1,8 @@
 #include "quoll/core/Base.h"
 #include "quoll/scene/LocalTransform.h"
 #include "quoll/scene/WorldTransform.h"
+#include "quoll/scene/PreviousWorldTransform.h"
+#include "quoll/scene/Sprite.h"
 #include "quoll/scene/Parent.h"
 #include "quoll/scene/JointAttachment.h"
 #include "quoll/scene/DirectionalLight.h"
@@ -40,6 +42,140 @@ TEST_F(SceneUpdaterTest, SetsLocalTransformToWorldTransformIfNoParent) {
             getLocalTransform(transform));
 }
 
+TEST_F(SceneUpdaterTest, DoesNotMarkUnchangedWorldTransformsAsUpdated) {
+  auto parent = entityDatabase.create();
+  entityDatabase.set<quoll::WorldTransform>(parent, {});
+  entityDatabase.set<quoll::LocalTransform>(parent, {});
+
+  auto child = entityDatabase.create();
+  entityDatabase.set<quoll::WorldTransform>(child, {});
+  entityDatabase.set<quoll::LocalTransform>(child, {});
+  entityDatabase.set<quoll::Parent>(child, {parent});
+
+  sceneUpdater.update(entityDatabase);
+
+  auto observer = entityDatabase.observeUpdate<quoll::WorldTransform>();
+  sceneUpdater.update(entityDatabase);
+  EXPECT_TRUE(observer.empty());
+
+  entityDatabase.get<quoll::LocalTransform>(child).localPosition.x = 2.0f;
+  sceneUpdater.update(entityDatabase);
+
+  EXPECT_EQ(observer.size(), 1);
+  for (auto [entity, world] : observer) {
+    EXPECT_EQ(entity, child);
+  }
+}
+
+TEST_F(SceneUpdaterTest,
+       StoresWorldTransformOfPreviousUpdateInPreviousWorldTransform) {
+  auto entity = entityDatabase.create();
+  quoll::LocalTransform transform{};
+  transform.localPosition = glm::vec3(1.0f, 0.5f, 2.5f);
+
+  entityDatabase.set<quoll::WorldTransform>(entity, {});
+  entityDatabase.set<quoll::PreviousWorldTransform>(entity, {});
+  entityDatabase.set(entity, transform);
+
+  sceneUpdater.storePreviousTransforms(entityDatabase);
+  sceneUpdater.update(entityDatabase);
+  EXPECT_EQ(
+      entityDatabase.get<quoll::PreviousWorldTransform>(entity).worldTransform,
+      glm::mat4{1.0f});
+
+  sceneUpdater.storePreviousTransforms(entityDatabase);
+  entityDatabase.get<quoll::LocalTransform>(entity).localPosition =
+      glm::vec3(2.0f, 1.0f, 5.0f);
+  sceneUpdater.update(entityDatabase);
+
+  EXPECT_EQ(
+      entityDatabase.get<quoll::PreviousWorldTransform>(entity).worldTransform,
+      getLocalTransform(transform));
+  EXPECT_EQ(entityDatabase.get<quoll::WorldTransform>(entity).worldTransform,
+            getLocalTransform(
+                entityDatabase.get<quoll::LocalTransform>(entity)));
+}
+
+TEST_F(SceneUpdaterTest,
+       KeepsPreviousWorldTransformIfWorldTransformIsChangedBeforeUpdate) {
+  auto entity = entityDatabase.create();
+  quoll::LocalTransform transform{};
+  transform.localPosition = glm::vec3(1.0f, 0.5f, 2.5f);
+
+  entityDatabase.set(entity, transform);
+  entityDatabase.set<quoll::WorldTransform>(entity,
+                                            {getLocalTransform(transform)});
+  entityDatabase.set<quoll::PreviousWorldTransform>(entity, {});
+
+  sceneUpdater.storePreviousTransforms(entityDatabase);
+
+  // Physics writes simulated pose before scene is updated
+  quoll::LocalTransform simulated = transform;
+  simulated.localPosition = glm::vec3(3.0f, 0.5f, 2.5f);
+  entityDatabase.set(entity, simulated);
+  entityDatabase.set<quoll::WorldTransform>(entity,
+                                            {getLocalTransform(simulated)});
+
+  sceneUpdater.update(entityDatabase);
+
+  EXPECT_EQ(
+      entityDatabase.get<quoll::PreviousWorldTransform>(entity).worldTransform,
+      getLocalTransform(transform));
+  EXPECT_EQ(entityDatabase.get<quoll::WorldTransform>(entity).worldTransform,
+            getLocalTransform(simulated));
+}
+
+TEST_F(SceneUpdaterTest,
+       DoesNotAddPreviousWorldTransformIfInterpolationIsDisabled) {
+  auto entity = entityDatabase.create();
+  entityDatabase.set<quoll::LocalTransform>(entity, {});
+  entityDatabase.set<quoll::WorldTransform>(entity, {});
+  entityDatabase.set<quoll::Sprite>(entity, {});
+
+  sceneUpdater.update(entityDatabase);
+
+  EXPECT_FALSE(entityDatabase.has<quoll::PreviousWorldTransform>(entity));
+}
+
+TEST_F(SceneUpdaterTest,
+       AddsPreviousWorldTransformToRenderablesIfInterpolationIsEnabled) {
+  auto sprite = entityDatabase.create();
+  entityDatabase.set<quoll::LocalTransform>(sprite, {});
+  entityDatabase.set<quoll::WorldTransform>(sprite, {});
+  entityDatabase.set<quoll::Sprite>(sprite, {});
+
+  auto other = entityDatabase.create();
+  entityDatabase.set<quoll::LocalTransform>(other, {});
+  entityDatabase.set<quoll::WorldTransform>(other, {});
+
+  sceneUpdater.enableTransformInterpolation();
+  sceneUpdater.update(entityDatabase);
+
+  EXPECT_TRUE(entityDatabase.has<quoll::PreviousWorldTransform>(sprite));
+  EXPECT_FALSE(entityDatabase.has<quoll::PreviousWorldTransform>(other));
+}
+
+TEST_F(SceneUpdaterTest,
+       SetsPreviousWorldTransformOfNewRenderablesToComputedWorldTransform) {
+  auto sprite = entityDatabase.create();
+  quoll::LocalTransform transform{};
+  transform.localPosition = glm::vec3(1.0f, 0.5f, 2.5f);
+  entityDatabase.set(sprite, transform);
+  entityDatabase.set<quoll::WorldTransform>(sprite, {});
+  entityDatabase.set<quoll::Sprite>(sprite, {});
+
+  sceneUpdater.enableTransformInterpolation();
+  sceneUpdater.update(entityDatabase);
+
+  ASSERT_TRUE(entityDatabase.has<quoll::PreviousWorldTransform>(sprite));
+  EXPECT_EQ(
+      entityDatabase.get<quoll::PreviousWorldTransform>(sprite).worldTransform,
+      getLocalTransform(transform));
+  EXPECT_EQ(
+      entityDatabase.get<quoll::PreviousWorldTransform>(sprite).worldTransform,
+      entityDatabase.get<quoll::WorldTransform>(sprite).worldTransform);
+}
+
 TEST_F(SceneUpdaterTest, CalculatesWorldTransformFromParentWorldTransform) {
   // parent
   auto parent = entityDatabase.create();
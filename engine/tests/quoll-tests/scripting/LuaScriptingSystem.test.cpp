@@ -299,12 +299,62 @@ TEST_F(LuaScriptingSystemTest, CallsScriptCollisionStartEventIfEntityCollided) {
   scriptingSystem.start(entityDatabase, physicsSystem);
   auto state = sol::state_view(component.state);
 
+  auto target = entityDatabase.create();
+
   eventSystem.dispatch(quoll::CollisionEvent::CollisionStarted,
-                       {entity, quoll::Entity{6}});
+                       {entity, target});
   eventSystem.poll();
 
   EXPECT_EQ(state["event"].get<i32>(), 1);
-  EXPECT_EQ(state["target"].get<i32>(), 6);
+  EXPECT_EQ(state["target"].get<u32>(), static_cast<u32>(target));
+}
+
+TEST_F(LuaScriptingSystemTest,
+       DoesNotCallScriptCollisionEventIfTargetIsDeleted) {
+  auto handle = loadLuaScript("scripting-system-tester.lua");
+
+  auto entity = entityDatabase.create();
+  entityDatabase.set<quoll::LuaScript>(entity, {handle});
+
+  auto &component = entityDatabase.get<quoll::LuaScript>(entity);
+
+  scriptingSystem.start(entityDatabase, physicsSystem);
+  auto state = sol::state_view(component.state);
+
+  auto target = entityDatabase.create();
+
+  eventSystem.dispatch(quoll::CollisionEvent::CollisionStarted,
+                       {entity, target});
+  entityDatabase.deleteEntity(target);
+  entityDatabase.create();
+  eventSystem.poll();
+
+  EXPECT_EQ(state["event"].get<i32>(), 0);
+}
+
+TEST_F(LuaScriptingSystemTest,
+       DoesNotCallScriptEventsIfEntityIsDeletedBeforePoll) {
+  auto handle = loadLuaScript("scripting-system-tester.lua");
+
+  auto entity = entityDatabase.create();
+  entityDatabase.set<quoll::LuaScript>(entity, {handle});
+
+  auto &component = entityDatabase.get<quoll::LuaScript>(entity);
+
+  scriptingSystem.start(entityDatabase, physicsSystem);
+  auto state = sol::state_view(component.state);
+
+  auto target = entityDatabase.create();
+
+  eventSystem.dispatch(quoll::CollisionEvent::CollisionStarted,
+                       {entity, target});
+  eventSystem.dispatch(quoll::KeyboardEvent::Pressed, {15, -1, 3});
+
+  // Script state is destroyed on next update
+  entityDatabase.deleteEntity(entity);
+  eventSystem.poll();
+
+  EXPECT_EQ(state["event"].get<i32>(), 0);
 }
 
 TEST_F(LuaScriptingSystemTest, CallsScriptCollisionEndEventIfEntityCollided) {
@@ -318,12 +368,14 @@ TEST_F(LuaScriptingSystemTest, CallsScriptCollisionEndEventIfEntityCollided) {
   scriptingSystem.start(entityDatabase, physicsSystem);
   auto state = sol::state_view(component.state);
 
+  auto target = entityDatabase.create();
+
   eventSystem.dispatch(quoll::CollisionEvent::CollisionEnded,
-                       {quoll::Entity{5}, entity});
+                       {target, entity});
   eventSystem.poll();
 
   EXPECT_EQ(state["event"].get<i32>(), 2);
-  EXPECT_EQ(state["target"].get<i32>(), 5);
+  EXPECT_EQ(state["target"].get<u32>(), static_cast<u32>(target));
 }
 
 TEST_F(LuaScriptingSystemTest, CallsScriptKeyPressEventIfKeyIsPressed) {
@@ -1,8 +1,10 @@
 #include "quoll/core/Base.h"
 #include "TestPhysicsBackend.h"
 
-void TestPhysicsBackend::update(f32 dt, quoll::EntityDatabase &entityDatabase) {
-}
+void TestPhysicsBackend::beginUpdate(f32 dt,
+                                     quoll::EntityDatabase &entityDatabase) {}
+
+void TestPhysicsBackend::endUpdate(quoll::EntityDatabase &entityDatabase) {}
 
 void TestPhysicsBackend::cleanup(quoll::EntityDatabase &entityDatabase) {}
 
@@ -4,7 +4,9 @@
 
 class TestPhysicsBackend : public quoll::PhysicsBackend {
 public:
-  void update(f32 dt, quoll::EntityDatabase &entityDatabase) override;
+  void beginUpdate(f32 dt, quoll::EntityDatabase &entityDatabase) override;
+
+  void endUpdate(quoll::EntityDatabase &entityDatabase) override;
 
   void cleanup(quoll::EntityDatabase &entityDatabase) override;
 
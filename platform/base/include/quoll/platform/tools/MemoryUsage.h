@@ -0,0 +1,18 @@
+#pragma once
+
+namespace quoll::platform {
+
+/**
+ * @brief Platform memory usage
+ */
+class MemoryUsage {
+public:
+  /**
+   * @brief Get peak resident memory of process
+   *
+   * @return Peak resident memory in bytes
+   */
+  static usize getPeakResidentSize();
+};
+
+} // namespace quoll::platform
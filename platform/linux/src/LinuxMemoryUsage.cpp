@@ -0,0 +1,20 @@
+#include "quoll/core/Base.h"
+#include "quoll/platform/tools/MemoryUsage.h"
+
+#include <sys/resource.h>
+
+namespace quoll::platform {
+
+usize MemoryUsage::getPeakResidentSize() {
+  static constexpr usize KilobyteSize = 1024;
+
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+  // Linux reports maximum resident set size in kilobytes
+  return static_cast<usize>(usage.ru_maxrss) * KilobyteSize;
+}
+
+} // namespace quoll::platform
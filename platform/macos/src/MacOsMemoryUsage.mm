@@ -0,0 +1,17 @@
+#include "quoll/platform/tools/MemoryUsage.h"
+
+#include <sys/resource.h>
+
+namespace quoll::platform {
+
+usize MemoryUsage::getPeakResidentSize() {
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+  // macOS reports maximum resident set size in bytes
+  return static_cast<usize>(usage.ru_maxrss);
+}
+
+} // namespace quoll::platform
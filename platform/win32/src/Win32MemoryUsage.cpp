@@ -0,0 +1,18 @@
+#include "quoll/core/Base.h"
+#include "quoll/platform/tools/MemoryUsage.h"
+#include <windows.h>
+#include <psapi.h>
+
+namespace quoll::platform {
+
+usize MemoryUsage::getPeakResidentSize() {
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                            sizeof(counters))) {
+    return 0;
+  }
+
+  return static_cast<usize>(counters.PeakWorkingSetSize);
+}
+
+} // namespace quoll::platform
@@ -22,6 +22,7 @@ project "QuollRuntime"
     loadSourceFiles{}
     linkDependenciesWith{"QuollEngine"}
     linkVulkanRHI{}
+    linkMockRHI{}
     linkOptick{}
     linkPlatform()
 
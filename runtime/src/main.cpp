@@ -2,10 +2,13 @@
 #include "quoll/core/Version.h"
 #include "quoll/core/Engine.h"
 #include "quoll/yaml/Yaml.h"
+#include "quoll/physx/PhysxBackendDescSerializer.h"
+#include "quoll/renderer/DynamicResolutionSettingsSerializer.h"
 
 #include "runtime/Runtime.h"
+#include "runtime/HeadlessRuntime.h"
 
-int main() {
+int main(int argc, char **argv) {
   auto gamePath = std::filesystem::current_path();
 
   quoll::Engine::setPath(gamePath / "engine");
@@ -26,6 +29,48 @@ int main() {
 
   launchConfig.name = node["name"].as<quoll::String>();
   launchConfig.startingScene = node["startingScene"].as<quoll::Uuid>();
+  launchConfig.physics =
+      quoll::PhysxBackendDescSerializer::deserialize(node["physics"]);
+  launchConfig.dynamicResolution =
+      quoll::DynamicResolutionSettingsSerializer::deserialize(
+          node["dynamicResolution"]);
+
+  // Headless runtime is started with:
+  // --headless [--ticks=N] [--input=path]
+  // [--report=path] [--no-render]
+  bool headless = false;
+  quoll::runtime::HeadlessOptions headlessOptions{};
+
+  for (int i = 1; i < argc; ++i) {
+    quoll::StringView arg = argv[i];
+
+    if (arg == "--headless") {
+      headless = true;
+    } else if (arg == "--no-render") {
+      headlessOptions.render = false;
+    } else if (arg.starts_with("--ticks=")) {
+      auto value = arg.substr(arg.find('=') + 1);
+      auto [end, error] = std::from_chars(value.data(),
+                                          value.data() + value.size(),
+                                          headlessOptions.numTicks);
+      if (error != std::errc{} || end != value.data() + value.size()) {
+        std::cerr << "Invalid number of ticks: " << value << std::endl;
+        return 1;
+      }
+    } else if (arg.starts_with("--input=")) {
+      headlessOptions.inputPath = arg.substr(arg.find('=') + 1);
+    } else if (arg.starts_with("--report=")) {
+      headlessOptions.reportPath = arg.substr(arg.find('=') + 1);
+    } else {
+      std::cerr << "Unknown argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+
+  if (headless) {
+    quoll::runtime::HeadlessRuntime runtime(launchConfig, headlessOptions);
+    return runtime.start() ? 0 : 1;
+  }
 
   quoll::runtime::Runtime runtime(launchConfig);
 
@@ -0,0 +1,139 @@
+#include "quoll/core/Base.h"
+#include "quoll/yaml/Yaml.h"
+
+#include "HeadlessReport.h"
+
+namespace quoll::runtime {
+
+/**
+ * @brief Add time to timing
+ *
+ * @param timing System timing
+ * @param time Time in milliseconds
+ */
+static void addTime(SystemTiming &timing, f64 time) {
+  timing.count++;
+  timing.total += time;
+  timing.min = std::min(timing.min, time);
+  timing.max = std::max(timing.max, time);
+}
+
+/**
+ * @brief Convert timing to Yaml
+ *
+ * @param timing System timing
+ * @return Yaml node
+ */
+static YAML::Node toYaml(const SystemTiming &timing) {
+  YAML::Node node;
+  node["name"] = timing.name;
+  node["count"] = timing.count;
+  node["average"] = timing.getAverage();
+  node["min"] = timing.count > 0 ? timing.min : 0.0;
+  node["max"] = timing.max;
+  node["total"] = timing.total;
+  return node;
+}
+
+void HeadlessReport::recordTiming(StringView name, f64 time) {
+  auto it = std::find_if(mTimings.begin(), mTimings.end(),
+                         [name](const auto &timing) {
+                           return timing.name == name;
+                         });
+
+  if (it == mTimings.end()) {
+    mTimings.push_back({String(name)});
+    it = mTimings.end() - 1;
+  }
+
+  addTime(*it, time);
+}
+
+void HeadlessReport::recordTick(f64 time, usize numEntities,
+                                const FrameArenaStats &frameArenaStats,
+                                usize frameArenaCapacity) {
+  addTime(mTickTiming, time);
+
+  mMaxEntities = std::max(mMaxEntities, numEntities);
+  mMaxFrameArenaSize =
+      std::max(mMaxFrameArenaSize, frameArenaStats.allocatedSize);
+  mMaxFrameArenaAllocations =
+      std::max(mMaxFrameArenaAllocations, frameArenaStats.allocationsCount);
+  mMaxFrameArenaCapacity = std::max(mMaxFrameArenaCapacity, frameArenaCapacity);
+}
+
+void HeadlessReport::setPeakResidentSize(usize size) {
+  mPeakResidentSize = size;
+}
+
+void HeadlessReport::print(std::ostream &stream) const {
+  static constexpr int NameWidth = 36;
+  static constexpr int ValueWidth = 12;
+  static constexpr f64 MegabyteSize = 1024.0 * 1024.0;
+
+  auto printTiming = [&stream](const SystemTiming &timing) {
+    stream << std::left << std::setw(NameWidth) << timing.name << std::right
+           << std::setw(ValueWidth) << timing.getAverage()
+           << std::setw(ValueWidth) << (timing.count > 0 ? timing.min : 0.0)
+           << std::setw(ValueWidth) << timing.max << std::setw(ValueWidth)
+           << timing.total << "\n";
+  };
+
+  auto flags = stream.flags();
+  auto precision = stream.precision();
+
+  stream << std::fixed << std::setprecision(3);
+  stream << "Ticks: " << mTickTiming.count << "\n\n";
+
+  stream << std::left << std::setw(NameWidth) << "System (ms)" << std::right
+         << std::setw(ValueWidth) << "Average" << std::setw(ValueWidth)
+         << "Min" << std::setw(ValueWidth) << "Max" << std::setw(ValueWidth)
+         << "Total"
+         << "\n";
+
+  for (const auto &timing : mTimings) {
+    printTiming(timing);
+  }
+  printTiming(mTickTiming);
+
+  stream << "\nPeak resident memory: "
+         << static_cast<f64>(mPeakResidentSize) / MegabyteSize << " MB\n"
+         << "Max entities: " << mMaxEntities << "\n"
+         << "Max frame arena size: "
+         << static_cast<f64>(mMaxFrameArenaSize) / MegabyteSize << " MB\n"
+         << "Max frame arena allocations: " << mMaxFrameArenaAllocations
+         << "\n"
+         << "Max frame arena capacity: "
+         << static_cast<f64>(mMaxFrameArenaCapacity) / MegabyteSize
+         << " MB\n";
+
+  stream.flags(flags);
+  stream.precision(precision);
+}
+
+bool HeadlessReport::write(const Path &path) const {
+  YAML::Node root;
+  root["ticks"] = mTickTiming.count;
+  root["tick"] = toYaml(mTickTiming);
+
+  root["systems"] = YAML::Node(YAML::NodeType::Sequence);
+  for (const auto &timing : mTimings) {
+    root["systems"].push_back(toYaml(timing));
+  }
+
+  root["memory"]["peakResidentSize"] = mPeakResidentSize;
+  root["memory"]["maxEntities"] = mMaxEntities;
+  root["memory"]["maxFrameArenaSize"] = mMaxFrameArenaSize;
+  root["memory"]["maxFrameArenaAllocations"] = mMaxFrameArenaAllocations;
+  root["memory"]["maxFrameArenaCapacity"] = mMaxFrameArenaCapacity;
+
+  std::ofstream stream(path);
+  if (!stream.good()) {
+    return false;
+  }
+
+  stream << root;
+  return stream.good();
+}
+
+} // namespace quoll::runtime
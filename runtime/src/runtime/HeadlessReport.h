@@ -0,0 +1,126 @@
+#pragma once
+
+#include "quoll/core/FrameArena.h"
+
+namespace quoll::runtime {
+
+/**
+ * @brief Timing of a system
+ *
+ * Times are in milliseconds
+ */
+struct SystemTiming {
+  /**
+   * System name
+   */
+  String name;
+
+  /**
+   * Number of recorded updates
+   */
+  u32 count = 0;
+
+  /**
+   * Total time
+   */
+  f64 total = 0.0;
+
+  /**
+   * Minimum time
+   */
+  f64 min = std::numeric_limits<f64>::max();
+
+  /**
+   * Maximum time
+   */
+  f64 max = 0.0;
+
+  /**
+   * @brief Get average time
+   *
+   * @return Average time
+   */
+  inline f64 getAverage() const {
+    return count > 0 ? total / static_cast<f64>(count) : 0.0;
+  }
+};
+
+/**
+ * @brief Headless runtime report
+ *
+ * Collects per system timings and
+ * memory high-water marks
+ */
+class HeadlessReport {
+public:
+  /**
+   * @brief Record system timing
+   *
+   * @param name System name
+   * @param time Time in milliseconds
+   */
+  void recordTiming(StringView name, f64 time);
+
+  /**
+   * @brief Record tick
+   *
+   * @param time Tick time in milliseconds
+   * @param numEntities Number of entities
+   * @param frameArenaStats Frame arena stats of tick
+   * @param frameArenaCapacity Frame arena capacity
+   */
+  void recordTick(f64 time, usize numEntities,
+                  const FrameArenaStats &frameArenaStats,
+                  usize frameArenaCapacity);
+
+  /**
+   * @brief Set peak resident memory
+   *
+   * @param size Peak resident memory in bytes
+   */
+  void setPeakResidentSize(usize size);
+
+  /**
+   * @brief Print report
+   *
+   * @param stream Output stream
+   */
+  void print(std::ostream &stream) const;
+
+  /**
+   * @brief Write report to Yaml file
+   *
+   * @param path Report file path
+   * @retval true Report is written
+   * @retval false Report is not written
+   */
+  bool write(const Path &path) const;
+
+  /**
+   * @brief Get system timings
+   *
+   * @return System timings in order of first record
+   */
+  inline const std::vector<SystemTiming> &getTimings() const {
+    return mTimings;
+  }
+
+  /**
+   * @brief Get tick timing
+   *
+   * @return Tick timing
+   */
+  inline const SystemTiming &getTickTiming() const { return mTickTiming; }
+
+private:
+  std::vector<SystemTiming> mTimings;
+  SystemTiming mTickTiming{"Tick"};
+
+  usize mMaxEntities = 0;
+  usize mMaxFrameArenaSize = 0;
+  usize mMaxFrameArenaAllocations = 0;
+  usize mMaxFrameArenaCapacity = 0;
+  usize mPeakResidentSize = 0;
+};
+
+} // namespace quoll::runtime
@@ -0,0 +1,179 @@
+#include "quoll/core/Base.h"
+#include "HeadlessRuntime.h"
+#include "HeadlessReport.h"
+#include "ScriptedInput.h"
+
+// Core systems
+#include "quoll/events/EventSystem.h"
+#include "quoll/lua-scripting/LuaScriptingSystem.h"
+#include "quoll/scene/SceneUpdater.h"
+#include "quoll/physics/PhysicsSystem.h"
+#include "quoll/scene/CameraAspectRatioUpdater.h"
+#include "quoll/animation/AnimationSystem.h"
+#include "quoll/scene/SkeletonUpdater.h"
+#include "quoll/audio/AudioSystem.h"
+#include "quoll/audio/NullAudioBackend.h"
+#include "quoll/core/EntityDeleter.h"
+#include "quoll/core/FrameArena.h"
+#include "quoll/loop/MainLoop.h"
+#include "quoll/scene/SceneIO.h"
+#include "quoll/renderer/SceneRenderer.h"
+#include "quoll/input/InputMapSystem.h"
+#include "quoll/platform/tools/MemoryUsage.h"
+
+// Render hardware interfaces
+#include "quoll/rhi-mock/MockRenderDevice.h"
+
+// Asset
+#include "quoll/asset/AssetCache.h"
+
+namespace quoll::runtime {
+
+HeadlessRuntime::HeadlessRuntime(const LaunchConfig &config,
+                                 const HeadlessOptions &options)
+    : mConfig(config), mOptions(options) {}
+
+bool HeadlessRuntime::start() {
+  static constexpr u32 Width = 800;
+  static constexpr u32 Height = 600;
+
+  // Matches fixed time step of main loop
+  static constexpr f32 TimeDelta = static_cast<f32>(DefaultTimeDelta);
+
+  using Clock = std::chrono::steady_clock;
+
+  ScriptedInput scriptedInput;
+  if (!mOptions.inputPath.empty()) {
+    auto res = ScriptedInput::load(mOptions.inputPath);
+    if (res.hasError()) {
+      std::cerr << res.getError() << std::endl;
+      return false;
+    }
+
+    scriptedInput = res.getData();
+  }
+
+  Scene scene;
+  EventSystem eventSystem;
+  InputDeviceManager deviceManager;
+  AssetCache assetCache(std::filesystem::current_path() / "assets", true);
+
+  // Scripted input is the only input device
+  deviceManager.addDevice(
+      {.type = InputDeviceType::Unknown,
+       .name = "Scripted input",
+       .index = 0,
+       .stateFn = [&scriptedInput](int key) {
+         return scriptedInput.getState(key);
+       }});
+
+  rhi::MockRenderDevice device;
+  RenderStorage renderStorage(&device);
+  SceneRenderer sceneRenderer(assetCache.getRegistry(), renderStorage);
+
+  auto res = assetCache.preloadAssets(renderStorage);
+
+  LuaScriptingSystem scriptingSystem(eventSystem, assetCache.getRegistry());
+  SceneUpdater sceneUpdater;
+  PhysicsSystem physicsSystem =
+      PhysicsSystem::createPhysxBackend(eventSystem, mConfig.physics);
+  CameraAspectRatioUpdater cameraAspectRatioUpdater;
+  AnimationSystem animationSystem(assetCache.getRegistry());
+  SkeletonUpdater skeletonUpdater;
+  AudioSystem<NullAudioBackend> audioSystem(assetCache.getRegistry());
+  EntityDeleter entityDeleter;
+  InputMapSystem inputMapSystem(deviceManager, assetCache.getRegistry());
+
+  cameraAspectRatioUpdater.setViewportSize({Width, Height});
+
+  audioSystem.observeChanges(scene.entityDatabase);
+  scriptingSystem.observeChanges(scene.entityDatabase);
+  physicsSystem.observeChanges(scene.entityDatabase);
+
+  auto handle = assetCache.getRegistry().getScenes().findHandleByUuid(
+      mConfig.startingScene);
+
+  if (handle == SceneAssetHandle::Null) {
+    std::cerr << "Scene not found: " << mConfig.startingScene.toString()
+              << std::endl;
+    return false;
+  }
+
+  SceneIO sceneIO(assetCache.getRegistry(), scene);
+  sceneIO.loadScene(handle);
+
+  HeadlessReport report;
+
+  auto measure = [&report](StringView name, auto &&fn) {
+    auto start = Clock::now();
+    fn();
+    report.recordTiming(
+        name, std::chrono::duration<f64, std::milli>(Clock::now() - start)
+                  .count());
+  };
+
+  auto &entityDatabase = scene.entityDatabase;
+  u32 frameIndex = 0;
+
+  for (u32 tick = 0; tick < mOptions.numTicks; ++tick) {
+    auto tickStart = Clock::now();
+
+    scriptedInput.update(tick);
+
+    measure("SceneUpdater::storePreviousTransforms",
+            [&] { sceneUpdater.storePreviousTransforms(entityDatabase); });
+    measure("EntityDeleter", [&] { entityDeleter.update(scene); });
+    measure("EventSystem", [&] { eventSystem.poll(); });
+    measure("PhysicsSystem::beginUpdate",
+            [&] { physicsSystem.beginUpdate(TimeDelta, entityDatabase); });
+    measure("InputMapSystem", [&] { inputMapSystem.update(entityDatabase); });
+    measure("CameraAspectRatioUpdater",
+            [&] { cameraAspectRatioUpdater.update(entityDatabase); });
+    measure("PhysicsSystem::endUpdate",
+            [&] { physicsSystem.endUpdate(entityDatabase); });
+    measure("LuaScriptingSystem::start",
+            [&] { scriptingSystem.start(entityDatabase, physicsSystem); });
+    measure("LuaScriptingSystem::update",
+            [&] { scriptingSystem.update(TimeDelta, entityDatabase); });
+    measure("AnimationSystem",
+            [&] { animationSystem.update(TimeDelta, entityDatabase); });
+    measure("SkeletonUpdater", [&] { skeletonUpdater.update(entityDatabase); });
+    measure("SceneUpdater", [&] { sceneUpdater.update(entityDatabase); });
+    measure("AudioSystem", [&] { audioSystem.output(entityDatabase); });
+
+    if (mOptions.render) {
+      frameIndex =
+          static_cast<u32>((frameIndex + 1) % rhi::RenderDevice::NumFrames);
+
+      measure("SceneRenderer::extractFrameData", [&] {
+        sceneRenderer.extractFrameData(entityDatabase, scene.activeCamera,
+                                       frameIndex);
+      });
+      measure("SceneRenderer::uploadFrameData",
+              [&] { sceneRenderer.uploadFrameData(frameIndex); });
+    }
+
+    auto tickTime =
+        std::chrono::duration<f64, std::milli>(Clock::now() - tickStart)
+            .count();
+
+    auto &frameArena = FrameArena::get();
+    frameArena.reset();
+    report.recordTick(tickTime, entityDatabase.getEntityCount(),
+                      frameArena.getLastFrameStats(),
+                      frameArena.getCapacity());
+  }
+
+  report.setPeakResidentSize(platform::MemoryUsage::getPeakResidentSize());
+  report.print(std::cout);
+
+  if (!mOptions.reportPath.empty() && !report.write(mOptions.reportPath)) {
+    std::cerr << "Cannot write report: " << mOptions.reportPath.string()
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace quoll::runtime
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "LaunchConfig.h"
+
+namespace quoll::runtime {
+
+/**
+ * @brief Headless runtime options
+ */
+struct HeadlessOptions {
+  /**
+   * Number of fixed ticks to simulate
+   */
+  u32 numTicks = 1000;
+
+  /**
+   * Scripted input file path
+   *
+   * No input is fed if path is empty
+   */
+  Path inputPath;
+
+  /**
+   * Report file path
+   *
+   * Report is only printed if path is empty
+   */
+  Path reportPath;
+
+  /**
+   * Extract and upload frame data
+   * on mock render device every tick
+   */
+  bool render = true;
+};
+
+/**
+ * @brief Headless runtime
+ *
+ * Runs starting scene for a fixed number of
+ * ticks as fast as possible without a window,
+ * GPU, or audio device. Rendering uses mock
+ * render device; so, frame data is prepared
+ * but nothing is drawn.
+ *
+ * Used for simulation soak tests, performance
+ * regression gates, and server side simulation.
+ */
+class HeadlessRuntime {
+public:
+  /**
+   * @brief Create headless runtime
+   *
+   * @param config Launch config
+   * @param options Headless options
+   */
+  HeadlessRuntime(const LaunchConfig &config, const HeadlessOptions &options);
+
+  /**
+   * @brief Run all ticks and report results
+   *
+   * @retval true Simulation completed
+   * @retval false Simulation could not start
+   */
+  bool start();
+
+private:
+  LaunchConfig mConfig;
+  HeadlessOptions mOptions;
+};
+
+} // namespace quoll::runtime
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "quoll/physx/PhysxBackendDesc.h"
+#include "quoll/renderer/DynamicResolutionController.h"
+
 namespace quoll::runtime {
 
 /**
@@ -15,6 +18,18 @@ struct LaunchConfig {
    * Starting scene uuid
    */
   Uuid startingScene;
+
+  /**
+   * Physics options
+   */
+  PhysxBackendDesc physics;
+
+  /**
+   * Dynamic resolution settings
+   *
+   * Dynamic resolution is disabled if empty
+   */
+  std::optional<DynamicResolutionSettings> dynamicResolution;
 };
 
 } // namespace quoll::runtime
@@ -6,6 +6,7 @@
 #include "quoll/events/EventSystem.h"
 #include "quoll/profiler/FPSCounter.h"
 #include "quoll/loop/MainLoop.h"
+#include "quoll/loop/FramePipeline.h"
 #include "quoll/renderer/Renderer.h"
 #include "quoll/lua-scripting/LuaScriptingSystem.h"
 #include "quoll/scene/SceneUpdater.h"
@@ -51,6 +52,9 @@ void Runtime::start() {
   RendererOptions initialOptions{};
   initialOptions.size = {Width, Height};
   Renderer renderer(renderStorage, initialOptions);
+  if (mConfig.dynamicResolution) {
+    renderer.enableDynamicResolution(*mConfig.dynamicResolution);
+  }
   ImguiRenderer imguiRenderer(window, renderStorage);
 
   {
@@ -82,7 +86,8 @@ void Runtime::start() {
 
   LuaScriptingSystem scriptingSystem(eventSystem, assetCache.getRegistry());
   SceneUpdater sceneUpdater;
-  PhysicsSystem physicsSystem = PhysicsSystem::createPhysxBackend(eventSystem);
+  PhysicsSystem physicsSystem =
+      PhysicsSystem::createPhysxBackend(eventSystem, mConfig.physics);
   CameraAspectRatioUpdater cameraAspectRatioUpdater;
   AnimationSystem animationSystem(assetCache.getRegistry());
   SkeletonUpdater skeletonUpdater;
@@ -96,13 +101,23 @@ void Runtime::start() {
                               static_cast<f32>(window.getFramebufferSize().x),
                               static_cast<f32>(window.getFramebufferSize().y));
 
+  // Updates run at a fixed time step; so,
+  // renderables keep previous transforms
+  // to render frames between updates
+  sceneUpdater.enableTransformInterpolation();
+
   audioSystem.observeChanges(scene.entityDatabase);
   scriptingSystem.observeChanges(scene.entityDatabase);
   physicsSystem.observeChanges(scene.entityDatabase);
 
+  // Resize events are received in update thread
+  // while render thread can be rendering; so,
+  // new size is handed over with the next
+  // prepared frame and applied in render thread
+  std::optional<glm::uvec2> resizedFramebuffer;
+
   window.addFramebufferResizeHandler([&](auto width, auto height) {
-    renderer.setFramebufferSize({width, height});
-    presenter.enqueueFramebufferUpdate();
+    resizedFramebuffer = glm::uvec2{width, height};
     cameraAspectRatioUpdater.setViewportSize({width, height});
     uiCanvasUpdater.setViewport(0.0f, 0.0f, static_cast<f32>(width),
                                 static_cast<f32>(height));
@@ -123,13 +138,17 @@ void Runtime::start() {
 
   mainLoop.setUpdateFn([&](f32 dt) mutable {
     auto &entityDatabase = scene.entityDatabase;
+    sceneUpdater.storePreviousTransforms(entityDatabase);
     entityDeleter.update(scene);
 
     eventSystem.poll();
 
+    // Input maps and cameras do not depend on physics
+    // and are updated while simulation is running
+    physicsSystem.beginUpdate(dt, entityDatabase);
     inputMapSystem.update(entityDatabase);
     cameraAspectRatioUpdater.update(entityDatabase);
-    physicsSystem.update(dt, entityDatabase);
+    physicsSystem.endUpdate(entityDatabase);
     scriptingSystem.start(entityDatabase, physicsSystem);
     scriptingSystem.update(dt, entityDatabase);
     animationSystem.update(dt, entityDatabase);
@@ -140,15 +159,20 @@ void Runtime::start() {
     return true;
   });
 
-  mainLoop.setRenderFn([&]() {
-    if (presenter.requiresFramebufferUpdate()) {
-      device->recreateSwapchain();
-      presenter.updateFramebuffers(device->getSwapchain());
-      return;
+  // Frames are extracted into slots of frame
+  // data. Slots only advance on submitted frames;
+  // so, slot matches device frame index and update
+  // thread never writes frame data that is in use
+  FramePipeline framePipeline(rhi::RenderDevice::NumFrames);
+  std::optional<glm::uvec2> preparedFramebufferSize;
+  std::optional<rhi::RenderFrame> renderFrame;
+
+  framePipeline.setPrepareFn([&](f32 alpha, u32 slot) {
+    if (resizedFramebuffer.has_value()) {
+      preparedFramebufferSize = resizedFramebuffer;
+      resizedFramebuffer.reset();
     }
 
-    renderer.rebuildIfSettingsChanged();
-
     imguiRenderer.beginRendering();
 
     ImGuiWindowFlags WindowFlags =
@@ -176,24 +200,61 @@ void Runtime::start() {
 
     imguiRenderer.endRendering();
 
-    const auto &renderFrame = device->beginFrame();
+    // Render thread only reads the copy of
+    // draw data; so, imgui context is only
+    // accessed in update thread
+    imguiRenderer.extractFrameData(slot);
+    sceneRenderer.extractFrameData(scene.entityDatabase, scene.activeCamera,
+                                   slot, alpha);
+  });
 
-    if (renderFrame.frameIndex < std::numeric_limits<u32>::max()) {
-      sceneRenderer.updateFrameData(scene.entityDatabase, scene.activeCamera,
-                                    renderFrame.frameIndex);
-      imguiRenderer.updateFrameData(renderFrame.frameIndex);
+  framePipeline.setRenderFn([&](u32 slot) {
+    renderFrame.reset();
 
-      renderer.execute(renderFrame.commandList, renderFrame.frameIndex);
+    if (preparedFramebufferSize.has_value()) {
+      renderer.setFramebufferSize(preparedFramebufferSize.value());
+      presenter.enqueueFramebufferUpdate();
+      preparedFramebufferSize.reset();
+    }
+
+    if (presenter.requiresFramebufferUpdate()) {
+      device->recreateSwapchain();
+      presenter.updateFramebuffers(device->getSwapchain());
+      return false;
+    }
 
-      presenter.present(renderFrame.commandList, renderer.getFinalTexture(),
-                        renderFrame.swapchainImageIndex);
+    // Prepared UI references textures
+    // of the previous graph
+    if (renderer.rebuildIfSettingsChanged()) {
+      return false;
+    }
 
-      device->endFrame(renderFrame);
-    } else {
+    renderFrame.emplace(device->beginFrame());
+    if (renderFrame->frameIndex == std::numeric_limits<u32>::max()) {
       presenter.updateFramebuffers(device->getSwapchain());
+      renderFrame.reset();
+      return false;
     }
+
+    QuollAssert(renderFrame->frameIndex == slot,
+                "Frame slot must match device frame index");
+
+    sceneRenderer.uploadFrameData(slot);
+    imguiRenderer.uploadFrameData(slot);
+    return true;
+  });
+
+  framePipeline.setSubmitFn([&](u32 slot) {
+    renderer.execute(renderFrame->commandList, slot);
+
+    presenter.present(renderFrame->commandList, renderer.getFinalTexture(),
+                      renderFrame->swapchainImageIndex);
+
+    device->endFrame(renderFrame.value());
   });
 
+  framePipeline.enableRenderThread();
+  mainLoop.setFramePipeline(framePipeline);
   mainLoop.run();
   device->waitForIdle();
 }
@@ -0,0 +1,84 @@
+#include "quoll/core/Base.h"
+#include "quoll/input/KeyMappings.h"
+#include "quoll/yaml/Yaml.h"
+
+#include "ScriptedInput.h"
+
+namespace quoll::runtime {
+
+Result<ScriptedInput> ScriptedInput::load(const Path &path) {
+  std::ifstream stream(path);
+  if (!stream.good()) {
+    return Result<ScriptedInput>::Error("Cannot open scripted input file: " +
+                                        path.string());
+  }
+
+  YAML::Node root;
+  try {
+    root = YAML::Load(stream);
+  } catch (std::exception &e) {
+    return Result<ScriptedInput>::Error(e.what());
+  }
+
+  if (!root.IsSequence()) {
+    return Result<ScriptedInput>::Error(
+        "Scripted input must be a list of events");
+  }
+
+  std::vector<ScriptedInputEvent> events;
+  for (const auto &node : root) {
+    if (!node["tick"] || !node["key"] || !node["value"]) {
+      return Result<ScriptedInput>::Error(
+          "Scripted input event must have tick, key, and value");
+    }
+
+    auto key = node["key"].as<String>("");
+    if (!input::exists(key)) {
+      return Result<ScriptedInput>::Error("Input key does not exist: " + key);
+    }
+
+    ScriptedInputEvent event{};
+    event.tick = node["tick"].as<u32>(0);
+    event.key = input::get(key);
+
+    auto value = node["value"];
+    bool boolValue = false;
+    if (value.IsSequence()) {
+      event.value = value.as<glm::vec2>(glm::vec2{0.0f});
+    } else if (YAML::convert<bool>::decode(value, boolValue)) {
+      event.value = boolValue;
+    } else {
+      event.value = value.as<f32>(0.0f);
+    }
+
+    events.push_back(event);
+  }
+
+  return Result<ScriptedInput>::Ok(ScriptedInput(std::move(events)));
+}
+
+ScriptedInput::ScriptedInput(std::vector<ScriptedInputEvent> events)
+    : mEvents(std::move(events)) {
+  std::stable_sort(
+      mEvents.begin(), mEvents.end(),
+      [](const auto &a, const auto &b) { return a.tick < b.tick; });
+}
+
+void ScriptedInput::update(u32 tick) {
+  for (; mNextEvent < mEvents.size() && mEvents.at(mNextEvent).tick <= tick;
+       ++mNextEvent) {
+    const auto &event = mEvents.at(mNextEvent);
+    mState.insert_or_assign(event.key, event.value);
+  }
+}
+
+InputStateValue ScriptedInput::getState(int key) const {
+  auto it = mState.find(key);
+  if (it == mState.end()) {
+    return false;
+  }
+
+  return it->second;
+}
+
+} // namespace quoll::runtime
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "quoll/asset/Result.h"
+#include "quoll/input/InputDevice.h"
+
+namespace quoll::runtime {
+
+/**
+ * @brief Scripted input event
+ */
+struct ScriptedInputEvent {
+  /**
+   * Tick when input state changes
+   */
+  u32 tick = 0;
+
+  /**
+   * Input key
+   */
+  int key = 0;
+
+  /**
+   * Input state value
+   */
+  InputStateValue value = false;
+};
+
+/**
+ * @brief Scripted input
+ *
+ * Replays input state changes at fixed ticks.
+ * Used to feed input in headless runtime
+ * where there is no window or input device.
+ */
+class ScriptedInput {
+public:
+  /**
+   * @brief Load scripted input from file
+   *
+   * File is a Yaml list of events; for example:
+   *
+   * - tick: 10
+   *   key: KEY_W
+   *   value: true
+   * - tick: 20
+   *   key: GAMEPAD_LEFT_X
+   *   value: 0.5
+   *
+   * Values are booleans, numbers, or
+   * lists of two numbers
+   *
+   * @param path Path to scripted input file
+   * @return Scripted input
+   */
+  static Result<ScriptedInput> load(const Path &path);
+
+public:
+  ScriptedInput() = default;
+
+  /**
+   * @brief Create scripted input
+   *
+   * @param events Scripted input events
+   */
+  ScriptedInput(std::vector<ScriptedInputEvent> events);
+
+  /**
+   * @brief Apply events up to tick
+   *
+   * @param tick Current tick
+   */
+  void update(u32 tick);
+
+  /**
+   * @brief Get input state
+   *
+   * Keys without events are not pressed
+   *
+   * @param key Input key
+   * @return Input state value
+   */
+  InputStateValue getState(int key) const;
+
+  /**
+   * @brief Get events
+   *
+   * @return Events sorted by tick
+   */
+  inline const std::vector<ScriptedInputEvent> &getEvents() const {
+    return mEvents;
+  }
+
+private:
+  std::vector<ScriptedInputEvent> mEvents;
+  usize mNextEvent = 0;
+  std::unordered_map<int, InputStateValue> mState;
+};
+
+} // namespace quoll::runtime